@@ -37,6 +37,20 @@ namespace openspace::dataloader::csv {
 Dataset loadCsvFile(std::filesystem::path path,
     std::optional<DataMapping> specs = std::nullopt);
 
+/**
+ * Loads the same CSV file as #loadCsvFile, but memory-maps the file instead of reading
+ * all rows into memory first and parses the rows in multiple line-aligned chunks
+ * concurrently. The order of the entries in the resulting dataset is the same as the
+ * order of the rows in the file.
+ *
+ * \param minimumChunkSize The smallest number of bytes that are handed to a single
+ *                         parsing task. Below the default of 1 MiB, the overhead of
+ *                         scheduling a task outweighs the time spent parsing
+ */
+Dataset loadCsvFileParallel(std::filesystem::path path,
+    std::optional<DataMapping> specs = std::nullopt,
+    size_t minimumChunkSize = 1024 * 1024);
+
 std::vector<Dataset::Texture> loadTextureMapFile(std::filesystem::path path,
     const std::set<int>& texturesInData);
 
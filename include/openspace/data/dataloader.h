@@ -26,9 +26,13 @@
 #define __OPENSPACE_CORE___DATALOADER___H__
 
 #include <openspace/data/datamapping.h>
+#include <openspace/util/memorymappedfile.h>
 #include <ghoul/glm.h>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -76,6 +80,145 @@ struct Dataset {
     glm::vec2 findValueRange(std::string_view variableName) const;
 };
 
+struct ColumnarDataset;
+
+namespace data {
+    /**
+     * Loads a columnar cache file by memory-mapping it. Returns `std::nullopt` if the
+     * file does not exist, has an incompatible schema version, or was created for a
+     * different \p fileHash (see #fileMetadataHash). Only the header and the variable and
+     * texture names are read eagerly; positions, columns, and comments are paged in on
+     * first access.
+     */
+    std::optional<ColumnarDataset> loadColumnarCachedFile(
+        const std::filesystem::path& path, uint64_t fileHash);
+
+    /**
+     * Saves the \p dataset into a columnar cache file at \p path. Every section of the
+     * file starts at a page boundary so that each column can be paged in independently.
+     */
+    void saveColumnarCachedFile(const ColumnarDataset& dataset,
+        const std::filesystem::path& path, uint64_t fileHash);
+} // namespace data
+
+/**
+ * A column-oriented (structure-of-arrays) representation of a Dataset. Instead of storing
+ * a separate vector of data values for each entry, the positions of all entries are
+ * stored in one packed array and all values belonging to the same data column are stored
+ * contiguously. This avoids one heap allocation per entry and makes operations that work
+ * on a single column, such as finding the range of a variable, access memory linearly.
+ *
+ * The values are either owned by the dataset or, if the dataset was loaded from a
+ * columnar cache file (see data::loadColumnarCachedFile), they point into the
+ * memory-mapped file. In the latter case, the pages of a column are only read from disk
+ * when the column is accessed for the first time, so columns that are never used do not
+ * take up any memory. Requesting write access to a column of a mapped dataset creates an
+ * owned copy of that column.
+ *
+ * The variables, textures, and indices have the same meaning as in the Dataset. The
+ * #createFromDataset and #toDataset functions convert between the two representations
+ * for consumers that require the row-based access.
+ */
+struct ColumnarDataset {
+    /**
+     * Creates a columnar dataset with the same contents as the provided \p dataset. All
+     * entries of the \p dataset must have the same number of data values.
+     */
+    static ColumnarDataset createFromDataset(const Dataset& dataset);
+
+    /**
+     * Creates a row-based Dataset with the same contents as this columnar dataset.
+     */
+    Dataset toDataset() const;
+
+    std::vector<Dataset::Variable> variables;
+    std::vector<Dataset::Texture> textures;
+
+    int textureDataIndex = -1;
+    int orientationDataIndex = -1;
+
+    /// This variable can be used to get an understanding of the world scale size of the
+    /// dataset
+    float maxPositionComponent = 0.f;
+
+    bool isEmpty() const;
+    size_t nEntries() const;
+
+    /// Returns the number of data values for each entry, which is the number of columns
+    size_t nColumns() const;
+
+    /// Returns the positions of all entries, packed without any padding
+    std::span<const glm::vec3> positions() const;
+
+    /// Returns all values of the data column with the provided \p columnIndex
+    std::span<const float> column(size_t columnIndex) const;
+
+    /// Returns all values of the data column with the provided \p columnIndex for
+    /// modification. If the column is memory-mapped, it is copied into memory first
+    std::span<float> mutableColumn(size_t columnIndex);
+
+    /// Returns the comment of the entry with the provided \p entryIndex, if it has one
+    std::optional<std::string_view> comment(size_t entryIndex) const;
+
+    /// Removes the first \p nEntries entries from the dataset. Memory-mapped data is not
+    /// copied, only the views into the mapped file are moved
+    void removeFirstEntries(size_t nEntries);
+
+    int index(std::string_view variableName) const;
+    bool normalizeVariable(std::string_view variableName);
+    glm::vec2 findValueRange(size_t variableIndex) const;
+    glm::vec2 findValueRange(std::string_view variableName) const;
+
+private:
+    friend std::optional<ColumnarDataset> data::loadColumnarCachedFile(
+        const std::filesystem::path& path, uint64_t fileHash);
+    friend void data::saveColumnarCachedFile(const ColumnarDataset& dataset,
+        const std::filesystem::path& path, uint64_t fileHash);
+
+    /**
+     * The memory that backs a ColumnarDataset. Each piece of data either lives in the
+     * vectors of this struct or, if the corresponding vector is empty and a #file is
+     * present, at the stored offset inside the memory-mapped #file.
+     */
+    struct Storage {
+        std::vector<glm::vec3> positions;
+        /// One entry per column, empty for columns that live in the mapped #file
+        std::vector<std::vector<float>> columns;
+        /// The comments of all entries stored consecutively. The comment of entry `i`
+        /// starts at `commentOffsets[i]` and ends at `commentOffsets[i + 1]`
+        std::vector<char> commentData;
+        std::vector<uint64_t> commentOffsets;
+        /// Stores 1 for all entries that have a comment and 0 otherwise
+        std::vector<uint8_t> hasComment;
+
+        std::shared_ptr<const MemoryMappedFile> file;
+        size_t positionsOffset = 0;
+        std::vector<size_t> columnOffsets;
+        size_t commentDataOffset = 0;
+        size_t commentOffsetsOffset = 0;
+        size_t hasCommentOffset = 0;
+    };
+
+    size_t _nEntries = 0;
+    size_t _nColumns = 0;
+    Storage _storage;
+};
+
+/**
+ * Returns the minimum and maximum value of the provided \p values, ignoring all NaN
+ * values. If \p values is empty or only contains NaN values, the returned range is
+ * (`std::numeric_limits<float>::max()`, `-std::numeric_limits<float>::max()`). The
+ * computation processes multiple values at the same time and is intended for contiguous
+ * columns, such as the ones in a ColumnarDataset.
+ */
+glm::vec2 findValueRange(std::span<const float> values);
+
+/**
+ * Maps all \p values from the provided \p range into the range [0, 1]. NaN values remain
+ * NaN values.
+ */
+void normalizeValues(std::span<float> values, glm::vec2 range);
+
 struct Labelset {
     int textColorIndex = -1;
 
@@ -96,14 +239,42 @@ struct ColorMap {
 };
 
 namespace data {
+    /// Determines how the contents of a data file are read from disk
+    enum class LoadMode {
+        /// The file is read line by line on the calling thread
+        Sequential,
+        /// The file is memory-mapped and its data rows are parsed in parallel chunks
+        Parallel
+    };
+
     Dataset loadFile(std::filesystem::path path,
-        std::optional<DataMapping> specs = std::nullopt);
+        std::optional<DataMapping> specs = std::nullopt,
+        LoadMode mode = LoadMode::Sequential);
 
     std::optional<Dataset> loadCachedFile(const std::filesystem::path& path);
     void saveCachedFile(const Dataset& dataset, const std::filesystem::path& path);
 
     Dataset loadFileWithCache(std::filesystem::path path,
-        std::optional<DataMapping> specs = std::nullopt);
+        std::optional<DataMapping> specs = std::nullopt,
+        LoadMode mode = LoadMode::Sequential);
+
+    /**
+     * Computes a hash over the size and the last modification time of the data file at
+     * \p path and the provided \p specs. The contents of the file are not read, so a
+     * change that keeps both the size and the modification time is not detected.
+     */
+    uint64_t fileMetadataHash(const std::filesystem::path& path,
+        const std::optional<DataMapping>& specs);
+
+    /**
+     * Loads the columnar representation of the data file at \p path. If a valid columnar
+     * cache file exists, it is memory-mapped, which makes loading almost instantaneous.
+     * Otherwise the file is loaded using the provided \p mode and a new cache file is
+     * created.
+     */
+    ColumnarDataset loadColumnarFileWithCache(std::filesystem::path path,
+        std::optional<DataMapping> specs = std::nullopt,
+        LoadMode mode = LoadMode::Sequential);
 } // namespace data
 
 namespace label {
@@ -116,6 +287,7 @@ namespace label {
     Labelset loadFileWithCache(std::filesystem::path path);
 
     Labelset loadFromDataset(const dataloader::Dataset& dataset);
+    Labelset loadFromDataset(const dataloader::ColumnarDataset& dataset);
 } // namespace label
 
 namespace color {
@@ -39,6 +39,19 @@ namespace openspace::dataloader::speck {
 Dataset loadSpeckFile(std::filesystem::path path,
     std::optional<DataMapping> specs = std::nullopt);
 
+/**
+ * Loads the same SPECK file as #loadSpeckFile, but memory-maps the file instead of
+ * streaming it and parses the data section in multiple line-aligned chunks concurrently.
+ * The resulting dataset is identical to the one created by #loadSpeckFile.
+ *
+ * \param minimumChunkSize The smallest number of bytes that are handed to a single
+ *                         parsing task. Below the default of 1 MiB, the overhead of
+ *                         scheduling a task outweighs the time spent parsing
+ */
+Dataset loadSpeckFileParallel(std::filesystem::path path,
+    std::optional<DataMapping> specs = std::nullopt,
+    size_t minimumChunkSize = 1024 * 1024);
+
 Labelset loadLabelFile(std::filesystem::path path);
 
 } // namespace openspace::dataloader::speck
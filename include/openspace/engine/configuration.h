@@ -103,6 +103,21 @@ struct Configuration {
     };
     LoadingScreen loadingScreen;
 
+    struct Synchronization {
+        bool useDeltaEncoding = false;
+        int keyframeInterval = 60;
+        bool useCompression = false;
+    };
+    Synchronization synchronization;
+
+    struct EphemerisCache {
+        bool isEnabled = false;
+        double positionTolerance = 1e-3;
+        double rotationTolerance = 1e-9;
+        bool isValidating = false;
+    };
+    EphemerisCache ephemerisCache;
+
     bool isCheckingOpenGLState = false;
     bool isLoggingOpenGLCalls = false;
     bool isPrintingEvents = false;
@@ -59,6 +59,7 @@ class ScriptEngine;
 class ScriptScheduler;
 class SessionRecordingHandler;
 class SyncEngine;
+class TaskScheduler;
 class TimeManager;
 class Server;
 class VersionChecker;
@@ -82,6 +83,7 @@ inline RaycasterManager* raycasterManager;
 inline RenderEngine* renderEngine;
 inline std::vector<std::unique_ptr<ScreenSpaceRenderable>>* screenSpaceRenderables;
 inline SyncEngine* syncEngine;
+inline TaskScheduler* taskScheduler;
 inline TimeManager* timeManager;
 inline Server* server;
 inline VersionChecker* versionChecker;
@@ -27,7 +27,9 @@
 
 #include <openspace/util/syncbuffer.h>
 #include <ghoul/misc/boolean.h>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace openspace {
@@ -37,11 +39,53 @@ class Syncable;
 /**
  * Manages a collection of `Syncable`s and ensures they are synchronized over SGCT nodes.
  * Encoding/Decoding order is handled internally.
+ *
+ * By default, the data of all Syncables is sent every frame. If delta encoding is enabled
+ * (see #setDeltaEncoding), the data of Syncables that provide a snapshot of their state
+ * (see Syncable::isSnapshot) is only sent if it changed since the previous frame or if
+ * the frame is a keyframe. Keyframes are sent in regular intervals and whenever the list
+ * of Syncables changes and they contain the data of all Syncables. Additionally, the
+ * data of each frame can be compressed (see #setCompression). Delta encoding and
+ * compression have to be enabled or disabled on all nodes at the same time.
  */
 class SyncEngine {
 public:
     BooleanType(IsMaster);
 
+    /// The default number of frames between two keyframes when using delta encoding
+    static constexpr int DefaultKeyframeInterval = 60;
+
+    /**
+     * Information about the amount of data that is synchronized by the SyncEngine. With
+     * the exception of the decodeTime, the values are only updated on the master node.
+     */
+    struct Statistics {
+        /// The number of bytes of the most recent frame before it was compressed
+        size_t rawBytes = 0;
+        /// The number of bytes that were produced by the most recent encoding
+        size_t frameBytes = 0;
+        /// The number of bytes that were produced since the SyncEngine was created
+        uint64_t totalBytes = 0;
+        /// The number of Syncables that were registered in the most recent frame
+        size_t nSyncables = 0;
+        /// The number of Syncables whose data was sent in the most recent frame
+        size_t nDirtySyncables = 0;
+        /// The number of frames that have been encoded
+        uint64_t nFrames = 0;
+        /// The number of frames that contained the data of all Syncables
+        uint64_t nKeyframes = 0;
+        /// The time it took to encode and compress the most recent frame
+        std::chrono::microseconds encodeTime = std::chrono::microseconds(0);
+        /// The time it took to decompress and decode the most recent frame
+        std::chrono::microseconds decodeTime = std::chrono::microseconds(0);
+
+        /**
+         * Returns the fraction of the registered Syncables whose data was sent in the
+         * most recent frame, or 0 if there are no Syncables.
+         */
+        double dirtyRatio() const;
+    };
+
     /**
      * Creates a new SyncEngine which a buffer size of \p syncBufferSize.
      *
@@ -95,12 +139,62 @@ public:
     */
     void removeSyncables(const std::vector<Syncable*>& syncables);
 
+    /**
+     * Enables or disables the delta encoding of the synchronized data. If it is enabled,
+     * a keyframe containing the data of all Syncables is sent every
+     * \p keyframeInterval frames.
+     *
+     * \param enabled Whether the delta encoding should be used
+     * \param keyframeInterval The number of frames between two keyframes
+     *
+     * \pre keyframeInterval must be bigger than 0
+     */
+    void setDeltaEncoding(bool enabled, int keyframeInterval = DefaultKeyframeInterval);
+
+    /**
+     * Returns whether the delta encoding of the synchronized data is enabled.
+     */
+    bool isDeltaEncoding() const;
+
+    /**
+     * Enables or disables the compression of the data of each frame.
+     */
+    void setCompression(bool enabled);
+
+    /**
+     * Returns whether the data of each frame is compressed.
+     */
+    bool isCompressing() const;
+
+    /**
+     * Returns the information about the amount of synchronized data.
+     */
+    const Statistics& statistics() const;
+
 private:
+    void encodeDelta();
+    void decodeDelta(const std::vector<std::byte>& data);
+
     /// Vector of Syncables. The vectors ensures consistent encode/decode order
     std::vector<Syncable*> _syncables;
 
     /// Databuffer used in encoding/decoding
     SyncBuffer _syncBuffer;
+    /// The delta-encoded frame, reused between frames to avoid reallocations
+    std::vector<std::byte> _frame;
+    /// Scratch space for compressing and decompressing frames
+    std::vector<std::byte> _compressed;
+
+    bool _useCompression = false;
+    bool _useDeltaEncoding = false;
+    int _keyframeInterval = DefaultKeyframeInterval;
+    int _framesSinceKeyframe = 0;
+    /// Set whenever the list of Syncables changes, which invalidates the snapshots
+    bool _needsKeyframe = true;
+    /// The most recently sent data of each Syncable, in the same order as _syncables
+    std::vector<std::vector<std::byte>> _snapshots;
+
+    Statistics _statistics;
 };
 
 } // namespace openspace
@@ -69,14 +69,14 @@ public:
      * \param dataset The *loaded* input dataset
      * \param useCaching Whether caching should be used when loading the color map file
      */
-    void initialize(const dataloader::Dataset& dataset, bool useCaching = true);
+    void initialize(const dataloader::ColumnarDataset& dataset, bool useCaching = true);
 
     /**
      * Initialize a 1D texture based on the entries in the color map file.
      */
     void initializeTexture();
 
-    void update(const dataloader::Dataset& dataset, bool useCaching = true);
+    void update(const dataloader::ColumnarDataset& dataset, bool useCaching = true);
 
     static openspace::Documentation Documentation();
 
@@ -104,7 +104,7 @@ private:
      * Fill parameter options list and range data based on the dataset and provided
      * information.
      */
-    void initializeParameterData(const dataloader::Dataset& dataset);
+    void initializeParameterData(const dataloader::ColumnarDataset& dataset);
 
     /// One item per color parameter option
     std::vector<glm::vec2> _colorRangeData;
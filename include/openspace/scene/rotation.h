@@ -69,6 +69,16 @@ public:
     const glm::dmat3& matrix() const;
     virtual glm::dmat3 matrix(const UpdateData& time) const = 0;
 
+    /**
+     * Returns whether #update can be called from a worker thread, concurrently with the
+     * updates of other rotations that do not depend on this one. This is only the case if
+     * the computation neither touches global state nor state that is shared with other
+     * objects. The default implementation returns `false`.
+     *
+     * \return `true` if this rotation can be updated from a worker thread
+     */
+    virtual bool isThreadSafe() const;
+
     static openspace::Documentation Documentation();
 
 protected:
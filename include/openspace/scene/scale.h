@@ -53,6 +53,16 @@ public:
     glm::dvec3 scaleValue() const;
     virtual glm::dvec3 scaleValue(const UpdateData& data) const = 0;
 
+    /**
+     * Returns whether #update can be called from a worker thread, concurrently with the
+     * updates of other scales that do not depend on this one. This is only the case if
+     * the computation neither touches global state nor state that is shared with other
+     * objects. The default implementation returns `false`.
+     *
+     * \return `true` if this scale can be updated from a worker thread
+     */
+    virtual bool isThreadSafe() const;
+
     static openspace::Documentation Documentation();
 
 protected:
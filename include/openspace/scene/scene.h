@@ -27,7 +27,9 @@
 
 #include <openspace/properties/propertyowner.h>
 
+#include <openspace/properties/scalar/boolproperty.h>
 #include <openspace/scene/scenegraphnode.h>
+#include <openspace/scene/sceneupdatescheduler.h>
 #include <ghoul/misc/boolean.h>
 #include <ghoul/misc/easing.h>
 #include <ghoul/misc/managedmemoryuniqueptr.h>
@@ -281,6 +283,7 @@ private:
     std::unique_ptr<Camera> _camera;
     std::vector<SceneGraphNode*> _topologicallySortedNodes;
     std::vector<SceneGraphNode*> _circularNodes;
+    SceneUpdateScheduler _updateScheduler;
     std::unordered_map<
         std::string, SceneGraphNode*,
         transparent_string_hash,
@@ -292,6 +295,8 @@ private:
     std::string _profilePropertyName;
     bool _valueIsTable = false;
 
+    BoolProperty _parallelUpdate;
+
     std::mutex _programUpdateLock;
     std::set<ghoul::opengl::ProgramObject*> _programsToUpdate;
     std::vector<std::unique_ptr<ghoul::opengl::ProgramObject>> _programs;
@@ -92,6 +92,36 @@ public:
     void deinitializeGL();
 
     void update(const UpdateData& data);
+
+    /**
+     * Updates the translation, rotation, and scale of this node and computes the world
+     * transformation. The world transformation of the parent and all dependencies must
+     * have been computed before this function is called. If #supportsConcurrentUpdate
+     * returns `true`, this function may be called from a worker thread concurrently with
+     * the same function of other nodes that do not depend on this node.
+     *
+     * \param data The update data that contains the current simulation time
+     */
+    void updateTransform(const UpdateData& data);
+
+    /**
+     * Updates the Renderable attached to this node with the world transformation that
+     * was computed in the last call to #updateTransform. This function must only be
+     * called from the main thread.
+     *
+     * \param data The update data that contains the current simulation time
+     */
+    void updateRenderable(const UpdateData& data);
+
+    /**
+     * Returns whether the translation, rotation, and scale of this node can all be
+     * updated from a worker thread, which determines whether #updateTransform can be
+     * called concurrently.
+     *
+     * \return `true` if #updateTransform can be called from a worker thread
+     */
+    bool supportsConcurrentUpdate() const;
+
     void render(const RenderData& data, RendererTasks& tasks);
 
     void attachChild(ghoul::mm_unique_ptr<SceneGraphNode> child);
@@ -0,0 +1,127 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___SCENEUPDATESCHEDULER___H__
+#define __OPENSPACE_CORE___SCENEUPDATESCHEDULER___H__
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Schedules the per-frame update of the scene graph nodes so that nodes that do not
+ * depend on each other can be updated concurrently. The nodes are grouped into levels,
+ * where every node is in the level directly after the latest level of any of the nodes it
+ * depends on (its parent and its dependencies). Nodes in the same level are independent
+ * of each other.
+ *
+ * The update of each node is split into two steps. The transformation step of the nodes
+ * whose transformations support it is executed concurrently on the workers of the global
+ * TaskScheduler, while the transformation step of all other nodes is executed in a
+ * serial lane on the calling thread at the same time. Afterwards, the finalization step
+ * is executed for all nodes of the level on the calling thread, which is where work that
+ * has to happen on the main thread, such as the update of the Renderable, is performed.
+ * As all steps of a level are finished before the next level starts, a node always sees
+ * the completely updated state of all of the nodes it depends on.
+ */
+class SceneUpdateScheduler {
+public:
+    /// The minimum number of nodes in a level that can be updated concurrently for the
+    /// level to be processed in parallel. Smaller levels are not worth the overhead
+    static constexpr size_t MinParallelNodes = 16;
+
+    /**
+     * The description of a single node for the creation of the schedule.
+     */
+    struct Node {
+        /// The indices of the nodes that have to be updated before this node. All of
+        /// them have to be smaller than the index of this node
+        std::vector<uint32_t> predecessors;
+
+        /// Whether the transformation step of this node can be executed on a worker
+        /// thread concurrently with other nodes
+        bool isConcurrent = false;
+    };
+
+    /**
+     * A group of nodes that do not depend on each other.
+     */
+    struct Level {
+        /// All nodes of the level in ascending order
+        std::vector<uint32_t> nodes;
+        /// The nodes whose transformation step can be executed concurrently
+        std::vector<uint32_t> concurrent;
+        /// The nodes whose transformation step has to be executed on the calling thread
+        std::vector<uint32_t> serial;
+    };
+
+    /**
+     * Creates the schedule for the provided \p nodes, which have to be sorted
+     * topologically, replacing any previous schedule.
+     *
+     * \param nodes The list of all nodes in topological order
+     *
+     * \pre Each predecessor of a node must have a smaller index than the node itself
+     */
+    void build(std::span<const Node> nodes);
+
+    /**
+     * Executes the update for all nodes. If \p parallel is `false`, both steps are
+     * executed for one node after another in their topological order, which is identical
+     * to a plain serial update.
+     *
+     * \param transform The transformation step of a node. It is called from worker
+     *        threads for nodes that were marked as concurrent
+     * \param finalize The finalization step of a node, which is always called on the
+     *        calling thread
+     * \param parallel Whether independent nodes should be updated concurrently
+     *
+     * \throw Any exception that is thrown by \p transform or \p finalize. If multiple
+     *        concurrent transformation steps fail, only the first exception is rethrown
+     *        once all steps of the level have finished
+     */
+    void run(const std::function<void(uint32_t)>& transform,
+        const std::function<void(uint32_t)>& finalize, bool parallel) const;
+
+    /**
+     * Returns the levels of the current schedule.
+     */
+    std::span<const Level> levels() const;
+
+    /**
+     * Returns the number of nodes in the current schedule.
+     */
+    size_t nNodes() const;
+
+private:
+    std::vector<Level> _levels;
+    size_t _nNodes = 0;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_CORE___SCENEUPDATESCHEDULER___H__
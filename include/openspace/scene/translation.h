@@ -32,6 +32,7 @@
 #include <ghoul/misc/managedmemoryuniqueptr.h>
 #include <functional>
 #include <limits>
+#include <span>
 
 namespace ghoul { class Dictionary; }
 
@@ -55,6 +56,36 @@ public:
 
     virtual glm::dvec3 position(const UpdateData& data) const = 0;
 
+    /**
+     * Returns whether #update can be called from a worker thread, concurrently with the
+     * updates of other translations that do not depend on this one. This is only the case
+     * if the computation neither touches global state nor state that is shared with other
+     * objects. The default implementation returns `false`.
+     *
+     * \return `true` if this translation can be updated from a worker thread
+     */
+    virtual bool isThreadSafe() const;
+
+    /**
+     * A function that computes the positions for a list of times in J2000 seconds. The
+     * first argument are the times and the positions are written into the second
+     * argument, which has the same size. The times are usually sorted, for example when
+     * sampling a trail, which implementations can use to evaluate them more efficiently.
+     */
+    using PositionFunction =
+        std::function<void(std::span<const double>, std::span<glm::dvec3>)>;
+
+    /**
+     * Returns a function that computes the same positions as #position for the times
+     * that are passed to it, but that does not access any state of this object and can
+     * thus be called from any thread. The returned function is a snapshot of the current
+     * parameters of the translation. The default implementation returns an empty
+     * function, signalling that the translation can only be evaluated on the main thread.
+     *
+     * \return A thread-safe function to evaluate the translation or an empty function
+     */
+    virtual PositionFunction concurrentPositionFunction() const;
+
     // Registers a callback that gets called when a significant change has been made that
     // invalidates potentially stored points, for example in trails
     void onParameterChange(std::function<void()> callback);
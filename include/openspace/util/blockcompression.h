@@ -0,0 +1,64 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+#ifndef __OPENSPACE_CORE___BLOCKCOMPRESSION___H__
+#define __OPENSPACE_CORE___BLOCKCOMPRESSION___H__
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Compresses the \p source bytes using a fast, byte-oriented LZ77 compression in the
+ * style of the LZ4 block format. The compression favors speed over compression ratio
+ * and is intended for data that is produced and consumed every frame, for example the
+ * synchronization data that is sent between cluster nodes. The result is written to
+ * \p destination, whose previous contents are discarded. The compressed data can be
+ * larger than the \p source if the data does not contain any repetitions.
+ *
+ * \param source The bytes that should be compressed
+ * \param destination The vector that receives the compressed bytes
+ */
+void compressBlock(std::span<const std::byte> source,
+    std::vector<std::byte>& destination);
+
+/**
+ * Decompresses the \p source bytes that were compressed with compressBlock. As the
+ * compressed data does not store its own length, the size of the original data has to
+ * be provided in \p decompressedSize. The \p source is validated while it is decompressed
+ * so that malformed data never leads to an access outside of the buffers.
+ *
+ * \param source The bytes that were created by compressBlock
+ * \param destination The vector that receives the decompressed bytes
+ * \param decompressedSize The number of bytes that were originally compressed
+ * \return `true` if the \p source was decompressed successfully, `false` if it was
+ *         malformed or did not decompress to exactly \p decompressedSize bytes
+ */
+bool decompressBlock(std::span<const std::byte> source,
+    std::vector<std::byte>& destination, size_t decompressedSize);
+
+} // namespace openspace
+
+#endif // __OPENSPACE_CORE___BLOCKCOMPRESSION___H__
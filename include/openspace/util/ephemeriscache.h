@@ -0,0 +1,153 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___EPHEMERISCACHE___H__
+#define __OPENSPACE_CORE___EPHEMERISCACHE___H__
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <set>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Approximates a smooth, vector-valued function of time with piecewise Chebyshev
+ * polynomials so that repeated evaluations do not have to call the (expensive) function
+ * again. The time axis is divided into fixed-length windows, which are clipped to the
+ * coverage intervals inside of which the function is smooth. The first evaluation inside
+ * a window fits a polynomial to the whole window and checks it against the function at
+ * points between the interpolation nodes. If the error is larger than the tolerance, the
+ * part of the window that contains the requested time is halved until the polynomial is
+ * accurate enough or the segment becomes too short, in which case that segment is
+ * marked as not being cacheable.
+ *
+ * Evaluations for times outside the coverage, or inside a segment that could not be
+ * approximated, are reported as misses and have to be answered by the caller instead.
+ */
+class EphemerisCache {
+public:
+    /**
+     * The function that is approximated. It has to write one value for each component
+     * into the provided span and return `false` if it could not be evaluated at the
+     * provided time.
+     */
+    using Function = std::function<bool(double time, std::span<double> result)>;
+
+    /// The default length of a window in seconds
+    static constexpr double DefaultWindowLength = 86400.0;
+
+    /// The degree of the Chebyshev polynomial of each segment
+    static constexpr int Degree = 12;
+
+    /// The number of times that a window is halved before giving up
+    static constexpr int MaxSubdivisions = 12;
+
+    /// The maximum number of segments that are kept before the cache is cleared
+    static constexpr size_t MaxSegments = 16384;
+
+    /**
+     * Creates a new cache for a function with \p nComponents values per time.
+     *
+     * \param nComponents The number of values that the function returns
+     * \param tolerance The largest absolute error of any component that is accepted
+     * \param coverage The sorted, non-overlapping intervals inside of which the function
+     *        is smooth and can be cached. Times outside of these intervals are misses
+     * \param windowLength The length of the top-level windows in seconds
+     *
+     * \pre \p nComponents must be bigger than 0
+     * \pre \p tolerance must be positive
+     * \pre \p windowLength must be positive
+     */
+    EphemerisCache(size_t nComponents, double tolerance,
+        std::vector<std::pair<double, double>> coverage,
+        double windowLength = DefaultWindowLength);
+
+    /**
+     * Evaluates the approximation of the \p function at the provided \p time. If no
+     * segment exists for the \p time, a new one is fitted by calling the \p function.
+     *
+     * \param time The time at which the function should be evaluated
+     * \param result The destination for the values. Is only modified on success
+     * \param function The function that is approximated
+     * \return `true` if the \p result was computed from the cache, `false` if the
+     *         \p time could not be served and the caller has to evaluate the function
+     *
+     * \pre \p result must have as many values as the cache has components
+     */
+    bool evaluate(double time, std::span<double> result, const Function& function);
+
+    /**
+     * Removes all segments, for example after the underlying data has changed.
+     */
+    void clear();
+
+    /// The number of evaluations that were served from the cache
+    uint64_t nHits() const;
+
+    /// The number of evaluations that could not be served from the cache
+    uint64_t nMisses() const;
+
+    /// The number of segments that are currently cached
+    size_t nSegments() const;
+
+private:
+    struct Segment {
+        double end = 0.0;
+        /// `false` if the function could not be approximated inside this segment
+        bool isValid = false;
+        /// (Degree + 1) coefficients for each component, stored component after component
+        std::vector<double> coefficients;
+    };
+
+    /**
+     * Tries to fit a polynomial to the \p function in the interval [\p begin, \p end].
+     *
+     * \return The segment or an invalid segment if the error was too large
+     */
+    Segment fit(double begin, double end, const Function& function) const;
+
+    void evaluate(const Segment& segment, double begin, double time,
+        std::span<double> result) const;
+
+    const size_t _nComponents;
+    const double _tolerance;
+    const std::vector<std::pair<double, double>> _coverage;
+    const double _windowLength;
+
+    /// All segments sorted by their begin time
+    std::map<double, Segment> _segments;
+    /// Intervals for which a fit was tried and failed, to not try them again
+    std::set<std::pair<double, double>> _failedIntervals;
+
+    uint64_t _nHits = 0;
+    uint64_t _nMisses = 0;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_CORE___EPHEMERISCACHE___H__
@@ -0,0 +1,178 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___EXPRESSION___H__
+#define __OPENSPACE_CORE___EXPRESSION___H__
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A mathematical expression that is parsed once and compiled into a compact list of
+ * instructions for a stack machine, which can then be evaluated without any further
+ * parsing or memory allocations. As the evaluation does not have any side effects and
+ * does not modify the object, an Expression can be evaluated from multiple threads at the
+ * same time.
+ *
+ * The expressions support the operators `+`, `-`, `*`, `/`, `%` (floating point
+ * remainder), and `^` (exponentiation, right-associative), parentheses, numbers in
+ * decimal and scientific notation, the constants `pi` and `e`, the named variables that
+ * are passed to the constructor, and the functions `sin`, `cos`, `tan`, `asin`, `acos`,
+ * `atan`, `atan2`, `sinh`, `cosh`, `tanh`, `sqrt`, `cbrt`, `abs`, `exp`, `log`, `log2`,
+ * `log10`, `floor`, `ceil`, `round`, `sign`, `min`, `max`, `pow`, `mod`, `hypot`, and
+ * `clamp`. Parts of the expression that do not depend on any variable are computed when
+ * the expression is compiled.
+ *
+ * Example: `1.5e11 * cos(2 * pi * t / 31557600)` with the variable `t`.
+ */
+class Expression {
+public:
+    /// The maximum number of intermediate values that an expression can require
+    static constexpr int MaxStackDepth = 32;
+
+    /// The maximum number of variables that an expression can have
+    static constexpr int MaxVariables = 16;
+
+    /**
+     * Compiles the expression in the \p source. The expression may refer to the names
+     * in \p variables, which have to be provided in the same order when evaluating it.
+     *
+     * \param source The text of the expression that should be compiled
+     * \param variables The names of the variables that are used in the expression
+     *
+     * \throw ghoul::RuntimeError If the \p source is not a valid expression, if it uses
+     *        an unknown name, or if it is too complex to be evaluated
+     * \pre \p variables must contain at most #MaxVariables names
+     */
+    explicit Expression(std::string_view source,
+        std::vector<std::string> variables = { "t" });
+
+    /**
+     * Evaluates the expression for the provided values of the variables.
+     *
+     * \param values The values of the variables, in the order they were passed to the
+     *        constructor
+     * \return The value of the expression
+     *
+     * \pre \p values must contain one value for each variable
+     */
+    double evaluate(std::span<const double> values) const;
+
+    /**
+     * Evaluates the expression for many sets of variable values at the same time, which
+     * is considerably faster than calling #evaluate for each of them individually. The
+     * value for the `i`-th variable of the `j`-th evaluation is `columns[i][j]`.
+     *
+     * \param columns One list of values per variable, each of them with as many values as
+     *        \p results
+     * \param results The location into which the values of the expression are written
+     *
+     * \pre \p columns must contain one list for each variable
+     * \pre Each of the \p columns must have the same size as \p results
+     */
+    void evaluate(std::span<const std::span<const double>> columns,
+        std::span<double> results) const;
+
+    /**
+     * Returns the text of the expression as it was passed to the constructor.
+     */
+    const std::string& source() const;
+
+    /**
+     * Returns the names of the variables of this expression.
+     */
+    const std::vector<std::string>& variables() const;
+
+    /**
+     * Returns `true` if the expression does not depend on any of its variables.
+     */
+    bool isConstant() const;
+
+    /// The operations of the stack machine
+    enum class OpCode : uint8_t {
+        Constant = 0,
+        Variable,
+        Negate,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Modulo,
+        Power,
+        Sin,
+        Cos,
+        Tan,
+        Asin,
+        Acos,
+        Atan,
+        Atan2,
+        Sinh,
+        Cosh,
+        Tanh,
+        Sqrt,
+        Cbrt,
+        Abs,
+        Exp,
+        Log,
+        Log2,
+        Log10,
+        Floor,
+        Ceil,
+        Round,
+        Sign,
+        Min,
+        Max,
+        Hypot,
+        Clamp
+    };
+
+    /// A single instruction of the compiled expression
+    struct Instruction {
+        OpCode code = OpCode::Constant;
+        /// The index of the variable for OpCode::Variable
+        uint32_t index = 0;
+        /// The value for OpCode::Constant
+        double value = 0.0;
+    };
+
+    /**
+     * Returns the instructions that the expression was compiled into.
+     */
+    std::span<const Instruction> instructions() const;
+
+private:
+    std::string _source;
+    std::vector<std::string> _variables;
+    std::vector<Instruction> _instructions;
+    int _stackDepth = 0;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_CORE___EXPRESSION___H__
@@ -0,0 +1,114 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___MEMORYMAPPEDFILE___H__
+#define __OPENSPACE_CORE___MEMORYMAPPEDFILE___H__
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A read-only view of a file on disk that is mapped into the address space of the
+ * process. The contents of the file are paged in by the operating system on first access
+ * rather than being copied into a separate buffer, which makes it possible to work with
+ * files that are larger than the available RAM or of which only a small part is needed.
+ *
+ * The mapping is released when the object is destroyed, which invalidates all pointers
+ * and views that were handed out.
+ */
+class MemoryMappedFile {
+public:
+    /**
+     * Maps the file at the provided \p path into memory.
+     *
+     * \param path The path to the file that should be mapped
+     *
+     * \throw ghoul::RuntimeError If the file does not exist or could not be mapped
+     * \pre \p path must not be empty
+     */
+    explicit MemoryMappedFile(std::filesystem::path path);
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+    MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+    /**
+     * Returns the pointer to the first byte of the mapped file. If the file is empty, a
+     * `nullptr` is returned.
+     */
+    const std::byte* data() const;
+
+    /**
+     * Returns the size of the mapped file in bytes.
+     */
+    size_t size() const;
+
+    /**
+     * Returns the contents of the mapped file as a character view.
+     */
+    std::string_view view() const;
+
+    /**
+     * Returns the path of the file that is mapped.
+     */
+    const std::filesystem::path& path() const;
+
+private:
+    void unmap();
+
+    std::filesystem::path _path;
+    const std::byte* _data = nullptr;
+    size_t _size = 0;
+
+#ifdef WIN32
+    void* _fileHandle = nullptr;
+    void* _mappingHandle = nullptr;
+#endif // WIN32
+};
+
+/**
+ * Splits the provided \p data into at most \p nChunks consecutive pieces of roughly equal
+ * size. Each piece, except for the last, ends directly after a newline character so that
+ * no line is split between two chunks. Concatenating the returned views results in the
+ * original \p data. Fewer than \p nChunks pieces are returned if there are not enough
+ * lines to fill all of them.
+ *
+ * \param data The text that should be split
+ * \param nChunks The maximum number of pieces that should be returned
+ * \return The list of line-aligned pieces
+ *
+ * \pre \p nChunks must be bigger than 0
+ */
+std::vector<std::string_view> splitAtLineBoundaries(std::string_view data,
+    size_t nChunks);
+
+} // namespace openspace
+
+#endif // __OPENSPACE_CORE___MEMORYMAPPEDFILE___H__
@@ -0,0 +1,218 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___SAMPLEDTIMELINE___H__
+#define __OPENSPACE_CORE___SAMPLEDTIMELINE___H__
+
+#include <atomic>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A timeline of values that are sampled at increasing points in time and that are
+ * interpolated between the samples. In contrast to the Timeline, the times, values, and
+ * optional derivatives of the samples are stored in separate contiguous arrays, which
+ * makes the search for a time cache friendly. The interval that was found in the last
+ * lookup is remembered and used as the starting point for the next search, so evaluating
+ * the timeline for successive times, for example during playback, is a constant time
+ * operation.
+ *
+ * If every sample has a derivative, the values can be interpolated with a cubic Hermite
+ * spline instead of linearly, which requires far fewer samples for the same accuracy if
+ * the values describe a smooth curve, such as the position of an object that is given
+ * together with its velocity.
+ *
+ * The samples can be of any type that can be moved. Only the #evaluate functions require
+ * that `T` supports the addition of two values and the multiplication with a `double`.
+ */
+template <typename T>
+class SampledTimeline {
+public:
+    enum class Interpolation {
+        /// The values are interpolated linearly between two samples
+        Linear = 0,
+        /// The values are interpolated with a cubic Hermite spline that uses the
+        /// derivatives of the samples. If not every sample has a derivative, linear
+        /// interpolation is used instead
+        Hermite
+    };
+
+    SampledTimeline() = default;
+    SampledTimeline(const SampledTimeline& other);
+    SampledTimeline(SampledTimeline&& other) noexcept;
+    ~SampledTimeline() = default;
+
+    SampledTimeline& operator=(const SampledTimeline& other);
+    SampledTimeline& operator=(SampledTimeline&& other) noexcept;
+
+    /**
+     * Adds a sample without a derivative at the provided \p time. Adding a sample without
+     * a derivative removes the derivatives of all other samples. Samples can be added in
+     * any order, but adding them in increasing time is the most efficient.
+     *
+     * \param time The time of the sample
+     * \param value The value at the \p time
+     * \return `true` if the sample was added, `false` if there already is a sample at the
+     *         \p time, in which case the timeline is not changed
+     */
+    bool addSample(double time, T value);
+
+    /**
+     * Adds a sample with a \p derivative at the provided \p time. The derivative is only
+     * kept if all other samples have a derivative as well. Samples can be added in any
+     * order, but adding them in increasing time is the most efficient.
+     *
+     * \param time The time of the sample
+     * \param value The value at the \p time
+     * \param derivative The rate of change of the value per unit of time
+     * \return `true` if the sample was added, `false` if there already is a sample at the
+     *         \p time, in which case the timeline is not changed
+     */
+    bool addSample(double time, T value, T derivative);
+
+    /**
+     * Removes all samples.
+     */
+    void clear();
+
+    /**
+     * Reserves the memory for \p nSamples samples.
+     */
+    void reserve(size_t nSamples);
+
+    /**
+     * Sets the method that is used to interpolate between samples.
+     */
+    void setInterpolation(Interpolation interpolation);
+
+    /**
+     * Returns the method that is used to interpolate between samples.
+     */
+    Interpolation interpolation() const;
+
+    /**
+     * Returns the number of samples in the timeline.
+     */
+    size_t nSamples() const;
+
+    /**
+     * Returns whether every sample has a derivative.
+     */
+    bool hasDerivatives() const;
+
+    /**
+     * Returns the times of all samples in increasing order.
+     */
+    std::span<const double> times() const;
+
+    /**
+     * Returns the values of all samples in the same order as the #times.
+     */
+    std::span<const T> values() const;
+
+    /**
+     * Returns the derivatives of all samples in the same order as the #times, or an
+     * empty list if not every sample has a derivative.
+     */
+    std::span<const T> derivatives() const;
+
+    /**
+     * Returns the index of the sample that starts the interval containing the \p time,
+     * which is the last sample whose time is smaller than or equal to \p time. Times
+     * before the first sample return the first interval and times after the last sample
+     * return the last interval.
+     *
+     * \param time The time for which to find the interval
+     * \return The index of the sample at the beginning of the interval
+     *
+     * \pre The timeline must contain at least two samples
+     */
+    size_t findInterval(double time) const;
+
+    /**
+     * Returns the value at the provided \p time. Times before the first sample or after
+     * the last sample return the value of the first or last sample, respectively. An
+     * empty timeline returns a default constructed value.
+     *
+     * \param time The time at which the timeline is evaluated
+     * \return The interpolated value at the \p time
+     */
+    T evaluate(double time) const;
+
+    /**
+     * Evaluates the timeline for all \p times and writes the values to \p result. This
+     * is equivalent to calling #evaluate for each of the times, but if the \p times are
+     * sorted, each interval is found in constant time, which is the case when sampling a
+     * trail.
+     *
+     * \param times The times at which the timeline is evaluated
+     * \param result The list into which the values are written
+     *
+     * \pre \p result must have the same size as \p times
+     */
+    void evaluate(std::span<const double> times, std::span<T> result) const;
+
+private:
+    bool insert(double time, T value, std::optional<T> derivative);
+    size_t findInterval(double time, size_t hint) const;
+    T evaluate(double time, size_t& hint) const;
+
+    std::vector<double> _times;
+    std::vector<T> _values;
+    std::vector<T> _derivatives;
+    bool _hasDerivatives = false;
+    Interpolation _interpolation = Interpolation::Linear;
+
+    /// The interval that was found in the last lookup, which is only used as a hint
+    mutable std::atomic<size_t> _cursor = 0;
+};
+
+/**
+ * Interpolates between the value \p v0 with the derivative \p d0 at the time \p t0 and
+ * the value \p v1 with the derivative \p d1 at the time \p t1 with a cubic Hermite
+ * spline. The derivatives are the rate of change of the values per unit of time.
+ *
+ * \param t0 The time at the beginning of the interval
+ * \param v0 The value at \p t0
+ * \param d0 The derivative at \p t0
+ * \param t1 The time at the end of the interval
+ * \param v1 The value at \p t1
+ * \param d1 The derivative at \p t1
+ * \param time The time at which the spline is evaluated
+ * \return The interpolated value at the \p time
+ *
+ * \pre \p t1 must be larger than \p t0
+ */
+template <typename T>
+T interpolateHermite(double t0, const T& v0, const T& d0, double t1, const T& v1,
+    const T& d1, double time);
+
+} // namespace openspace
+
+#include "sampledtimeline.inl"
+
+#endif // __OPENSPACE_CORE___SAMPLEDTIMELINE___H__
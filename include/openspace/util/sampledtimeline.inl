@@ -0,0 +1,260 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <ghoul/misc/assert.h>
+#include <algorithm>
+
+namespace openspace {
+
+template <typename T>
+SampledTimeline<T>::SampledTimeline(const SampledTimeline& other)
+    : _times(other._times)
+    , _values(other._values)
+    , _derivatives(other._derivatives)
+    , _hasDerivatives(other._hasDerivatives)
+    , _interpolation(other._interpolation)
+    , _cursor(other._cursor.load(std::memory_order_relaxed))
+{}
+
+template <typename T>
+SampledTimeline<T>::SampledTimeline(SampledTimeline&& other) noexcept
+    : _times(std::move(other._times))
+    , _values(std::move(other._values))
+    , _derivatives(std::move(other._derivatives))
+    , _hasDerivatives(other._hasDerivatives)
+    , _interpolation(other._interpolation)
+    , _cursor(other._cursor.load(std::memory_order_relaxed))
+{}
+
+template <typename T>
+SampledTimeline<T>& SampledTimeline<T>::operator=(const SampledTimeline& other) {
+    _times = other._times;
+    _values = other._values;
+    _derivatives = other._derivatives;
+    _hasDerivatives = other._hasDerivatives;
+    _interpolation = other._interpolation;
+    _cursor = other._cursor.load(std::memory_order_relaxed);
+    return *this;
+}
+
+template <typename T>
+SampledTimeline<T>& SampledTimeline<T>::operator=(SampledTimeline&& other) noexcept {
+    _times = std::move(other._times);
+    _values = std::move(other._values);
+    _derivatives = std::move(other._derivatives);
+    _hasDerivatives = other._hasDerivatives;
+    _interpolation = other._interpolation;
+    _cursor = other._cursor.load(std::memory_order_relaxed);
+    return *this;
+}
+
+template <typename T>
+bool SampledTimeline<T>::addSample(double time, T value) {
+    return insert(time, std::move(value), std::nullopt);
+}
+
+template <typename T>
+bool SampledTimeline<T>::addSample(double time, T value, T derivative) {
+    return insert(time, std::move(value), std::move(derivative));
+}
+
+template <typename T>
+bool SampledTimeline<T>::insert(double time, T value, std::optional<T> derivative) {
+    size_t index = _times.size();
+    if (!_times.empty() && time <= _times.back()) {
+        const auto it = std::lower_bound(_times.begin(), _times.end(), time);
+        if (*it == time) {
+            return false;
+        }
+        index = static_cast<size_t>(std::distance(_times.begin(), it));
+    }
+
+    const bool keepDerivatives =
+        derivative.has_value() && (_times.empty() || _hasDerivatives);
+    if (!keepDerivatives) {
+        _derivatives.clear();
+    }
+    _hasDerivatives = keepDerivatives;
+
+    _times.insert(_times.begin() + index, time);
+    _values.insert(_values.begin() + index, std::move(value));
+    if (keepDerivatives) {
+        _derivatives.insert(_derivatives.begin() + index, std::move(*derivative));
+    }
+    return true;
+}
+
+template <typename T>
+void SampledTimeline<T>::clear() {
+    _times.clear();
+    _values.clear();
+    _derivatives.clear();
+    _hasDerivatives = false;
+}
+
+template <typename T>
+void SampledTimeline<T>::reserve(size_t nSamples) {
+    _times.reserve(nSamples);
+    _values.reserve(nSamples);
+    _derivatives.reserve(nSamples);
+}
+
+template <typename T>
+void SampledTimeline<T>::setInterpolation(Interpolation interpolation) {
+    _interpolation = interpolation;
+}
+
+template <typename T>
+typename SampledTimeline<T>::Interpolation SampledTimeline<T>::interpolation() const {
+    return _interpolation;
+}
+
+template <typename T>
+size_t SampledTimeline<T>::nSamples() const {
+    return _times.size();
+}
+
+template <typename T>
+bool SampledTimeline<T>::hasDerivatives() const {
+    return _hasDerivatives;
+}
+
+template <typename T>
+std::span<const double> SampledTimeline<T>::times() const {
+    return _times;
+}
+
+template <typename T>
+std::span<const T> SampledTimeline<T>::values() const {
+    return _values;
+}
+
+template <typename T>
+std::span<const T> SampledTimeline<T>::derivatives() const {
+    return _derivatives;
+}
+
+template <typename T>
+size_t SampledTimeline<T>::findInterval(double time) const {
+    ghoul_assert(_times.size() >= 2, "Timeline must contain at least two samples");
+
+    const size_t i = findInterval(time, _cursor.load(std::memory_order_relaxed));
+    _cursor.store(i, std::memory_order_relaxed);
+    return i;
+}
+
+template <typename T>
+size_t SampledTimeline<T>::findInterval(double time, size_t hint) const {
+    const size_t last = _times.size() - 2;
+    const size_t i = std::min(hint, last);
+
+    // Successive lookups usually end up in the same or the next interval, so these are
+    // checked before falling back to a binary search
+    if (_times[i] <= time) {
+        if (i == last || time < _times[i + 1]) {
+            return i;
+        }
+        if (i + 1 == last || time < _times[i + 2]) {
+            return i + 1;
+        }
+        const auto it = std::upper_bound(_times.begin() + i + 2, _times.end(), time);
+        const size_t index = static_cast<size_t>(std::distance(_times.begin(), it));
+        return std::min(index - 1, last);
+    }
+
+    if (i > 0 && _times[i - 1] <= time) {
+        return i - 1;
+    }
+    const auto it = std::upper_bound(_times.begin(), _times.begin() + i, time);
+    const size_t index = static_cast<size_t>(std::distance(_times.begin(), it));
+    return index > 0 ? index - 1 : 0;
+}
+
+template <typename T>
+T SampledTimeline<T>::evaluate(double time) const {
+    size_t hint = _cursor.load(std::memory_order_relaxed);
+    T result = evaluate(time, hint);
+    _cursor.store(hint, std::memory_order_relaxed);
+    return result;
+}
+
+template <typename T>
+void SampledTimeline<T>::evaluate(std::span<const double> times,
+                                  std::span<T> result) const
+{
+    ghoul_assert(times.size() == result.size(), "Result must have the same size");
+
+    size_t hint = _cursor.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < times.size(); i++) {
+        result[i] = evaluate(times[i], hint);
+    }
+    _cursor.store(hint, std::memory_order_relaxed);
+}
+
+template <typename T>
+T SampledTimeline<T>::evaluate(double time, size_t& hint) const {
+    if (_times.empty()) {
+        return T();
+    }
+    if (time <= _times.front()) {
+        return _values.front();
+    }
+    if (time >= _times.back()) {
+        return _values.back();
+    }
+
+    const size_t i = findInterval(time, hint);
+    hint = i;
+
+    if (_interpolation == Interpolation::Hermite && _hasDerivatives) {
+        return interpolateHermite(
+            _times[i], _values[i], _derivatives[i],
+            _times[i + 1], _values[i + 1], _derivatives[i + 1],
+            time
+        );
+    }
+    const double s = (time - _times[i]) / (_times[i + 1] - _times[i]);
+    return _values[i] * (1.0 - s) + _values[i + 1] * s;
+}
+
+template <typename T>
+T interpolateHermite(double t0, const T& v0, const T& d0, double t1, const T& v1,
+                     const T& d1, double time)
+{
+    ghoul_assert(t1 > t0, "The interval must have a positive length");
+
+    // The basis functions of the cubic Hermite spline on the unit interval. The
+    // derivatives are scaled by the length of the interval to account for that
+    const double h = t1 - t0;
+    const double s = (time - t0) / h;
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+    const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+    const double h10 = s3 - 2.0 * s2 + s;
+    const double h01 = -2.0 * s3 + 3.0 * s2;
+    const double h11 = s3 - s2;
+    return v0 * h00 + d0 * (h10 * h) + v1 * h01 + d1 * (h11 * h);
+}
+
+} // namespace openspace
@@ -32,9 +32,13 @@
 #include <ghoul/misc/boolean.h>
 #include <ghoul/misc/exception.h>
 #include <array>
+#include <cstdint>
 #include <filesystem>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <set>
 
@@ -57,7 +61,9 @@
 
 namespace openspace {
 
+class EphemerisCache;
 struct LuaLibrary;
+class SpiceService;
 
 void throwSpiceError(const std::string& errorMessage);
 
@@ -195,6 +201,25 @@ public:
     static bool isInitialized();
     static SpiceManager& ref();
 
+    /**
+     * Statistics about the ephemeris cache that is used by the #targetPosition and
+     * #positionTransformMatrix functions when the cache is enabled.
+     */
+    struct EphemerisCacheStatistics {
+        /// The number of queries that were answered from the cache
+        uint64_t nHits = 0;
+        /// The number of queries that had to be passed on to SPICE
+        uint64_t nMisses = 0;
+        /// The number of polynomial segments that are currently stored
+        uint64_t nSegments = 0;
+        /// The number of validated queries whose error was bigger than the tolerance
+        uint64_t nValidationFailures = 0;
+        /// The largest position error in km that was found during validation
+        double maxPositionError = 0.0;
+        /// The largest error of a rotation matrix element found during validation
+        double maxRotationError = 0.0;
+    };
+
     /**
      * Loads one or more SPICE kernels into a program. The provided path can either be a
      * binary, text-kernel, or meta-kernel which gets loaded into the kernel pool. The
@@ -899,6 +924,84 @@ public:
      */
     static std::filesystem::path leapSecondKernel();
 
+    /**
+     * Returns the SpiceService that evaluates batches of queries on a dedicated worker
+     * thread. The service is created on the first call to this function.
+     *
+     * \return The SpiceService of this SpiceManager
+     */
+    SpiceService& service();
+
+    /**
+     * Returns the mutex that serializes all calls into CSPICE. All functions of the
+     * SpiceManager lock this mutex themselves, so it only has to be locked by code that
+     * calls CSPICE functions directly while the SpiceService might be in use.
+     *
+     * \return The mutex that protects CSPICE
+     */
+    std::recursive_mutex& mutex() const;
+
+    /**
+     * Enables or disables the ephemeris cache. If the cache is enabled, the
+     * #targetPosition and #positionTransformMatrix functions approximate the results with
+     * piecewise Chebyshev polynomials inside the coverage of the loaded SPK and CK
+     * kernels instead of calling SPICE for every query. Queries outside the coverage or
+     * for which no accurate enough polynomial can be found are passed on to SPICE.
+     * Disabling the cache removes all cached segments.
+     *
+     * \param enabled Whether the ephemeris cache should be used
+     */
+    void setEphemerisCacheEnabled(bool enabled);
+
+    /**
+     * Returns whether the ephemeris cache is enabled. See #setEphemerisCacheEnabled.
+     *
+     * \return `true` if the ephemeris cache is enabled
+     */
+    bool isEphemerisCacheEnabled() const;
+
+    /**
+     * Sets the largest error that the cached values are allowed to have. Changing the
+     * tolerance removes all cached segments.
+     *
+     * \param positionTolerance The largest error of each position component in km
+     * \param rotationTolerance The largest error of each rotation matrix element
+     *
+     * \pre \p positionTolerance must be positive
+     * \pre \p rotationTolerance must be positive
+     */
+    void setEphemerisCacheTolerance(double positionTolerance, double rotationTolerance);
+
+    /**
+     * Enables or disables the validation of the ephemeris cache. In validation mode,
+     * each value that is served from the cache is compared against the result from SPICE
+     * and the difference is recorded in the #ephemerisCacheStatistics. The values that
+     * are returned in this mode are the ones from SPICE, so this mode is slower than not
+     * using the cache at all and should only be used for testing.
+     *
+     * \param enabled Whether the cached values should be compared against SPICE
+     */
+    void setEphemerisCacheValidation(bool enabled);
+
+    /**
+     * Returns the statistics of the ephemeris cache since the SpiceManager was created
+     * or since the last call to #resetEphemerisCacheStatistics.
+     *
+     * \return The statistics of the ephemeris cache
+     */
+    EphemerisCacheStatistics ephemerisCacheStatistics() const;
+
+    /**
+     * Resets the hit and miss counters and the validation errors of the ephemeris cache.
+     */
+    void resetEphemerisCacheStatistics();
+
+    /**
+     * Removes all cached segments. This is done automatically whenever a kernel is loaded
+     * or unloaded as the coverage and the values might change.
+     */
+    void clearEphemerisCache();
+
     static LuaLibrary luaLibrary();
 
 private:
@@ -1007,6 +1110,37 @@ private:
     glm::dmat3 getEstimatedTransformMatrix(const std::string& fromFrame,
         const std::string& toFrame, double time) const;
 
+    /**
+     * The implementation of #targetPosition that always uses SPICE.
+     */
+    glm::dvec3 uncachedTargetPosition(const std::string& target,
+        const std::string& observer, const std::string& referenceFrame,
+        AberrationCorrection aberrationCorrection, double ephemerisTime,
+        double& lightTime) const;
+
+    /**
+     * The implementation of #positionTransformMatrix that always uses SPICE.
+     */
+    glm::dmat3 uncachedPositionTransformMatrix(const std::string& sourceFrame,
+        const std::string& destinationFrame, double ephemerisTime) const;
+
+    /**
+     * Returns the ephemeris cache for the positions of the \p target relative to the
+     * \p observer, creating it if it does not exist yet. The coverage of the cache is the
+     * time during which both the \p target and the \p observer have SPK coverage.
+     */
+    EphemerisCache& positionCache(const std::string& target,
+        const std::string& observer, const std::string& referenceFrame,
+        AberrationCorrection aberrationCorrection) const;
+
+    /**
+     * Returns the ephemeris cache for the rotation matrices between the \p sourceFrame
+     * and the \p destinationFrame, creating it if it does not exist yet. If any of the
+     * frames has CK coverage, the cache is restricted to that coverage.
+     */
+    EphemerisCache& rotationCache(const std::string& sourceFrame,
+        const std::string& destinationFrame) const;
+
     /**
      * Loads pre defined leap seconds time kernel (naif00012.tls).
      */
@@ -1033,6 +1167,30 @@ private:
     /// The last assigned kernel-id, used to determine the next free kernel id
     KernelHandle _lastAssignedKernel = KernelHandle(0);
 
+    /// Whether positions and rotations are served from the ephemeris caches
+    bool _isEphemerisCacheEnabled = false;
+    /// Whether cached values are compared against the values from SPICE
+    bool _isEphemerisCacheValidating = false;
+    /// The largest error of each cached position component in km
+    double _positionCacheTolerance = 1e-3;
+    /// The largest error of each cached rotation matrix element
+    double _rotationCacheTolerance = 1e-9;
+
+    /// The position caches, keyed by the target, observer, frame, and correction
+    mutable std::unordered_map<std::string, std::unique_ptr<EphemerisCache>>
+        _positionCaches;
+    /// The rotation caches, keyed by the source and destination frame
+    mutable std::unordered_map<std::string, std::unique_ptr<EphemerisCache>>
+        _rotationCaches;
+    /// Contains the counters of caches that have been removed and the validation errors
+    mutable EphemerisCacheStatistics _ephemerisCacheStatistics;
+
+    /// Serializes all calls into CSPICE, which is not re-entrant
+    mutable std::recursive_mutex _mutex;
+
+    /// The worker that evaluates batched queries, created on demand
+    std::unique_ptr<SpiceService> _service;
+
     static SpiceManager* _instance;
 };
 
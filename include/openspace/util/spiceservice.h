@@ -0,0 +1,151 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___SPICESERVICE___H__
+#define __OPENSPACE_CORE___SPICESERVICE___H__
+
+#include <openspace/util/spicemanager.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Evaluates batches of SPICE queries on a dedicated worker thread. CSPICE is not
+ * re-entrant, so all calls into the SpiceManager are serialized, but handing a whole
+ * batch, for example all epochs of a trail or all targets of a field-of-view check, to
+ * the worker allows the caller to continue with other work and pick up the results in a
+ * later frame instead of blocking until every query has been answered.
+ *
+ * Batches are executed in the order in which they were submitted. Each function returns
+ * a future that receives one result per input value in the same order. If any of the
+ * queries of a batch fails, the SpiceManager::SpiceException is stored in the future
+ * instead. Batches that have not been started when the SpiceService is destroyed are
+ * discarded and their futures report a `std::future_error`.
+ */
+class SpiceService {
+public:
+    /**
+     * Creates a new SpiceService that evaluates its queries with the provided \p spice
+     * manager and starts the worker thread.
+     */
+    explicit SpiceService(const SpiceManager& spice);
+
+    /**
+     * Finishes the currently running batch and stops the worker thread.
+     */
+    ~SpiceService();
+
+    SpiceService(const SpiceService&) = delete;
+    SpiceService& operator=(const SpiceService&) = delete;
+
+    /**
+     * Computes the positions of the \p target relative to the \p observer for all of the
+     * \p ephemerisTimes. See SpiceManager::targetPosition.
+     *
+     * \return The positions in km in the same order as the \p ephemerisTimes
+     */
+    std::future<std::vector<glm::dvec3>> targetPositions(std::string target,
+        std::string observer, std::string referenceFrame,
+        SpiceManager::AberrationCorrection aberrationCorrection,
+        std::vector<double> ephemerisTimes);
+
+    /**
+     * Computes the states of the \p target relative to the \p observer for all of the
+     * \p ephemerisTimes. See SpiceManager::targetState.
+     *
+     * \return The states in the same order as the \p ephemerisTimes
+     */
+    std::future<std::vector<SpiceManager::TargetStateResult>> targetStates(
+        std::string target, std::string observer, std::string referenceFrame,
+        SpiceManager::AberrationCorrection aberrationCorrection,
+        std::vector<double> ephemerisTimes);
+
+    /**
+     * Computes the rotation matrices from the \p sourceFrame to the \p destinationFrame
+     * for all of the \p ephemerisTimes. See SpiceManager::positionTransformMatrix.
+     *
+     * \return The matrices in the same order as the \p ephemerisTimes
+     */
+    std::future<std::vector<glm::dmat3>> positionTransformMatrices(
+        std::string sourceFrame, std::string destinationFrame,
+        std::vector<double> ephemerisTimes);
+
+    /**
+     * Checks for each of the \p targets whether it is in the field of view of the
+     * \p instrument at the provided \p ephemerisTime. See
+     * SpiceManager::isTargetInFieldOfView.
+     *
+     * \return Whether the targets are visible in the same order as the \p targets
+     */
+    std::future<std::vector<bool>> targetsInFieldOfView(std::vector<std::string> targets,
+        std::string observer, std::string referenceFrame, std::string instrument,
+        SpiceManager::FieldOfViewMethod method,
+        SpiceManager::AberrationCorrection aberrationCorrection, double ephemerisTime);
+
+    /**
+     * Computes the surface intercepts of all of the \p directionVectors with the
+     * \p target at the provided \p ephemerisTime. See SpiceManager::surfaceIntercept.
+     *
+     * \return The intercepts in the same order as the \p directionVectors
+     */
+    std::future<std::vector<SpiceManager::SurfaceInterceptResult>> surfaceIntercepts(
+        std::string target, std::string observer, std::string fovFrame,
+        std::string referenceFrame,
+        SpiceManager::AberrationCorrection aberrationCorrection, double ephemerisTime,
+        std::vector<glm::dvec3> directionVectors);
+
+    /**
+     * Returns the number of batches that have been submitted but were not started yet.
+     */
+    size_t nQueuedBatches() const;
+
+private:
+    /**
+     * Adds the \p batch to the queue of the worker and returns the future for its result.
+     */
+    template <typename T>
+    std::future<T> submit(std::function<T()> batch);
+
+    void work();
+
+    const SpiceManager& _spice;
+
+    std::deque<std::function<void()>> _batches;
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _shouldStop = false;
+
+    std::thread _worker;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_CORE___SPICESERVICE___H__
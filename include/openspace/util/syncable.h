@@ -42,6 +42,17 @@ protected:
     friend class SyncEngine;
 
     virtual void preSync(bool isMaster);
+
+    /**
+     * Returns whether the data written in #encode is a snapshot of the complete state of
+     * this Syncable, meaning that decoding the same data repeatedly has the same effect
+     * as decoding it once. If this is the case, the SyncEngine is allowed to skip sending
+     * the data while it is unchanged from the previous frame. Syncables whose data
+     * represents events instead, for example a list of scripts that should be executed
+     * once, must return `false`, which is the default.
+     */
+    virtual bool isSnapshot() const;
+
     virtual void encode(SyncBuffer* syncBuffer) = 0;
     virtual void decode(SyncBuffer* syncBuffer) = 0;
     virtual void postSync(bool isMaster);
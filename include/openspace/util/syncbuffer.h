@@ -27,6 +27,7 @@
 
 #include <ghoul/glm.h>
 #include <cstddef>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -60,7 +61,18 @@ public:
     void reset();
 
     void setData(std::vector<std::byte> data);
-    std::vector<std::byte> data();
+
+    /**
+     * Replaces the data that is decoded with a copy of \p data. The existing storage of
+     * the buffer is reused if it is large enough.
+     */
+    void setData(std::span<const std::byte> data);
+
+    /**
+     * Returns a view of the bytes that have been encoded since the last call to #reset.
+     * The view is invalidated by the next call to any of the encode functions or #reset.
+     */
+    std::span<const std::byte> data() const;
 
 private:
     size_t _n;
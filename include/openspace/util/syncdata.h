@@ -69,6 +69,7 @@ public:
     const T& data() const;
 
 protected:
+    bool isSnapshot() const override;
     void encode(SyncBuffer* syncBuffer) override;
     void decode(SyncBuffer* syncBuffer) override;
     void postSync(bool isMaster) override;
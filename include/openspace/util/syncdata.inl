@@ -61,6 +61,12 @@ const T& SyncData<T>::data() const {
     return _data;
 }
 
+template <class T>
+bool SyncData<T>::isSnapshot() const {
+    // The encoded value completely replaces the previous value on the client nodes
+    return true;
+}
+
 template <class T>
 void SyncData<T>::encode(SyncBuffer* syncBuffer) {
     const std::unique_lock lock(_mutex);
@@ -0,0 +1,195 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+#ifndef __OPENSPACE_CORE___TASKSCHEDULER___H__
+#define __OPENSPACE_CORE___TASKSCHEDULER___H__
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A fixed set of worker threads that execute tasks in the background. Every worker owns
+ * one queue per Priority. Tasks that are enqueued from one of the workers are added to
+ * that worker's own queues, while all other tasks are distributed between the workers.
+ * A worker always executes the most recently added task of its own queues first and, if
+ * all of its queues are empty, steals the oldest task from one of the other workers.
+ * Tasks with a higher priority are always preferred over tasks with a lower priority,
+ * regardless of the queue they are in.
+ *
+ * As the number of workers is fixed on creation, the number of tasks that run
+ * concurrently is bounded, no matter how many tasks are enqueued. Tasks can be collected
+ * in a TaskGroup, which makes it possible to wait for their completion or to cancel the
+ * ones that have not started yet.
+ */
+class TaskScheduler {
+public:
+    enum class Priority {
+        High = 0,
+        Normal,
+        Low
+    };
+
+    /**
+     * A handle to a collection of tasks that have been enqueued in a TaskScheduler.
+     * Copies of a TaskGroup refer to the same collection of tasks.
+     */
+    class TaskGroup {
+    public:
+        TaskGroup();
+
+        /**
+         * Marks the tasks of this group as cancelled. Tasks that have not started yet
+         * will be skipped, tasks that are already running are not interrupted but can
+         * check #isCancelled to return early. Tasks that are enqueued after the group
+         * was cancelled are skipped as well.
+         */
+        void cancel();
+
+        /**
+         * Returns whether #cancel has been called for this group.
+         */
+        bool isCancelled() const;
+
+        /**
+         * Returns the number of tasks of this group that have not finished yet.
+         */
+        size_t nOutstandingTasks() const;
+
+        /**
+         * Blocks until all tasks of this group have finished or were skipped. If this
+         * function is called from a worker of a TaskScheduler, that worker executes other
+         * tasks while it is waiting, so that waiting from inside a task cannot deadlock.
+         */
+        void wait() const;
+
+    private:
+        friend class TaskScheduler;
+
+        struct State {
+            std::atomic_bool isCancelled = false;
+            size_t nOutstanding = 0;
+            mutable std::mutex mutex;
+            std::condition_variable condition;
+        };
+        std::shared_ptr<State> _state;
+    };
+
+    /**
+     * Creates a new TaskScheduler with \p nThreads worker threads.
+     *
+     * \pre \p nThreads must be bigger than 0
+     */
+    explicit TaskScheduler(unsigned int nThreads);
+
+    /**
+     * Stops all workers after they finished their current task. Tasks that have not been
+     * started are discarded and count as finished for their TaskGroup.
+     */
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /**
+     * Adds the \p task to the scheduler to be executed by one of the workers.
+     *
+     * \param task The function that should be executed
+     * \param priority The priority of the task in relation to the other queued tasks
+     */
+    void enqueue(std::function<void()> task, Priority priority = Priority::Normal);
+
+    /**
+     * Adds the \p task to the scheduler to be executed by one of the workers as part of
+     * the provided \p group.
+     *
+     * \param task The function that should be executed
+     * \param priority The priority of the task in relation to the other queued tasks
+     * \param group The group to which the \p task is added
+     */
+    void enqueue(std::function<void()> task, Priority priority, const TaskGroup& group);
+
+    /**
+     * Calls the \p function once for every index in the range `[0, n)` and waits until
+     * all calls have finished. All but one of the calls are enqueued as a single
+     * TaskGroup, the call with index 0 is always executed by the calling thread. This
+     * makes it possible to run work that is bound to that thread alongside the other
+     * calls. If any of the calls throws an exception, the calls that have not started
+     * yet are skipped and the first exception is rethrown on the calling thread once all
+     * running calls have finished.
+     *
+     * \param n The number of times the \p function is called
+     * \param function The function that is called with each index
+     * \param priority The priority of the tasks in relation to the other queued tasks
+     */
+    void parallelFor(size_t n, const std::function<void(size_t)>& function,
+        Priority priority = Priority::Normal);
+
+    /**
+     * Returns the number of worker threads.
+     */
+    unsigned int nThreads() const;
+
+    /**
+     * Returns the number of tasks that have been enqueued but were not started yet.
+     */
+    size_t nQueuedTasks() const;
+
+private:
+    struct Task {
+        std::function<void()> function;
+        std::shared_ptr<TaskGroup::State> group;
+    };
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::array<std::deque<Task>, 3> tasks;
+    };
+
+    void push(Task task, Priority priority);
+    bool pop(unsigned int worker, Task& task);
+    void execute(Task& task);
+    void work(unsigned int worker);
+
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
+    std::vector<std::thread> _workers;
+
+    std::atomic<size_t> _nQueued = 0;
+    std::atomic<unsigned int> _nextQueue = 0;
+
+    std::mutex _sleepMutex;
+    std::condition_variable _sleepCondition;
+    bool _shouldStop = false;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_CORE___TASKSCHEDULER___H__
@@ -25,6 +25,7 @@
 #ifndef __OPENSPACE_CORE___TIMELINE___H__
 #define __OPENSPACE_CORE___TIMELINE___H__
 
+#include <atomic>
 #include <deque>
 
 namespace openspace {
@@ -54,13 +55,22 @@ struct Keyframe : public KeyframeBase {
 };
 
 /**
- * Templated class for timelines.
+ * Templated class for timelines. The position of the last keyframe that was found is
+ * remembered and used as the starting point for the next search, which makes the lookup
+ * of keyframes for successive timestamps, such as during playback, a constant time
+ * operation.
  */
 template <typename T>
 class Timeline {
 public:
+    Timeline() = default;
+    Timeline(const Timeline& other);
+    Timeline(Timeline&& other) noexcept;
     virtual ~Timeline() = default;
 
+    Timeline& operator=(const Timeline& other);
+    Timeline& operator=(Timeline&& other) noexcept;
+
     void addKeyframe(double time, const T& data);
     void addKeyframe(double time, T&& data);
     void clearKeyframes();
@@ -76,8 +86,19 @@ public:
     const std::deque<Keyframe<T>>& keyframes() const;
 
 private:
+    /**
+     * Returns the index of the first keyframe whose timestamp is not smaller than the
+     * \p timestamp or, if \p inclusive is `true`, the first keyframe whose timestamp is
+     * larger than the \p timestamp. The search starts at the result of the previous call.
+     */
+    size_t partitionPoint(double timestamp, bool inclusive) const;
+
     size_t _nextKeyframeId = 1;
     std::deque<Keyframe<T>> _keyframes;
+
+    /// The result of the last call to #partitionPoint, which is only used as a hint and
+    /// may be out of date when keyframes have been added or removed since then
+    mutable std::atomic<size_t> _cursor = 0;
 };
 
 /**
@@ -32,6 +32,36 @@ Keyframe<T>::Keyframe(size_t i, double t, T d)
     , data(std::move(d))
 {}
 
+template <typename T>
+Timeline<T>::Timeline(const Timeline& other)
+    : _nextKeyframeId(other._nextKeyframeId)
+    , _keyframes(other._keyframes)
+    , _cursor(other._cursor.load(std::memory_order_relaxed))
+{}
+
+template <typename T>
+Timeline<T>::Timeline(Timeline&& other) noexcept
+    : _nextKeyframeId(other._nextKeyframeId)
+    , _keyframes(std::move(other._keyframes))
+    , _cursor(other._cursor.load(std::memory_order_relaxed))
+{}
+
+template <typename T>
+Timeline<T>& Timeline<T>::operator=(const Timeline& other) {
+    _nextKeyframeId = other._nextKeyframeId;
+    _keyframes = other._keyframes;
+    _cursor = other._cursor.load(std::memory_order_relaxed);
+    return *this;
+}
+
+template <typename T>
+Timeline<T>& Timeline<T>::operator=(Timeline&& other) noexcept {
+    _nextKeyframeId = other._nextKeyframeId;
+    _keyframes = std::move(other._keyframes);
+    _cursor = other._cursor.load(std::memory_order_relaxed);
+    return *this;
+}
+
 template <typename T>
 void Timeline<T>::addKeyframe(double timestamp, T&& data) {
     _nextKeyframeId++;
@@ -173,56 +203,62 @@ size_t Timeline<T>::nKeyframes() const {
 template <typename T>
 const Keyframe<T>* Timeline<T>::firstKeyframeAfter(double timestamp, bool inclusive) const
 {
-    typename std::deque<Keyframe<T>>::const_iterator it;
-    if (inclusive) {
-        it = std::lower_bound(
-            _keyframes.begin(),
-            _keyframes.end(),
-            timestamp,
-            &compareKeyframeTimeWithTime
-        );
-    }
-    else {
-        it = std::upper_bound(
-            _keyframes.begin(),
-            _keyframes.end(),
-            timestamp,
-            &compareTimeWithKeyframeTime
-        );
-    }
-
-    if (it == _keyframes.end()) {
+    // The first keyframe after the timestamp is the first one that is not before it, so
+    // the meaning of inclusive is reversed compared to #lastKeyframeBefore
+    const size_t i = partitionPoint(timestamp, !inclusive);
+    if (i == _keyframes.size()) {
         return nullptr;
     }
-    return &(*it);
+    return &_keyframes[i];
 }
 
 template <typename T>
 const Keyframe<T>* Timeline<T>::lastKeyframeBefore(double timestamp, bool inclusive) const
 {
-    typename std::deque<Keyframe<T>>::const_iterator it;
-    if (inclusive) {
-        it = std::upper_bound(
-            _keyframes.begin(),
-            _keyframes.end(),
-            timestamp,
-            &compareTimeWithKeyframeTime
-        );
+    const size_t i = partitionPoint(timestamp, inclusive);
+    if (i == 0) {
+        return nullptr;
     }
-    else {
-        it = std::lower_bound(
+    return &_keyframes[i - 1];
+}
+
+template <typename T>
+size_t Timeline<T>::partitionPoint(double timestamp, bool inclusive) const {
+    auto isBefore = [timestamp, inclusive](const KeyframeBase& keyframe) {
+        return inclusive ?
+            keyframe.timestamp <= timestamp :
+            keyframe.timestamp < timestamp;
+    };
+
+    // The result is the index of the first keyframe that is not before the timestamp.
+    // Successive lookups usually end up at the same or the neighboring keyframe, so
+    // these are checked before falling back to a binary search
+    const size_t n = _keyframes.size();
+    size_t i = std::min(_cursor.load(std::memory_order_relaxed), n);
+    if (i < n && isBefore(_keyframes[i])) {
+        if (i + 1 == n || !isBefore(_keyframes[i + 1])) {
+            i = i + 1;
+        }
+        else {
+            const auto it = std::partition_point(
+                _keyframes.begin() + i + 2,
+                _keyframes.end(),
+                isBefore
+            );
+            i = static_cast<size_t>(std::distance(_keyframes.begin(), it));
+        }
+    }
+    else if (i > 0 && !isBefore(_keyframes[i - 1])) {
+        const auto it = std::partition_point(
             _keyframes.begin(),
-            _keyframes.end(),
-            timestamp,
-            &compareKeyframeTimeWithTime
+            _keyframes.begin() + i - 1,
+            isBefore
         );
+        i = static_cast<size_t>(std::distance(_keyframes.begin(), it));
     }
 
-    if (it == _keyframes.begin()) {
-        return nullptr;
-    }
-    it--;
-    return &(*it);
+    _cursor.store(i, std::memory_order_relaxed);
+    return i;
 }
 
 template <typename T>
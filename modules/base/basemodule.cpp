@@ -75,12 +75,14 @@
 #include <modules/base/rendering/screenspacetext.h>
 #include <modules/base/rendering/screenspacetimevaryingimageonline.h>
 #include <modules/base/rotation/constantrotation.h>
+#include <modules/base/rotation/expressionrotation.h>
 #include <modules/base/rotation/fixedrotation.h>
 #include <modules/base/rotation/globerotation.h>
 #include <modules/base/rotation/luarotation.h>
 #include <modules/base/rotation/multirotation.h>
 #include <modules/base/rotation/staticrotation.h>
 #include <modules/base/rotation/timelinerotation.h>
+#include <modules/base/scale/expressionscale.h>
 #include <modules/base/scale/luascale.h>
 #include <modules/base/scale/multiscale.h>
 #include <modules/base/scale/nonuniformstaticscale.h>
@@ -88,6 +90,7 @@
 #include <modules/base/scale/timedependentscale.h>
 #include <modules/base/scale/timelinescale.h>
 #include <modules/base/task/convertmodeltask.h>
+#include <modules/base/translation/expressiontranslation.h>
 #include <modules/base/translation/globetranslation.h>
 #include <modules/base/translation/luatranslation.h>
 #include <modules/base/translation/multitranslation.h>
@@ -213,6 +216,7 @@ void BaseModule::internalInitialize(const ghoul::Dictionary&) {
     ghoul_assert(fRotation, "Rotation factory was not created");
 
     fRotation->registerClass<ConstantRotation>("ConstantRotation");
+    fRotation->registerClass<ExpressionRotation>("ExpressionRotation");
     fRotation->registerClass<FixedRotation>("FixedRotation");
     fRotation->registerClass<GlobeRotation>("GlobeRotation");
     fRotation->registerClass<LuaRotation>("LuaRotation");
@@ -224,6 +228,7 @@ void BaseModule::internalInitialize(const ghoul::Dictionary&) {
     ghoul::TemplateFactory<Scale>* fScale = FactoryManager::ref().factory<Scale>();
     ghoul_assert(fScale, "Scale factory was not created");
 
+    fScale->registerClass<ExpressionScale>("ExpressionScale");
     fScale->registerClass<LuaScale>("LuaScale");
     fScale->registerClass<MultiScale>("MultiScale");
     fScale->registerClass<NonUniformStaticScale>("NonUniformStaticScale");
@@ -244,6 +249,7 @@ void BaseModule::internalInitialize(const ghoul::Dictionary&) {
         FactoryManager::ref().factory<Translation>();
     ghoul_assert(fTranslation, "Translation factory was not created");
 
+    fTranslation->registerClass<ExpressionTranslation>("ExpressionTranslation");
     fTranslation->registerClass<GlobeTranslation>("GlobeTranslation");
     fTranslation->registerClass<LuaTranslation>("LuaTranslation");
     fTranslation->registerClass<MultiTranslation>("MultiTranslation");
@@ -321,6 +327,7 @@ std::vector<Documentation> BaseModule::documentations() const {
         ScreenSpaceTimeVaryingImageOnline::Documentation(),
 
         ConstantRotation::Documentation(),
+        ExpressionRotation::Documentation(),
         FixedRotation::Documentation(),
         GlobeRotation::Documentation(),
         LuaRotation::Documentation(),
@@ -328,6 +335,7 @@ std::vector<Documentation> BaseModule::documentations() const {
         StaticRotation::Documentation(),
         TimelineRotation::Documentation(),
 
+        ExpressionScale::Documentation(),
         LuaScale::Documentation(),
         MultiScale::Documentation(),
         NonUniformStaticScale::Documentation(),
@@ -338,6 +346,7 @@ std::vector<Documentation> BaseModule::documentations() const {
         TimeFrameInterval::Documentation(),
         TimeFrameUnion::Documentation(),
 
+        ExpressionTranslation::Documentation(),
         GlobeTranslation::Documentation(),
         LuaTranslation::Documentation(),
         MultiTranslation::Documentation(),
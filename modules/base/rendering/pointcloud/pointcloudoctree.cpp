@@ -0,0 +1,352 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/base/rendering/pointcloud/pointcloudoctree.h>
+
+#include <openspace/engine/globals.h>
+#include <openspace/util/taskscheduler.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/profiling.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace {
+    using namespace openspace;
+
+    using Node = PointCloudOctree::Node;
+
+    // Scrambles the index of a point. Points of equal importance are ordered by this
+    // value, which results in a uniformly distributed subset of them in each node
+    uint32_t scramble(uint32_t i) {
+        i ^= i >> 16;
+        i *= 0x7feb352d;
+        i ^= i >> 15;
+        i *= 0x846ca68b;
+        i ^= i >> 16;
+        return i;
+    }
+
+    struct Builder {
+        std::span<const float> positions;
+        std::span<const float> importance;
+        std::span<uint32_t> order;
+        size_t maxPointsPerNode = 0;
+
+        float importanceOf(uint32_t i) const {
+            if (importance.empty() || std::isnan(importance[i])) {
+                return -std::numeric_limits<float>::infinity();
+            }
+            return importance[i];
+        }
+
+        // Returns whether point a should be stored closer to the root than point b
+        bool isMoreImportant(uint32_t a, uint32_t b) const {
+            const float ia = importanceOf(a);
+            const float ib = importanceOf(b);
+            if (ia != ib) {
+                return ia > ib;
+            }
+            const uint32_t sa = scramble(a);
+            const uint32_t sb = scramble(b);
+            return sa != sb ? sa < sb : a < b;
+        }
+
+        int octant(uint32_t i, const glm::vec3& center) const {
+            return (positions[3 * i] >= center.x ? 1 : 0) |
+                   (positions[3 * i + 1] >= center.y ? 2 : 0) |
+                   (positions[3 * i + 2] >= center.z ? 4 : 0);
+        }
+
+        // Creates the subtree for the points in the order between first and last and
+        // appends its nodes in pre-order to the list of nodes. Returns the index of the
+        // root of the subtree in that list
+        int32_t build(size_t first, size_t last, const glm::vec3& center, float halfSize,
+                      int depth, std::vector<Node>& nodes, bool parallel) const
+        {
+            const int32_t index = static_cast<int32_t>(nodes.size());
+            Node node;
+            node.center = center;
+            node.halfSize = halfSize;
+            node.first = static_cast<uint32_t>(first);
+            node.subtreeEnd = static_cast<uint32_t>(last);
+
+            if (last - first <= maxPointsPerNode ||
+                depth >= PointCloudOctree::MaxDepth)
+            {
+                node.count = static_cast<uint32_t>(last - first);
+                nodes.push_back(node);
+                return index;
+            }
+
+            // Move the most important points to the front, which are kept in this node.
+            // Sorting them by their index afterwards improves the locality when rendering
+            const size_t own = first + maxPointsPerNode;
+            std::nth_element(
+                order.begin() + first,
+                order.begin() + own,
+                order.begin() + last,
+                [this](uint32_t a, uint32_t b) { return isMoreImportant(a, b); }
+            );
+            std::sort(order.begin() + first, order.begin() + own);
+            node.count = static_cast<uint32_t>(maxPointsPerNode);
+            nodes.push_back(node);
+
+            // Distribute the remaining points to the children with a counting sort
+            std::array<size_t, 8> counts = {};
+            for (size_t i = own; i < last; i++) {
+                counts[octant(order[i], center)]++;
+            }
+            std::array<size_t, 9> starts = {};
+            starts[0] = own;
+            for (int i = 0; i < 8; i++) {
+                starts[i + 1] = starts[i] + counts[i];
+            }
+            const std::vector<uint32_t> rest = std::vector<uint32_t>(
+                order.begin() + own,
+                order.begin() + last
+            );
+            std::array<size_t, 8> next = {};
+            std::copy(starts.begin(), starts.begin() + 8, next.begin());
+            for (const uint32_t i : rest) {
+                order[next[octant(i, center)]++] = i;
+            }
+
+            const float childHalfSize = halfSize / 2.f;
+            auto childCenter = [&center, childHalfSize](int oct) {
+                return center + glm::vec3(
+                    (oct & 1) ? childHalfSize : -childHalfSize,
+                    (oct & 2) ? childHalfSize : -childHalfSize,
+                    (oct & 4) ? childHalfSize : -childHalfSize
+                );
+            };
+
+            if (parallel) {
+                // The children cover disjoint ranges of the order, so their subtrees can
+                // be created independently and are then appended to the list of nodes
+                std::array<std::vector<Node>, 8> subtrees;
+                global::taskScheduler->parallelFor(
+                    8,
+                    [&](size_t oct) {
+                        if (counts[oct] > 0) {
+                            build(
+                                starts[oct],
+                                starts[oct + 1],
+                                childCenter(static_cast<int>(oct)),
+                                childHalfSize,
+                                depth + 1,
+                                subtrees[oct],
+                                false
+                            );
+                        }
+                    },
+                    TaskScheduler::Priority::High
+                );
+
+                for (int oct = 0; oct < 8; oct++) {
+                    if (counts[oct] == 0) {
+                        continue;
+                    }
+                    const int32_t offset = static_cast<int32_t>(nodes.size());
+                    for (Node n : subtrees[oct]) {
+                        for (int32_t& child : n.children) {
+                            child = child >= 0 ? child + offset : child;
+                        }
+                        nodes.push_back(n);
+                    }
+                    nodes[index].children[oct] = offset;
+                }
+            }
+            else {
+                for (int oct = 0; oct < 8; oct++) {
+                    if (counts[oct] == 0) {
+                        continue;
+                    }
+                    const int32_t child = build(
+                        starts[oct],
+                        starts[oct + 1],
+                        childCenter(oct),
+                        childHalfSize,
+                        depth + 1,
+                        nodes,
+                        false
+                    );
+                    nodes[index].children[oct] = child;
+                }
+            }
+
+            return index;
+        }
+    };
+} // namespace
+
+namespace openspace {
+
+void PointCloudOctree::build(std::span<const float> positions,
+                             std::span<const float> importance,
+                             std::span<const Range> ranges, size_t maxPointsPerNode)
+{
+    ZoneScoped;
+
+    ghoul_assert(positions.size() % 3 == 0, "Positions must have three values");
+    ghoul_assert(
+        importance.empty() || importance.size() * 3 == positions.size(),
+        "Importance must be empty or have one value per point"
+    );
+    ghoul_assert(maxPointsPerNode > 0, "Nodes must be able to store points");
+
+    const size_t nPoints = positions.size() / 3;
+    _order = std::vector<uint32_t>(nPoints);
+    std::iota(_order.begin(), _order.end(), 0);
+    _nodes.clear();
+    _roots.clear();
+
+    std::vector<Range> allPoints;
+    if (ranges.empty()) {
+        allPoints.push_back({ 0, nPoints });
+        ranges = allPoints;
+    }
+
+    const Builder builder = {
+        .positions = positions,
+        .importance = importance,
+        .order = _order,
+        .maxPointsPerNode = maxPointsPerNode
+    };
+    for (const Range& range : ranges) {
+        ghoul_assert(range.first + range.count <= nPoints, "Range out of bounds");
+
+        // Find the cube that contains all points of this range
+        glm::vec3 minPos = glm::vec3(std::numeric_limits<float>::max());
+        glm::vec3 maxPos = glm::vec3(-std::numeric_limits<float>::max());
+        for (size_t i = range.first; i < range.first + range.count; i++) {
+            for (int c = 0; c < 3; c++) {
+                const float v = positions[3 * i + c];
+                if (std::isfinite(v)) {
+                    minPos[c] = std::min(minPos[c], v);
+                    maxPos[c] = std::max(maxPos[c], v);
+                }
+            }
+        }
+        if (range.count == 0 || minPos.x > maxPos.x) {
+            _roots.push_back(-1);
+            continue;
+        }
+
+        const glm::vec3 center = (minPos + maxPos) * 0.5f;
+        const glm::vec3 extent = maxPos - minPos;
+        // Enlarge the cube slightly so that no point lies exactly on its boundary
+        const float halfSize =
+            0.5f * std::max({ extent.x, extent.y, extent.z }) * 1.001f +
+            std::numeric_limits<float>::min();
+
+        _roots.push_back(builder.build(
+            range.first,
+            range.first + range.count,
+            center,
+            halfSize,
+            0,
+            _nodes,
+            true
+        ));
+    }
+}
+
+size_t PointCloudOctree::select(size_t tree, const glm::dvec3& cameraPosition,
+                                std::span<const glm::dvec4> frustum,
+                                double minAngularSize, std::vector<Range>& result) const
+{
+    ZoneScoped;
+
+    if (tree >= _roots.size() || _roots[tree] < 0) {
+        return 0;
+    }
+
+    // The children are put on the stack in reverse order, so that the nodes are visited
+    // in pre-order, which is the order in which their points are stored
+    size_t nSelected = 0;
+    std::vector<int32_t> stack = { _roots[tree] };
+    while (!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        const glm::dvec3 center = glm::dvec3(node.center);
+        const double radius = std::sqrt(3.0) * static_cast<double>(node.halfSize);
+
+        const bool isCulled = std::any_of(
+            frustum.begin(),
+            frustum.end(),
+            [&center, radius](const glm::dvec4& plane) {
+                return glm::dot(glm::dvec3(plane), center) + plane.w < -radius;
+            }
+        );
+        if (isCulled) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            const bool isAdjacent = !result.empty() &&
+                result.back().first + result.back().count == node.first;
+            if (isAdjacent) {
+                result.back().count += node.count;
+            }
+            else {
+                result.push_back({ node.first, node.count });
+            }
+            nSelected += node.count;
+        }
+
+        const double distance = glm::distance(center, cameraPosition);
+        const bool shouldRefine =
+            distance <= radius || radius / distance > minAngularSize;
+        if (shouldRefine) {
+            for (auto it = node.children.rbegin(); it != node.children.rend(); it++) {
+                if (*it >= 0) {
+                    stack.push_back(*it);
+                }
+            }
+        }
+    }
+
+    return nSelected;
+}
+
+std::span<const uint32_t> PointCloudOctree::order() const {
+    return _order;
+}
+
+std::span<const PointCloudOctree::Node> PointCloudOctree::nodes() const {
+    return _nodes;
+}
+
+int32_t PointCloudOctree::root(size_t tree) const {
+    return tree < _roots.size() ? _roots[tree] : -1;
+}
+
+size_t PointCloudOctree::nTrees() const {
+    return _roots.size();
+}
+
+} // namespace openspace
@@ -0,0 +1,154 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_BASE___POINTCLOUDOCTREE___H__
+#define __OPENSPACE_MODULE_BASE___POINTCLOUDOCTREE___H__
+
+#include <ghoul/glm.h>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A spatial index for the points of a point cloud that is used to only render the points
+ * that contribute to the image. Each node of the octree covers a cubic region of space
+ * and stores the most important points of that region, for example the brightest or the
+ * largest ones, while the remaining points are distributed to its children. Close to the
+ * root of the tree, a node thus contains a sparse but representative subset of the points
+ * in its region, which gets denser the further down the tree the nodes are.
+ *
+ * The octree does not store the points themselves, but an order of the point indices in
+ * which the points of each node and of each subtree are contiguous. Uploading this order
+ * as an index buffer makes it possible to draw a selection of nodes with only a few draw
+ * calls. The points can be split into multiple independent ranges, for example one per
+ * texture array, and a separate tree is created for each of them.
+ */
+class PointCloudOctree {
+public:
+    /// The maximum depth of the tree. Nodes at this depth store all of their points, even
+    /// if there are more than the requested maximum number of points per node
+    static constexpr int MaxDepth = 16;
+
+    struct Range {
+        size_t first = 0;
+        size_t count = 0;
+    };
+
+    struct Node {
+        /// The center of the cube that is covered by this node
+        glm::vec3 center = glm::vec3(0.f);
+        /// Half of the side length of the cube that is covered by this node
+        float halfSize = 0.f;
+
+        /// The index of the first point stored in this node in the #order
+        uint32_t first = 0;
+        /// The number of points that are stored in this node
+        uint32_t count = 0;
+        /// The index in the #order after the last point of this node and all of its
+        /// descendants
+        uint32_t subtreeEnd = 0;
+
+        /// The indices of the child nodes, or -1 if the child does not exist
+        std::array<int32_t, 8> children = { -1, -1, -1, -1, -1, -1, -1, -1 };
+    };
+
+    /**
+     * Creates the octree for the provided points, replacing any previous tree. The
+     * points in each of the \p ranges are sorted into a separate tree and only reordered
+     * within their range.
+     *
+     * \param positions The positions of all points, with three values per point
+     * \param importance The importance of each point, where points with a higher value
+     *        are stored closer to the root. If this is empty, all points are equally
+     *        important and a uniform subset of them is stored in each node
+     * \param ranges The ranges of points that should be placed in separate trees. If it
+     *        is empty, a single tree is created for all points
+     * \param maxPointsPerNode The maximum number of points that are stored in a node
+     *        before the remaining points are distributed to its children
+     *
+     * \pre The size of \p positions must be a multiple of 3
+     * \pre \p importance must be empty or contain one value per point
+     * \pre \p maxPointsPerNode must be positive
+     */
+    void build(std::span<const float> positions, std::span<const float> importance,
+        std::span<const Range> ranges, size_t maxPointsPerNode);
+
+    /**
+     * Selects the points of the \p tree that contribute to an image rendered from the
+     * \p cameraPosition. A node is skipped, including all of its descendants, if it is
+     * completely outside of any of the \p frustum planes. The children of a visible node
+     * are only considered if the node appears larger than the \p minAngularSize. The
+     * selected points are appended to the \p result as ranges in the #order, where
+     * adjacent ranges are merged.
+     *
+     * \param tree The index of the tree, which corresponds to the index of the range
+     *        that was passed to #build
+     * \param cameraPosition The position of the camera in the coordinate system of the
+     *        points
+     * \param frustum The planes of the view frustum in the coordinate system of the
+     *        points. The xyz components are the normalized normal pointing into the
+     *        frustum and w is the distance. If this is empty, no culling is performed
+     * \param minAngularSize The angular radius in radians a node must have for its
+     *        children to be considered
+     * \param result The list to which the selected ranges are appended
+     * \return The number of points that were selected
+     */
+    size_t select(size_t tree, const glm::dvec3& cameraPosition,
+        std::span<const glm::dvec4> frustum, double minAngularSize,
+        std::vector<Range>& result) const;
+
+    /**
+     * Returns the order of the point indices in which the points of each node and each
+     * subtree are contiguous.
+     */
+    std::span<const uint32_t> order() const;
+
+    /**
+     * Returns all nodes of all trees.
+     */
+    std::span<const Node> nodes() const;
+
+    /**
+     * Returns the index of the root node of the provided \p tree, or -1 if the tree does
+     * not contain any points.
+     */
+    int32_t root(size_t tree) const;
+
+    /**
+     * Returns the number of trees.
+     */
+    size_t nTrees() const;
+
+private:
+    std::vector<uint32_t> _order;
+    std::vector<Node> _nodes;
+    std::vector<int32_t> _roots;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_BASE___POINTCLOUDOCTREE___H__
@@ -0,0 +1,388 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/base/rendering/pointcloud/pointdataslice.h>
+
+#include <openspace/engine/globals.h>
+#include <openspace/util/taskscheduler.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/exception.h>
+#include <ghoul/misc/profiling.h>
+#include <glm/gtx/quaternion.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    using namespace openspace;
+
+    using Attribute = PointDataSlice::Attribute;
+    using Layout = PointDataSlice::Layout;
+    using TextureLayer = PointDataSlice::TextureLayer;
+
+    // Calls the function for each block of points on the workers of the task scheduler.
+    // The function is called with the index of the first point of the block and the
+    // number of points
+    template <typename Func>
+    void forEachBlock(size_t nPoints, const Func& func) {
+        const size_t nBlocks =
+            (nPoints + PointDataSlice::BlockSize - 1) / PointDataSlice::BlockSize;
+        global::taskScheduler->parallelFor(
+            nBlocks,
+            [&func, nPoints](size_t block) {
+                const size_t first = block * PointDataSlice::BlockSize;
+                func(first, std::min(PointDataSlice::BlockSize, nPoints - first));
+            },
+            TaskScheduler::Priority::High
+        );
+    }
+
+    TextureLayer textureLayer(const Layout& layout, float textureId) {
+        const auto it = layout.textures.find(static_cast<int>(textureId));
+        return it != layout.textures.end() ? it->second : layout.defaultTexture;
+    }
+} // namespace
+
+namespace openspace {
+
+PointDataSlice::UpdateResult PointDataSlice::update(
+                                               const dataloader::ColumnarDataset& dataset,
+                                                     size_t nPoints, const Layout& layout)
+{
+    ZoneScoped;
+
+    ghoul_assert(nPoints <= dataset.nEntries(), "Too many points requested");
+
+    const std::array<bool, NAttributes> hasAttribute = {
+        true,
+        layout.colorParameterIndex >= 0,
+        layout.sizeParameterIndex >= 0,
+        layout.orientationIndex >= 0,
+        layout.hasTextureLayer
+    };
+
+    // The order of the points only depends on how they are assigned to texture arrays
+    const bool orderChanged = !_isValid || nPoints != _nPoints ||
+        layout.textureIndex != _layout.textureIndex ||
+        layout.textures != _layout.textures ||
+        layout.defaultTexture != _layout.defaultTexture ||
+        layout.nTextureArrays != _layout.nTextureArrays;
+    const bool sizeChanged = !_isValid || nPoints != _nPoints ||
+        hasAttribute != _hasAttribute;
+
+    const bool transformChanged = layout.unitScale != _layout.unitScale ||
+        layout.transformation != _layout.transformation;
+    std::array<bool, NAttributes> isDirty = {
+        transformChanged,
+        layout.colorParameterIndex != _layout.colorParameterIndex,
+        layout.sizeParameterIndex != _layout.sizeParameterIndex ||
+            layout.sizeMultiplier != _layout.sizeMultiplier,
+        transformChanged || layout.orientationIndex != _layout.orientationIndex,
+        layout.hasTextureLayer != _layout.hasTextureLayer
+    };
+    for (int i = 0; i < NAttributes; i++) {
+        isDirty[i] = isDirty[i] || orderChanged || !_hasAttribute[i];
+    }
+
+    _layout = layout;
+    _nPoints = nPoints;
+    if (orderChanged) {
+        computeOrder(dataset);
+    }
+
+    UpdateResult result;
+    if (sizeChanged) {
+        // Move the columns that are still valid to their new location and leave room
+        // for the ones that have to be recomputed
+        std::array<size_t, NAttributes> offsets = {};
+        size_t size = 0;
+        for (int i = 0; i < NAttributes; i++) {
+            offsets[i] = size;
+            if (hasAttribute[i]) {
+                size += nValues(static_cast<Attribute>(i)) * _nPoints;
+            }
+        }
+
+        std::vector<float> data = std::vector<float>(size);
+        for (int i = 0; i < NAttributes; i++) {
+            if (hasAttribute[i] && !isDirty[i]) {
+                const std::span<const float> c = column(static_cast<Attribute>(i));
+                std::copy(c.begin(), c.end(), data.begin() + offsets[i]);
+            }
+        }
+
+        _data = std::move(data);
+        _offsets = offsets;
+        _hasAttribute = hasAttribute;
+        result.needsReallocation = true;
+    }
+
+    for (int i = 0; i < NAttributes; i++) {
+        if (hasAttribute[i] && isDirty[i]) {
+            computeColumn(dataset, static_cast<Attribute>(i));
+            result.changedAttributes.push_back(static_cast<Attribute>(i));
+        }
+    }
+
+    _isValid = true;
+    return result;
+}
+
+void PointDataSlice::invalidate() {
+    _isValid = false;
+}
+
+std::span<const float> PointDataSlice::data() const {
+    return _data;
+}
+
+std::span<const float> PointDataSlice::column(Attribute attribute) const {
+    if (!hasAttribute(attribute)) {
+        return std::span<const float>();
+    }
+
+    return std::span<const float>(
+        _data.data() + columnOffset(attribute),
+        nValues(attribute) * _nPoints
+    );
+}
+
+bool PointDataSlice::hasAttribute(Attribute attribute) const {
+    return _hasAttribute[static_cast<int>(attribute)];
+}
+
+size_t PointDataSlice::columnOffset(Attribute attribute) const {
+    return _offsets[static_cast<int>(attribute)];
+}
+
+int PointDataSlice::nValues(Attribute attribute) {
+    switch (attribute) {
+        case Attribute::Position:       return 3;
+        case Attribute::ColorParameter: return 1;
+        case Attribute::SizeParameter:  return 1;
+        case Attribute::Orientation:    return 4;
+        case Attribute::TextureLayer:   return 1;
+        default:                        throw ghoul::MissingCaseException();
+    }
+}
+
+std::span<const PointDataSlice::Range> PointDataSlice::textureArrayRanges() const {
+    return _ranges;
+}
+
+size_t PointDataSlice::nPoints() const {
+    return _nPoints;
+}
+
+double PointDataSlice::maxRadius() const {
+    return _maxRadius;
+}
+
+glm::quat PointDataSlice::orientationQuaternion(const glm::dmat4& transformation,
+                                                const float* uv)
+{
+    const glm::vec3 u = glm::normalize(glm::vec3(
+        transformation * glm::dvec4(uv[0], uv[1], uv[2], 1.f)
+    ));
+    const glm::vec3 v = glm::normalize(glm::vec3(
+        transformation * glm::dvec4(uv[3], uv[4], uv[5], 1.f)
+    ));
+
+    // First rotate to align the z-axis with plane normal
+    const glm::vec3 planeNormal = glm::normalize(glm::cross(u, v));
+    glm::quat q = glm::normalize(glm::rotation(glm::vec3(0.f, 0.f, 1.f), planeNormal));
+
+    // Add rotation around plane normal (rotate new x-axis to u)
+    const glm::vec3 rotatedRight = glm::normalize(
+        glm::vec3(glm::mat4_cast(q) * glm::vec4(1.f, 0.f, 0.f, 1.f))
+    );
+    q = glm::normalize(glm::rotation(rotatedRight, u)) * q;
+
+    return q;
+}
+
+void PointDataSlice::computeOrder(const dataloader::ColumnarDataset& dataset) {
+    ZoneScoped;
+
+    const unsigned int nArrays = std::max(_layout.nTextureArrays, 1u);
+    _order.clear();
+    _ranges = std::vector<Range>(nArrays);
+
+    if (_layout.textureIndex < 0) {
+        // All points use the same texture array, so the order of the entries is kept
+        const unsigned int id = std::min(_layout.defaultTexture.arrayId, nArrays - 1);
+        _ranges[id] = { 0, _nPoints };
+        return;
+    }
+
+    const std::span<const float> textureIds = dataset.column(_layout.textureIndex);
+    std::vector<unsigned int> arrayIds = std::vector<unsigned int>(_nPoints);
+    forEachBlock(_nPoints, [&](size_t first, size_t n) {
+        for (size_t i = first; i < first + n; i++) {
+            const TextureLayer t = textureLayer(_layout, textureIds[i]);
+            arrayIds[i] = std::min(t.arrayId, nArrays - 1);
+        }
+    });
+
+    // Counting sort of the points by their texture array, which keeps the relative order
+    // of the points that use the same texture array
+    for (const unsigned int arrayId : arrayIds) {
+        _ranges[arrayId].count++;
+    }
+    std::vector<size_t> next = std::vector<size_t>(nArrays);
+    size_t first = 0;
+    for (unsigned int i = 0; i < nArrays; i++) {
+        _ranges[i].first = first;
+        next[i] = first;
+        first += _ranges[i].count;
+    }
+
+    _order.resize(_nPoints);
+    for (size_t i = 0; i < _nPoints; i++) {
+        _order[next[arrayIds[i]]++] = static_cast<unsigned int>(i);
+    }
+}
+
+void PointDataSlice::computeColumn(const dataloader::ColumnarDataset& dataset,
+                                   Attribute attribute)
+{
+    ZoneScoped;
+
+    float* column = _data.data() + columnOffset(attribute);
+
+    switch (attribute) {
+        case Attribute::Position:
+        {
+            const std::span<const glm::vec3> positions = dataset.positions();
+            const glm::dmat4& m = _layout.transformation;
+            const double unitScale = _layout.unitScale;
+
+            std::vector<double> radii = std::vector<double>(_nPoints / BlockSize + 1);
+            forEachBlock(_nPoints, [&](size_t first, size_t n) {
+                // Gather the positions first so that the transformation is computed in a
+                // loop over contiguous values that the compiler can vectorize
+                std::vector<double> x = std::vector<double>(n);
+                std::vector<double> y = std::vector<double>(n);
+                std::vector<double> z = std::vector<double>(n);
+                for (size_t i = 0; i < n; i++) {
+                    const glm::vec3& p = positions[entryIndex(first + i)];
+                    x[i] = static_cast<double>(p.x) * unitScale;
+                    y[i] = static_cast<double>(p.y) * unitScale;
+                    z[i] = static_cast<double>(p.z) * unitScale;
+                }
+
+                float* dst = column + 3 * first;
+                double maxRadius2 = 0.0;
+                for (size_t i = 0; i < n; i++) {
+                    const double tx =
+                        m[0][0] * x[i] + m[1][0] * y[i] + m[2][0] * z[i] + m[3][0];
+                    const double ty =
+                        m[0][1] * x[i] + m[1][1] * y[i] + m[2][1] * z[i] + m[3][1];
+                    const double tz =
+                        m[0][2] * x[i] + m[1][2] * y[i] + m[2][2] * z[i] + m[3][2];
+                    dst[3 * i] = static_cast<float>(tx);
+                    dst[3 * i + 1] = static_cast<float>(ty);
+                    dst[3 * i + 2] = static_cast<float>(tz);
+                    maxRadius2 = std::max(maxRadius2, tx * tx + ty * ty + tz * tz);
+                }
+                radii[first / BlockSize] = std::sqrt(maxRadius2);
+            });
+
+            _maxRadius = *std::max_element(radii.begin(), radii.end());
+            break;
+        }
+        case Attribute::ColorParameter:
+        {
+            const std::span<const float> values =
+                dataset.column(_layout.colorParameterIndex);
+            forEachBlock(_nPoints, [&](size_t first, size_t n) {
+                for (size_t i = first; i < first + n; i++) {
+                    column[i] = values[entryIndex(i)];
+                }
+            });
+            break;
+        }
+        case Attribute::SizeParameter:
+        {
+            const std::span<const float> values =
+                dataset.column(_layout.sizeParameterIndex);
+            const float multiplier = _layout.sizeMultiplier;
+            forEachBlock(_nPoints, [&](size_t first, size_t n) {
+                for (size_t i = first; i < first + n; i++) {
+                    column[i] = multiplier * values[entryIndex(i)];
+                }
+            });
+            break;
+        }
+        case Attribute::Orientation:
+        {
+            // The two vectors spanning the plane are stored in six consecutive columns
+            std::array<std::span<const float>, 6> uv;
+            for (size_t j = 0; j < uv.size(); j++) {
+                uv[j] = dataset.column(_layout.orientationIndex + j);
+            }
+            forEachBlock(_nPoints, [&](size_t first, size_t n) {
+                for (size_t i = first; i < first + n; i++) {
+                    const size_t e = entryIndex(i);
+                    const std::array<float, 6> values = {
+                        uv[0][e], uv[1][e], uv[2][e], uv[3][e], uv[4][e], uv[5][e]
+                    };
+                    const glm::quat q = orientationQuaternion(
+                        _layout.transformation,
+                        values.data()
+                    );
+                    column[4 * i] = q.x;
+                    column[4 * i + 1] = q.y;
+                    column[4 * i + 2] = q.z;
+                    column[4 * i + 3] = q.w;
+                }
+            });
+            break;
+        }
+        case Attribute::TextureLayer:
+        {
+            if (_layout.textureIndex < 0) {
+                const float layer = static_cast<float>(_layout.defaultTexture.layer);
+                std::fill_n(column, _nPoints, layer);
+                break;
+            }
+
+            const std::span<const float> ids = dataset.column(_layout.textureIndex);
+            forEachBlock(_nPoints, [&](size_t first, size_t n) {
+                for (size_t i = first; i < first + n; i++) {
+                    const TextureLayer t = textureLayer(_layout, ids[entryIndex(i)]);
+                    column[i] = static_cast<float>(t.layer);
+                }
+            });
+            break;
+        }
+        default:
+            throw ghoul::MissingCaseException();
+    }
+}
+
+size_t PointDataSlice::entryIndex(size_t i) const {
+    return _order.empty() ? i : _order[i];
+}
+
+} // namespace openspace
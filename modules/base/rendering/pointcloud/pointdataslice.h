@@ -0,0 +1,234 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_BASE___POINTDATASLICE___H__
+#define __OPENSPACE_MODULE_BASE___POINTDATASLICE___H__
+
+#include <openspace/data/dataloader.h>
+#include <ghoul/glm.h>
+#include <array>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Builds the vertex data of a point cloud from a columnar dataset. Instead of
+ * interleaving all attributes of a point, each attribute is stored in its own contiguous
+ * column, which makes it possible to recompute and upload only the attributes that have
+ * actually changed, for example when the color parameter is switched. As only the data
+ * columns that are referenced by the layout are read, the remaining columns of a
+ * memory-mapped dataset are never loaded from disk. The points are ordered by the texture
+ * array they use, so that each texture array can be drawn with a single draw call.
+ *
+ * Which attributes are created and from which data columns they are taken is described
+ * by a Layout. On every call to #update, the provided layout is compared to the layout
+ * that was used to create the current data and only the affected columns are rebuilt.
+ * The columns are computed in blocks on the workers of the global TaskScheduler without
+ * any access to OpenGL.
+ */
+class PointDataSlice {
+public:
+    /// The attributes that can be part of the data, in the order in which their columns
+    /// are stored
+    enum class Attribute {
+        Position = 0,
+        ColorParameter,
+        SizeParameter,
+        Orientation,
+        TextureLayer
+    };
+    static constexpr int NAttributes = 5;
+
+    /// The number of points that are processed together by one task
+    static constexpr size_t BlockSize = 4096;
+
+    struct TextureLayer {
+        unsigned int arrayId = 0;
+        unsigned int layer = 0;
+
+        bool operator==(const TextureLayer&) const = default;
+    };
+
+    /**
+     * The description of the attributes that should be created for each point.
+     */
+    struct Layout {
+        /// The factor that converts the positions in the dataset into meters
+        double unitScale = 1.0;
+        /// The transformation that is applied to the positions and orientations after
+        /// the unit conversion
+        glm::dmat4 transformation = glm::dmat4(1.0);
+
+        /// The index of the data column that is used as the color parameter, or -1 if
+        /// the points do not have a color parameter
+        int colorParameterIndex = -1;
+        /// The index of the data column that is used as the size parameter, or -1 if the
+        /// points do not have a size parameter
+        int sizeParameterIndex = -1;
+        /// The factor that is applied to the size parameter
+        float sizeMultiplier = 1.f;
+        /// The index of the first of the six data columns that contain the two vectors
+        /// spanning the plane of each point, or -1 if no orientation is used
+        int orientationIndex = -1;
+
+        /// Whether a texture layer is created for each point
+        bool hasTextureLayer = false;
+        /// The index of the data column that contains the texture id of each point. If
+        /// it is -1, all points use the #defaultTexture
+        int textureIndex = -1;
+        /// The texture array and layer for each texture id used in the data
+        std::unordered_map<int, TextureLayer> textures;
+        /// The texture that is used for points without a texture id or whose texture id
+        /// is not part of #textures
+        TextureLayer defaultTexture;
+        /// The number of texture arrays that the points are distributed into
+        unsigned int nTextureArrays = 1;
+
+        bool operator==(const Layout&) const = default;
+    };
+
+    /**
+     * The range of points that use the same texture array.
+     */
+    struct Range {
+        size_t first = 0;
+        size_t count = 0;
+    };
+
+    /**
+     * Describes what has changed in the last call to #update.
+     */
+    struct UpdateResult {
+        /// If this is `true`, the size of the data or the location of the columns has
+        /// changed and all of the data has to be uploaded again
+        bool needsReallocation = false;
+        /// The list of attributes whose values have changed. If #needsReallocation is
+        /// `false`, only these columns have to be uploaded again
+        std::vector<Attribute> changedAttributes;
+    };
+
+    /**
+     * Updates the data for the first \p nPoints entries of the \p dataset based on the
+     * provided \p layout. Only the columns that are affected by the difference between
+     * \p layout and the layout that was used in the previous call are recomputed. If
+     * the contents of \p dataset have changed, #invalidate has to be called first.
+     *
+     * \param dataset The dataset from which the data is created
+     * \param nPoints The number of entries of the dataset that should be used
+     * \param layout The description of the attributes that should be created
+     * \return A description of the parts of the data that have changed
+     *
+     * \pre \p nPoints must not be bigger than the number of entries in \p dataset
+     */
+    UpdateResult update(const dataloader::ColumnarDataset& dataset, size_t nPoints,
+        const Layout& layout);
+
+    /**
+     * Marks all data as invalid so that everything is recomputed in the next call to
+     * #update.
+     */
+    void invalidate();
+
+    /**
+     * Returns the data of all columns, one after the other.
+     */
+    std::span<const float> data() const;
+
+    /**
+     * Returns the values of the column for the provided \p attribute, which is empty if
+     * the attribute is not part of the current layout.
+     */
+    std::span<const float> column(Attribute attribute) const;
+
+    /**
+     * Returns whether the provided \p attribute is part of the current layout.
+     */
+    bool hasAttribute(Attribute attribute) const;
+
+    /**
+     * Returns the offset of the column for the provided \p attribute in number of floats
+     * from the beginning of #data.
+     */
+    size_t columnOffset(Attribute attribute) const;
+
+    /**
+     * Returns the number of values that each point has for the provided \p attribute.
+     */
+    static int nValues(Attribute attribute);
+
+    /**
+     * Returns the ranges of points that use the same texture array, one per texture
+     * array.
+     */
+    std::span<const Range> textureArrayRanges() const;
+
+    /**
+     * Returns the number of points in the current data.
+     */
+    size_t nPoints() const;
+
+    /**
+     * Returns the largest distance of any transformed point from the origin.
+     */
+    double maxRadius() const;
+
+    /**
+     * Returns the index of the entry in the dataset from which the point at index \p i
+     * was created.
+     */
+    size_t entryIndex(size_t i) const;
+
+    /**
+     * Computes the rotation from the XY plane to the plane that is spanned by the two
+     * vectors that are stored in the six values starting at \p uv after applying the
+     * \p transformation to them.
+     */
+    static glm::quat orientationQuaternion(const glm::dmat4& transformation,
+        const float* uv);
+
+private:
+    void computeOrder(const dataloader::ColumnarDataset& dataset);
+    void computeColumn(const dataloader::ColumnarDataset& dataset, Attribute attribute);
+
+    Layout _layout;
+    bool _isValid = false;
+    size_t _nPoints = 0;
+
+    /// The entry index for each point, sorted by texture array. If it is empty, the
+    /// points are in the same order as the entries
+    std::vector<unsigned int> _order;
+    std::vector<Range> _ranges;
+
+    std::vector<float> _data;
+    std::array<bool, NAttributes> _hasAttribute = {};
+    std::array<size_t, NAttributes> _offsets = {};
+
+    double _maxRadius = 0.0;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_BASE___POINTDATASLICE___H__
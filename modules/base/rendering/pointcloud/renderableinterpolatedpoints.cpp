@@ -387,11 +387,8 @@ void RenderableInterpolatedPoints::addPositionDataForPoint(unsigned int index,
 {
     auto [firstIndex, secondIndex] = interpolationIndices(index);
 
-    const dataloader::Dataset::Entry& e0 = _dataset.entries[firstIndex];
-    const dataloader::Dataset::Entry& e1 = _dataset.entries[secondIndex];
-
-    glm::dvec3 position0 = transformedPosition(e0);
-    glm::dvec3 position1 = transformedPosition(e1);
+    glm::dvec3 position0 = transformedPosition(firstIndex);
+    glm::dvec3 position1 = transformedPosition(secondIndex);
 
     const double r = std::max(glm::length(position0), glm::length(position1));
     maxRadius = std::max(maxRadius, r);
@@ -415,10 +412,8 @@ void RenderableInterpolatedPoints::addPositionDataForPoint(unsigned int index,
             maxAllowedindex
         );
 
-        const dataloader::Dataset::Entry& e00 = _dataset.entries[beforeIndex];
-        const dataloader::Dataset::Entry& e11 = _dataset.entries[afterIndex];
-        glm::dvec3 positionBefore = transformedPosition(e00);
-        glm::dvec3 positionAfter = transformedPosition(e11);
+        glm::dvec3 positionBefore = transformedPosition(beforeIndex);
+        glm::dvec3 positionAfter = transformedPosition(afterIndex);
 
         for (int j = 0; j < 3; j++) {
             result.push_back(static_cast<float>(positionBefore[j]));
@@ -434,13 +429,12 @@ void RenderableInterpolatedPoints::addColorAndSizeDataForPoint(unsigned int inde
                                                         std::vector<float>& result) const
 {
     auto [firstIndex, secondIndex] = interpolationIndices(index);
-    const dataloader::Dataset::Entry& e0 = _dataset.entries[firstIndex];
-    const dataloader::Dataset::Entry& e1 = _dataset.entries[secondIndex];
 
     if (hasColorData()) {
         const int colorParamIndex = currentColorParameterIndex();
-        result.push_back(e0.data[colorParamIndex]);
-        result.push_back(e1.data[colorParamIndex]);
+        const std::span<const float> values = _dataset.column(colorParamIndex);
+        result.push_back(values[firstIndex]);
+        result.push_back(values[secondIndex]);
     }
 
     if (hasSizeData()) {
@@ -451,8 +445,9 @@ void RenderableInterpolatedPoints::addColorAndSizeDataForPoint(unsigned int inde
 
         // Convert to diameter if data is given as radius
         float multiplier = _sizeSettings.sizeMapping->isRadius ? 2.f : 1.f;
-        result.push_back(multiplier * e0.data[sizeParamIndex]);
-        result.push_back(multiplier * e1.data[sizeParamIndex]);
+        const std::span<const float> values = _dataset.column(sizeParamIndex);
+        result.push_back(multiplier * values[firstIndex]);
+        result.push_back(multiplier * values[secondIndex]);
     }
 }
 
@@ -460,11 +455,9 @@ void RenderableInterpolatedPoints::addOrientationDataForPoint(unsigned int index
                                                          std::vector<float>& result) const
 {
     auto [firstIndex, secondIndex] = interpolationIndices(index);
-    const dataloader::Dataset::Entry& e0 = _dataset.entries[firstIndex];
-    const dataloader::Dataset::Entry& e1 = _dataset.entries[secondIndex];
 
-    glm::quat q0 = orientationQuaternion(e0);
-    glm::quat q1 = orientationQuaternion(e1);
+    glm::quat q0 = orientationQuaternion(firstIndex);
+    glm::quat q1 = orientationQuaternion(secondIndex);
 
     result.push_back(q0.x);
     result.push_back(q0.y);
@@ -528,7 +521,7 @@ void RenderableInterpolatedPoints::initializeBufferData() {
 }
 
 void RenderableInterpolatedPoints::updateBufferData() {
-    if (!_hasDataFile || _dataset.entries.empty()) {
+    if (!_hasDataFile || _dataset.nEntries() == 0) {
         return;
     }
 
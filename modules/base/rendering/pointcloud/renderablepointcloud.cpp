@@ -42,6 +42,7 @@
 #include <ghoul/opengl/textureunit.h>
 #include <glm/gtx/quaternion.hpp>
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <utility>
@@ -64,6 +65,26 @@ namespace {
         Bottom
     };
 
+    // Extracts the left, right, bottom, and top planes of the view frustum from the
+    // provided model-view-projection matrix, with normals that point into the frustum
+    std::array<glm::dvec4, 4> frustumPlanes(const glm::dmat4& mvp) {
+        const glm::dvec4 row0 = glm::dvec4(mvp[0][0], mvp[1][0], mvp[2][0], mvp[3][0]);
+        const glm::dvec4 row1 = glm::dvec4(mvp[0][1], mvp[1][1], mvp[2][1], mvp[3][1]);
+        const glm::dvec4 row3 = glm::dvec4(mvp[0][3], mvp[1][3], mvp[2][3], mvp[3][3]);
+
+        std::array<glm::dvec4, 4> planes = {
+            row3 + row0,
+            row3 - row0,
+            row3 + row1,
+            row3 - row1
+        };
+        for (glm::dvec4& plane : planes) {
+            const double length = glm::length(glm::dvec3(plane));
+            plane = length > 0.0 ? plane / length : glm::dvec4(0.0);
+        }
+        return planes;
+    }
+
     constexpr Property::PropertyInfo TextureEnabledInfo = {
         "Enabled",
         "Enabled",
@@ -202,6 +223,32 @@ namespace {
         Property::Visibility::AdvancedUser
     };
 
+    constexpr Property::PropertyInfo LodEnabledInfo = {
+        "Enabled",
+        "Enabled",
+        "If true, the points are sorted into an octree and only the points of the nodes "
+        "that are visible and large enough on the screen are rendered. Nodes close to "
+        "the root contain the most important points, so that the overall shape of the "
+        "dataset is kept when it is seen from far away.",
+        Property::Visibility::AdvancedUser
+    };
+
+    constexpr Property::PropertyInfo LodThresholdInfo = {
+        "Threshold",
+        "Threshold",
+        "The angular radius, in degrees, that a node of the octree must have before the "
+        "points of its children are rendered as well. A lower value renders more points.",
+        Property::Visibility::AdvancedUser
+    };
+
+    constexpr Property::PropertyInfo LodRenderedPointsInfo = {
+        "NumberOfRenderedPoints",
+        "Number of rendered points",
+        "Information about how many points were selected for rendering in the last "
+        "frame when the level of detail is enabled.",
+        Property::Visibility::AdvancedUser
+    };
+
     constexpr Property::PropertyInfo NumShownDataPointsInfo = {
         "NumberOfDataPoints",
         "Number of shown data points",
@@ -337,6 +384,12 @@ namespace {
         // changes to the color map.
         std::optional<bool> useCaching;
 
+        // If true, the data file is memory-mapped and its rows are parsed on multiple
+        // threads concurrently. This results in the same dataset as the default
+        // sequential loading, but is considerably faster for large files. It has no
+        // effect if a cached version of the dataset is used.
+        std::optional<bool> parallelLoading;
+
         // A dictionary specifying details on how to load the dataset. Updating the data
         // mapping will lead to a new cached version of the dataset.
         std::optional<ghoul::Dictionary> dataMapping
@@ -484,6 +537,32 @@ namespace {
         // the dataset.
         std::optional<Fading> fading;
 
+        struct LevelOfDetail {
+            // [[codegen::verbatim(LodEnabledInfo.description)]]
+            std::optional<bool> enabled;
+
+            // [[codegen::verbatim(LodThresholdInfo.description)]]
+            std::optional<float> threshold;
+
+            // The name of the data column that determines how important a point is.
+            // Points with a higher value are stored closer to the root of the octree and
+            // are thus visible from further away. If no column is provided, all points
+            // are equally important and a uniform subset is shown.
+            std::optional<std::string> importanceColumn;
+
+            // If true, points with a lower value in the importance column are more
+            // important, which is the case for magnitudes.
+            std::optional<bool> invertImportance;
+
+            // The number of points that a node of the octree stores before the remaining
+            // points are passed on to its children.
+            std::optional<int> maxPointsPerNode [[codegen::greater(0)]];
+        };
+        // Settings related to rendering only a subset of the points based on their
+        // distance to the camera, which is useful for very large datasets. The octree
+        // that is used for this is only created if these settings are provided.
+        std::optional<LevelOfDetail> levelOfDetail;
+
         // Transformation matrix to be applied to the position of each object.
         std::optional<glm::dmat4x4> transformationMatrix;
     };
@@ -632,11 +711,32 @@ RenderablePointCloud::Fading::Fading(const ghoul::Dictionary& dictionary)
     addProperty(invert);
 }
 
+RenderablePointCloud::LevelOfDetail::LevelOfDetail(const ghoul::Dictionary& dictionary)
+    : PropertyOwner({ "LevelOfDetail", "Level of Detail", "" })
+    , enabled(LodEnabledInfo, false)
+    , threshold(LodThresholdInfo, 2.f, 0.01f, 45.f)
+    , nRenderedPoints(LodRenderedPointsInfo, 0)
+{
+    const Parameters p = codegen::bake<Parameters>(dictionary);
+
+    if (p.levelOfDetail.has_value()) {
+        const Parameters::LevelOfDetail lod = *p.levelOfDetail;
+        enabled = lod.enabled.value_or(true);
+        threshold = lod.threshold.value_or(threshold);
+    }
+
+    addProperty(enabled);
+    addProperty(threshold);
+    nRenderedPoints.setReadOnly(true);
+    addProperty(nRenderedPoints);
+}
+
 RenderablePointCloud::RenderablePointCloud(const ghoul::Dictionary& dictionary)
     : Renderable(dictionary)
     , _sizeSettings(dictionary)
     , _colorSettings(dictionary)
     , _fading(dictionary)
+    , _levelOfDetail(dictionary)
     , _useAdditiveBlending(UseAdditiveBlendingInfo, true)
     , _useRotation(UseOrientationDataInfo, false)
     , _drawElements(DrawElementsInfo, true)
@@ -760,6 +860,18 @@ RenderablePointCloud::RenderablePointCloud(const ghoul::Dictionary& dictionary)
         addPropertySubOwner(_fading);
     }
 
+    if (p.levelOfDetail.has_value()) {
+        _importanceColumn = p.levelOfDetail->importanceColumn.value_or(_importanceColumn);
+        _invertImportance = p.levelOfDetail->invertImportance.value_or(_invertImportance);
+        _maxPointsPerNode = static_cast<size_t>(
+            p.levelOfDetail->maxPointsPerNode.value_or(
+                static_cast<int>(_maxPointsPerNode)
+            )
+        );
+        _levelOfDetail.enabled.onChange([this]() { _dataIsDirty = true; });
+        addPropertySubOwner(_levelOfDetail);
+    }
+
     if (p.coloring.has_value() && (*p.coloring).colorMapping.has_value()) {
         _hasColorMapFile = true;
 
@@ -783,6 +895,7 @@ RenderablePointCloud::RenderablePointCloud(const ghoul::Dictionary& dictionary)
     }
 
     _useCaching = p.useCaching.value_or(_useCaching);
+    _useParallelLoading = p.parallelLoading.value_or(_useParallelLoading);
 
     _skipFirstDataPoint = p.skipFirstDataPoint.value_or(_skipFirstDataPoint);
 
@@ -828,18 +941,32 @@ void RenderablePointCloud::initialize() {
     }
 
     if (_hasDataFile) {
+        const dataloader::data::LoadMode mode = _useParallelLoading ?
+            dataloader::data::LoadMode::Parallel :
+            dataloader::data::LoadMode::Sequential;
+
         if (_useCaching) {
-            _dataset = dataloader::data::loadFileWithCache(_dataFile, _dataMapping);
+            // The cache file is memory-mapped and only the columns that are used for
+            // rendering are actually read from disk
+            _dataset = dataloader::data::loadColumnarFileWithCache(
+                _dataFile,
+                _dataMapping,
+                mode
+            );
         }
         else {
-            _dataset = dataloader::data::loadFile(_dataFile, _dataMapping);
+            // The data is only ever accessed one column at a time, so the row-based
+            // dataset is converted into columns right after loading
+            _dataset = dataloader::ColumnarDataset::createFromDataset(
+                dataloader::data::loadFile(_dataFile, _dataMapping, mode)
+            );
         }
 
         if (_skipFirstDataPoint) {
-            _dataset.entries.erase(_dataset.entries.begin());
+            _dataset.removeFirstEntries(1);
         }
 
-        _nDataPoints = static_cast<unsigned int>(_dataset.entries.size());
+        _nDataPoints = static_cast<unsigned int>(_dataset.nEntries());
         _hasOrientationData = _dataset.orientationDataIndex >= 0;
 
         // If no scale exponent was specified, compute one that will at least show the
@@ -894,6 +1021,7 @@ void RenderablePointCloud::initializeGL() {
 void RenderablePointCloud::deinitializeGL() {
     glDeleteVertexArrays(1, &_vao);
     glDeleteBuffers(1, &_vbo);
+    glDeleteBuffers(1, &_ebo);
 
     deinitializeShaders();
 
@@ -915,6 +1043,7 @@ void RenderablePointCloud::initializeShadersAndGlExtras() {
 
     glCreateVertexArrays(1, &_vao);
     glCreateBuffers(1, &_vbo);
+    glCreateBuffers(1, &_ebo);
 }
 
 void RenderablePointCloud::deinitializeShaders() {
@@ -1155,7 +1284,7 @@ void RenderablePointCloud::renderPoints(const RenderData& data,
                                         const glm::dvec3& orthoRight,
                                         const glm::dvec3& orthoUp, float fadeInVariable)
 {
-    if (!_hasDataFile || _dataset.entries.empty()) {
+    if (!_hasDataFile || _dataset.nEntries() == 0) {
         return;
     }
 
@@ -1284,25 +1413,86 @@ void RenderablePointCloud::renderPoints(const RenderData& data,
 
     glBindVertexArray(_vao);
 
+    // With the level of detail, only the nodes of the octree that are selected for the
+    // camera are drawn. Each tree corresponds to one texture array
+    const bool useLod = _levelOfDetail.enabled && _octree.nTrees() > 0;
+    glm::dvec3 lodCameraPosition = glm::dvec3(0.0);
+    std::array<glm::dvec4, 4> lodFrustum;
+    if (useLod) {
+        const glm::dvec4 cameraPosition = glm::dvec4(data.camera.position(), 1.0);
+        lodCameraPosition = glm::dvec3(glm::inverse(modelMatrix) * cameraPosition);
+        lodFrustum = frustumPlanes(
+            glm::dmat4(data.camera.projectionMatrix()) *
+            data.camera.combinedViewMatrix() * modelMatrix
+        );
+        _lodSelection.clear();
+    }
+    auto drawPoints = [&](size_t tree, GLint first, GLsizei count) {
+        if (!useLod) {
+            glDrawArrays(GL_POINTS, first, count);
+            return;
+        }
+
+        const size_t begin = _lodSelection.size();
+        _octree.select(
+            tree,
+            lodCameraPosition,
+            lodFrustum,
+            glm::radians(static_cast<double>(_levelOfDetail.threshold)),
+            _lodSelection
+        );
+        _lodCounts.clear();
+        _lodOffsets.clear();
+        for (size_t i = begin; i < _lodSelection.size(); i++) {
+            const PointCloudOctree::Range& r = _lodSelection[i];
+            _lodCounts.push_back(static_cast<GLsizei>(r.count));
+            _lodOffsets.push_back(
+                reinterpret_cast<const void*>(r.first * sizeof(uint32_t))
+            );
+        }
+        glMultiDrawElements(
+            GL_POINTS,
+            _lodCounts.data(),
+            GL_UNSIGNED_INT,
+            _lodOffsets.data(),
+            static_cast<GLsizei>(_lodCounts.size())
+        );
+    };
+
     if (useTexture && !_textureArrays.empty()) {
-        for (const TextureArrayInfo& arrayInfo : _textureArrays) {
+        for (size_t i = 0; i < _textureArrays.size(); i++) {
+            const TextureArrayInfo& arrayInfo = _textureArrays[i];
             spriteTextureUnit.bind(arrayInfo.renderId);
             _program->setUniform(
                 _uniformCache.aspectRatioScale,
                 arrayInfo.aspectRatioScale
             );
-            glDrawArrays(
-                GL_POINTS,
+            drawPoints(
+                i,
                 arrayInfo.startOffset,
                 static_cast<GLsizei>(arrayInfo.nPoints)
             );
         }
     }
+    else if (useLod) {
+        _program->setUniform(_uniformCache.aspectRatioScale, glm::vec2(1.f));
+        for (size_t i = 0; i < _octree.nTrees(); i++) {
+            drawPoints(i, 0, 0);
+        }
+    }
     else {
         _program->setUniform(_uniformCache.aspectRatioScale, glm::vec2(1.f));
         glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(_nDataPoints));
     }
 
+    if (useLod) {
+        size_t nRendered = 0;
+        for (const PointCloudOctree::Range& r : _lodSelection) {
+            nRendered += r.count;
+        }
+        _levelOfDetail.nRenderedPoints = static_cast<unsigned int>(nRendered);
+    }
+
     glBindVertexArray(0);
     _program->deactivate();
 
@@ -1366,53 +1556,20 @@ void RenderablePointCloud::update(const UpdateData&) {
     }
 }
 
-glm::dvec3 RenderablePointCloud::transformedPosition(
-                                                const dataloader::Dataset::Entry& e) const
-{
+glm::dvec3 RenderablePointCloud::transformedPosition(size_t entryIndex) const {
     const double unitMeter = toMeter(_unit);
-    glm::dvec4 position = glm::dvec4(glm::dvec3(e.position) * unitMeter, 1.0);
+    const glm::dvec3 p = glm::dvec3(_dataset.positions()[entryIndex]);
+    glm::dvec4 position = glm::dvec4(p * unitMeter, 1.0);
     return glm::dvec3(_transformationMatrix * position);
 }
 
-glm::quat RenderablePointCloud::orientationQuaternion(
-                                                const dataloader::Dataset::Entry& e) const
-{
-    const int orientationDataIndex = _dataset.orientationDataIndex;
-
-    const glm::vec3 u = glm::normalize(glm::vec3(
-        _transformationMatrix *
-        glm::dvec4(
-            e.data[orientationDataIndex + 0],
-            e.data[orientationDataIndex + 1],
-            e.data[orientationDataIndex + 2],
-            1.f
-        )
-    ));
-
-    const glm::vec3 v = glm::normalize(glm::vec3(
-        _transformationMatrix *
-        glm::dvec4(
-            e.data[orientationDataIndex + 3],
-            e.data[orientationDataIndex + 4],
-            e.data[orientationDataIndex + 5],
-            1.f
-        )
-    ));
-
-    // Get the quaternion that represents the rotation from XY plane to the plane that is
-    // spanned by the UV vectors
-
-    // First rotate to align the z-axis with plane normal
-    const glm::vec3 planeNormal = glm::normalize(glm::cross(u, v));
-    glm::quat q = glm::normalize(glm::rotation(glm::vec3(0.f, 0.f, 1.f), planeNormal));
-
-    // Add rotation around plane normal (rotate new x-axis to u)
-    const glm::vec3 rotatedRight = glm::normalize(
-        glm::vec3(glm::mat4_cast(q) * glm::vec4(1.f, 0.f, 0.f, 1.f))
-    );
-    q = glm::normalize(glm::rotation(rotatedRight, u)) * q;
-
-    return q;
+glm::quat RenderablePointCloud::orientationQuaternion(size_t entryIndex) const {
+    // The two vectors spanning the plane are stored in six consecutive columns
+    std::array<float, 6> uv;
+    for (size_t i = 0; i < uv.size(); i++) {
+        uv[i] = _dataset.column(_dataset.orientationDataIndex + i)[entryIndex];
+    }
+    return PointDataSlice::orientationQuaternion(_transformationMatrix, uv.data());
 }
 
 int RenderablePointCloud::nAttributesPerPoint() const {
@@ -1442,7 +1599,7 @@ int RenderablePointCloud::bufferVertexAttribute(const std::string& name, GLint n
 }
 
 void RenderablePointCloud::updateBufferData() {
-    if (!_hasDataFile || _dataset.entries.empty()) {
+    if (!_hasDataFile || _dataset.nEntries() == 0) {
         return;
     }
 
@@ -1450,38 +1607,118 @@ void RenderablePointCloud::updateBufferData() {
     TracyGpuZone("Data dirty");
     LDEBUG("Regenerating data");
 
-    std::vector<float> slice = createDataSlice();
+    using Attribute = PointDataSlice::Attribute;
+    const PointDataSlice::UpdateResult res = _dataSlice.update(
+        _dataset,
+        _nDataPoints,
+        dataSliceLayout()
+    );
 
-    int size = static_cast<int>(slice.size());
+    if (res.needsReallocation) {
+        const std::span<const float> data = _dataSlice.data();
+
+        glBindVertexArray(_vao);
+        glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+        glNamedBufferData(_vbo, data.size_bytes(), data.data(), GL_STATIC_DRAW);
+
+        // Each attribute is stored in its own column, so the stride of an attribute is
+        // the size of its own values. Attributes that are no longer used are disabled as
+        // they would otherwise point outside of the buffer
+        auto bufferColumn = [this](const std::string& name, Attribute attribute) {
+            if (_dataSlice.hasAttribute(attribute)) {
+                const int n = PointDataSlice::nValues(attribute);
+                const int offset = static_cast<int>(_dataSlice.columnOffset(attribute));
+                bufferVertexAttribute(name, n, n, offset);
+            }
+            else {
+                const GLint attrib = _program->attributeLocation(name);
+                if (attrib >= 0) {
+                    glDisableVertexArrayAttrib(_vao, attrib);
+                }
+            }
+        };
+        bufferColumn("in_position", Attribute::Position);
+        bufferColumn("in_colorParameter", Attribute::ColorParameter);
+        bufferColumn("in_scalingParameter", Attribute::SizeParameter);
+        bufferColumn("in_orientation", Attribute::Orientation);
+        bufferColumn("in_textureLayer", Attribute::TextureLayer);
 
-    glBindVertexArray(_vao);
-    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
-    glNamedBufferData(_vbo, size * sizeof(float), slice.data(), GL_STATIC_DRAW);
+        glBindVertexArray(0);
+    }
+    else {
+        // Only upload the columns that have changed, for example when switching to a
+        // different color parameter
+        for (const Attribute attribute : res.changedAttributes) {
+            const std::span<const float> column = _dataSlice.column(attribute);
+            glNamedBufferSubData(
+                _vbo,
+                _dataSlice.columnOffset(attribute) * sizeof(float),
+                column.size_bytes(),
+                column.data()
+            );
+        }
+    }
 
-    const int attibsPerPoint = nAttributesPerPoint();
-    int offset = 0;
+    const std::span<const PointDataSlice::Range> ranges = _dataSlice.textureArrayRanges();
+    for (size_t i = 0; i < _textureArrays.size() && i < ranges.size(); i++) {
+        _textureArrays[i].nPoints = static_cast<int>(ranges[i].count);
+        _textureArrays[i].startOffset = static_cast<GLint>(ranges[i].first);
+    }
+    setBoundingSphere(_dataSlice.maxRadius());
+
+    // The octree only depends on the positions and the order of the points, so it is kept
+    // when any of the other attributes change
+    const bool positionsChanged = std::find(
+        res.changedAttributes.begin(),
+        res.changedAttributes.end(),
+        Attribute::Position
+    ) != res.changedAttributes.end();
+    _octreeIsDirty |= positionsChanged;
+    if (_levelOfDetail.enabled && _octreeIsDirty) {
+        updateOctree();
+    }
 
-    offset = bufferVertexAttribute("in_position", 3, attibsPerPoint, offset);
+    _dataIsDirty = false;
+}
 
-    if (hasColorData()) {
-        offset = bufferVertexAttribute("in_colorParameter", 1, attibsPerPoint, offset);
-    }
+void RenderablePointCloud::updateOctree() {
+    ZoneScoped;
 
-    if (hasSizeData()) {
-        offset = bufferVertexAttribute("in_scalingParameter", 1, attibsPerPoint, offset);
+    std::vector<float> importance;
+    if (!_importanceColumn.empty()) {
+        const int index = _dataset.index(_importanceColumn);
+        if (index >= 0) {
+            const std::span<const float> values = _dataset.column(index);
+            const float sign = _invertImportance ? -1.f : 1.f;
+            importance.resize(_dataSlice.nPoints());
+            for (size_t i = 0; i < importance.size(); i++) {
+                importance[i] = sign * values[_dataSlice.entryIndex(i)];
+            }
+        }
+        else {
+            LWARNING(std::format(
+                "Could not find importance column '{}' in the dataset", _importanceColumn
+            ));
+        }
     }
 
-    if (useOrientationData()) {
-        offset = bufferVertexAttribute("in_orientation", 4, attibsPerPoint, offset);
+    std::vector<PointCloudOctree::Range> trees;
+    for (const PointDataSlice::Range& range : _dataSlice.textureArrayRanges()) {
+        trees.push_back({ range.first, range.count });
     }
 
-    if (_hasSpriteTexture) {
-        offset = bufferVertexAttribute("in_textureLayer", 1, attibsPerPoint, offset);
-    }
+    _octree.build(
+        _dataSlice.column(PointDataSlice::Attribute::Position),
+        importance,
+        trees,
+        _maxPointsPerNode
+    );
 
-    glBindVertexArray(0);
+    const std::span<const uint32_t> order = _octree.order();
+    glNamedBufferData(_ebo, order.size_bytes(), order.data(), GL_STATIC_DRAW);
+    glVertexArrayElementBuffer(_vao, _ebo);
 
-    _dataIsDirty = false;
+    _octreeIsDirty = false;
 }
 
 void RenderablePointCloud::updateSpriteTexture() {
@@ -1568,8 +1805,7 @@ void RenderablePointCloud::addPositionDataForPoint(unsigned int index,
                                                    std::vector<float>& result,
                                                    double& maxRadius) const
 {
-    const dataloader::Dataset::Entry& e = _dataset.entries[index];
-    glm::dvec3 position = transformedPosition(e);
+    glm::dvec3 position = transformedPosition(index);
     const double r = glm::length(position);
 
     // Add values to result
@@ -1583,11 +1819,9 @@ void RenderablePointCloud::addPositionDataForPoint(unsigned int index,
 void RenderablePointCloud::addColorAndSizeDataForPoint(unsigned int index,
                                                        std::vector<float>& result) const
 {
-    const dataloader::Dataset::Entry& e = _dataset.entries[index];
-
     if (hasColorData()) {
         const int colorParamIndex = currentColorParameterIndex();
-        result.push_back(e.data[colorParamIndex]);
+        result.push_back(_dataset.column(colorParamIndex)[index]);
     }
 
     if (hasSizeData()) {
@@ -1598,15 +1832,14 @@ void RenderablePointCloud::addColorAndSizeDataForPoint(unsigned int index,
 
         // Convert to diameter if data is given as radius
         float multiplier = _sizeSettings.sizeMapping->isRadius ? 2.f : 1.f;
-        result.push_back(multiplier * e.data[sizeParamIndex]);
+        result.push_back(multiplier * _dataset.column(sizeParamIndex)[index]);
     }
 }
 
 void RenderablePointCloud::addOrientationDataForPoint(unsigned int index,
                                                       std::vector<float>& result) const
 {
-    const dataloader::Dataset::Entry& e = _dataset.entries[index];
-    glm::quat q = orientationQuaternion(e);
+    glm::quat q = orientationQuaternion(index);
 
     result.push_back(q.x);
     result.push_back(q.y);
@@ -1617,7 +1850,7 @@ void RenderablePointCloud::addOrientationDataForPoint(unsigned int index,
 std::vector<float> RenderablePointCloud::createDataSlice() {
     ZoneScoped;
 
-    if (_dataset.entries.empty()) {
+    if (_dataset.nEntries() == 0) {
         return std::vector<float>();
     }
 
@@ -1631,12 +1864,10 @@ std::vector<float> RenderablePointCloud::createDataSlice() {
 
     // Reserve enough space for all points in each for now
     for (std::vector<float>& subres : subResults) {
-        subres.reserve(nAttributesPerPoint() * _dataset.entries.size());
+        subres.reserve(nAttributesPerPoint() * _dataset.nEntries());
     }
 
     for (unsigned int i = 0; i < _nDataPoints; i++) {
-        const dataloader::Dataset::Entry& e = _dataset.entries[i];
-
         unsigned int subresultIndex = 0;
         // Default texture layer for single texture is zero
         float textureLayer = 0.f;
@@ -1645,7 +1876,7 @@ std::vector<float> RenderablePointCloud::createDataSlice() {
             hasMultiTextureData();
 
         if (useMultiTexture) {
-            int texId = static_cast<int>(e.data[_dataset.textureDataIndex]);
+            int texId = static_cast<int>(_dataset.column(_dataset.textureDataIndex)[i]);
             size_t texIndex = _indexInDataToTextureIndex[texId];
             textureLayer = static_cast<float>(
                 _textureIndexToArrayMap[texIndex].layer
@@ -1675,7 +1906,7 @@ std::vector<float> RenderablePointCloud::createDataSlice() {
 
     // Combine subresults, which should be in same order as texture arrays
     std::vector<float> result;
-    result.reserve(nAttributesPerPoint() * _dataset.entries.size());
+    result.reserve(nAttributesPerPoint() * _dataset.nEntries());
     size_t vertexCount = 0;
     for (size_t i = 0; i < subResults.size(); i++) {
         result.insert(result.end(), subResults[i].begin(), subResults[i].end());
@@ -1692,6 +1923,45 @@ std::vector<float> RenderablePointCloud::createDataSlice() {
     return result;
 }
 
+PointDataSlice::Layout RenderablePointCloud::dataSliceLayout() const {
+    PointDataSlice::Layout layout;
+    layout.unitScale = toMeter(_unit);
+    layout.transformation = _transformationMatrix;
+
+    if (hasColorData()) {
+        layout.colorParameterIndex = currentColorParameterIndex();
+    }
+    if (hasSizeData()) {
+        layout.sizeParameterIndex = currentSizeParameterIndex();
+        // Convert to diameter if data is given as radius
+        layout.sizeMultiplier = _sizeSettings.sizeMapping->isRadius ? 2.f : 1.f;
+    }
+    if (useOrientationData()) {
+        layout.orientationIndex = _dataset.orientationDataIndex;
+    }
+
+    layout.hasTextureLayer = _hasSpriteTexture;
+    layout.nTextureArrays = static_cast<unsigned int>(_textureArrays.size());
+    if (_textureMode == TextureInputMode::Multi && hasMultiTextureData()) {
+        layout.textureIndex = _dataset.textureDataIndex;
+
+        auto textureLayer = [this](size_t textureIndex) -> PointDataSlice::TextureLayer {
+            const auto it = _textureIndexToArrayMap.find(textureIndex);
+            if (it == _textureIndexToArrayMap.end()) {
+                return PointDataSlice::TextureLayer();
+            }
+            return { .arrayId = it->second.arrayId, .layer = it->second.layer };
+        };
+
+        for (const std::pair<const int, size_t>& p : _indexInDataToTextureIndex) {
+            layout.textures[p.first] = textureLayer(p.second);
+        }
+        // Texture ids that are not known fall back to the first texture
+        layout.defaultTexture = textureLayer(0);
+    }
+
+    return layout;
+}
 
 gl::GLenum RenderablePointCloud::internalGlFormat(bool useAlpha) const {
     if (useAlpha) {
@@ -27,6 +27,8 @@
 
 #include <openspace/rendering/renderable.h>
 
+#include <modules/base/rendering/pointcloud/pointcloudoctree.h>
+#include <modules/base/rendering/pointcloud/pointdataslice.h>
 #include <modules/base/rendering/pointcloud/sizemappingcomponent.h>
 #include <openspace/data/dataloader.h>
 #include <openspace/data/datamapping.h>
@@ -91,8 +93,8 @@ protected:
     virtual void setExtraUniforms();
     virtual void preUpdate();
 
-    glm::dvec3 transformedPosition(const dataloader::Dataset::Entry& e) const;
-    glm::quat orientationQuaternion(const dataloader::Dataset::Entry& e) const;
+    glm::dvec3 transformedPosition(size_t entryIndex) const;
+    glm::quat orientationQuaternion(size_t entryIndex) const;
 
     virtual int nAttributesPerPoint() const;
 
@@ -132,6 +134,18 @@ protected:
 
     std::vector<float> createDataSlice();
 
+    /**
+     * Creates the description of the vertex attributes that are used for the current
+     * settings of the color, size, orientation, and texture mapping.
+     */
+    PointDataSlice::Layout dataSliceLayout() const;
+
+    /**
+     * Rebuilds the octree that is used for the level of detail from the positions in the
+     * current data slice and uploads the resulting order of the points to the _ebo.
+     */
+    void updateOctree();
+
     /**
      * A function that subclasses could override to initialize their own textures to
      * use for rendering, when the `_textureMode` is set to Other.
@@ -203,6 +217,14 @@ protected:
     };
     Fading _fading;
 
+    struct LevelOfDetail : PropertyOwner {
+        explicit LevelOfDetail(const ghoul::Dictionary& dictionary);
+        BoolProperty enabled;
+        FloatProperty threshold;
+        UIntProperty nRenderedPoints;
+    };
+    LevelOfDetail _levelOfDetail;
+
     BoolProperty _useAdditiveBlending;
     BoolProperty _useRotation;
 
@@ -242,11 +264,17 @@ protected:
     DistanceUnit _unit = DistanceUnit::Parsec;
 
     bool _useCaching = true;
+    bool _useParallelLoading = false;
     bool _shouldComputeScaleExponent = false;
     bool _createLabelsFromDataset = false;
     bool _skipFirstDataPoint = false;
 
-    dataloader::Dataset _dataset;
+    std::string _importanceColumn;
+    bool _invertImportance = false;
+    size_t _maxPointsPerNode = 1024;
+    bool _octreeIsDirty = true;
+
+    dataloader::ColumnarDataset _dataset;
     dataloader::DataMapping _dataMapping;
 
     std::unique_ptr<LabelsComponent> _labels;
@@ -256,6 +284,20 @@ protected:
     GLuint _vao = 0;
     GLuint _vbo = 0;
 
+    /// The vertex data that is stored in the _vbo, with one column per attribute
+    PointDataSlice _dataSlice;
+
+    /// The order of the points in the octree, which is stored in the _ebo. There is one
+    /// tree per texture array, or a single one if there are no texture arrays
+    PointCloudOctree _octree;
+    GLuint _ebo = 0;
+
+    /// The ranges of the _ebo that are drawn in the current frame and the counts and
+    /// offsets that are passed to OpenGL. They are kept to avoid allocations per frame
+    std::vector<PointCloudOctree::Range> _lodSelection;
+    std::vector<GLsizei> _lodCounts;
+    std::vector<const void*> _lodOffsets;
+
     /// List of (unique) loaded textures. The other maps refer to the index in this vector
     std::vector<std::unique_ptr<ghoul::opengl::Texture>> _textures;
     std::unordered_map<std::string, size_t> _textureNameToIndex;
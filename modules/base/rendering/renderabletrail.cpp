@@ -32,20 +32,32 @@
 #include <openspace/util/time.h>
 #include <openspace/util/updatestructures.h>
 #include <ghoul/filesystem/filesystem.h>
+#include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/assert.h>
 #include <ghoul/misc/dictionary.h>
+#include <ghoul/misc/exception.h>
 #include <ghoul/misc/profiling.h>
 #include <ghoul/opengl/openglstatecache.h>
 #include <ghoul/opengl/programobject.h>
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 
 namespace {
     using namespace openspace;
 
+    constexpr std::string_view _loggerCat = "RenderableTrail";
+
+    // The sample cache holds this many times the number of samples of the latest request,
+    // which allows the trail to be scrubbed back and forth without recomputing samples
+    constexpr size_t SampleCacheCapacityFactor = 8;
+    constexpr size_t MinimumSampleCacheCapacity = 1024;
+
     // The possible values for the _renderingModes property
     enum RenderingMode {
         RenderingModeLines = 0,
@@ -280,6 +292,132 @@ glm::dvec3 RenderableTrail::translationPosition(Time time) const {
     return _translation->position(data);
 }
 
+bool RenderableTrail::requestSamples(int64_t first, int64_t last) {
+    ZoneScoped;
+
+    if (_sampleJob.has_value()) {
+        const std::future_status status =
+            _sampleJob->positions.wait_for(std::chrono::seconds(0));
+        if (status != std::future_status::ready) {
+            return false;
+        }
+        collectSampleJob();
+    }
+
+    const size_t nRequested = static_cast<size_t>(std::max<int64_t>(last - first + 1, 0));
+    _sampleCacheCapacity = std::max(
+        SampleCacheCapacityFactor * nRequested,
+        MinimumSampleCacheCapacity
+    );
+
+    const std::vector<TrailSampleCache::Range> missing =
+        _sampleCache.missingRanges(first, last);
+    if (missing.empty()) {
+        _sampleCache.trim(first, last, _sampleCacheCapacity);
+        return true;
+    }
+
+    Translation::PositionFunction evaluate;
+    if (!_concurrentSamplingFailed) {
+        evaluate = _translation->concurrentPositionFunction();
+    }
+
+    if (!evaluate) {
+        // The translation can only be evaluated on this thread
+        std::vector<glm::dvec3> positions;
+        for (const TrailSampleCache::Range& range : missing) {
+            positions.clear();
+            positions.reserve(range.last - range.first + 1);
+            for (int64_t i = range.first; i <= range.last; i++) {
+                positions.push_back(translationPosition(Time(_sampleCache.time(i))));
+            }
+            _sampleCache.insert(range.first, positions);
+        }
+        _sampleCache.trim(first, last, _sampleCacheCapacity);
+        return true;
+    }
+
+    std::vector<double> times;
+    for (const TrailSampleCache::Range& range : missing) {
+        for (int64_t i = range.first; i <= range.last; i++) {
+            times.push_back(_sampleCache.time(i));
+        }
+    }
+
+    // The job must not access this object as it might outlive the current frame. The
+    // future is only ever released once it is ready, as the destructor of a future
+    // returned by std::async would otherwise block until the computation is finished
+    _sampleJob = SampleJob {
+        .generation = _sampleCache.generation(),
+        .ranges = missing,
+        .positions = std::async(
+            std::launch::async,
+            [evaluate = std::move(evaluate), times = std::move(times)]() {
+                ZoneScopedN("Trail Samples");
+
+                // The times of each range are increasing, so the translation can find
+                // its samples for successive times in constant time
+                std::vector<glm::dvec3> res = std::vector<glm::dvec3>(times.size());
+                evaluate(times, res);
+                return res;
+            }
+        )
+    };
+    return false;
+}
+
+void RenderableTrail::collectSampleJob() {
+    ghoul_assert(_sampleJob.has_value(), "No sample job");
+
+    try {
+        const std::vector<glm::dvec3> positions = _sampleJob->positions.get();
+
+        // If the samples were invalidated in the meantime, the results are outdated
+        if (_sampleJob->generation == _sampleCache.generation()) {
+            const std::span<const glm::dvec3> all = positions;
+            size_t offset = 0;
+            for (const TrailSampleCache::Range& range : _sampleJob->ranges) {
+                const size_t n = static_cast<size_t>(range.last - range.first + 1);
+                _sampleCache.insert(range.first, all.subspan(offset, n));
+                offset += n;
+            }
+        }
+    }
+    catch (const ghoul::RuntimeError& e) {
+        LWARNING(std::format(
+            "Error computing trail samples for '{}', falling back to computing them on "
+            "the main thread: {}", identifier(), e.message
+        ));
+        _concurrentSamplingFailed = true;
+    }
+    _sampleJob = std::nullopt;
+}
+
+glm::dvec3 RenderableTrail::samplePosition(double time) {
+    const std::optional<int64_t> index = _sampleCache.index(time);
+    if (!index.has_value()) {
+        return translationPosition(Time(time));
+    }
+
+    if (const glm::dvec3* cached = _sampleCache.find(*index);  cached) {
+        return *cached;
+    }
+
+    const glm::dvec3 position = translationPosition(Time(_sampleCache.time(*index)));
+    _sampleCache.insert(*index, std::span(&position, 1));
+    if (_sampleCacheCapacity > 0 && _sampleCache.size() > 2 * _sampleCacheCapacity) {
+        // Trimming is only done once the cache has grown significantly past its capacity
+        // to amortize the cost of removing samples
+        _sampleCache.trim(*index, *index, _sampleCacheCapacity);
+    }
+    return position;
+}
+
+void RenderableTrail::invalidateSamples() {
+    _sampleCache.clear();
+    _concurrentSamplingFailed = false;
+}
+
 void RenderableTrail::internalRender(bool renderLines, bool renderPoints,
                                      const RenderData& data,
                                      const glm::dmat4& modelTransform,
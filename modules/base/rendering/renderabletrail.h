@@ -27,6 +27,7 @@
 
 #include <openspace/rendering/renderable.h>
 
+#include <modules/base/rendering/trailsamplecache.h>
 #include <openspace/properties/misc/optionproperty.h>
 #include <openspace/properties/scalar/boolproperty.h>
 #include <openspace/properties/scalar/floatproperty.h>
@@ -35,6 +36,9 @@
 #include <ghoul/misc/managedmemoryuniqueptr.h>
 #include <ghoul/opengl/ghoul_gl.h>
 #include <ghoul/opengl/uniformcache.h>
+#include <future>
+#include <optional>
+#include <vector>
 
 namespace openspace {
 
@@ -113,6 +117,36 @@ protected:
      */
     glm::dvec3 translationPosition(Time time) const;
 
+    /**
+     * Ensures that the samples with indices between \p first and \p last (inclusive) are
+     * available in the #_sampleCache. Only the samples that are missing are computed. If
+     * the Translation provides a concurrent position function, the missing samples are
+     * computed on a worker thread and this function has to be called again in a later
+     * frame to pick up the results. Otherwise, the samples are computed immediately.
+     *
+     * \param first The index of the first sample that is needed
+     * \param last The index of the last sample that is needed
+     * \return `true` if all requested samples are available in the #_sampleCache,
+     *         `false` if some of them are still being computed
+     */
+    bool requestSamples(int64_t first, int64_t last);
+
+    /**
+     * Returns the trail position at the provided \p time. If the \p time lies on the grid
+     * of the #_sampleCache, the cached sample is used or the computed position is stored
+     * in the cache.
+     *
+     * \param time The time in J2000 seconds for which to get the position
+     * \return The position of the trail at the given time
+     */
+    glm::dvec3 samplePosition(double time);
+
+    /**
+     * Removes all cached samples, for example after a parameter of the Translation has
+     * changed. Samples that are still being computed are discarded when they arrive.
+     */
+    void invalidateSamples();
+
     static openspace::Documentation Documentation();
 
     /**
@@ -134,6 +168,10 @@ protected:
     /// The Translation object that provides the position of the individual trail points
     ghoul::mm_unique_ptr<Translation> _translation;
 
+    /// The samples of the trail that were computed previously and that can be reused the
+    /// next time the vertex buffer has to be regenerated
+    TrailSampleCache _sampleCache;
+
     /**
      * The RenderInformation contains information filled in by the concrete subclasses to
      * be used by this class.
@@ -189,6 +227,24 @@ private:
         bool useSplitRenderMode = false, int numberOfUniqueVertices = 0,
         int floatingOffset = 0);
 
+    /// Copies the results of a finished sample job into the #_sampleCache
+    void collectSampleJob();
+
+    /// A batch of samples that is currently being computed on a worker thread
+    struct SampleJob {
+        /// The generation of the #_sampleCache at the time the job was started
+        uint64_t generation = 0;
+        /// The ranges of sample indices that are computed, in the order of the results
+        std::vector<TrailSampleCache::Range> ranges;
+        std::future<std::vector<glm::dvec3>> positions;
+    };
+    std::optional<SampleJob> _sampleJob;
+    /// Set if a sample job failed, in which case the samples are computed on the main
+    /// thread until the samples are invalidated
+    bool _concurrentSamplingFailed = false;
+    /// The number of samples that are kept in the #_sampleCache
+    size_t _sampleCacheCapacity = 0;
+
    Appearance _appearance;
 
     /// Program object used to render the data stored in RenderInformation
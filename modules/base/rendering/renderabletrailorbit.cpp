@@ -29,6 +29,7 @@
 #include <openspace/util/timeconstants.h>
 #include <openspace/util/updatestructures.h>
 #include <openspace/util/time.h>
+#include <ghoul/misc/assert.h>
 #include <ghoul/misc/dictionary.h>
 #include <algorithm>
 #include <chrono>
@@ -184,7 +185,10 @@ RenderableTrailOrbit::RenderableTrailOrbit(const ghoul::Dictionary& dictionary)
 {
     const Parameters p = codegen::bake<Parameters>(dictionary);
 
-    _translation->onParameterChange([this]() { _needsFullSweep = true; });
+    _translation->onParameterChange([this]() {
+        invalidateSamples();
+        _needsFullSweep = true;
+    });
 
     _forceFullOrbitTrail = p.forceFullOrbitTrail.value_or(_forceFullOrbitTrail);
     _forceFullOrbitTrail.onChange([&]() {
@@ -443,7 +447,13 @@ RenderableTrailOrbit::UpdateReport RenderableTrailOrbit::updateTrails(
 {
     const double time = data.time.j2000Seconds();
     if (_needsFullSweep) {
-        fullSweep(time);
+        if (!fullSweep(time)) {
+            return {
+                .floatingPointNeedsUpdate = false,
+                .permanentPointsNeedUpdate = false,
+                .nUpdated = 0
+            };
+        }
         _previousPhase = trailPhase(time);
         return {
             .floatingPointNeedsUpdate = false,
@@ -506,7 +516,13 @@ RenderableTrailOrbit::UpdateReport RenderableTrailOrbit::updateTrails(
             // If we would need to generate more new points than there are total points in
             // the array, it is faster to regenerate the entire array
             if (nNewPoints >= static_cast<uint64_t>(_resolution)) {
-                fullSweep(time);
+                if (!fullSweep(time)) {
+                    return {
+                        .floatingPointNeedsUpdate = false,
+                        .permanentPointsNeedUpdate = false,
+                        .nUpdated = 0
+                    };
+                }
                 return {
                     .floatingPointNeedsUpdate = false,
                     .permanentPointsNeedUpdate = true,
@@ -519,7 +535,7 @@ RenderableTrailOrbit::UpdateReport RenderableTrailOrbit::updateTrails(
 
                 // Get the new permanent point and write it into the (previously) floating
                 // location
-                const glm::vec3 p = translationPosition(Time(_lastPointTime));
+                const glm::vec3 p = samplePosition(_lastPointTime);
                 _vertexArray[_primaryRenderInformation.first] = { p.x, p.y, p.z };
 
                 // Move the current pointer back one step to be used as the new floating
@@ -550,7 +566,13 @@ RenderableTrailOrbit::UpdateReport RenderableTrailOrbit::updateTrails(
             // If we would need to generate more new points than there are total points in
             // the array, it is faster to regenerate the entire array
             if (nNewPoints >= _resolution) {
-                fullSweep(time);
+                if (!fullSweep(time)) {
+                    return {
+                        .floatingPointNeedsUpdate = false,
+                        .permanentPointsNeedUpdate = false,
+                        .nUpdated = 0
+                    };
+                }
                 return {
                     .floatingPointNeedsUpdate = false,
                     .permanentPointsNeedUpdate = true,
@@ -563,7 +585,7 @@ RenderableTrailOrbit::UpdateReport RenderableTrailOrbit::updateTrails(
 
                 // Get the new permanent point and write it into the (previously)
                 // floating location
-                const glm::vec3 p = translationPosition(Time(_firstPointTime));
+                const glm::vec3 p = samplePosition(_firstPointTime);
                 _vertexArray[_primaryRenderInformation.first] = { p.x, p.y, p.z };
 
                 // if we are on the upper bounds of the array, we start at 0
@@ -609,7 +631,29 @@ RenderableTrailOrbit::UpdateReport RenderableTrailOrbit::updateTrails(
     }
 }
 
-void RenderableTrailOrbit::fullSweep(double time) {
+bool RenderableTrailOrbit::fullSweep(double time) {
+    using namespace std::chrono;
+    const double periodSeconds = _period * duration_cast<seconds>(hours(24)).count();
+    const double secondsPerPoint = periodSeconds / (_resolution - 1);
+
+    const PhaseType phase = trailPhase(time);
+
+    // In the normal phase, the permanent points lie on a fixed time grid, which means
+    // that the samples of previous sweeps can be reused and only the missing ones have to
+    // be computed
+    const bool useSampleGrid = phase == PhaseType::Normal && _resolution > 1 &&
+        std::isfinite(secondsPerPoint) && secondsPerPoint > 0.0;
+    int64_t lastIndex = 0;
+    if (useSampleGrid) {
+        _sampleCache.setGrid(0.0, secondsPerPoint);
+        lastIndex = static_cast<int64_t>(std::floor(time / secondsPerPoint));
+        if (!requestSamples(lastIndex - _resolution + 2, lastIndex)) {
+            // Keep the previous trail until all of the samples have been computed
+            _needsFullSweep = true;
+            return false;
+        }
+    }
+
     // Reserve the space for the vertices
     _vertexArray.clear();
     _vertexArray.resize(_resolution);
@@ -623,33 +667,43 @@ void RenderableTrailOrbit::fullSweep(double time) {
         std::iota(_indexArray.begin() + _resolution, _indexArray.end(), 0);
     }
 
-    using namespace std::chrono;
-    const double periodSeconds = _period * duration_cast<seconds>(hours(24)).count();
-    const double secondsPerPoint = periodSeconds / (_resolution - 1);
-
-    const PhaseType phase = trailPhase(time);
+    if (useSampleGrid) {
+        // The first point is the floating point at the current time, followed by the
+        // permanent points in descending temporal order
+        const glm::vec3 p = translationPosition(Time(time));
+        _vertexArray[0] = { p.x, p.y, p.z };
+        for (int i = 1; i < _resolution; i++) {
+            const glm::dvec3* sample = _sampleCache.find(lastIndex - i + 1);
+            ghoul_assert(sample, "Missing trail sample");
+            const glm::vec3 q = *sample;
+            _vertexArray[i] = { q.x, q.y, q.z };
+        }
 
-    if ((phase == PhaseType::Beginning) || (phase == PhaseType::Pre)) {
-        time = Time::convertTime(_startTime) + periodSeconds;
-    }
-    else if ((phase == PhaseType::Ending) || (phase == PhaseType::Post)) {
-        time = Time::convertTime(_endTime);
+        _lastPointTime = _sampleCache.time(lastIndex);
+        _firstPointTime = _sampleCache.time(lastIndex - _resolution + 2);
     }
-    _lastPointTime = time;
+    else {
+        if ((phase == PhaseType::Beginning) || (phase == PhaseType::Pre)) {
+            time = Time::convertTime(_startTime) + periodSeconds;
+        }
+        else if ((phase == PhaseType::Ending) || (phase == PhaseType::Post)) {
+            time = Time::convertTime(_endTime);
+        }
+        _lastPointTime = time;
 
+        for (int i = 0; i < _resolution; i++) {
+            const glm::vec3 p = translationPosition(Time(time));
+            _vertexArray[i] = { p.x, p.y, p.z };
 
-    for (int i = 0; i < _resolution; i++) {
-        const glm::vec3 p = translationPosition(Time(time));
-        _vertexArray[i] = { p.x, p.y, p.z };
+            time -= secondsPerPoint;
+        }
 
-        time -= secondsPerPoint;
+        _firstPointTime = time + secondsPerPoint;
     }
 
     _primaryRenderInformation.first = 0;
     _primaryRenderInformation.count = _resolution;
 
-    _firstPointTime = time + secondsPerPoint;
-
     // Updating bounding sphere
     glm::vec3 maxVertex(-std::numeric_limits<float>::max());
     glm::vec3 minVertex(std::numeric_limits<float>::max());
@@ -669,6 +723,7 @@ void RenderableTrailOrbit::fullSweep(double time) {
     setBoundingSphere(glm::distance(maxVertex, minVertex) / 2.f);
 
     _needsFullSweep = false;
+    return true;
 }
 
 } // namespace openspace
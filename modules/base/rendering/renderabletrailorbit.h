@@ -63,11 +63,15 @@ private:
 	};
 
     /**
-     * Performs a full sweep of the orbit and fills the entire vertex buffer object.
+     * Performs a full sweep of the orbit and fills the entire vertex buffer object. If
+     * some of the samples are still being computed, the vertex array is not modified so
+     * that the previous trail can be rendered until all samples are available.
      *
      * \param time The current time up to which the full sweep should be performed
+     * \return `true` if the vertex array was filled, `false` if the sweep has to be
+     *         repeated in a later frame
      */
-    void fullSweep(double time);
+    bool fullSweep(double time);
 
     /**
      * This structure is returned from the #updateTrails method and gives information
@@ -30,6 +30,7 @@
 #include <openspace/util/time.h>
 #include <openspace/util/timeconstants.h>
 #include <openspace/util/updatestructures.h>
+#include <ghoul/misc/assert.h>
 #include <algorithm>
 #include <cmath>
 #include <iterator>
@@ -163,7 +164,10 @@ RenderableTrailTrajectory::RenderableTrailTrajectory(const ghoul::Dictionary& di
 {
     const Parameters p = codegen::bake<Parameters>(dictionary);
 
-    _translation->onParameterChange([this]() { reset(); });
+    _translation->onParameterChange([this]() {
+        invalidateSamples();
+        reset();
+    });
 
     _renderFullTrail = p.showFullTrail.value_or(_renderFullTrail);
     addProperty(_renderFullTrail);
@@ -275,12 +279,27 @@ void RenderableTrailTrajectory::reset() {
 
 void RenderableTrailTrajectory::updateBuffer() {
     // Convert the start and end time from string representations to J2000 seconds
-    _start = SpiceManager::ref().ephemerisTimeFromDate(_startTime);
-    _end = SpiceManager::ref().ephemerisTimeFromDate(_endTime);
-    const double timespan = _end - _start;
+    const double start = SpiceManager::ref().ephemerisTimeFromDate(_startTime);
+    const double end = SpiceManager::ref().ephemerisTimeFromDate(_endTime);
+    const double timespan = end - start;
+
+    const double totalSampleInterval = _sampleInterval / _timeStampSubsamplingFactor;
+    const unsigned int nVertices = static_cast<unsigned int>(
+        std::ceil(timespan / totalSampleInterval)
+    );
 
-    _totalSampleInterval = _sampleInterval / _timeStampSubsamplingFactor;
-    _nVertices = static_cast<unsigned int>(std::ceil(timespan / _totalSampleInterval));
+    // The samples are placed on a grid starting at the start time, so samples that were
+    // computed before are reused if only the end time changes
+    _sampleCache.setGrid(start, totalSampleInterval);
+    if (!requestSamples(0, static_cast<int64_t>(nVertices) - 1)) {
+        // Keep the previous trail until all of the samples have been computed
+        return;
+    }
+
+    _start = start;
+    _end = end;
+    _totalSampleInterval = totalSampleInterval;
+    _nVertices = nVertices;
 
     // Make space for the vertices
     _vertexArray.clear();
@@ -292,12 +311,12 @@ void RenderableTrailTrajectory::updateBuffer() {
 
     // Calculate all vertex positions
     for (unsigned int i = 0; i < _nVertices; i++) {
-        const glm::dvec3 dp = translationPosition(
-            Time(_start + i * _totalSampleInterval)
-        );
+        const glm::dvec3* sample = _sampleCache.find(i);
+        ghoul_assert(sample, "Missing trail sample");
+        const glm::dvec3 dp = *sample;
         const glm::vec3 p = dp;
         _vertexArray[i] = { p.x, p.y, p.z };
-        _timeVector[i] = Time(_start + i * _totalSampleInterval).j2000Seconds();
+        _timeVector[i] = _sampleCache.time(i);
         _dVertexArray[i] = { dp.x, dp.y, dp.z };
 
         // Set max and min vertex for bounding sphere calculations
@@ -308,7 +327,7 @@ void RenderableTrailTrajectory::updateBuffer() {
     // Full sweep is complete here.
     // Adds the last point in time to the _vertexArray so that we ensure that points for
     // _start and _end always exists
-    const glm::dvec3 dp = translationPosition(Time(_end));
+    const glm::dvec3 dp = samplePosition(_end);
     const glm::vec3 p = dp;
     _vertexArray[_nVertices] = { p.x, p.y, p.z };
     _timeVector[_nVertices] = Time(_end).j2000Seconds();
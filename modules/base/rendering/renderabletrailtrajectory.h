@@ -59,7 +59,9 @@ public:
 private:
 
     /**
-     * Update vertex buffer when a full sweep is needed.
+     * Update vertex buffer when a full sweep is needed. If some of the samples are still
+     * being computed, the previous vertex buffer is kept and the update is repeated in a
+     * later frame.
      */
     void updateBuffer();
 
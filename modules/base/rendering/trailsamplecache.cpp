@@ -0,0 +1,240 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/base/rendering/trailsamplecache.h>
+
+#include <ghoul/misc/assert.h>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace {
+    // The relative distance to a grid point below which a time is considered to be on the
+    // grid. Times that are accumulated by repeatedly adding the interval drift slightly
+    constexpr double GridTolerance = 1e-6;
+} // namespace
+
+namespace openspace {
+
+void TrailSampleCache::setGrid(double origin, double interval) {
+    ghoul_assert(interval > 0.0 && std::isfinite(interval), "Invalid interval");
+
+    if (origin != _origin || interval != _interval) {
+        _origin = origin;
+        _interval = interval;
+        clear();
+    }
+}
+
+double TrailSampleCache::time(int64_t index) const {
+    return _origin + static_cast<double>(index) * _interval;
+}
+
+std::optional<int64_t> TrailSampleCache::index(double time) const {
+    const double i = std::round((time - _origin) / _interval);
+    if (!std::isfinite(i) || std::abs(i) > 9e15) {
+        return std::nullopt;
+    }
+    const int64_t idx = static_cast<int64_t>(i);
+    if (std::abs(this->time(idx) - time) > GridTolerance * _interval) {
+        return std::nullopt;
+    }
+    return idx;
+}
+
+const glm::dvec3* TrailSampleCache::find(int64_t index) const {
+    auto it = _runs.upper_bound(index);
+    if (it == _runs.begin()) {
+        return nullptr;
+    }
+    it--;
+    const int64_t offset = index - it->first;
+    if (offset >= static_cast<int64_t>(it->second.size())) {
+        return nullptr;
+    }
+    return &it->second[offset];
+}
+
+std::vector<TrailSampleCache::Range> TrailSampleCache::missingRanges(int64_t first,
+                                                                     int64_t last) const
+{
+    std::vector<Range> res;
+    if (last < first) {
+        return res;
+    }
+
+    // Start with the run that might contain the first requested index
+    auto it = _runs.upper_bound(first);
+    if (it != _runs.begin()) {
+        it--;
+    }
+
+    int64_t current = first;
+    for (; it != _runs.end() && current <= last; it++) {
+        const int64_t runFirst = it->first;
+        const int64_t runLast = runFirst + static_cast<int64_t>(it->second.size()) - 1;
+        if (runLast < current) {
+            continue;
+        }
+        if (runFirst > current) {
+            res.push_back({ current, std::min(runFirst - 1, last) });
+        }
+        current = runLast + 1;
+    }
+    if (current <= last) {
+        res.push_back({ current, last });
+    }
+    return res;
+}
+
+void TrailSampleCache::insert(int64_t first, std::span<const glm::dvec3> positions) {
+    if (positions.empty()) {
+        return;
+    }
+    const int64_t last = first + static_cast<int64_t>(positions.size()) - 1;
+
+    // Find all runs that overlap or touch the new samples as they are merged into a
+    // single run
+    auto begin = _runs.upper_bound(first - 1);
+    if (begin != _runs.begin()) {
+        auto prev = std::prev(begin);
+        const int64_t prevEnd = prev->first + static_cast<int64_t>(prev->second.size());
+        if (prevEnd >= first) {
+            begin = prev;
+        }
+    }
+    auto end = _runs.upper_bound(last + 1);
+
+    if (begin == end) {
+        _runs.emplace(first, std::vector<glm::dvec3>(positions.begin(), positions.end()));
+        _size += positions.size();
+        return;
+    }
+
+    if (std::next(begin) == end && begin->first <= first) {
+        // The new samples only overwrite or extend a single run, which is the common case
+        // of a trail that advances by a few samples, so the run can be updated in place
+        std::vector<glm::dvec3>& run = begin->second;
+        const size_t offset = static_cast<size_t>(first - begin->first);
+        const size_t newSize = std::max(run.size(), offset + positions.size());
+        _size += newSize - run.size();
+        run.resize(newSize);
+        std::copy(positions.begin(), positions.end(), run.begin() + offset);
+        return;
+    }
+
+    const int64_t mergedFirst = std::min(first, begin->first);
+    const auto& lastRun = *std::prev(end);
+    const int64_t mergedLast = std::max(
+        last,
+        lastRun.first + static_cast<int64_t>(lastRun.second.size()) - 1
+    );
+
+    std::vector<glm::dvec3> merged(mergedLast - mergedFirst + 1);
+    for (auto it = begin; it != end; it++) {
+        const int64_t offset = it->first - mergedFirst;
+        std::copy(it->second.begin(), it->second.end(), merged.begin() + offset);
+        _size -= it->second.size();
+    }
+    std::copy(positions.begin(), positions.end(), merged.begin() + (first - mergedFirst));
+
+    _runs.erase(begin, end);
+    _size += merged.size();
+    _runs.emplace(mergedFirst, std::move(merged));
+}
+
+void TrailSampleCache::trim(int64_t first, int64_t last, size_t maxSamples) {
+    while (_size > maxSamples && !_runs.empty()) {
+        const size_t excess = _size - maxSamples;
+
+        auto front = _runs.begin();
+        auto back = std::prev(_runs.end());
+        const int64_t backLast =
+            back->first + static_cast<int64_t>(back->second.size()) - 1;
+
+        // The number of samples that lie before and after the protected range
+        const int64_t distanceFront = first - front->first;
+        const int64_t distanceBack = backLast - last;
+        if (distanceFront <= 0 && distanceBack <= 0) {
+            // Everything that is left is inside the protected range
+            break;
+        }
+
+        if (distanceFront >= distanceBack) {
+            // Remove samples from the beginning of the first run, but not past the
+            // protected range or the end of the run
+            std::vector<glm::dvec3>& run = front->second;
+            const size_t n = std::min({
+                excess,
+                static_cast<size_t>(distanceFront),
+                run.size()
+            });
+            if (n == run.size()) {
+                _runs.erase(front);
+            }
+            else {
+                std::vector<glm::dvec3> rest = std::vector<glm::dvec3>(
+                    run.begin() + n,
+                    run.end()
+                );
+                const int64_t newFirst = front->first + static_cast<int64_t>(n);
+                _runs.erase(front);
+                _runs.emplace(newFirst, std::move(rest));
+            }
+            _size -= n;
+        }
+        else {
+            // Remove samples from the end of the last run
+            std::vector<glm::dvec3>& run = back->second;
+            const size_t n = std::min({
+                excess,
+                static_cast<size_t>(distanceBack),
+                run.size()
+            });
+            if (n == run.size()) {
+                _runs.erase(back);
+            }
+            else {
+                run.resize(run.size() - n);
+            }
+            _size -= n;
+        }
+    }
+}
+
+void TrailSampleCache::clear() {
+    _runs.clear();
+    _size = 0;
+    _generation++;
+}
+
+size_t TrailSampleCache::size() const {
+    return _size;
+}
+
+uint64_t TrailSampleCache::generation() const {
+    return _generation;
+}
+
+} // namespace openspace
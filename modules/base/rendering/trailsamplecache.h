@@ -0,0 +1,134 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_BASE___TRAILSAMPLECACHE___H__
+#define __OPENSPACE_MODULE_BASE___TRAILSAMPLECACHE___H__
+
+#include <ghoul/glm.h>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Stores positions of a trail that were sampled on a regular time grid so that they can
+ * be reused when the trail has to be regenerated. The grid is defined by an origin and an
+ * interval, with the sample with the index `i` being located at the time
+ * `origin + i * interval`. The samples are kept in runs of consecutive indices, which
+ * makes it cheap to find the intervals that are still missing for a range of indices.
+ *
+ * Changing the grid or clearing the cache increments the generation of the cache, which
+ * can be used to detect whether samples that were computed asynchronously are still
+ * valid when they arrive.
+ */
+class TrailSampleCache {
+public:
+    /// An inclusive range of sample indices
+    struct Range {
+        int64_t first = 0;
+        int64_t last = 0;
+
+        auto operator<=>(const Range&) const = default;
+    };
+
+    /**
+     * Sets the time grid of the cache. If either the \p origin or the \p interval differ
+     * from the current values, all samples are removed.
+     *
+     * \param origin The time of the sample with the index 0 in J2000 seconds
+     * \param interval The time between two consecutive samples in seconds
+     *
+     * \pre \p interval must be positive and finite
+     */
+    void setGrid(double origin, double interval);
+
+    /**
+     * Returns the time of the sample with the provided \p index in J2000 seconds.
+     */
+    double time(int64_t index) const;
+
+    /**
+     * Returns the index of the sample at the provided \p time, or `std::nullopt` if the
+     * \p time does not lie on the grid.
+     */
+    std::optional<int64_t> index(double time) const;
+
+    /**
+     * Returns the position of the sample with the provided \p index or `nullptr` if the
+     * sample is not in the cache.
+     */
+    const glm::dvec3* find(int64_t index) const;
+
+    /**
+     * Returns the ranges of sample indices between \p first and \p last (inclusive) that
+     * are not in the cache, in ascending order.
+     */
+    std::vector<Range> missingRanges(int64_t first, int64_t last) const;
+
+    /**
+     * Adds the \p positions for consecutive samples starting at the index \p first to the
+     * cache, replacing existing samples with the same indices.
+     */
+    void insert(int64_t first, std::span<const glm::dvec3> positions);
+
+    /**
+     * Removes samples until at most \p maxSamples are left. Samples that are furthest
+     * away from the range between \p first and \p last are removed first and samples
+     * inside the range are never removed.
+     */
+    void trim(int64_t first, int64_t last, size_t maxSamples);
+
+    /**
+     * Removes all samples from the cache.
+     */
+    void clear();
+
+    /**
+     * Returns the number of samples that are stored in the cache.
+     */
+    size_t size() const;
+
+    /**
+     * Returns the generation of the cache, which changes whenever all samples are
+     * invalidated.
+     */
+    uint64_t generation() const;
+
+private:
+    double _origin = 0.0;
+    double _interval = 1.0;
+    uint64_t _generation = 0;
+    size_t _size = 0;
+
+    /// The runs of consecutive samples, indexed by the index of their first sample. Two
+    /// runs never overlap and are never adjacent
+    std::map<int64_t, std::vector<glm::dvec3>> _runs;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_BASE___TRAILSAMPLECACHE___H__
@@ -37,6 +37,7 @@ public:
     explicit ConstantRotation(const ghoul::Dictionary& dictionary);
 
     glm::dmat3 matrix(const UpdateData& data) const override;
+    bool isThreadSafe() const override;
 
     static openspace::Documentation Documentation();
 
@@ -0,0 +1,156 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/base/rotation/expressionrotation.h>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/util/updatestructures.h>
+#include <ghoul/format.h>
+#include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/dictionary.h>
+#include <ghoul/misc/exception.h>
+#include <span>
+
+namespace {
+    using namespace openspace;
+
+    constexpr std::string_view _loggerCat = "ExpressionRotation";
+
+    constexpr Property::PropertyInfo XInfo = {
+        "X",
+        "X",
+        "The expression that computes the Euler angle of the rotation in radians around "
+        "the x axis. It can use the variable `t`, which is the simulation time in "
+        "seconds past the J2000 epoch.",
+        Property::Visibility::AdvancedUser
+    };
+
+    constexpr Property::PropertyInfo YInfo = {
+        "Y",
+        "Y",
+        "The expression that computes the Euler angle of the rotation in radians around "
+        "the y axis. It can use the variable `t`, which is the simulation time in "
+        "seconds past the J2000 epoch.",
+        Property::Visibility::AdvancedUser
+    };
+
+    constexpr Property::PropertyInfo ZInfo = {
+        "Z",
+        "Z",
+        "The expression that computes the Euler angle of the rotation in radians around "
+        "the z axis. It can use the variable `t`, which is the simulation time in "
+        "seconds past the J2000 epoch.",
+        Property::Visibility::AdvancedUser
+    };
+
+    // Computes the rotation of the scene graph node from three mathematical expressions
+    // of the simulation time that provide the Euler angles, in radians, around the
+    // principal axes. In contrast to the LuaRotation, the expressions are compiled once
+    // when they are set and are then evaluated without the Lua interpreter, which makes
+    // the rotation much cheaper to evaluate.
+    //
+    // The expressions can use the variable `t`, the simulation time in seconds past the
+    // J2000 epoch, the arithmetic operators `+`, `-`, `*`, `/`, `%`, and `^`, the
+    // constants `pi` and `e`, and common mathematical functions such as `sin`, `cos`,
+    // `sqrt`, `atan2`, `min`, `max`, or `clamp`. For example, a rotation around the z
+    // axis once every day is described by `Z = "2 * pi * t / 86400"`.
+    struct [[codegen::Dictionary(ExpressionRotation)]] Parameters {
+        // [[codegen::verbatim(XInfo.description)]]
+        std::string x;
+
+        // [[codegen::verbatim(YInfo.description)]]
+        std::string y;
+
+        // [[codegen::verbatim(ZInfo.description)]]
+        std::string z;
+    };
+
+    double evaluate(const Expression& expression, double time) {
+        return expression.evaluate(std::span(&time, 1));
+    }
+} // namespace
+#include "expressionrotation_codegen.cpp"
+
+namespace openspace {
+
+Documentation ExpressionRotation::Documentation() {
+    return codegen::doc<Parameters>("base_rotation_expression");
+}
+
+ExpressionRotation::ExpressionRotation(const ghoul::Dictionary& dictionary)
+    : Rotation(dictionary)
+    , _x(XInfo)
+    , _y(YInfo)
+    , _z(ZInfo)
+{
+    const Parameters p = codegen::bake<Parameters>(dictionary);
+
+    // Invalid expressions in the dictionary are errors, whereas invalid expressions that
+    // are set later through the properties are only logged
+    _xExpression = std::make_shared<const Expression>(p.x);
+    _yExpression = std::make_shared<const Expression>(p.y);
+    _zExpression = std::make_shared<const Expression>(p.z);
+
+    _x = p.x;
+    _x.onChange([this]() { compileExpression(_x, _xExpression); });
+    addProperty(_x);
+
+    _y = p.y;
+    _y.onChange([this]() { compileExpression(_y, _yExpression); });
+    addProperty(_y);
+
+    _z = p.z;
+    _z.onChange([this]() { compileExpression(_z, _zExpression); });
+    addProperty(_z);
+}
+
+glm::dmat3 ExpressionRotation::matrix(const UpdateData& data) const {
+    const double t = data.time.j2000Seconds();
+    const glm::dvec3 angles = glm::dvec3(
+        evaluate(*_xExpression, t),
+        evaluate(*_yExpression, t),
+        evaluate(*_zExpression, t)
+    );
+    return glm::mat3_cast(glm::dquat(angles));
+}
+
+void ExpressionRotation::compileExpression(const StringProperty& property,
+                                           std::shared_ptr<const Expression>& expression)
+{
+    try {
+        expression = std::make_shared<const Expression>(property.value());
+        requireUpdate();
+    }
+    catch (const ghoul::RuntimeError& e) {
+        LERROR(std::format(
+            "Invalid expression for '{}': {}", property.identifier(), e.message
+        ));
+    }
+}
+
+bool ExpressionRotation::isThreadSafe() const {
+    return true;
+}
+
+} // namespace openspace
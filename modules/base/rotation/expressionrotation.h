@@ -22,53 +22,44 @@
  * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
  ****************************************************************************************/
 
-#ifndef __OPENSPACE_MODULE_GLOBEBROWSING___TILELOADJOB___H__
-#define __OPENSPACE_MODULE_GLOBEBROWSING___TILELOADJOB___H__
+#ifndef __OPENSPACE_MODULE_BASE___EXPRESSIONROTATION___H__
+#define __OPENSPACE_MODULE_BASE___EXPRESSIONROTATION___H__
 
-#include <openspace/util/job.h>
-#include <modules/globebrowsing/src/rawtile.h>
+#include <openspace/scene/rotation.h>
 
-#include <modules/globebrowsing/src/tileindex.h>
+#include <openspace/properties/misc/stringproperty.h>
+#include <openspace/util/expression.h>
+#include <memory>
 
 namespace openspace {
 
-class RawTileDataReader;
+class ExpressionRotation : public Rotation {
+public:
+    explicit ExpressionRotation(const ghoul::Dictionary& dictionary);
 
-struct TileLoadJob : public Job<RawTile> {
-    /**
-     * Allocates enough data for one tile. When calling #product, the ownership of this
-     * data will be released. If `product()` has not been called before the TileLoadJob is
-     * finished, the data will be deleted as it has not been exposed outside of this
-     * object.
-     */
-    TileLoadJob(RawTileDataReader& rawTileDataReader, TileIndex tileIndex);
+    glm::dmat3 matrix(const UpdateData& data) const override;
+    bool isThreadSafe() const override;
 
-    /**
-     * Destroys the allocated data pointer if it has been allocated and the TileLoadJob
-     * has ownership of it.
-     */
-    ~TileLoadJob() override;
+    static openspace::Documentation Documentation();
 
-    /**
-     * If the TileLoadJob has been created using PBO, this is the address that the
-     * RawTileDataReader will read to. In case specified so in the TileTextureInitData of
-     * RawTileDataReader, the data will also be written to CPU memory.
-     */
-    void execute() override;
+private:
+    /// Compiles the value of the \p property and replaces the \p expression with it. If
+    /// the value is not a valid expression, an error is logged and the previous
+    /// expression is kept
+    void compileExpression(const StringProperty& property,
+        std::shared_ptr<const Expression>& expression);
 
-    /**
-     * Marks the job as finised and releases ownership of the data. Unless the job is
-     * marked as finished, the pixel data will be deallocated when the job is deleted.
-     */
-    RawTile product() override;
+    StringProperty _x;
+    StringProperty _y;
+    StringProperty _z;
 
-protected:
-    RawTileDataReader& _rawTileDataReader;
-    RawTile _rawTile;
-    const TileIndex _chunkIndex;
-    bool _hasTile = false;
+    /// The compiled expressions for the three components. A compiled expression is never
+    /// modified, which makes it safe to evaluate it on any thread
+    std::shared_ptr<const Expression> _xExpression;
+    std::shared_ptr<const Expression> _yExpression;
+    std::shared_ptr<const Expression> _zExpression;
 };
 
 } // namespace openspace
 
-#endif // __OPENSPACE_MODULE_GLOBEBROWSING___TILELOADJOB___H__
+#endif // __OPENSPACE_MODULE_BASE___EXPRESSIONROTATION___H__
@@ -84,4 +84,13 @@ glm::dmat3 MultiRotation::matrix(const UpdateData& data) const {
     return res;
 }
 
+bool MultiRotation::isThreadSafe() const {
+    for (const ghoul::mm_unique_ptr<Rotation>& rotation : _rotations) {
+        if (!rotation->isThreadSafe()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace openspace
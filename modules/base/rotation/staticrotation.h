@@ -36,6 +36,7 @@ public:
     explicit StaticRotation(const ghoul::Dictionary& dictionary);
 
     glm::dmat3 matrix(const UpdateData& data) const override;
+    bool isThreadSafe() const override;
 
     static openspace::Documentation Documentation();
 
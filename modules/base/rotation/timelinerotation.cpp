@@ -141,4 +141,13 @@ glm::dmat3 TimelineRotation::matrix(const UpdateData& data) const {
     }
 }
 
+bool TimelineRotation::isThreadSafe() const {
+    for (const Keyframe<ghoul::mm_unique_ptr<Rotation>>& kf : _timeline.keyframes()) {
+        if (!kf.data->isThreadSafe()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace openspace
@@ -22,32 +22,44 @@
  * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
  ****************************************************************************************/
 
-#include <modules/globebrowsing/src/tileloadjob.h>
+#ifndef __OPENSPACE_MODULE_BASE___EXPRESSIONSCALE___H__
+#define __OPENSPACE_MODULE_BASE___EXPRESSIONSCALE___H__
 
-#include <modules/globebrowsing/src/rawtiledatareader.h>
-#include <utility>
+#include <openspace/scene/scale.h>
+
+#include <openspace/properties/misc/stringproperty.h>
+#include <openspace/util/expression.h>
+#include <memory>
 
 namespace openspace {
 
-TileLoadJob::TileLoadJob(RawTileDataReader& rawTileDataReader, TileIndex tileIndex)
-    : _rawTileDataReader(rawTileDataReader)
-    , _chunkIndex(std::move(tileIndex))
-{}
+class ExpressionScale : public Scale {
+public:
+    explicit ExpressionScale(const ghoul::Dictionary& dictionary);
+
+    glm::dvec3 scaleValue(const UpdateData& data) const override;
+    bool isThreadSafe() const override;
 
-TileLoadJob::~TileLoadJob() {
-    if (_hasTile) {
-        _rawTile.imageData = nullptr;
-    }
-}
+    static openspace::Documentation Documentation();
 
-void TileLoadJob::execute() {
-    _rawTile = _rawTileDataReader.readTileData(_chunkIndex);
-    _hasTile = true;
-}
+private:
+    /// Compiles the value of the \p property and replaces the \p expression with it. If
+    /// the value is not a valid expression, an error is logged and the previous
+    /// expression is kept
+    void compileExpression(const StringProperty& property,
+        std::shared_ptr<const Expression>& expression);
 
-RawTile TileLoadJob::product() {
-    _hasTile = false;
-    return std::move(_rawTile);
-}
+    StringProperty _x;
+    StringProperty _y;
+    StringProperty _z;
+
+    /// The compiled expressions for the three components. A compiled expression is never
+    /// modified, which makes it safe to evaluate it on any thread
+    std::shared_ptr<const Expression> _xExpression;
+    std::shared_ptr<const Expression> _yExpression;
+    std::shared_ptr<const Expression> _zExpression;
+};
 
 } // namespace openspace
+
+#endif // __OPENSPACE_MODULE_BASE___EXPRESSIONSCALE___H__
@@ -82,4 +82,13 @@ glm::dvec3 MultiScale::scaleValue(const UpdateData& data) const {
     return res;
 }
 
+bool MultiScale::isThreadSafe() const {
+    for (const ghoul::mm_unique_ptr<Scale>& scale : _scales) {
+        if (!scale->isThreadSafe()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace openspace
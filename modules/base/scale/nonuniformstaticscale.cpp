@@ -76,4 +76,8 @@ glm::dvec3 NonUniformStaticScale::scaleValue(const UpdateData&) const {
     return _scaleValue;
 }
 
+bool NonUniformStaticScale::isThreadSafe() const {
+    return true;
+}
+
 } // namespace openspace
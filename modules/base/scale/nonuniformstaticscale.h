@@ -36,6 +36,7 @@ public:
     explicit NonUniformStaticScale(const ghoul::Dictionary& dictionary);
 
     glm::dvec3 scaleValue(const UpdateData& data) const override;
+    bool isThreadSafe() const override;
 
     static openspace::Documentation Documentation();
 
@@ -75,4 +75,8 @@ glm::dvec3 StaticScale::scaleValue(const UpdateData&) const {
     return glm::dvec3(_scaleValue);
 }
 
+bool StaticScale::isThreadSafe() const {
+    return true;
+}
+
 } // namespace openspace
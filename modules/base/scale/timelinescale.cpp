@@ -142,4 +142,13 @@ glm::dvec3 TimelineScale::scaleValue(const UpdateData& data) const {
     return glm::dvec3(0.0);
 }
 
+bool TimelineScale::isThreadSafe() const {
+    for (const Keyframe<ghoul::mm_unique_ptr<Scale>>& kf : _timeline.keyframes()) {
+        if (!kf.data->isThreadSafe()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace openspace
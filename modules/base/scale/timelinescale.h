@@ -40,6 +40,7 @@ public:
 
     void update(const UpdateData& data) override;
     glm::dvec3 scaleValue(const UpdateData& data) const override;
+    bool isThreadSafe() const override;
     static openspace::Documentation Documentation();
 
 private:
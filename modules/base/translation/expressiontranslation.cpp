@@ -0,0 +1,183 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/base/translation/expressiontranslation.h>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/util/updatestructures.h>
+#include <ghoul/format.h>
+#include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/dictionary.h>
+#include <ghoul/misc/exception.h>
+#include <array>
+#include <span>
+#include <vector>
+
+namespace {
+    using namespace openspace;
+
+    constexpr std::string_view _loggerCat = "ExpressionTranslation";
+
+    constexpr Property::PropertyInfo XInfo = {
+        "X",
+        "X",
+        "The expression that computes the x component of the translation in meters. It "
+        "can use the variable `t`, which is the simulation time in seconds past the "
+        "J2000 epoch.",
+        Property::Visibility::AdvancedUser
+    };
+
+    constexpr Property::PropertyInfo YInfo = {
+        "Y",
+        "Y",
+        "The expression that computes the y component of the translation in meters. It "
+        "can use the variable `t`, which is the simulation time in seconds past the "
+        "J2000 epoch.",
+        Property::Visibility::AdvancedUser
+    };
+
+    constexpr Property::PropertyInfo ZInfo = {
+        "Z",
+        "Z",
+        "The expression that computes the z component of the translation in meters. It "
+        "can use the variable `t`, which is the simulation time in seconds past the "
+        "J2000 epoch.",
+        Property::Visibility::AdvancedUser
+    };
+
+    // Computes the translation of the scene graph node from three mathematical
+    // expressions of the simulation time, one for each principal axis, in meters. In
+    // contrast to the LuaTranslation, the expressions are compiled once when they are
+    // set and are then evaluated without the Lua interpreter. This makes the translation
+    // much cheaper to evaluate and allows it to be evaluated on other threads, for
+    // example when computing trails.
+    //
+    // The expressions can use the variable `t`, the simulation time in seconds past the
+    // J2000 epoch, the arithmetic operators `+`, `-`, `*`, `/`, `%`, and `^`, the
+    // constants `pi` and `e`, and common mathematical functions such as `sin`, `cos`,
+    // `sqrt`, `atan2`, `min`, `max`, or `clamp`. For example, a circular orbit with a
+    // radius of one astronomical unit and a period of one year is described by
+    // `X = "1.496e11 * cos(2 * pi * t / 31557600)"` and
+    // `Y = "1.496e11 * sin(2 * pi * t / 31557600)"`.
+    struct [[codegen::Dictionary(ExpressionTranslation)]] Parameters {
+        // [[codegen::verbatim(XInfo.description)]]
+        std::string x;
+
+        // [[codegen::verbatim(YInfo.description)]]
+        std::string y;
+
+        // [[codegen::verbatim(ZInfo.description)]]
+        std::string z;
+    };
+
+    double evaluate(const Expression& expression, double time) {
+        return expression.evaluate(std::span(&time, 1));
+    }
+} // namespace
+#include "expressiontranslation_codegen.cpp"
+
+namespace openspace {
+
+Documentation ExpressionTranslation::Documentation() {
+    return codegen::doc<Parameters>("base_translation_expression");
+}
+
+ExpressionTranslation::ExpressionTranslation(const ghoul::Dictionary& dictionary)
+    : Translation(dictionary)
+    , _x(XInfo)
+    , _y(YInfo)
+    , _z(ZInfo)
+{
+    const Parameters p = codegen::bake<Parameters>(dictionary);
+
+    // Invalid expressions in the dictionary are errors, whereas invalid expressions that
+    // are set later through the properties are only logged
+    _xExpression = std::make_shared<const Expression>(p.x);
+    _yExpression = std::make_shared<const Expression>(p.y);
+    _zExpression = std::make_shared<const Expression>(p.z);
+
+    _x = p.x;
+    _x.onChange([this]() { compileExpression(_x, _xExpression); });
+    addProperty(_x);
+
+    _y = p.y;
+    _y.onChange([this]() { compileExpression(_y, _yExpression); });
+    addProperty(_y);
+
+    _z = p.z;
+    _z.onChange([this]() { compileExpression(_z, _zExpression); });
+    addProperty(_z);
+}
+
+glm::dvec3 ExpressionTranslation::position(const UpdateData& data) const {
+    const double t = data.time.j2000Seconds();
+    return glm::dvec3(
+        evaluate(*_xExpression, t),
+        evaluate(*_yExpression, t),
+        evaluate(*_zExpression, t)
+    );
+}
+
+Translation::PositionFunction ExpressionTranslation::concurrentPositionFunction() const {
+    // The expressions are never modified after they have been compiled, so the function
+    // can share them with this object
+    return [x = _xExpression, y = _yExpression, z = _zExpression]
+        (std::span<const double> times, std::span<glm::dvec3> positions)
+    {
+        // The time is the only variable of the expressions, so all times are evaluated
+        // in one batch per coordinate
+        const std::array<std::span<const double>, 1> columns = { times };
+        const std::array<const Expression*, 3> expressions = {
+            x.get(), y.get(), z.get()
+        };
+        std::vector<double> values = std::vector<double>(times.size());
+        for (glm::length_t axis = 0; axis < 3; axis++) {
+            expressions[axis]->evaluate(columns, values);
+            for (size_t i = 0; i < times.size(); i++) {
+                positions[i][axis] = values[i];
+            }
+        }
+    };
+}
+
+void ExpressionTranslation::compileExpression(const StringProperty& property,
+                                            std::shared_ptr<const Expression>& expression)
+{
+    try {
+        expression = std::make_shared<const Expression>(property.value());
+        requireUpdate();
+        notifyObservers();
+    }
+    catch (const ghoul::RuntimeError& e) {
+        LERROR(std::format(
+            "Invalid expression for '{}': {}", property.identifier(), e.message
+        ));
+    }
+}
+
+bool ExpressionTranslation::isThreadSafe() const {
+    return true;
+}
+
+} // namespace openspace
@@ -22,62 +22,45 @@
  * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
  ****************************************************************************************/
 
-#include <ghoul/misc/assert.h>
-#include <modules/globebrowsing/src/prioritizingconcurrentjobmanager.h>
+#ifndef __OPENSPACE_MODULE_BASE___EXPRESSIONTRANSLATION___H__
+#define __OPENSPACE_MODULE_BASE___EXPRESSIONTRANSLATION___H__
 
-namespace openspace {
-
-template <typename P, typename KeyType>
-PrioritizingConcurrentJobManager<P, KeyType>::PrioritizingConcurrentJobManager(
-                                                              LRUThreadPool<KeyType> pool)
-    : _threadPool(std::move(pool))
-{}
+#include <openspace/scene/translation.h>
 
-template <typename P, typename KeyType>
-void PrioritizingConcurrentJobManager<P, KeyType>::enqueueJob(std::shared_ptr<Job<P>> job,
-                                                              KeyType key)
-{
-    _threadPool.enqueue([this, job]() {
-        job->execute();
-        const std::unique_lock lock(_finishedJobsMutex);
-        _finishedJobs.push(job);
-    }, key);
-}
+#include <openspace/properties/misc/stringproperty.h>
+#include <openspace/util/expression.h>
+#include <memory>
 
-template <typename P, typename KeyType>
-std::vector<KeyType>
-PrioritizingConcurrentJobManager<P, KeyType>::keysToUnfinishedJobs() {
-    return _threadPool.getUnqueuedTasksKeys();
-}
+namespace openspace {
 
-template <typename P, typename KeyType>
-std::vector<KeyType>
-PrioritizingConcurrentJobManager<P, KeyType>::keysToEnqueuedJobs() {
-    return _threadPool.getQueuedTasksKeys();
-}
+class ExpressionTranslation : public Translation {
+public:
+    explicit ExpressionTranslation(const ghoul::Dictionary& dictionary);
 
-template <typename P, typename KeyType>
-bool PrioritizingConcurrentJobManager<P, KeyType>::touch(KeyType key) {
-    return _threadPool.touch(key);
-}
+    glm::dvec3 position(const UpdateData& data) const override;
+    bool isThreadSafe() const override;
+    PositionFunction concurrentPositionFunction() const override;
 
-template <typename P, typename KeyType>
-void PrioritizingConcurrentJobManager<P, KeyType>::clearEnqueuedJobs() {
-    _threadPool.clearEnqueuedTasks();
-}
+    static openspace::Documentation Documentation();
 
-template <typename P, typename KeyType>
-std::shared_ptr<Job<P>> PrioritizingConcurrentJobManager<P, KeyType>::popFinishedJob() {
-    ghoul_assert(!_finishedJobs.empty(), "There is no finished job to pop");
+private:
+    /// Compiles the value of the \p property and replaces the \p expression with it. If
+    /// the value is not a valid expression, an error is logged and the previous
+    /// expression is kept
+    void compileExpression(const StringProperty& property,
+        std::shared_ptr<const Expression>& expression);
 
-    const std::unique_lock lock(_finishedJobsMutex);
-    std::shared_ptr<Job<P>> result = _finishedJobs.pop();
-    return result;
-}
+    StringProperty _x;
+    StringProperty _y;
+    StringProperty _z;
 
-template <typename P, typename KeyType>
-size_t PrioritizingConcurrentJobManager<P, KeyType>::numFinishedJobs() const {
-    return _finishedJobs.size();
-}
+    /// The compiled expressions for the three components. A compiled expression is never
+    /// modified, which makes it safe to evaluate it on any thread
+    std::shared_ptr<const Expression> _xExpression;
+    std::shared_ptr<const Expression> _yExpression;
+    std::shared_ptr<const Expression> _zExpression;
+};
 
 } // namespace openspace
+
+#endif // __OPENSPACE_MODULE_BASE___EXPRESSIONTRANSLATION___H__
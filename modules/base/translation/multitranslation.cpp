@@ -84,4 +84,13 @@ glm::dvec3 MultiTranslation::position(const UpdateData& data) const {
     return res;
 }
 
+bool MultiTranslation::isThreadSafe() const {
+    for (const ghoul::mm_unique_ptr<Translation>& translation : _translations) {
+        if (!translation->isThreadSafe()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace openspace
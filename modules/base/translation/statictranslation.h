@@ -36,6 +36,7 @@ public:
     explicit StaticTranslation(const ghoul::Dictionary& dictionary);
 
     glm::dvec3 position(const UpdateData& data) const override;
+    bool isThreadSafe() const override;
     static openspace::Documentation Documentation();
 
 private:
@@ -24,17 +24,24 @@
 
 #include <modules/base/translation/timelinetranslation.h>
 
+#include <modules/base/translation/statictranslation.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/scene/scene.h>
 #include <openspace/util/updatestructures.h>
 #include <openspace/util/time.h>
+#include <ghoul/format.h>
+#include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/dictionary.h>
 #include <optional>
+#include <span>
 #include <utility>
+#include <vector>
 
 namespace {
     using namespace openspace;
 
+    constexpr std::string_view _loggerCat = "TimelineTranslation";
+
     constexpr Property::PropertyInfo ShouldInterpolateInfo = {
         "ShouldInterpolate",
         "Should interpolate",
@@ -57,6 +64,28 @@ namespace {
         // [[codegen::verbatim(ShouldInterpolateInfo.description)]]
         std::optional<bool> shouldInterpolate;
     };
+
+    // Returns the indices of the last keyframe at or before the time and of the first
+    // keyframe at or after the time. If there is no keyframe on one side of the time,
+    // both indices refer to the keyframe on the other side
+    template <typename T>
+    std::pair<size_t, size_t> keyframesAround(const SampledTimeline<T>& timeline,
+                                              double time)
+    {
+        const std::span<const double> times = timeline.times();
+        if (times.size() == 1 || time <= times.front()) {
+            return { 0, 0 };
+        }
+        if (time >= times.back()) {
+            return { times.size() - 1, times.size() - 1 };
+        }
+
+        const size_t i = timeline.findInterval(time);
+        if (times[i] == time) {
+            return { i, i };
+        }
+        return { i, i + 1 };
+    }
 } // namespace
 #include "timelinetranslation_codegen.cpp"
 
@@ -72,76 +101,179 @@ TimelineTranslation::TimelineTranslation(const ghoul::Dictionary& dictionary)
 {
     const Parameters p = codegen::bake<Parameters>(dictionary);
 
+    _timeline.reserve(p.keyframes.size());
     for (const std::pair<const std::string, ghoul::Dictionary>& kf : p.keyframes) {
         const double t = Time::convertTime(kf.first);
 
         ghoul::mm_unique_ptr<Translation> translation =
             Translation::createFromDictionary(kf.second);
         translation->setIdentifier(makeIdentifier(kf.first));
-        addPropertySubOwner(translation.get());
-        _timeline.addKeyframe(t, std::move(translation));
+        Translation* ptr = translation.get();
+        if (!_timeline.addSample(t, std::move(translation))) {
+            LWARNING(std::format(
+                "Ignoring keyframe '{}' as there already is a keyframe at that time",
+                kf.first
+            ));
+            continue;
+        }
+        ptr->onParameterChange([this]() {
+            requireUpdate();
+            notifyObservers();
+        });
+        addPropertySubOwner(ptr);
     }
 
     _shouldInterpolate = p.shouldInterpolate.value_or(_shouldInterpolate);
+    _shouldInterpolate.onChange([this]() {
+        requireUpdate();
+        notifyObservers();
+    });
     addProperty(_shouldInterpolate);
 }
 
 void TimelineTranslation::initialize() {
     Translation::initialize();
-    for (const Keyframe<ghoul::mm_unique_ptr<Translation>>& kf : _timeline.keyframes()) {
-        kf.data->initialize();
+    for (const ghoul::mm_unique_ptr<Translation>& translation : _timeline.values()) {
+        translation->initialize();
     }
 }
 
 void TimelineTranslation::update(const UpdateData& data) {
-    const double now = data.time.j2000Seconds();
-    using KeyframePointer = const Keyframe<ghoul::mm_unique_ptr<Translation>>*;
-
-    if (KeyframePointer prev = _timeline.lastKeyframeBefore(now, true);  prev) {
-        prev->data->update(data);
-    }
-    if (KeyframePointer next = _timeline.firstKeyframeAfter(now, true);  next) {
-        next->data->update(data);
+    if (_timeline.nSamples() > 0) {
+        const std::span<const ghoul::mm_unique_ptr<Translation>> translations =
+            _timeline.values();
+        const auto [prev, next] = keyframesAround(_timeline, data.time.j2000Seconds());
+        translations[prev]->update(data);
+        if (next != prev) {
+            translations[next]->update(data);
+        }
     }
 
     Translation::update(data);
 }
 
 glm::dvec3 TimelineTranslation::position(const UpdateData& data) const {
-    const double now = data.time.j2000Seconds();
-    using KeyframePointer = const Keyframe<ghoul::mm_unique_ptr<Translation>>*;
-
-    KeyframePointer prev = _timeline.lastKeyframeBefore(now, true);
-    KeyframePointer next = _timeline.firstKeyframeAfter(now, true);
-
-    if (!prev && !next) {
+    if (_timeline.nSamples() == 0) {
         return glm::dvec3(0.0);
     }
-    if (!prev) {
-        prev = next;
-    }
-    if (!next) {
-        next = prev;
-    }
-    const double prevTime = prev->timestamp;
-    const double nextTime = next->timestamp;
+
+    const double now = data.time.j2000Seconds();
+    const std::span<const double> times = _timeline.times();
+    const std::span<const ghoul::mm_unique_ptr<Translation>> translations =
+        _timeline.values();
+    const auto [prev, next] = keyframesAround(_timeline, now);
+    const double prevTime = times[prev];
+    const double nextTime = times[next];
 
     if (_shouldInterpolate) {
         double t = 0.0;
         if (nextTime - prevTime > 0.0) {
             t = (now - prevTime) / (nextTime - prevTime);
         }
-        return glm::mix(prev->data->position(data), next->data->position(data), t);
+        return glm::mix(
+            translations[prev]->position(data),
+            translations[next]->position(data),
+            t
+        );
     }
     else {
         if (prevTime <= now && now < nextTime) {
-            return prev->data->position(data);
+            return translations[prev]->position(data);
         }
         else if (nextTime <= now) {
-            return next->data->position(data);
+            return translations[next]->position(data);
         }
     }
     return glm::dvec3(0.0);
 }
 
+bool TimelineTranslation::isThreadSafe() const {
+    for (const ghoul::mm_unique_ptr<Translation>& translation : _timeline.values()) {
+        if (!translation->isThreadSafe()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Translation::PositionFunction TimelineTranslation::concurrentPositionFunction() const {
+    const std::span<const double> times = _timeline.times();
+    const std::span<const ghoul::mm_unique_ptr<Translation>> translations =
+        _timeline.values();
+    if (translations.empty()) {
+        return PositionFunction();
+    }
+
+    // If all keyframes are interpolated static positions, the translation is piecewise
+    // linear in time and all times are evaluated in one pass over the samples
+    if (_shouldInterpolate) {
+        SampledTimeline<glm::dvec3> positions;
+        positions.reserve(translations.size());
+        for (size_t i = 0; i < translations.size(); i++) {
+            if (!dynamic_cast<const StaticTranslation*>(translations[i].get())) {
+                break;
+            }
+            positions.addSample(times[i], translations[i]->position(UpdateData()));
+        }
+        if (positions.nSamples() == translations.size()) {
+            return [positions = std::move(positions)](std::span<const double> t,
+                                                      std::span<glm::dvec3> result)
+            {
+                positions.evaluate(t, result);
+            };
+        }
+    }
+
+    SampledTimeline<PositionFunction> functions;
+    functions.reserve(translations.size());
+    for (size_t i = 0; i < translations.size(); i++) {
+        PositionFunction function = translations[i]->concurrentPositionFunction();
+        if (!function) {
+            return PositionFunction();
+        }
+        functions.addSample(times[i], std::move(function));
+    }
+
+    return [functions = std::move(functions), interpolate = _shouldInterpolate.value()]
+        (std::span<const double> t, std::span<glm::dvec3> result)
+    {
+        const std::span<const double> keyframeTimes = functions.times();
+        std::vector<glm::dvec3> nextPositions;
+
+        // Successive times that lie between the same keyframes are evaluated together
+        size_t begin = 0;
+        while (begin < t.size()) {
+            const std::pair<size_t, size_t> around = keyframesAround(functions, t[begin]);
+            size_t end = begin + 1;
+            while (end < t.size() && keyframesAround(functions, t[end]) == around) {
+                end++;
+            }
+
+            const auto [prev, next] = around;
+            const std::span<const double> runTimes = t.subspan(begin, end - begin);
+            const std::span<glm::dvec3> runPositions = result.subspan(begin, end - begin);
+            functions.values()[prev](runTimes, runPositions);
+            if (interpolate && next != prev) {
+                nextPositions.resize(runTimes.size());
+                functions.values()[next](runTimes, nextPositions);
+                const double t0 = keyframeTimes[prev];
+                const double t1 = keyframeTimes[next];
+                for (size_t i = 0; i < runTimes.size(); i++) {
+                    const double s = (runTimes[i] - t0) / (t1 - t0);
+                    runPositions[i] = glm::mix(runPositions[i], nextPositions[i], s);
+                }
+            }
+            else if (!interpolate) {
+                // Without interpolation, there is no position before the first keyframe
+                for (size_t i = 0; i < runTimes.size(); i++) {
+                    if (runTimes[i] < keyframeTimes[prev]) {
+                        runPositions[i] = glm::dvec3(0.0);
+                    }
+                }
+            }
+            begin = end;
+        }
+    };
+}
+
 } // namespace openspace
@@ -28,7 +28,7 @@
 #include <openspace/scene/translation.h>
 
 #include <openspace/properties/scalar/boolproperty.h>
-#include <openspace/util/timeline.h>
+#include <openspace/util/sampledtimeline.h>
 
 namespace openspace {
 
@@ -40,10 +40,14 @@ public:
 
     void update(const UpdateData& data) override;
     glm::dvec3 position(const UpdateData& data) const override;
+    bool isThreadSafe() const override;
+    PositionFunction concurrentPositionFunction() const override;
     static openspace::Documentation Documentation();
 
 private:
-    Timeline<ghoul::mm_unique_ptr<Translation>> _timeline;
+    /// The keyframe translations, whose times are stored contiguously so that
+    /// successive lookups during playback and trail sampling are constant time
+    SampledTimeline<ghoul::mm_unique_ptr<Translation>> _timeline;
     BoolProperty _shouldInterpolate;
 };
 
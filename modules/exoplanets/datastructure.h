@@ -35,6 +35,9 @@ namespace openspace {
 
 struct Documentation;
 
+// This struct is written as-is into the binary file created by the
+// ExoplanetsDataPreparationTask. New members also have to be added to the list of members
+// that is used to clear the padding bytes in that task
 struct ExoplanetDataEntry {
     /// Orbital semi-major axis in AU
     float a = std::numeric_limits<float>::quiet_NaN();
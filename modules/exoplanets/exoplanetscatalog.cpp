@@ -0,0 +1,380 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/exoplanets/exoplanetscatalog.h>
+
+#include <modules/exoplanets/exoplanetshelper.h>
+#include <modules/space/rendering/renderablehabitablezone.h>
+#include <ghoul/format.h>
+#include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/exception.h>
+#include <ghoul/misc/profiling.h>
+#include <ghoul/misc/stringhelper.h>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+namespace {
+    constexpr std::string_view _loggerCat = "ExoplanetsCatalog";
+
+    // Returns all distinct sequences of three characters in the name. The name is padded
+    // so that the beginning and end of the name also produce sequences, which makes
+    // short names and prefixes more likely to match
+    std::vector<uint32_t> trigrams(std::string_view lowercaseName) {
+        const std::string padded = std::format("  {} ", lowercaseName);
+
+        std::vector<uint32_t> res;
+        res.reserve(padded.size() - 2);
+        for (size_t i = 0; i + 2 < padded.size(); i++) {
+            const uint32_t c0 = static_cast<unsigned char>(padded[i]);
+            const uint32_t c1 = static_cast<unsigned char>(padded[i + 1]);
+            const uint32_t c2 = static_cast<unsigned char>(padded[i + 2]);
+            res.push_back((c0 << 16) | (c1 << 8) | c2);
+        }
+        std::sort(res.begin(), res.end());
+        res.erase(std::unique(res.begin(), res.end()), res.end());
+        return res;
+    }
+
+    // The edit distance between the two strings, which is the number of inserted,
+    // removed, or replaced characters, or swapped adjacent characters, that are needed to
+    // turn one string into the other
+    size_t editDistance(std::string_view lhs, std::string_view rhs) {
+        std::vector<size_t> previous = std::vector<size_t>(rhs.size() + 1);
+        std::vector<size_t> row = std::vector<size_t>(rhs.size() + 1);
+        std::vector<size_t> next = std::vector<size_t>(rhs.size() + 1);
+        std::iota(row.begin(), row.end(), size_t(0));
+        for (size_t i = 1; i <= lhs.size(); i++) {
+            next[0] = i;
+            for (size_t j = 1; j <= rhs.size(); j++) {
+                const size_t cost = lhs[i - 1] == rhs[j - 1] ? 0 : 1;
+                next[j] = std::min({ row[j] + 1, next[j - 1] + 1, row[j - 1] + cost });
+                if (i > 1 && j > 1 && lhs[i - 1] == rhs[j - 2] &&
+                    lhs[i - 2] == rhs[j - 1])
+                {
+                    next[j] = std::min(next[j], previous[j - 2] + 1);
+                }
+            }
+            std::swap(previous, row);
+            std::swap(row, next);
+        }
+        return row.back();
+    }
+} // namespace
+
+namespace openspace {
+
+ExoplanetsCatalog::ExoplanetsCatalog(std::filesystem::path dataFile,
+                                     const std::filesystem::path& lookUpTable)
+    : _data(std::move(dataFile))
+{
+    ZoneScoped;
+
+    const MemoryMappedFile lut = MemoryMappedFile(lookUpTable);
+    std::string_view content = lut.view();
+
+    // Group the planets by their host star in the order in which the stars first appear
+    std::unordered_map<std::string, size_t> indices;
+    int lineNumber = 0;
+    while (!content.empty()) {
+        lineNumber++;
+        const size_t lineEnd = content.find('\n');
+        std::string_view line = content.substr(0, lineEnd);
+        content.remove_prefix(
+            lineEnd == std::string_view::npos ? content.size() : lineEnd + 1
+        );
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty()) {
+            continue;
+        }
+
+        // Each line consists of the planet name and the location of its data entry
+        const size_t comma = line.find(',');
+        if (comma == std::string_view::npos || comma < 2) {
+            throw ghoul::RuntimeError(std::format(
+                "Invalid entry in line {} of look-up table '{}'", lineNumber, lookUpTable
+            ));
+        }
+        const std::string_view name = line.substr(0, comma);
+        const std::string_view location = line.substr(comma + 1);
+
+        size_t offset = 0;
+        const std::from_chars_result res = std::from_chars(
+            location.data(),
+            location.data() + location.size(),
+            offset
+        );
+        if (res.ec != std::errc() || _data.size() < sizeof(ExoplanetDataEntry) ||
+            offset > _data.size() - sizeof(ExoplanetDataEntry))
+        {
+            throw ghoul::RuntimeError(std::format(
+                "Invalid location in line {} of look-up table '{}'",
+                lineNumber, lookUpTable
+            ));
+        }
+
+        // Remove the last two characters, that specify the planet
+        std::string host = std::string(name.substr(0, name.size() - 2));
+        const auto [it, isNew] = indices.try_emplace(host, _systems.size());
+        if (isNew) {
+            System system;
+            system.lowercaseName = ghoul::toLowerCase(host);
+            system.starName = std::move(host);
+            _systems.push_back(std::move(system));
+        }
+        _systems[it->second].planets.push_back({ std::string(name), offset });
+        _nPlanets++;
+    }
+
+    // Compute the information that is needed for the filters up front
+    for (System& system : _systems) {
+        for (const Planet& planet : system.planets) {
+            const ExoplanetDataEntry p = entry(planet.offset);
+            if (hasSufficientData(p)) {
+                system.nSufficientPlanets++;
+                updateStarDataFromNewPlanet(system.starData, p);
+            }
+        }
+
+        const StarData& star = system.starData;
+        if (system.nSufficientPlanets == 0 || std::isnan(star.luminosity)) {
+            continue;
+        }
+        const glm::dvec4 zone = RenderableHabitableZone::computeKopparapuZoneBoundaries(
+            star.teff,
+            star.luminosity
+        );
+        for (const Planet& planet : system.planets) {
+            const ExoplanetDataEntry p = entry(planet.offset);
+            if (!hasSufficientData(p)) {
+                continue;
+            }
+            const double a = static_cast<double>(p.a);
+            if (a >= zone[1] && a <= zone[2]) {
+                system.hasConservativeHabitablePlanet = true;
+            }
+            if (a >= zone[0] && a <= zone[3]) {
+                system.hasOptimisticHabitablePlanet = true;
+            }
+        }
+    }
+
+    // Sorting the systems by name makes the prefix search a binary search
+    std::sort(
+        _systems.begin(),
+        _systems.end(),
+        [](const System& lhs, const System& rhs) {
+            return std::tie(lhs.lowercaseName, lhs.starName) <
+                   std::tie(rhs.lowercaseName, rhs.starName);
+        }
+    );
+
+    _systemIndices.reserve(_systems.size());
+    for (size_t i = 0; i < _systems.size(); i++) {
+        _systemIndices[_systems[i].starName] = i;
+        for (uint32_t trigram : trigrams(_systems[i].lowercaseName)) {
+            _trigrams[trigram].push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    LINFO(std::format(
+        "Loaded {} exoplanets in {} systems", _nPlanets, _systems.size()
+    ));
+}
+
+size_t ExoplanetsCatalog::nSystems() const {
+    return _systems.size();
+}
+
+size_t ExoplanetsCatalog::nPlanets() const {
+    return _nPlanets;
+}
+
+bool ExoplanetsCatalog::hasSystem(std::string_view starName) const {
+    return _systemIndices.contains(starName);
+}
+
+ExoplanetSystem ExoplanetsCatalog::system(std::string_view starName) const {
+    ExoplanetSystem result;
+    result.starName = starName;
+
+    const auto it = _systemIndices.find(starName);
+    if (it == _systemIndices.end()) {
+        return result;
+    }
+
+    for (const Planet& planet : _systems[it->second].planets) {
+        const ExoplanetDataEntry p = entry(planet.offset);
+        std::string name = planet.name;
+        sanitizeNameString(name);
+
+        if (!hasSufficientData(p)) {
+            LWARNING(std::format("Insufficient data for exoplanet '{}'", name));
+            continue;
+        }
+
+        result.planetNames.push_back(std::move(name));
+        result.planetsData.push_back(p);
+        updateStarDataFromNewPlanet(result.starData, p);
+    }
+    return result;
+}
+
+std::vector<std::string> ExoplanetsCatalog::systems(const Filter& filter) const {
+    std::vector<std::string> res;
+    for (const System& system : _systems) {
+        if (passes(system, filter)) {
+            res.push_back(system.starName);
+        }
+    }
+    return res;
+}
+
+std::vector<std::string> ExoplanetsCatalog::searchPrefix(std::string_view prefix,
+                                                         size_t maxResults,
+                                                         const Filter& filter) const
+{
+    const std::string lowercase = ghoul::toLowerCase(std::string(prefix));
+
+    auto it = std::lower_bound(
+        _systems.begin(),
+        _systems.end(),
+        lowercase,
+        [](const System& system, const std::string& value) {
+            return system.lowercaseName < value;
+        }
+    );
+
+    std::vector<std::string> res;
+    for (; it != _systems.end() && res.size() < maxResults; it++) {
+        if (!it->lowercaseName.starts_with(lowercase)) {
+            break;
+        }
+        if (passes(*it, filter)) {
+            res.push_back(it->starName);
+        }
+    }
+    return res;
+}
+
+std::vector<std::string> ExoplanetsCatalog::searchFuzzy(std::string_view name,
+                                                        size_t maxResults,
+                                                        const Filter& filter) const
+{
+    if (name.empty() || maxResults == 0) {
+        return std::vector<std::string>();
+    }
+    const std::string lowercase = ghoul::toLowerCase(std::string(name));
+
+    // Count how many sequences of three characters each system shares with the name
+    std::vector<uint32_t> counts = std::vector<uint32_t>(_systems.size(), 0);
+    std::vector<uint32_t> candidates;
+    for (uint32_t trigram : trigrams(lowercase)) {
+        const auto it = _trigrams.find(trigram);
+        if (it == _trigrams.end()) {
+            continue;
+        }
+        for (uint32_t index : it->second) {
+            if (counts[index] == 0) {
+                candidates.push_back(index);
+            }
+            counts[index]++;
+        }
+    }
+    std::erase_if(
+        candidates,
+        [this, &filter](uint32_t index) { return !passes(_systems[index], filter); }
+    );
+
+    // Only the candidates that share the most sequences are compared by their edit
+    // distance, which is the more expensive measure
+    const size_t nCompared = std::min(
+        candidates.size(),
+        std::max<size_t>(4 * maxResults, 32)
+    );
+    std::partial_sort(
+        candidates.begin(),
+        candidates.begin() + nCompared,
+        candidates.end(),
+        [&counts](uint32_t lhs, uint32_t rhs) {
+            return counts[lhs] != counts[rhs] ? counts[lhs] > counts[rhs] : lhs < rhs;
+        }
+    );
+    candidates.resize(nCompared);
+
+    std::vector<std::pair<size_t, uint32_t>> ranked;
+    ranked.reserve(candidates.size());
+    for (uint32_t index : candidates) {
+        const size_t distance = editDistance(lowercase, _systems[index].lowercaseName);
+        ranked.emplace_back(distance, index);
+    }
+    std::sort(ranked.begin(), ranked.end());
+
+    std::vector<std::string> res;
+    res.reserve(std::min(maxResults, ranked.size()));
+    for (size_t i = 0; i < ranked.size() && i < maxResults; i++) {
+        res.push_back(_systems[ranked[i].second].starName);
+    }
+    return res;
+}
+
+ExoplanetDataEntry ExoplanetsCatalog::entry(size_t offset) const {
+    // The entries in the file are not aligned, so they have to be copied
+    ExoplanetDataEntry p;
+    std::memcpy(&p, _data.data() + offset, sizeof(ExoplanetDataEntry));
+    return p;
+}
+
+bool ExoplanetsCatalog::passes(const System& system, const Filter& filter) const {
+    if (filter.requireSufficientData && system.nSufficientPlanets == 0) {
+        return false;
+    }
+    if (system.nSufficientPlanets < filter.minNumberOfPlanets) {
+        return false;
+    }
+    if (filter.requireHabitablePlanet) {
+        const bool isHabitable = filter.useOptimisticZone ?
+            system.hasOptimisticHabitablePlanet :
+            system.hasConservativeHabitablePlanet;
+        if (!isHabitable) {
+            return false;
+        }
+    }
+    if (filter.maxDistance.has_value()) {
+        // Stars without a valid position are never close enough
+        const float distance = glm::length(system.starData.position);
+        if (!(distance <= *filter.maxDistance)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace openspace
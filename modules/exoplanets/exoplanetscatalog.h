@@ -0,0 +1,176 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_EXOPLANETS___EXOPLANETSCATALOG___H__
+#define __OPENSPACE_MODULE_EXOPLANETS___EXOPLANETSCATALOG___H__
+
+#include <modules/exoplanets/datastructure.h>
+#include <openspace/util/memorymappedfile.h>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * An index over the exoplanet data files that are created by the
+ * ExoplanetsDataPreparationTask. The look-up table is only read once, when the catalog is
+ * created, and the planets are grouped by their host star in a hash map. The binary data
+ * file is memory mapped and the individual entries are only copied out of it when they
+ * are requested.
+ *
+ * In addition to finding a system by the exact name of its host star, the catalog
+ * supports case-insensitive prefix searches, a fuzzy search that tolerates misspelled
+ * names, and queries that filter the systems by some of their properties, for example
+ * whether any of their planets orbits in the habitable zone of the star. The information
+ * needed for the filters is computed when the catalog is created, so all queries only
+ * touch the in-memory index.
+ */
+class ExoplanetsCatalog {
+public:
+    struct Filter {
+        /// Only include systems with at least one planet that has sufficient data for
+        /// a visualization
+        bool requireSufficientData = true;
+        /// Only include systems with at least one planet whose semi-major axis is inside
+        /// the habitable zone of the host star
+        bool requireHabitablePlanet = false;
+        /// If `true`, the optimistic boundaries of the habitable zone are used instead of
+        /// the conservative boundaries
+        bool useOptimisticZone = false;
+        /// The minimum number of planets with sufficient data in the system
+        int minNumberOfPlanets = 0;
+        /// The maximum distance of the host star from the Sun in parsec
+        std::optional<float> maxDistance;
+    };
+
+    /**
+     * Creates the catalog from the prepared binary \p dataFile and its \p lookUpTable.
+     *
+     * \param dataFile The path to the binary file containing the ExoplanetDataEntry
+     *        records
+     * \param lookUpTable The path to the text file that maps planet names to the byte
+     *        offset of their record in the \p dataFile
+     *
+     * \throw ghoul::RuntimeError If either file could not be read or the look-up table
+     *        refers to a record outside of the \p dataFile
+     */
+    ExoplanetsCatalog(std::filesystem::path dataFile,
+        const std::filesystem::path& lookUpTable);
+
+    ExoplanetsCatalog(const ExoplanetsCatalog&) = delete;
+    ExoplanetsCatalog& operator=(const ExoplanetsCatalog&) = delete;
+
+    /**
+     * Returns the number of host stars in the catalog.
+     */
+    size_t nSystems() const;
+
+    /**
+     * Returns the number of planets in the catalog.
+     */
+    size_t nPlanets() const;
+
+    /**
+     * Returns whether the catalog contains a host star with the exact \p starName.
+     */
+    bool hasSystem(std::string_view starName) const;
+
+    /**
+     * Returns the system for the host star with the exact \p starName. Only planets with
+     * sufficient data for a visualization are included in the result. If the star does
+     * not exist, the returned system does not contain any planets.
+     *
+     * \param starName The name of the host star
+     * \return The data for the exoplanet system
+     */
+    ExoplanetSystem system(std::string_view starName) const;
+
+    /**
+     * Returns the names of all host stars that pass the \p filter in alphabetical order.
+     */
+    std::vector<std::string> systems(const Filter& filter) const;
+
+    /**
+     * Returns the names of the host stars that start with \p prefix, ignoring the case,
+     * in alphabetical order.
+     *
+     * \param prefix The beginning of the names that are searched for
+     * \param maxResults The maximum number of names that are returned
+     * \param filter The filter that the systems have to pass
+     * \return The matching names of host stars
+     */
+    std::vector<std::string> searchPrefix(std::string_view prefix, size_t maxResults,
+        const Filter& filter) const;
+
+    /**
+     * Returns the names of the host stars that are most similar to the provided \p name,
+     * ignoring the case, sorted by their edit distance to \p name. Candidates are found
+     * through the sequences of three characters they share with the \p name, so only
+     * names that have at least one such sequence in common are returned.
+     *
+     * \param name The name, possibly misspelled, that is searched for
+     * \param maxResults The maximum number of names that are returned
+     * \param filter The filter that the systems have to pass
+     * \return The most similar names of host stars
+     */
+    std::vector<std::string> searchFuzzy(std::string_view name, size_t maxResults,
+        const Filter& filter) const;
+
+private:
+    struct Planet {
+        std::string name;
+        size_t offset = 0;
+    };
+
+    struct System {
+        std::string starName;
+        std::string lowercaseName;
+        std::vector<Planet> planets;
+        StarData starData;
+        int nSufficientPlanets = 0;
+        bool hasConservativeHabitablePlanet = false;
+        bool hasOptimisticHabitablePlanet = false;
+    };
+
+    ExoplanetDataEntry entry(size_t offset) const;
+    bool passes(const System& system, const Filter& filter) const;
+
+    MemoryMappedFile _data;
+    /// All systems sorted by their lowercase name
+    std::vector<System> _systems;
+    /// Maps the name of a host star to its index in the list of systems
+    std::unordered_map<std::string_view, size_t> _systemIndices;
+    /// Maps each sequence of three characters to the systems whose name contains it
+    std::unordered_map<uint32_t, std::vector<uint32_t>> _trigrams;
+    size_t _nPlanets = 0;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_EXOPLANETS___EXOPLANETSCATALOG___H__
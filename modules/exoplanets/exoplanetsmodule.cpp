@@ -25,6 +25,7 @@
 #include <modules/exoplanets/exoplanetsmodule.h>
 
 #include <modules/exoplanets/datastructure.h>
+#include <modules/exoplanets/exoplanetscatalog.h>
 #include <modules/exoplanets/rendering/renderableorbitdisc.h>
 #include <modules/exoplanets/tasks/exoplanetsdatapreparationtask.h>
 #include <openspace/documentation/documentation.h>
@@ -35,6 +36,7 @@
 #include <ghoul/misc/assert.h>
 #include <ghoul/misc/dictionary.h>
 #include <ghoul/misc/templatefactory.h>
+#include <memory>
 #include <optional>
 #include <sstream>
 
@@ -235,6 +237,9 @@ ExoplanetsModule::ExoplanetsModule()
     _exoplanetsDataFolder.setReadOnly(true);
 
     _exoplanetsDataFolder.onChange([this]() {
+        // The catalog is recreated from the new data files the next time it is used
+        _catalog = nullptr;
+
         std::filesystem::path f = _exoplanetsDataFolder.value();
        if (!std::filesystem::is_directory(f)) {
             LERROR(std::format(
@@ -285,10 +290,24 @@ ExoplanetsModule::ExoplanetsModule()
     addProperty(_habitableZoneOpacity);
 }
 
+ExoplanetsModule::~ExoplanetsModule() = default;
+
 bool ExoplanetsModule::hasDataFiles() const {
     return !_exoplanetsDataFolder.value().empty();
 }
 
+const ExoplanetsCatalog& ExoplanetsModule::catalog() {
+    ghoul_assert(hasDataFiles(), "Data files not loaded");
+
+    if (!_catalog) {
+        _catalog = std::make_unique<ExoplanetsCatalog>(
+            exoplanetsDataPath(),
+            lookUpTablePath()
+        );
+    }
+    return *_catalog;
+}
+
 std::filesystem::path ExoplanetsModule::exoplanetsDataPath() const {
     ghoul_assert(hasDataFiles(), "Data files not loaded");
 
@@ -430,6 +449,8 @@ LuaLibrary ExoplanetsModule::luaLibrary() const {
             codegen::lua::RemoveExoplanetSystem,
             codegen::lua::SystemData,
             codegen::lua::ListOfExoplanets,
+            codegen::lua::SearchExoplanetSystems,
+            codegen::lua::FilteredListOfExoplanets,
             codegen::lua::ListAvailableExoplanetSystems,
             codegen::lua::LoadSystemDataFromCsv
         },
@@ -33,19 +33,34 @@
 #include <openspace/properties/vector/vec3property.h>
 #include <ghoul/glm.h>
 #include <filesystem>
+#include <memory>
 
 namespace openspace {
 
 struct Documentation;
+class ExoplanetsCatalog;
 
 class ExoplanetsModule : public OpenSpaceModule {
 public:
     constexpr static const char* Name = "Exoplanets";
 
     ExoplanetsModule();
-    ~ExoplanetsModule() override = default;
+    ~ExoplanetsModule() override;
 
     bool hasDataFiles() const;
+
+    /**
+     * Returns the catalog of the exoplanets in the configured data files. The catalog is
+     * created the first time this function is called and recreated if the data folder
+     * changes.
+     *
+     * \return The catalog of the exoplanets
+     *
+     * \throw ghoul::RuntimeError If the data files could not be loaded
+     * \pre #hasDataFiles must return `true`
+     */
+    const ExoplanetsCatalog& catalog();
+
     std::filesystem::path exoplanetsDataPath() const;
     std::filesystem::path lookUpTablePath() const;
     std::filesystem::path teffToBvConversionFilePath() const;
@@ -86,6 +101,8 @@ protected:
     BoolProperty _useOptimisticZone;
 
     FloatProperty _habitableZoneOpacity;
+
+    std::unique_ptr<ExoplanetsCatalog> _catalog;
 };
 
 } // namespace openspace
@@ -23,6 +23,7 @@
  ****************************************************************************************/
 
 #include <modules/exoplanets/datastructure.h>
+#include <modules/exoplanets/exoplanetscatalog.h>
 #include <modules/exoplanets/exoplanetshelper.h>
 #include <modules/exoplanets/tasks/exoplanetsdatapreparationtask.h>
 #include <openspace/engine/globals.h>
@@ -31,9 +32,11 @@
 #include <openspace/scripting/scriptengine.h>
 #include <ghoul/lua/lua_helper.h>
 #include <ghoul/misc/csvreader.h>
+#include <ghoul/misc/exception.h>
 #include <ghoul/misc/stringhelper.h>
 #include <algorithm>
 #include <map>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -43,125 +46,31 @@ namespace {
 
 constexpr std::string_view _loggerCat = "ExoplanetsModule";
 
-ExoplanetSystem findSystemInData(std::string_view starName) {
-    const ExoplanetsModule* module = global::moduleEngine->module<ExoplanetsModule>();
-
-    const std::filesystem::path binPath = module->exoplanetsDataPath();
-    std::ifstream data = std::ifstream(absPath(binPath), std::ios::in | std::ios::binary);
-    if (!data.good()) {
-        throw ghoul::lua::LuaError(std::format(
-            "Failed to open exoplanets data file '{}'", binPath
-        ));
-    }
-
-    const std::filesystem::path lutPath = module->lookUpTablePath();
-    std::ifstream lut = std::ifstream(absPath(lutPath));
-    if (!lut.good()) {
-        throw ghoul::lua::LuaError(std::format(
-            "Failed to open exoplanets look-up table '{}'", lutPath
-        ));
-    }
-
-    ExoplanetSystem system;
-
-    // 1. Search lut for the starname and return the corresponding location
-    // 2. Go to that location in the data file
-    // 3. Read sizeof(exoplanet) bytes into an exoplanet object
-    ExoplanetDataEntry p;
-    std::string line;
-    while (ghoul::getline(lut, line)) {
-        std::istringstream ss = std::istringstream(line);
-        std::string name;
-        ghoul::getline(ss, name, ',');
-
-        if (name.substr(0, name.length() - 2) != starName) {
-            continue;
-        }
-
-        std::string location_s;
-        ghoul::getline(ss, location_s);
-        long location = std::stol(location_s.c_str());
-
-        data.seekg(location);
-        data.read(reinterpret_cast<char*>(&p), sizeof(ExoplanetDataEntry));
-
-        sanitizeNameString(name);
-
-        if (!hasSufficientData(p)) {
-            LWARNING(std::format("Insufficient data for exoplanet '{}'", name));
-            continue;
-        }
-
-        system.planetNames.push_back(name);
-        system.planetsData.push_back(p);
-
-        updateStarDataFromNewPlanet(system.starData, p);
-    }
-
-    system.starName = starName;
-    return system;
-}
-
-std::vector<std::string> hostStarsWithSufficientData() {
-    const ExoplanetsModule* module = global::moduleEngine->module<ExoplanetsModule>();
+const ExoplanetsCatalog& catalog() {
+    ExoplanetsModule* module = global::moduleEngine->module<ExoplanetsModule>();
 
     if (!module->hasDataFiles()) {
         // If no data file path has been configured at all, we just bail out early here
         throw ghoul::lua::LuaError("No data path was configured for the exoplanets");
     }
 
-    const std::filesystem::path lutPath = module->lookUpTablePath();
-    std::ifstream lookupTableFile(absPath(lutPath));
-    if (!lookupTableFile.good()) {
+    try {
+        return module->catalog();
+    }
+    catch (const ghoul::RuntimeError& e) {
         throw ghoul::lua::LuaError(std::format(
-            "Failed to open lookup table file '{}'", lutPath
+            "Failed to load exoplanets data: {}", e.message
         ));
     }
+}
 
-    const std::filesystem::path binPath = module->exoplanetsDataPath();
-    std::ifstream data = std::ifstream(absPath(binPath), std::ios::in | std::ios::binary);
-    if (!data.good()) {
-        throw ghoul::lua::LuaError(std::format("Failed to open data file '{}'", binPath));
-    }
-
-    std::vector<std::string> names;
-    std::string line;
-
-    // Read number of lines
-    int nExoplanets = 0;
-    while (ghoul::getline(lookupTableFile, line)) {
-        nExoplanets++;
-    }
-    lookupTableFile.clear();
-    lookupTableFile.seekg(0);
-    names.reserve(nExoplanets);
-
-    ExoplanetDataEntry p;
-    while (ghoul::getline(lookupTableFile, line)) {
-        std::stringstream ss(line);
-        std::string name;
-        ghoul::getline(ss, name, ',');
-        // Remove the last two characters, that specify the planet
-        name = name.substr(0, name.size() - 2);
-
-        // Don't want to list systems where there is not enough data to visualize. So,
-        // test if there is before adding the name to the list
-        std::string location_s;
-        ghoul::getline(ss, location_s);
-        long location = std::stol(location_s.c_str());
-
-        data.seekg(location);
-        data.read(reinterpret_cast<char*>(&p), sizeof(ExoplanetDataEntry));
-
-        if (hasSufficientData(p)) {
-            names.push_back(name);
-        }
-    }
+ExoplanetSystem findSystemInData(std::string_view starName) {
+    return catalog().system(starName);
+}
 
-    // For easier read, sort by names and remove duplicates
-    std::sort(names.begin(), names.end());
-    names.erase(std::unique(names.begin(), names.end()), names.end());
-    return names;
+std::vector<std::string> hostStarsWithSufficientData() {
+    // Don't want to list systems where there is not enough data to visualize
+    return catalog().systems(ExoplanetsCatalog::Filter());
 }
 
 /**
@@ -214,6 +123,65 @@ std::vector<std::string> hostStarsWithSufficientData() {
     return names;
 }
 
+/**
+ * Returns a list with names of host stars that match the provided name, ignoring the
+ * case. Stars whose name starts with the provided name are returned first, followed by
+ * the stars with the most similar names, so that misspelled names can be found as well.
+ * Only systems that have sufficient data for generating a visualization are included.
+ *
+ * \param name The full or partial name of the host star
+ * \param maxResults The maximum number of names that are returned
+ *
+ * \return A list of exoplanet host star names
+ */
+[[codegen::luawrap]] std::vector<std::string> searchExoplanetSystems(std::string name,
+                                                                     int maxResults = 10)
+{
+    const size_t n = static_cast<size_t>(std::max(maxResults, 0));
+    const ExoplanetsCatalog::Filter filter;
+    std::vector<std::string> names = catalog().searchPrefix(name, n, filter);
+    if (names.size() < n) {
+        for (std::string& match : catalog().searchFuzzy(name, n, filter)) {
+            if (names.size() == n) {
+                break;
+            }
+            if (std::find(names.begin(), names.end(), match) == names.end()) {
+                names.push_back(std::move(match));
+            }
+        }
+    }
+    return names;
+}
+
+/**
+ * Returns a list with names of the host stars of all exoplanet systems that have
+ * sufficient data for generating a visualization and that match the provided criteria.
+ * Whether the optimistic or conservative habitable zone is used is decided by the
+ * module's `UseOptimisticZone` setting.
+ *
+ * \param inHabitableZone If `true`, only systems with at least one planet whose orbit is
+ *        inside the habitable zone of the star are returned
+ * \param minNumberOfPlanets The minimum number of planets with sufficient data in the
+ *        system
+ * \param maxDistance The maximum distance of the host star from the Sun, in parsec
+ *
+ * \return A list of exoplanet host star names
+ */
+[[codegen::luawrap]] std::vector<std::string> filteredListOfExoplanets(
+                                                                     bool inHabitableZone,
+                                                    std::optional<int> minNumberOfPlanets,
+                                                         std::optional<float> maxDistance)
+{
+    const ExoplanetsModule* module = global::moduleEngine->module<ExoplanetsModule>();
+
+    ExoplanetsCatalog::Filter filter;
+    filter.requireHabitablePlanet = inHabitableZone;
+    filter.useOptimisticZone = module->useOptimisticZone();
+    filter.minNumberOfPlanets = minNumberOfPlanets.value_or(0);
+    filter.maxDistance = maxDistance;
+    return catalog().systems(filter);
+}
+
 /**
  * Lists the names of the host stars of all exoplanet systems that have sufficient data
  * for generating a visualization, and prints the list to the console.
@@ -263,10 +231,15 @@ std::vector<std::string> hostStarsWithSufficientData() {
 
     std::vector<std::string> columnNames =
         ExoplanetsDataPreparationTask::readFirstDataRow(inputDataFile);
+    const std::vector<ExoplanetsDataPreparationTask::Column> columns =
+        ExoplanetsDataPreparationTask::columnLayout(columnNames);
 
     const ExoplanetsModule* module = global::moduleEngine->module<ExoplanetsModule>();
-    const std::filesystem::path
-        teffBvConversionPath = module->teffToBvConversionFilePath();
+    const ExoplanetsDataPreparationTask::LookupTables lookupTables =
+        ExoplanetsDataPreparationTask::LookupTables(
+            "",
+            module->teffToBvConversionFilePath()
+        );
 
     std::map<std::string, ExoplanetSystem> hostNameToSystemDataMap;
 
@@ -277,9 +250,8 @@ std::vector<std::string> hostStarsWithSufficientData() {
     while (ghoul::getline(inputDataFile, row)) {
         PlanetData planetData = ExoplanetsDataPreparationTask::parseDataRow(
             row,
-            columnNames,
-            "",
-            module->teffToBvConversionFilePath()
+            columns,
+            lookupTables
         );
 
         if (!hasSufficientData(planetData.dataEntry)) {
@@ -25,23 +25,164 @@
 #include <modules/exoplanets/tasks/exoplanetsdatapreparationtask.h>
 
 #include <openspace/documentation/documentation.h>
+#include <openspace/engine/globals.h>
 #include <openspace/util/coordinateconversion.h>
+#include <openspace/util/memorymappedfile.h>
+#include <openspace/util/taskscheduler.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/format.h>
 #include <ghoul/glm.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/dictionary.h>
 #include <ghoul/misc/stringhelper.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <charconv>
 #include <cmath>
+#include <cstddef>
+#include <cstring>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <string_view>
 #include <system_error>
+#include <type_traits>
+#include <unordered_map>
 
 namespace {
     constexpr std::string_view _loggerCat = "ExoplanetsDataPreparationTask";
 
+    using PreparationTask = openspace::ExoplanetsDataPreparationTask;
+    using Column = PreparationTask::Column;
+    using PlanetData = PreparationTask::PlanetData;
+
+    // The smallest number of bytes of the CSV file that we want to hand to a single
+    // parsing task. Below that the overhead of scheduling the task outweighs the parsing
+    constexpr size_t MinimumChunkSize = 256 * 1024;
+
+    // Removes a single trailing carriage return, which is what ghoul::getline does for
+    // each line and each value it reads
+    std::string_view trimCarriageReturn(std::string_view str) {
+        if (!str.empty() && str.back() == '\r') {
+            str.remove_suffix(1);
+        }
+        return str;
+    }
+
+    // Calls the function for each comma-separated value in the row. A trailing comma
+    // does not produce an empty value, the same way as repeatedly calling ghoul::getline
+    template <typename Func>
+    void forEachValue(std::string_view row, Func&& func) {
+        size_t begin = 0;
+        while (begin < row.size()) {
+            size_t end = row.find(',', begin);
+            if (end == std::string_view::npos) {
+                end = row.size();
+            }
+            if (!func(trimCarriageReturn(row.substr(begin, end - begin)))) {
+                return;
+            }
+            begin = end + 1;
+        }
+    }
+
+    // Calls the function for each line in the data. The text after the last newline is
+    // only considered a line if it is not empty, the same as repeatedly calling
+    // ghoul::getline
+    template <typename Func>
+    void forEachLine(std::string_view data, Func&& func) {
+        size_t begin = 0;
+        while (begin < data.size()) {
+            size_t end = data.find('\n', begin);
+            if (end == std::string_view::npos) {
+                end = data.size();
+            }
+            func(trimCarriageReturn(data.substr(begin, end - begin)));
+            begin = end + 1;
+        }
+    }
+
+    std::vector<PlanetData> parseChunk(std::string_view chunk,
+                                       const std::vector<Column>& columns,
+                                       const PreparationTask::LookupTables& tables)
+    {
+        std::vector<PlanetData> res;
+        forEachLine(chunk, [&](std::string_view row) {
+            res.push_back(PreparationTask::parseDataRow(row, columns, tables));
+        });
+        return res;
+    }
+
+    // Determines which bytes of an ExoplanetDataEntry are padding between its members.
+    // The padding is cleared before an entry is written to the binary file, as its
+    // content is otherwise undefined and the same CSV file would not always result in the
+    // same binary file. The mask is built from the layout of the members, so every member
+    // of the struct has to be listed here
+    constexpr std::array<bool, sizeof(openspace::ExoplanetDataEntry)> paddingBytes() {
+        using Entry = openspace::ExoplanetDataEntry;
+        static_assert(
+            std::is_standard_layout_v<Entry>,
+            "offsetof requires a standard layout type"
+        );
+
+        struct Member {
+            size_t offset;
+            size_t size;
+        };
+        constexpr std::array Members = {
+            Member { offsetof(Entry, a), sizeof(Entry::a) },
+            Member { offsetof(Entry, aUpper), sizeof(Entry::aUpper) },
+            Member { offsetof(Entry, aLower), sizeof(Entry::aLower) },
+            Member { offsetof(Entry, bigOmega), sizeof(Entry::bigOmega) },
+            Member { offsetof(Entry, bigOmegaUpper), sizeof(Entry::bigOmegaUpper) },
+            Member { offsetof(Entry, bigOmegaLower), sizeof(Entry::bigOmegaLower) },
+            Member { offsetof(Entry, binary), sizeof(Entry::binary) },
+            Member { offsetof(Entry, bmv), sizeof(Entry::bmv) },
+            Member { offsetof(Entry, ecc), sizeof(Entry::ecc) },
+            Member { offsetof(Entry, eccUpper), sizeof(Entry::eccUpper) },
+            Member { offsetof(Entry, eccLower), sizeof(Entry::eccLower) },
+            Member { offsetof(Entry, i), sizeof(Entry::i) },
+            Member { offsetof(Entry, iUpper), sizeof(Entry::iUpper) },
+            Member { offsetof(Entry, iLower), sizeof(Entry::iLower) },
+            Member { offsetof(Entry, nPlanets), sizeof(Entry::nPlanets) },
+            Member { offsetof(Entry, nStars), sizeof(Entry::nStars) },
+            Member { offsetof(Entry, omega), sizeof(Entry::omega) },
+            Member { offsetof(Entry, omegaUpper), sizeof(Entry::omegaUpper) },
+            Member { offsetof(Entry, omegaLower), sizeof(Entry::omegaLower) },
+            Member { offsetof(Entry, per), sizeof(Entry::per) },
+            Member { offsetof(Entry, perUpper), sizeof(Entry::perUpper) },
+            Member { offsetof(Entry, perLower), sizeof(Entry::perLower) },
+            Member { offsetof(Entry, r), sizeof(Entry::r) },
+            Member { offsetof(Entry, rUpper), sizeof(Entry::rUpper) },
+            Member { offsetof(Entry, rLower), sizeof(Entry::rLower) },
+            Member { offsetof(Entry, rStar), sizeof(Entry::rStar) },
+            Member { offsetof(Entry, rStarUpper), sizeof(Entry::rStarUpper) },
+            Member { offsetof(Entry, rStarLower), sizeof(Entry::rStarLower) },
+            Member { offsetof(Entry, luminosity), sizeof(Entry::luminosity) },
+            Member { offsetof(Entry, luminosityUpper), sizeof(Entry::luminosityUpper) },
+            Member { offsetof(Entry, luminosityLower), sizeof(Entry::luminosityLower) },
+            Member { offsetof(Entry, teff), sizeof(Entry::teff) },
+            Member { offsetof(Entry, teffUpper), sizeof(Entry::teffUpper) },
+            Member { offsetof(Entry, teffLower), sizeof(Entry::teffLower) },
+            Member { offsetof(Entry, tt), sizeof(Entry::tt) },
+            Member { offsetof(Entry, ttUpper), sizeof(Entry::ttUpper) },
+            Member { offsetof(Entry, ttLower), sizeof(Entry::ttLower) },
+            Member { offsetof(Entry, positionX), sizeof(Entry::positionX) },
+            Member { offsetof(Entry, positionY), sizeof(Entry::positionY) },
+            Member { offsetof(Entry, positionZ), sizeof(Entry::positionZ) }
+        };
+
+        std::array<bool, sizeof(Entry)> res;
+        res.fill(true);
+        for (const Member& member : Members) {
+            for (size_t i = member.offset; i < member.offset + member.size; i++) {
+                res[i] = false;
+            }
+        }
+        return res;
+    }
+
     // Used for generating the binary data files that are used for the exoplanet system
     // loading in OpenSpace. Using this binary file allows efficient data loading of an
     // arbitrary exoplanet system during runtime, without keeping all data in memory.
@@ -135,11 +276,11 @@ std::string ExoplanetsDataPreparationTask::description() {
 void ExoplanetsDataPreparationTask::perform(
                                            const Task::ProgressCallback& progressCallback)
 {
-    std::ifstream inputDataFile(_inputDataPath);
-    if (!inputDataFile.good()) {
+    if (!std::filesystem::is_regular_file(_inputDataPath)) {
         LERROR(std::format("Failed to open input file '{}'", _inputDataPath));
         return;
     }
+    const MemoryMappedFile inputDataFile = MemoryMappedFile(_inputDataPath);
 
     std::ofstream binFile = std::ofstream(
         _outputBinPath,
@@ -163,48 +304,109 @@ void ExoplanetsDataPreparationTask::perform(
         return;
     }
 
-    int version = 1;
-    binFile.write(reinterpret_cast<char*>(&version), sizeof(int));
-
-    // Read until the first line containing the column names and save them for later
-    const std::vector<std::string> columnNames = readFirstDataRow(inputDataFile);
-
-    // Read total number of items
-    int total = 0;
-    std::string row;
-    while (ghoul::getline(inputDataFile, row)) {
-        total++;
+    // The star positions and the color conversion are only read once for all planets
+    const LookupTables lookupTables = LookupTables(_inputSpeckPath, _teffToBvFilePath);
+
+    // Read until the first line containing the column names, skipping past comments and
+    // empty lines
+    const std::string_view content = inputDataFile.view();
+    std::string_view header;
+    size_t offset = 0;
+    while (offset < content.size()) {
+        size_t end = content.find('\n', offset);
+        if (end == std::string_view::npos) {
+            end = content.size();
+        }
+        header = trimCarriageReturn(content.substr(offset, end - offset));
+        offset = end + 1;
+        if (!header.empty() && header[0] != '#') {
+            break;
+        }
     }
-    inputDataFile.clear();
-    inputDataFile.seekg(0);
 
-    // The reading is restarted, so we need to read past the first line containing the
-    // data names, again
-    readFirstDataRow(inputDataFile);
-
-    LINFO(std::format("Loading {} exoplanets", total));
+    std::vector<std::string> columnNames;
+    forEachValue(header, [&columnNames](std::string_view name) {
+        columnNames.emplace_back(name);
+        return true;
+    });
+    const std::vector<Column> columns = columnLayout(columnNames);
+
+    // Parse the rows in line-aligned chunks concurrently. Each chunk keeps the order of
+    // its rows, so concatenating the chunks results in the order of the file
+    const std::string_view data = content.substr(std::min(offset, content.size()));
+    const size_t nChunks = std::max(data.size() / MinimumChunkSize, size_t(1));
+    const std::vector<std::string_view> chunks = splitAtLineBoundaries(data, nChunks);
+
+    // Each chunk is reported twice, once after it was parsed and once after its records
+    // were built. The callback is not required to be thread-safe
+    std::atomic<size_t> nChunksDone = 0;
+    std::mutex progressMutex;
+    auto chunkDone = [&]() {
+        const size_t done = ++nChunksDone;
+        std::lock_guard lock(progressMutex);
+        progressCallback(done / (2.f * chunks.size()));
+    };
 
-    int exoplanetCount = 0;
-    while (ghoul::getline(inputDataFile, row)) {
-        exoplanetCount++;
-        progressCallback(static_cast<float>(exoplanetCount) / static_cast<float>(total));
+    std::vector<std::vector<PlanetData>> planets =
+        std::vector<std::vector<PlanetData>>(chunks.size());
+    global::taskScheduler->parallelFor(
+        chunks.size(),
+        [&](size_t i) {
+            planets[i] = parseChunk(chunks[i], columns, lookupTables);
+            chunkDone();
+        }
+    );
 
-        PlanetData planetData = parseDataRow(
-            row,
-            columnNames,
-            _inputSpeckPath,
-            _teffToBvFilePath
-        );
+    // The first planet of each chunk determines where its records are placed in the
+    // binary file
+    std::vector<size_t> firstPlanet = std::vector<size_t>(chunks.size() + 1, 0);
+    for (size_t i = 0; i < chunks.size(); i++) {
+        firstPlanet[i + 1] = firstPlanet[i] + planets[i].size();
+    }
+    const size_t total = firstPlanet.back();
+    LINFO(std::format("Loading {} exoplanets", total));
 
-        // Create look-up table
-        const long pos = static_cast<long>(binFile.tellp());
-        const std::string planetName = planetData.host + " " + planetData.component;
-        lutFile << planetName << "," << pos << '\n';
+    constexpr int Version = 1;
+    std::vector<std::byte> binData = std::vector<std::byte>(
+        sizeof(int) + total * sizeof(ExoplanetDataEntry)
+    );
+    std::memcpy(binData.data(), &Version, sizeof(int));
+
+    // Build the records and the look-up table entries for each chunk concurrently.
+    // Their placement only depends on the position of the planet in the file
+    constexpr std::array<bool, sizeof(ExoplanetDataEntry)> Padding = paddingBytes();
+    std::vector<std::string> lutData = std::vector<std::string>(chunks.size());
+    global::taskScheduler->parallelFor(
+        chunks.size(),
+        [&](size_t i) {
+            for (size_t j = 0; j < planets[i].size(); j++) {
+                const PlanetData& planet = planets[i][j];
+                const size_t pos =
+                    sizeof(int) + (firstPlanet[i] + j) * sizeof(ExoplanetDataEntry);
+
+                std::byte* record = binData.data() + pos;
+                std::memcpy(record, &planet.dataEntry, sizeof(ExoplanetDataEntry));
+                for (size_t k = 0; k < Padding.size(); k++) {
+                    if (Padding[k]) {
+                        record[k] = std::byte(0);
+                    }
+                }
+
+                lutData[i] += std::format(
+                    "{} {},{}\n",
+                    planet.host, planet.component, pos
+                );
+            }
+            chunkDone();
+        }
+    );
 
-        binFile.write(
-            reinterpret_cast<char*>(&planetData.dataEntry),
-            sizeof(ExoplanetDataEntry)
-        );
+    binFile.write(
+        reinterpret_cast<const char*>(binData.data()),
+        static_cast<std::streamsize>(binData.size())
+    );
+    for (const std::string& lut : lutData) {
+        lutFile << lut;
     }
 
     progressCallback(1.f);
@@ -234,13 +436,66 @@ ExoplanetsDataPreparationTask::readFirstDataRow(std::ifstream& file)
     return columnNames;
 }
 
+std::vector<ExoplanetsDataPreparationTask::Column>
+ExoplanetsDataPreparationTask::columnLayout(const std::vector<std::string>& columnNames)
+{
+    static const std::unordered_map<std::string_view, Column> Columns = {
+        { "pl_letter", Column::PlanetLetter },
+        { "pl_name", Column::PlanetName },
+        { "pl_orbsmax", Column::SemiMajorAxis },
+        { "pl_orbsmaxerr1", Column::SemiMajorAxisUpper },
+        { "pl_orbsmaxerr2", Column::SemiMajorAxisLower },
+        { "pl_orbeccen", Column::Eccentricity },
+        { "pl_orbeccenerr1", Column::EccentricityUpper },
+        { "pl_orbeccenerr2", Column::EccentricityLower },
+        { "pl_orbincl", Column::Inclination },
+        { "pl_orbinclerr1", Column::InclinationUpper },
+        { "pl_orbinclerr2", Column::InclinationLower },
+        { "pl_orblper", Column::ArgumentOfPeriastron },
+        { "pl_orblpererr1", Column::ArgumentOfPeriastronUpper },
+        { "pl_orblpererr2", Column::ArgumentOfPeriastronLower },
+        { "pl_orbper", Column::Period },
+        { "pl_orbpererr1", Column::PeriodUpper },
+        { "pl_orbpererr2", Column::PeriodLower },
+        { "pl_radj", Column::Radius },
+        { "pl_radjerr1", Column::RadiusUpper },
+        { "pl_radjerr2", Column::RadiusLower },
+        { "pl_tranmid", Column::TransitMidpoint },
+        { "pl_tranmiderr1", Column::TransitMidpointUpper },
+        { "pl_tranmiderr2", Column::TransitMidpointLower },
+        { "hostname", Column::HostName },
+        { "ra", Column::RightAscension },
+        { "dec", Column::Declination },
+        { "sy_dist", Column::Distance },
+        { "st_rad", Column::StarRadius },
+        { "st_raderr1", Column::StarRadiusUpper },
+        { "st_raderr2", Column::StarRadiusLower },
+        { "st_teff", Column::EffectiveTemperature },
+        { "st_tefferr1", Column::EffectiveTemperatureUpper },
+        { "st_tefferr2", Column::EffectiveTemperatureLower },
+        { "st_lum", Column::Luminosity },
+        { "st_lumerr1", Column::LuminosityUpper },
+        { "st_lumerr2", Column::LuminosityLower },
+        { "cb_flag", Column::Binary },
+        { "sy_snum", Column::NumberOfStars },
+        { "sy_pnum", Column::NumberOfPlanets }
+    };
+
+    std::vector<Column> res;
+    res.reserve(columnNames.size());
+    for (const std::string& name : columnNames) {
+        auto it = Columns.find(name);
+        res.push_back(it != Columns.end() ? it->second : Column::Ignored);
+    }
+    return res;
+}
+
 ExoplanetsDataPreparationTask::PlanetData
-ExoplanetsDataPreparationTask::parseDataRow(const std::string& row,
-                                            const std::vector<std::string>& columnNames,
-                                          const std::filesystem::path& positionSourceFile,
-                                    const std::filesystem::path& bvFromTeffConversionFile)
+ExoplanetsDataPreparationTask::parseDataRow(std::string_view row,
+                                            const std::vector<Column>& columns,
+                                            const LookupTables& lookupTables)
 {
-    auto readFloatData = [](const std::string& str) -> float {
+    auto readFloatData = [](std::string_view str) -> float {
 #ifdef WIN32
         float result;
         auto [p, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
@@ -250,11 +505,11 @@ ExoplanetsDataPreparationTask::parseDataRow(const std::string& row,
         return std::numeric_limits<float>::quiet_NaN();
 #else // ^^^^ WIN32 // !WIN32 vvvv
         // clang is missing float support for std::from_chars
-        return !str.empty() ? std::stof(str, nullptr) : NAN;
+        return !str.empty() ? std::stof(std::string(str), nullptr) : NAN;
 #endif // WIN32
-};
+    };
 
-    auto readDoubleData = [](const std::string& str) -> double {
+    auto readDoubleData = [](std::string_view str) -> double {
 #ifdef WIN32
         double result;
         auto [p, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
@@ -264,11 +519,11 @@ ExoplanetsDataPreparationTask::parseDataRow(const std::string& row,
         return std::numeric_limits<double>::quiet_NaN();
 #else // ^^^^ WIN32 // !WIN32 vvvv
         // clang is missing double support for std::from_chars
-        return !str.empty() ? std::stod(str, nullptr) : NAN;
+        return !str.empty() ? std::stod(std::string(str), nullptr) : NAN;
 #endif // WIN32
     };
 
-    auto readIntegerData = [](const std::string& str) -> int {
+    auto readIntegerData = [](std::string_view str) -> int {
         int result = 0;
         auto [p, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
         if (ec == std::errc()) {
@@ -277,8 +532,8 @@ ExoplanetsDataPreparationTask::parseDataRow(const std::string& row,
         return -1;
     };
 
-    auto readStringData = [](const std::string& str) -> std::string {
-        std::string result = str;
+    auto readStringData = [](std::string_view str) -> std::string {
+        std::string result = std::string(str);
         result.erase(std::remove(result.begin(), result.end(), '\"'), result.end());
         return result;
     };
@@ -287,160 +542,175 @@ ExoplanetsDataPreparationTask::parseDataRow(const std::string& row,
     float dec = std::numeric_limits<float>::quiet_NaN(); // decimal degrees
     float distanceInParsec = std::numeric_limits<float>::quiet_NaN();
 
-    std::istringstream lineStream(row);
-    int columnIndex = 0;
+    size_t columnIndex = 0;
 
     ExoplanetDataEntry p;
     std::string component;
     std::string starName;
     std::string name;
 
-    std::string data;
-    while (ghoul::getline(lineStream, data, ',')) {
-        const std::string& column = columnNames[columnIndex];
+    forEachValue(row, [&](std::string_view data) {
+        if (columnIndex >= columns.size()) {
+            // The row has more values than there are columns
+            return false;
+        }
+        const Column column = columns[columnIndex];
         columnIndex++;
 
-        if (column == "pl_letter") {
-            component = readStringData(data);
-        }
-        else if (column == "pl_name") {
-            name = readStringData(data);
-        }
-        // Orbital semi-major axis
-        else if (column == "pl_orbsmax") {
-            p.a = readFloatData(data);
-        }
-        else if (column == "pl_orbsmaxerr1") {
-            p.aUpper = readDoubleData(data);
-        }
-        else if (column == "pl_orbsmaxerr2") {
-            p.aLower = -readDoubleData(data);
-        }
-        // Orbital eccentricity
-        else if (column == "pl_orbeccen") {
-            p.ecc = readFloatData(data);
-        }
-        else if (column == "pl_orbeccenerr1") {
-            p.eccUpper = readFloatData(data);
-        }
-        else if (column == "pl_orbeccenerr2") {
-            p.eccLower = -readFloatData(data);
-        }
-        // Orbital inclination
-        else if (column == "pl_orbincl") {
-            p.i = readFloatData(data);
-        }
-        else if (column == "pl_orbinclerr1") {
-            p.iUpper = readFloatData(data);
-        }
-        else if (column == "pl_orbinclerr2") {
-            p.iLower = -readFloatData(data);
-        }
-        // Argument of periastron
-        else if (column == "pl_orblper") {
-            p.omega = readFloatData(data);
-        }
-        else if (column == "pl_orblpererr1") {
-            p.omegaUpper = readFloatData(data);
-        }
-        else if (column == "pl_orblpererr2") {
-            p.omegaLower = -readFloatData(data);
-        }
-        // Orbital period
-        else if (column == "pl_orbper") {
-            p.per = readDoubleData(data);
-        }
-        else if (column == "pl_orbpererr1") {
-            p.perUpper = readFloatData(data);
-        }
-        else if (column == "pl_orbpererr2") {
-            p.perLower = -readFloatData(data);
-        }
-        // Radius of the planet (Jupiter radii)
-        else if (column == "pl_radj") {
-            p.r = readDoubleData(data);
-        }
-        else if (column == "pl_radjerr1") {
-            p.rUpper = readDoubleData(data);
-        }
-        else if (column == "pl_radjerr2") {
-            p.rLower = -readDoubleData(data);
-        }
-        // Time of transit midpoint
-        else if (column == "pl_tranmid") {
-            p.tt = readDoubleData(data);
-        }
-        else if (column == "pl_tranmiderr1") {
-            p.ttUpper = readFloatData(data);
-        }
-        else if (column == "pl_tranmiderr2") {
-            p.ttLower = -readFloatData(data);
-        }
-        // Star - name and position
-        else if (column == "hostname") {
-            starName = readStringData(data);
-            glm::vec3 position = starPosition(starName, positionSourceFile);
-            p.positionX = position[0];
-            p.positionY = position[1];
-            p.positionZ = position[2];
-        }
-        else if (column == "ra") {
-            ra = readFloatData(data);
-        }
-        else if (column == "dec") {
-            dec = readFloatData(data);
-        }
-        else if (column == "sy_dist") {
-            distanceInParsec = readFloatData(data);
-        }
-        // Star radius
-        else if (column == "st_rad") {
-            p.rStar = readFloatData(data);
-        }
-        else if (column == "st_raderr1") {
-            p.rStarUpper = readFloatData(data);
-        }
-        else if (column == "st_raderr2") {
-            p.rStarLower = -readFloatData(data);
-        }
-        // Effective temperature and color of star
-        // (B-V color index computed from star's effective temperature)
-        else if (column == "st_teff") {
-            p.teff = readFloatData(data);
-            p.bmv = bvFromTeff(p.teff, bvFromTeffConversionFile);
-        }
-        else if (column == "st_tefferr1") {
-            p.teffUpper = readFloatData(data);
-        }
-        else if (column == "st_tefferr2") {
-            p.teffLower = -readFloatData(data);
-        }
-        // Star luminosity
-        else if (column == "st_lum") {
-            const float dataInLogSolar = readFloatData(data);
-            p.luminosity = static_cast<float>(std::pow(10, dataInLogSolar));
-        }
-        else if (column == "st_lumerr1") {
-            const float dataInLogSolar = readFloatData(data);
-            p.luminosityUpper = static_cast<float>(std::pow(10, dataInLogSolar));
-        }
-        else if (column == "st_lumerr2") {
-            const float dataInLogSolar = readFloatData(data);
-            p.luminosityLower = static_cast<float>(-std::pow(10, dataInLogSolar));
-        }
-        // Is the planet orbiting a binary system?
-        else if (column == "cb_flag") {
-            p.binary = readIntegerData(data) != 0;
-        }
-        // Number of stars in the system
-        else if (column == "sy_snum") {
-            p.nStars = readIntegerData(data);
-        }
-        // Number of planets in the system
-        else if (column == "sy_pnum") {
-            p.nPlanets = readIntegerData(data);
-        }
-    }
+        switch (column) {
+            case Column::Ignored:
+                break;
+            case Column::PlanetLetter:
+                component = readStringData(data);
+                break;
+            case Column::PlanetName:
+                name = readStringData(data);
+                break;
+            // Orbital semi-major axis
+            case Column::SemiMajorAxis:
+                p.a = readFloatData(data);
+                break;
+            case Column::SemiMajorAxisUpper:
+                p.aUpper = readDoubleData(data);
+                break;
+            case Column::SemiMajorAxisLower:
+                p.aLower = -readDoubleData(data);
+                break;
+            // Orbital eccentricity
+            case Column::Eccentricity:
+                p.ecc = readFloatData(data);
+                break;
+            case Column::EccentricityUpper:
+                p.eccUpper = readFloatData(data);
+                break;
+            case Column::EccentricityLower:
+                p.eccLower = -readFloatData(data);
+                break;
+            // Orbital inclination
+            case Column::Inclination:
+                p.i = readFloatData(data);
+                break;
+            case Column::InclinationUpper:
+                p.iUpper = readFloatData(data);
+                break;
+            case Column::InclinationLower:
+                p.iLower = -readFloatData(data);
+                break;
+            // Argument of periastron
+            case Column::ArgumentOfPeriastron:
+                p.omega = readFloatData(data);
+                break;
+            case Column::ArgumentOfPeriastronUpper:
+                p.omegaUpper = readFloatData(data);
+                break;
+            case Column::ArgumentOfPeriastronLower:
+                p.omegaLower = -readFloatData(data);
+                break;
+            // Orbital period
+            case Column::Period:
+                p.per = readDoubleData(data);
+                break;
+            case Column::PeriodUpper:
+                p.perUpper = readFloatData(data);
+                break;
+            case Column::PeriodLower:
+                p.perLower = -readFloatData(data);
+                break;
+            // Radius of the planet (Jupiter radii)
+            case Column::Radius:
+                p.r = readDoubleData(data);
+                break;
+            case Column::RadiusUpper:
+                p.rUpper = readDoubleData(data);
+                break;
+            case Column::RadiusLower:
+                p.rLower = -readDoubleData(data);
+                break;
+            // Time of transit midpoint
+            case Column::TransitMidpoint:
+                p.tt = readDoubleData(data);
+                break;
+            case Column::TransitMidpointUpper:
+                p.ttUpper = readFloatData(data);
+                break;
+            case Column::TransitMidpointLower:
+                p.ttLower = -readFloatData(data);
+                break;
+            // Star - name and position
+            case Column::HostName:
+            {
+                starName = readStringData(data);
+                const glm::vec3 position = lookupTables.starPosition(starName);
+                p.positionX = position[0];
+                p.positionY = position[1];
+                p.positionZ = position[2];
+                break;
+            }
+            case Column::RightAscension:
+                ra = readFloatData(data);
+                break;
+            case Column::Declination:
+                dec = readFloatData(data);
+                break;
+            case Column::Distance:
+                distanceInParsec = readFloatData(data);
+                break;
+            // Star radius
+            case Column::StarRadius:
+                p.rStar = readFloatData(data);
+                break;
+            case Column::StarRadiusUpper:
+                p.rStarUpper = readFloatData(data);
+                break;
+            case Column::StarRadiusLower:
+                p.rStarLower = -readFloatData(data);
+                break;
+            // Effective temperature and color of star
+            // (B-V color index computed from star's effective temperature)
+            case Column::EffectiveTemperature:
+                p.teff = readFloatData(data);
+                p.bmv = lookupTables.bvFromTeff(p.teff);
+                break;
+            case Column::EffectiveTemperatureUpper:
+                p.teffUpper = readFloatData(data);
+                break;
+            case Column::EffectiveTemperatureLower:
+                p.teffLower = -readFloatData(data);
+                break;
+            // Star luminosity
+            case Column::Luminosity:
+            {
+                const float dataInLogSolar = readFloatData(data);
+                p.luminosity = static_cast<float>(std::pow(10, dataInLogSolar));
+                break;
+            }
+            case Column::LuminosityUpper:
+            {
+                const float dataInLogSolar = readFloatData(data);
+                p.luminosityUpper = static_cast<float>(std::pow(10, dataInLogSolar));
+                break;
+            }
+            case Column::LuminosityLower:
+            {
+                const float dataInLogSolar = readFloatData(data);
+                p.luminosityLower = static_cast<float>(-std::pow(10, dataInLogSolar));
+                break;
+            }
+            // Is the planet orbiting a binary system?
+            case Column::Binary:
+                p.binary = readIntegerData(data) != 0;
+                break;
+            // Number of stars in the system
+            case Column::NumberOfStars:
+                p.nStars = readIntegerData(data);
+                break;
+            // Number of planets in the system
+            case Column::NumberOfPlanets:
+                p.nPlanets = readIntegerData(data);
+                break;
+        }
+        return true;
+    });
 
     // @TODO (emmbr 2020-10-05) Currently, the dataset has no information about the
     // longitude of the ascending node, but maybe it might in the future
@@ -467,74 +737,45 @@ ExoplanetsDataPreparationTask::parseDataRow(const std::string& row,
     };
 }
 
-glm::vec3 ExoplanetsDataPreparationTask::starPosition(const std::string& starName,
-                                                  const std::filesystem::path& sourceFile)
+ExoplanetsDataPreparationTask::LookupTables::LookupTables(
+                                          const std::filesystem::path& positionSourceFile,
+                                    const std::filesystem::path& bvFromTeffConversionFile)
 {
-    glm::vec3 position = glm::vec3(std::numeric_limits<float>::quiet_NaN());
-
-    if (sourceFile.empty()) {
-        // No file specified => return NaN position
-        return position;
-    }
+    if (!positionSourceFile.empty()) {
+        std::ifstream exoplanetsFile(positionSourceFile);
+        if (!exoplanetsFile) {
+            LERROR(std::format("Error opening file '{}'", positionSourceFile));
+        }
 
-    std::ifstream exoplanetsFile(sourceFile);
-    if (!exoplanetsFile) {
-        LERROR(std::format("Error opening file '{}'", sourceFile));
-    }
+        std::string line;
+        while (ghoul::getline(exoplanetsFile, line)) {
+            const bool shouldSkipLine =
+                line.empty() || line[0] == '#' || line.substr(0, 7) == "datavar" ||
+                line.substr(0, 10) == "texturevar" || line.substr(0, 7) == "texture";
 
-    std::string line;
-    while (ghoul::getline(exoplanetsFile, line)) {
-        const bool shouldSkipLine =
-            line.empty() || line[0] == '#' || line.substr(0, 7) == "datavar" ||
-            line.substr(0, 10) == "texturevar" || line.substr(0, 7) == "texture";
+            if (shouldSkipLine) {
+                continue;
+            }
 
-        if (shouldSkipLine) {
-            continue;
-        }
+            std::string data;
+            std::string name;
+            std::istringstream linestream = std::istringstream(line);
+            ghoul::getline(linestream, data, '#');
+            ghoul::getline(linestream, name);
+            name.erase(0, 1);
 
-        std::string data;
-        std::string name;
-        std::istringstream linestream = std::istringstream(line);
-        ghoul::getline(linestream, data, '#');
-        ghoul::getline(linestream, name);
-        name.erase(0, 1);
-
-        std::string coord;
-        if (name == starName) {
-            std::stringstream dataStream(data);
-            ghoul::getline(dataStream, coord, ' ');
-            position.x = std::stof(coord, nullptr);
-            ghoul::getline(dataStream, coord, ' ');
-            position.y = std::stof(coord, nullptr);
-            ghoul::getline(dataStream, coord, ' ');
-            position.z = std::stof(coord, nullptr);
-            break;
+            // Only the first line for each star is used. The position values are parsed
+            // when they are requested
+            _starData.try_emplace(std::move(name), std::move(data));
         }
     }
 
-    return position;
-}
-
-float ExoplanetsDataPreparationTask::bvFromTeff(float teff,
-                                              const std::filesystem::path& conversionFile)
-{
-    if (std::isnan(teff)) {
-        return std::numeric_limits<float>::quiet_NaN();
-    }
-
-    std::ifstream teffToBvFile(conversionFile);
+    std::ifstream teffToBvFile(bvFromTeffConversionFile);
     if (!teffToBvFile.good()) {
-        LERROR(std::format("Failed to open file '{}'", conversionFile));
-        return std::numeric_limits<float>::quiet_NaN();
+        LERROR(std::format("Failed to open file '{}'", bvFromTeffConversionFile));
+        return;
     }
 
-    // Find the line in the file that most closely corresponds to the specified teff, and
-    // finally interpolate the value
-    float bv = 0.f;
-    float bvUpper = 0.f;
-    float bvLower = 0.f;
-    float teffLower = 0.f;
-    float teffUpper = 0.f;
     std::string row;
     while (ghoul::getline(teffToBvFile, row)) {
         std::istringstream lineStream(row);
@@ -543,28 +784,63 @@ float ExoplanetsDataPreparationTask::bvFromTeff(float teff,
         std::string bvString;
         ghoul::getline(lineStream, bvString);
 
-        const float teffCurrent = std::stof(teffString, nullptr);
-        const float bvCurrent = std::stof(bvString, nullptr);
+        const float teff = std::stof(teffString, nullptr);
+        _teff.push_back(teff);
+        _bv.push_back(std::stof(bvString, nullptr));
 
-        if (teff > teffCurrent) {
-            teffLower = teffCurrent;
-            bvLower = bvCurrent;
-        }
-        else {
-            teffUpper = teffCurrent;
-            bvUpper = bvCurrent;
-            if (bvLower == 0.f) {
-                bv = 2.f;
-            }
-            else {
-                const float bvDiff = (bvUpper - bvLower);
-                const float teffDiff = (teffUpper - teffLower);
-                bv = ((bvDiff * (teff - teffLower)) / teffDiff) + bvLower;
-            }
-            break;
-        }
+        // A row with a NaN temperature is always chosen when searching through the rows
+        const float searchTeff =
+            std::isnan(teff) ? std::numeric_limits<float>::infinity() : teff;
+        _maxTeff.push_back(
+            _maxTeff.empty() ? searchTeff : std::max(_maxTeff.back(), searchTeff)
+        );
     }
-    return bv;
+    _hasConversionTable = true;
+}
+
+glm::vec3 ExoplanetsDataPreparationTask::LookupTables::starPosition(
+                                                       const std::string& starName) const
+{
+    glm::vec3 position = glm::vec3(std::numeric_limits<float>::quiet_NaN());
+
+    auto it = _starData.find(starName);
+    if (it == _starData.end()) {
+        return position;
+    }
+
+    std::string coord;
+    std::stringstream dataStream(it->second);
+    ghoul::getline(dataStream, coord, ' ');
+    position.x = std::stof(coord, nullptr);
+    ghoul::getline(dataStream, coord, ' ');
+    position.y = std::stof(coord, nullptr);
+    ghoul::getline(dataStream, coord, ' ');
+    position.z = std::stof(coord, nullptr);
+    return position;
+}
+
+float ExoplanetsDataPreparationTask::LookupTables::bvFromTeff(float teff) const {
+    if (std::isnan(teff) || !_hasConversionTable) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+
+    // Find the first row in the table with a teff that is not smaller than the specified
+    // teff, and interpolate the value with the row before it
+    auto it = std::lower_bound(_maxTeff.begin(), _maxTeff.end(), teff);
+    if (it == _maxTeff.end()) {
+        return 0.f;
+    }
+
+    const size_t upper = std::distance(_maxTeff.begin(), it);
+    const float bvLower = upper > 0 ? _bv[upper - 1] : 0.f;
+    if (bvLower == 0.f) {
+        return 2.f;
+    }
+
+    const float teffLower = _teff[upper - 1];
+    const float bvDiff = (_bv[upper] - bvLower);
+    const float teffDiff = (_teff[upper] - teffLower);
+    return ((bvDiff * (teff - teffLower)) / teffDiff) + bvLower;
 }
 
 } // namespace openspace
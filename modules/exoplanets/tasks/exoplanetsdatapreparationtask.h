@@ -30,6 +30,10 @@
 #include <modules/exoplanets/datastructure.h>
 #include <filesystem>
 #include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace openspace {
 
@@ -42,6 +46,104 @@ public:
         ExoplanetDataEntry dataEntry;
     };
 
+    /**
+     * The columns of the CSV file of exoplanets that are used when parsing a row. All
+     * other columns are ignored.
+     */
+    enum class Column {
+        Ignored = 0,
+        PlanetLetter,
+        PlanetName,
+        SemiMajorAxis,
+        SemiMajorAxisUpper,
+        SemiMajorAxisLower,
+        Eccentricity,
+        EccentricityUpper,
+        EccentricityLower,
+        Inclination,
+        InclinationUpper,
+        InclinationLower,
+        ArgumentOfPeriastron,
+        ArgumentOfPeriastronUpper,
+        ArgumentOfPeriastronLower,
+        Period,
+        PeriodUpper,
+        PeriodLower,
+        Radius,
+        RadiusUpper,
+        RadiusLower,
+        TransitMidpoint,
+        TransitMidpointUpper,
+        TransitMidpointLower,
+        HostName,
+        RightAscension,
+        Declination,
+        Distance,
+        StarRadius,
+        StarRadiusUpper,
+        StarRadiusLower,
+        EffectiveTemperature,
+        EffectiveTemperatureUpper,
+        EffectiveTemperatureLower,
+        Luminosity,
+        LuminosityUpper,
+        LuminosityLower,
+        Binary,
+        NumberOfStars,
+        NumberOfPlanets
+    };
+
+    /**
+     * The star positions and the conversion from effective temperature to B-V color
+     * index that are used when parsing the rows of the CSV file. Both files are read once
+     * when the tables are created instead of once for every parsed row.
+     */
+    class LookupTables {
+    public:
+        /**
+         * Reads the star positions and the conversion table from the provided files.
+         *
+         * \param positionSourceFile A SPECK file to use for getting the position of the
+         *        stars. If the path is empty, no star positions are available
+         * \param bvFromTeffConversionFile A text file containing a mapping between
+         *        effective temperature (teff) values and B-V color index values. Each
+         *        line should include two values separated by a comma: first the teff
+         *        value and then the B-V value
+         */
+        LookupTables(const std::filesystem::path& positionSourceFile,
+            const std::filesystem::path& bvFromTeffConversionFile);
+
+        /**
+         * Returns the position of the star with the provided name from the SPECK file. If
+         * the star is not found, the returned position will contain NaN values.
+         *
+         * \param starName The name of the star to look for
+         * eturn The resulting star position, given in galactic XYZ
+         */
+        glm::vec3 starPosition(const std::string& starName) const;
+
+        /**
+         * Computes the B-V color index for the provided \p teff value by interpolating
+         * between the closest rows of the conversion table.
+         *
+         * \param teff The effective temperature of the star
+         * \return The B-V color index or NaN if no conversion table is available
+         */
+        float bvFromTeff(float teff) const;
+
+    private:
+        /// The position values of the first line in the SPECK file for each star name
+        std::unordered_map<std::string, std::string> _starData;
+
+        bool _hasConversionTable = false;
+        std::vector<float> _teff;
+        std::vector<float> _bv;
+        /// The largest teff value of all rows up to each row, which makes it possible to
+        /// find the first row with a teff that is not smaller than a requested value
+        /// with a binary search, regardless of the order of the rows in the file
+        std::vector<float> _maxTeff;
+    };
+
     explicit ExoplanetsDataPreparationTask(const ghoul::Dictionary& dictionary);
 
     std::string description() override;
@@ -58,28 +160,32 @@ public:
      */
     static std::vector<std::string> readFirstDataRow(std::ifstream& file);
 
+    /**
+     * Determines which of the \p columnNames are used by #parseDataRow. The result
+     * should be computed once per file and then be used for all of its rows, so that the
+     * column names do not have to be compared for every row.
+     *
+     * \param columnNames The list of column names in the file, from the CSV header
+     * \return The meaning of each column in the file
+     */
+    static std::vector<Column> columnLayout(const std::vector<std::string>& columnNames);
+
     /**
      * Parse a row in the CSV file of exoplanets. Assumes the same format and column names
      * as provided by the NASA Exoplanet Archive.
      *
      * \param row The row to parse, given as a string
-     * \param columnNames The list of column names in the file, from the CSV header
-     * \param positionSourceFile A SPECK file to use for getting the position of the star.
-     *        This is used to make sure the position of the star matches those of other
-     *        star datasets. If no file is provided, the position from the CSV data file
-     *        is read and used instead
-     * \param bvFromTeffConversionFile A text file containing a mapping between effective
-     *        temperature (teff) values and B-V color index values. Each line should
-     *        include two values separated by a comma: first the teff value and then the
-     *        B-V value
+     * \param columns The meaning of each column in the file, as returned by
+     *        #columnLayout
+     * \param lookupTables The star positions and color conversion table. If a star is
+     *        not found in the star positions, the position from the CSV data file is
+     *        read and used instead
      * \return An object containing the parsed information
      *
      * /sa https://exoplanetarchive.ipac.caltech.edu/
      */
-    static PlanetData parseDataRow(const std::string& row,
-        const std::vector<std::string>& columnNames,
-        const std::filesystem::path& positionSourceFile,
-        const std::filesystem::path& bvFromTeffConversionFile);
+    static PlanetData parseDataRow(std::string_view row,
+        const std::vector<Column>& columns, const LookupTables& lookupTables);
 
 private:
     std::filesystem::path _inputDataPath;
@@ -87,22 +193,6 @@ private:
     std::filesystem::path _outputBinPath;
     std::filesystem::path _outputLutPath;
     std::filesystem::path _teffToBvFilePath;
-
-    /**
-     * Try to find the star position from an input speck file. If not found, the returned
-     * position will contain NaN values.
-     *
-     * \param starName The name of the star to look for in the file
-     * \param sourceFile The name of the file in which to look
-     * \return The resulting star position, given in galactix XYZ
-     */
-    static glm::vec3 starPosition(const std::string& starName,
-        const std::filesystem::path& sourceFile);
-
-    /**
-     * Compute b - v color from teff value using a conversion file.
-     */
-    static float bvFromTeff(float teff, const std::filesystem::path& conversionFile);
 };
 
 } // namespace openspace
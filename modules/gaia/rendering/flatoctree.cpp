@@ -0,0 +1,204 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/gaia/rendering/flatoctree.h>
+
+#include <modules/gaia/rendering/octreeculler.h>
+#include <openspace/util/distanceconstants.h>
+#include <ghoul/misc/assert.h>
+#include <array>
+
+namespace {
+    using namespace openspace;
+
+    constexpr size_t PosSize = 3;
+    constexpr size_t ColSize = 2;
+    constexpr size_t VelSize = 3;
+
+    /**
+     * Calculates the corners of the \p node in the same order and units as the
+     * OctreeManager does.
+     */
+    void nodeCorners(const FlatOctree::Node& node, std::array<glm::dvec4, 8>& corners) {
+        for (int i = 0; i < 8; i++) {
+            const float x = (i % 2 == 0) ?
+                node.origin.x + node.halfDimension :
+                node.origin.x - node.halfDimension;
+            const float y = (i % 4 < 2) ?
+                node.origin.y + node.halfDimension :
+                node.origin.y - node.halfDimension;
+            const float z = (i < 4) ?
+                node.origin.z + node.halfDimension :
+                node.origin.z - node.halfDimension;
+            const glm::dvec3 pos =
+                glm::dvec3(x, y, z) * 1000.0 * distanceconstants::Parsec;
+            corners[i] = glm::dvec4(pos, 1.0);
+        }
+    }
+} // namespace
+
+namespace openspace {
+
+bool FlatOctree::Node::isLeaf() const {
+    return firstChild == NoChildren;
+}
+
+FlatOctree::FlatOctree(const OctreeManager& octree) {
+    const OctreeManager::OctreeNode& root = octree.root();
+
+    // Breadth-first traversal in which all children of a node are appended at the same
+    // time, which places them next to each other in the node array
+    std::vector<const OctreeManager::OctreeNode*> sources = { &root };
+    _nodes.push_back(Node());
+    size_t nStoredStars = 0;
+    for (size_t i = 0; i < sources.size(); i++) {
+        const OctreeManager::OctreeNode& source = *sources[i];
+
+        Node node;
+        node.origin = glm::vec3(source.originX, source.originY, source.originZ);
+        node.halfDimension = source.halfDimension;
+        node.nStars = static_cast<uint32_t>(source.numStars);
+        node.firstStar = static_cast<uint32_t>(nStoredStars);
+        node.nStoredStars = static_cast<uint32_t>(source.posData.size() / PosSize);
+        nStoredStars += node.nStoredStars;
+
+        if (!source.isLeaf) {
+            node.firstChild = static_cast<uint32_t>(_nodes.size());
+            for (const std::shared_ptr<OctreeManager::OctreeNode>& c : source.children) {
+                sources.push_back(c.get());
+                _nodes.push_back(Node());
+            }
+        }
+        _nodes[i] = node;
+    }
+
+    // The root of the OctreeManager does not store its own extent, it is determined by
+    // the maximum distance of the Octree instead
+    _nodes[0].halfDimension = static_cast<float>(octree.maxDist());
+    _nodes.shrink_to_fit();
+
+    _stars.positionX.resize(nStoredStars);
+    _stars.positionY.resize(nStoredStars);
+    _stars.positionZ.resize(nStoredStars);
+    _stars.magnitude.resize(nStoredStars);
+    _stars.color.resize(nStoredStars);
+    _stars.velocityX.resize(nStoredStars);
+    _stars.velocityY.resize(nStoredStars);
+    _stars.velocityZ.resize(nStoredStars);
+    for (size_t i = 0; i < sources.size(); i++) {
+        const OctreeManager::OctreeNode& source = *sources[i];
+        const Node& node = _nodes[i];
+        ghoul_assert(
+            source.colData.size() == node.nStoredStars * ColSize &&
+            source.velData.size() == node.nStoredStars * VelSize,
+            "Star data of node is incomplete"
+        );
+
+        for (uint32_t s = 0; s < node.nStoredStars; s++) {
+            const size_t idx = node.firstStar + s;
+            _stars.positionX[idx] = source.posData[s * PosSize];
+            _stars.positionY[idx] = source.posData[s * PosSize + 1];
+            _stars.positionZ[idx] = source.posData[s * PosSize + 2];
+            _stars.magnitude[idx] = source.colData[s * ColSize];
+            _stars.color[idx] = source.colData[s * ColSize + 1];
+            _stars.velocityX[idx] = source.velData[s * VelSize];
+            _stars.velocityY[idx] = source.velData[s * VelSize + 1];
+            _stars.velocityZ[idx] = source.velData[s * VelSize + 2];
+        }
+    }
+}
+
+void FlatOctree::findVisibleNodes(OctreeCuller& culler, const glm::dmat4& mvp,
+                                  const glm::vec2& screenSize, float lodPixelThreshold,
+                                  std::vector<uint32_t>& result) const
+{
+    result.clear();
+    if (_nodes.empty()) {
+        return;
+    }
+
+    std::array<glm::dvec4, 8> corners;
+
+    // Check if the entire tree is too small to see. Just as in the OctreeManager, the
+    // root itself is never rendered
+    const Node& root = _nodes[0];
+    nodeCorners(root, corners);
+    if (root.isLeaf() || !culler.isVisible(corners, mvp)) {
+        return;
+    }
+    const glm::vec2 rootSize = culler.getNodeSizeInPixels(corners, mvp, screenSize);
+    if (rootSize.x * rootSize.y < lodPixelThreshold * 2) {
+        return;
+    }
+
+    // Depth-first traversal with an explicit stack. The children are pushed in reverse
+    // so that they are visited in the same Morton order as in the OctreeManager
+    std::vector<uint32_t> stack;
+    stack.reserve(64);
+    for (uint32_t i = 8; i > 0; i--) {
+        stack.push_back(root.firstChild + i - 1);
+    }
+
+    while (!stack.empty()) {
+        const uint32_t index = stack.back();
+        stack.pop_back();
+
+        const Node& node = _nodes[index];
+        nodeCorners(node, corners);
+        if (!culler.isVisible(corners, mvp)) {
+            continue;
+        }
+
+        if (!node.isLeaf()) {
+            const glm::vec2 size = culler.getNodeSizeInPixels(corners, mvp, screenSize);
+            if (size.x * size.y >= lodPixelThreshold) {
+                // The node is big enough on screen that we need to traverse its children
+                for (uint32_t i = 8; i > 0; i--) {
+                    stack.push_back(node.firstChild + i - 1);
+                }
+                continue;
+            }
+        }
+
+        if (node.nStars > 0) {
+            result.push_back(index);
+        }
+    }
+}
+
+const std::vector<FlatOctree::Node>& FlatOctree::nodes() const {
+    return _nodes;
+}
+
+const FlatOctree::StarData& FlatOctree::stars() const {
+    return _stars;
+}
+
+size_t FlatOctree::memoryFootprint() const {
+    const size_t nStars = _stars.positionX.capacity();
+    return _nodes.capacity() * sizeof(Node) +
+        nStars * (PosSize + ColSize + VelSize) * sizeof(float);
+}
+
+} // namespace openspace
@@ -0,0 +1,131 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_GAIA___FLATOCTREE___H__
+#define __OPENSPACE_MODULE_GAIA___FLATOCTREE___H__
+
+#include <modules/gaia/rendering/octreemanager.h>
+#include <ghoul/glm.h>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace openspace {
+
+class OctreeCuller;
+
+/**
+ * A read-only representation of an Octree that is optimized for culling and traversal.
+ * All nodes are stored in a single array in breadth-first order and the eight children
+ * of an inner node are stored consecutively, so that a node only has to store the index
+ * of its first child instead of eight pointers. The star data of all nodes is stored as
+ * a structure of arrays in which the stars belonging to a single node are contiguous.
+ *
+ * In contrast to the OctreeManager::OctreeNode, the nodes neither carry a mutex nor any
+ * of the bookkeeping that is needed while constructing or streaming the Octree, which
+ * makes a node small enough that two of them fit into a single cache line.
+ */
+class FlatOctree {
+public:
+    /// The value of Node::firstChild for leaf nodes
+    static constexpr uint32_t NoChildren = std::numeric_limits<uint32_t>::max();
+
+    struct Node {
+        /// The center of the node [kPc]
+        glm::vec3 origin = glm::vec3(0.f);
+        /// Half of the side length of the node [kPc]
+        float halfDimension = 0.f;
+        /// The index of the first of the eight consecutive children, or NoChildren
+        uint32_t firstChild = NoChildren;
+        /// The number of stars that are rendered for this node
+        uint32_t nStars = 0;
+        /// The index of the first star of this node in the StarData arrays
+        uint32_t firstStar = 0;
+        /// The number of stars of this node that are stored in the StarData arrays
+        uint32_t nStoredStars = 0;
+
+        bool isLeaf() const;
+    };
+
+    /**
+     * The star values of all nodes, stored in one array per value. The stars of node `n`
+     * are located in the range [`n.firstStar`, `n.firstStar + n.nStoredStars`).
+     */
+    struct StarData {
+        std::vector<float> positionX;
+        std::vector<float> positionY;
+        std::vector<float> positionZ;
+        std::vector<float> magnitude;
+        std::vector<float> color;
+        std::vector<float> velocityX;
+        std::vector<float> velocityY;
+        std::vector<float> velocityZ;
+    };
+
+    FlatOctree() = default;
+
+    /**
+     * Creates a flat copy of the provided \p octree, including all star data that is
+     * currently loaded into its nodes.
+     *
+     * \param octree The Octree that should be copied
+     * \pre \p octree must have been initialized
+     */
+    explicit FlatOctree(const OctreeManager& octree);
+
+    /**
+     * Finds all nodes that should be rendered for the provided camera by applying the
+     * same rules as the OctreeManager::traverseData function: Nodes outside of the view
+     * are skipped together with their descendants, leaves are rendered, and inner nodes
+     * are rendered using their LOD cache if they cover fewer than \p lodPixelThreshold
+     * pixels. Nodes that do not contain any stars are never returned.
+     *
+     * \param culler The culler that is used to test the visibility of the nodes
+     * \param mvp The model-view-projection matrix of the camera
+     * \param screenSize The size of the screen in pixels
+     * \param lodPixelThreshold The number of pixels below which an inner node is rendered
+     *        instead of its children
+     * \param result The indices of the nodes that should be rendered, in depth-first
+     *        Morton order. The vector is cleared before any node is added
+     */
+    void findVisibleNodes(OctreeCuller& culler, const glm::dmat4& mvp,
+        const glm::vec2& screenSize, float lodPixelThreshold,
+        std::vector<uint32_t>& result) const;
+
+    const std::vector<Node>& nodes() const;
+    const StarData& stars() const;
+
+    /**
+     * \return The number of bytes that are used by the nodes and the star data
+     */
+    size_t memoryFootprint() const;
+
+private:
+    std::vector<Node> _nodes;
+    StarData _stars;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_GAIA___FLATOCTREE___H__
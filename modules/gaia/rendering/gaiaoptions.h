@@ -38,7 +38,8 @@ enum FileReaderOption {
     Speck,
     BinaryRaw,
     BinaryOctree,
-    StreamOctree
+    StreamOctree,
+    StreamOctreeContainer
 };
 
 enum ShaderOption {
@@ -0,0 +1,244 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/gaia/rendering/octreecontainer.h>
+
+#include <ghoul/format.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/exception.h>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <utility>
+
+#ifdef WIN32
+#include <Windows.h>
+#else // ^^^^ WIN32 // !WIN32 vvvv
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // WIN32
+
+namespace {
+    constexpr std::array<char, 8> Identifier = { 'O', 'S', 'G', 'A', 'I', 'A', 'O', 'C' };
+    constexpr uint32_t FileVersion = 1;
+
+    struct Header {
+        std::array<char, 8> identifier = Identifier;
+        uint32_t version = FileVersion;
+        int32_t valuesPerStar = 0;
+        int32_t maxStarsPerNode = 0;
+        int32_t maxDist = 0;
+        uint64_t nNodes = 0;
+        // Offset of the node table, measured in bytes from the beginning of the file
+        uint64_t tableOffset = 0;
+    };
+    static_assert(std::is_trivially_copyable_v<Header>);
+    static_assert(
+        std::is_trivially_copyable_v<openspace::OctreeContainer::NodeEntry> &&
+        sizeof(openspace::OctreeContainer::NodeEntry) == 24
+    );
+
+    size_t systemPageSize() {
+#ifdef WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return static_cast<size_t>(info.dwPageSize);
+#else // ^^^^ WIN32 // !WIN32 vvvv
+        return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif // WIN32
+    }
+
+    void writePadding(std::ofstream& file) {
+        using namespace openspace;
+        const uint64_t pos = static_cast<uint64_t>(file.tellp());
+        const uint64_t padding =
+            (OctreeContainer::DataAlignment - pos % OctreeContainer::DataAlignment) %
+            OctreeContainer::DataAlignment;
+        const std::array<char, OctreeContainer::DataAlignment> zeros = {};
+        file.write(zeros.data(), padding);
+    }
+} // namespace
+
+namespace openspace {
+
+OctreeContainer::OctreeContainer(std::filesystem::path path)
+    : _file(std::move(path))
+{
+    const uint64_t fileSize = _file.size();
+    if (fileSize < sizeof(Header)) {
+        throw ghoul::RuntimeError(std::format(
+            "Octree container '{}' is too small", _file.path()
+        ));
+    }
+
+    Header header;
+    std::memcpy(&header, _file.data(), sizeof(Header));
+    if (header.identifier != Identifier || header.version != FileVersion) {
+        throw ghoul::RuntimeError(std::format(
+            "File '{}' is not an Octree container or has an unsupported version",
+            _file.path()
+        ));
+    }
+
+    // Make sure that neither the table nor any of the nodes are reaching beyond the end
+    // of the file, which would be the case for a file that was only partially written
+    auto isInFile = [fileSize](uint64_t offset, uint64_t size) {
+        return offset <= fileSize && size <= fileSize - offset;
+    };
+
+    if (header.tableOffset % alignof(NodeEntry) != 0 ||
+        header.nNodes > fileSize / sizeof(NodeEntry) ||
+        !isInFile(header.tableOffset, header.nNodes * sizeof(NodeEntry)))
+    {
+        throw ghoul::RuntimeError(std::format(
+            "Node table of Octree container '{}' is corrupt", _file.path()
+        ));
+    }
+
+    _nodes = std::span<const NodeEntry>(
+        reinterpret_cast<const NodeEntry*>(_file.data() + header.tableOffset),
+        header.nNodes
+    );
+    for (const NodeEntry& node : _nodes) {
+        if (node.dataOffset % DataAlignment != 0 ||
+            !isInFile(node.dataOffset, node.nValues * sizeof(float)))
+        {
+            throw ghoul::RuntimeError(std::format(
+                "Node data of Octree container '{}' is corrupt", _file.path()
+            ));
+        }
+    }
+
+    _valuesPerStar = header.valuesPerStar;
+    _maxStarsPerNode = header.maxStarsPerNode;
+    _maxDist = header.maxDist;
+}
+
+void OctreeContainer::write(const std::filesystem::path& path, int32_t valuesPerStar,
+                            int32_t maxStarsPerNode, int32_t maxDist,
+                            std::vector<NodeEntry> nodes,
+                            const std::function<std::vector<float>(size_t)>& nodeData)
+{
+    std::ofstream file = std::ofstream(path, std::ofstream::binary);
+    if (!file.good()) {
+        throw ghoul::RuntimeError(std::format("Error opening file '{}'", path));
+    }
+
+    Header header;
+    header.valuesPerStar = valuesPerStar;
+    header.maxStarsPerNode = maxStarsPerNode;
+    header.maxDist = maxDist;
+    header.nNodes = nodes.size();
+
+    // The header is written again at the end once the location of the table is known
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        const std::vector<float> data = nodeData(i);
+        nodes[i].nValues = static_cast<uint32_t>(data.size());
+        nodes[i].dataOffset = 0;
+        if (data.empty()) {
+            continue;
+        }
+
+        writePadding(file);
+        nodes[i].dataOffset = static_cast<uint64_t>(file.tellp());
+        file.write(
+            reinterpret_cast<const char*>(data.data()),
+            data.size() * sizeof(float)
+        );
+    }
+
+    writePadding(file);
+    header.tableOffset = static_cast<uint64_t>(file.tellp());
+    file.write(
+        reinterpret_cast<const char*>(nodes.data()),
+        nodes.size() * sizeof(NodeEntry)
+    );
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    if (!file.good()) {
+        throw ghoul::RuntimeError(std::format("Error writing file '{}'", path));
+    }
+}
+
+int32_t OctreeContainer::valuesPerStar() const {
+    return _valuesPerStar;
+}
+
+int32_t OctreeContainer::maxStarsPerNode() const {
+    return _maxStarsPerNode;
+}
+
+int32_t OctreeContainer::maxDist() const {
+    return _maxDist;
+}
+
+std::span<const OctreeContainer::NodeEntry> OctreeContainer::nodes() const {
+    return _nodes;
+}
+
+std::span<const float> OctreeContainer::nodeData(size_t index) const {
+    ghoul_assert(index < _nodes.size(), "Index out of range");
+
+    const NodeEntry& node = _nodes[index];
+    if (node.nValues == 0) {
+        return std::span<const float>();
+    }
+    return std::span<const float>(
+        reinterpret_cast<const float*>(_file.data() + node.dataOffset),
+        node.nValues
+    );
+}
+
+void OctreeContainer::prefetch(size_t index) const {
+    ghoul_assert(index < _nodes.size(), "Index out of range");
+
+    const NodeEntry& node = _nodes[index];
+    if (node.nValues == 0) {
+        return;
+    }
+
+    // The data offset is only aligned to DataAlignment, but the system page size can be
+    // larger (16 KiB or 64 KiB on some ARM systems), in which case madvise fails with
+    // EINVAL for an unaligned start. The range is therefore extended outwards to page
+    // boundaries, which is safe as the mapping itself starts at a page boundary
+    static const size_t PageSize = systemPageSize();
+    const uintptr_t first = reinterpret_cast<uintptr_t>(_file.data() + node.dataOffset);
+    const uintptr_t last = first + node.nValues * sizeof(float);
+    const uintptr_t alignedFirst = first & ~(PageSize - 1);
+    const uintptr_t alignedLast = (last + PageSize - 1) & ~(PageSize - 1);
+    void* begin = reinterpret_cast<void*>(alignedFirst);
+    const size_t size = alignedLast - alignedFirst;
+#ifdef WIN32
+    WIN32_MEMORY_RANGE_ENTRY range = { .VirtualAddress = begin, .NumberOfBytes = size };
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else // ^^^^ WIN32 // !WIN32 vvvv
+    madvise(begin, size, MADV_WILLNEED);
+#endif // WIN32
+}
+
+} // namespace openspace
@@ -0,0 +1,135 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_GAIA___OCTREECONTAINER___H__
+#define __OPENSPACE_MODULE_GAIA___OCTREECONTAINER___H__
+
+#include <openspace/util/memorymappedfile.h>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A single file that contains the structure and the star data of an entire Octree and
+ * that is memory-mapped rather than read. The file starts with a header that is followed
+ * by the star data of every node, each of which begins at a multiple of DataAlignment,
+ * and ends with a table that has one entry per node. The entries of the table are stored
+ * in the same depth-first Morton order in which the OctreeManager writes and reads its
+ * nodes, which means that the Octree can be reconstructed by walking the table from
+ * front to back.
+ *
+ * As the star data of each node is aligned, reading one node touches few pages outside
+ * of that node and the operating system can be asked to page in the data of nodes that
+ * will be needed soon without blocking the calling thread.
+ */
+class OctreeContainer {
+public:
+    /// The alignment of the star data of each node in bytes. This is independent of the
+    /// page size of the system, which is queried at runtime in #prefetch
+    static constexpr size_t DataAlignment = 4096;
+
+    struct NodeEntry {
+        /// The offset of the star data from the beginning of the file in bytes
+        uint64_t dataOffset = 0;
+        /// The number of float values in the star data
+        uint32_t nValues = 0;
+        /// The number of stars in this node, equivalent to OctreeNode::numStars
+        int32_t numStars = 0;
+        /// Non-zero if the node is a leaf
+        uint8_t isLeaf = 0;
+        uint8_t padding[7] = {};
+    };
+
+    /**
+     * Maps the container file at the provided \p path into memory and validates that its
+     * header and node table are consistent with the size of the file.
+     *
+     * \param path The path to the container file
+     *
+     * \throw ghoul::RuntimeError If the file could not be mapped or is not a valid
+     *        container file
+     */
+    explicit OctreeContainer(std::filesystem::path path);
+
+    /**
+     * Writes a container file to \p path. The \p nodes must be provided in depth-first
+     * Morton order and only need to have their `numStars` and `isLeaf` values set, the
+     * location of the star data is determined while writing.
+     *
+     * \param path The path of the file that is written
+     * \param valuesPerStar The number of values that are stored for every star
+     * \param maxStarsPerNode The maximum number of stars per node of the Octree
+     * \param maxDist The half side length of the root of the Octree [kPc]
+     * \param nodes The structure of the Octree
+     * \param nodeData Callback that returns the star data for the node with the provided
+     *        index
+     *
+     * \throw ghoul::RuntimeError If the file could not be written
+     */
+    static void write(const std::filesystem::path& path, int32_t valuesPerStar,
+        int32_t maxStarsPerNode, int32_t maxDist, std::vector<NodeEntry> nodes,
+        const std::function<std::vector<float>(size_t)>& nodeData);
+
+    int32_t valuesPerStar() const;
+    int32_t maxStarsPerNode() const;
+    int32_t maxDist() const;
+
+    /**
+     * \return The entries of all nodes in depth-first Morton order
+     */
+    std::span<const NodeEntry> nodes() const;
+
+    /**
+     * Returns the star data of the node with the provided \p index. The returned values
+     * point directly into the mapped file, so accessing them might block the calling
+     * thread until the operating system has paged in the data.
+     *
+     * \pre \p index must be smaller than the number of nodes
+     */
+    std::span<const float> nodeData(size_t index) const;
+
+    /**
+     * Asks the operating system to page in the star data of the node with the provided
+     * \p index in the background. This function does not wait for the data to arrive.
+     *
+     * \pre \p index must be smaller than the number of nodes
+     */
+    void prefetch(size_t index) const;
+
+private:
+    MemoryMappedFile _file;
+
+    int32_t _valuesPerStar = 0;
+    int32_t _maxStarsPerNode = 0;
+    int32_t _maxDist = 0;
+    std::span<const NodeEntry> _nodes;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_GAIA___OCTREECONTAINER___H__
@@ -48,14 +48,14 @@ OctreeCuller::OctreeCuller(AABB3 viewFrustum)
     : _viewFrustum(std::move(viewFrustum))
 {}
 
-bool OctreeCuller::isVisible(const std::vector<glm::dvec4>& corners,
+bool OctreeCuller::isVisible(std::span<const glm::dvec4> corners,
                              const glm::dmat4& mvp)
 {
     createNodeBounds(corners, mvp);
     return intersects(_viewFrustum, _nodeBounds);
 }
 
-glm::vec2 OctreeCuller::getNodeSizeInPixels(const std::vector<glm::dvec4>& corners,
+glm::vec2 OctreeCuller::getNodeSizeInPixels(std::span<const glm::dvec4> corners,
                                             const glm::dmat4& mvp,
                                             const glm::vec2& screenSize)
 {
@@ -68,7 +68,7 @@ glm::vec2 OctreeCuller::getNodeSizeInPixels(const std::vector<glm::dvec4>& corne
     return glm::vec2(size.x * screenSize.x, size.y * screenSize.y);
 }
 
-void OctreeCuller::createNodeBounds(const std::vector<glm::dvec4>& corners,
+void OctreeCuller::createNodeBounds(std::span<const glm::dvec4> corners,
                                     const glm::dmat4& mvp)
 {
     // Create a bounding box in clipping space from node boundaries
@@ -25,13 +25,17 @@
 #include <modules/gaia/rendering/octreemanager.h>
 
 #include <modules/globebrowsing/src/basictypes.h>
+#include <openspace/engine/globals.h>
 #include <openspace/util/distanceconstants.h>
 #include <ghoul/format.h>
 #include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/exception.h>
 #include <algorithm>
 #include <cstdint>
+#include <functional>
+#include <span>
 #include <string_view>
-#include <thread>
 
 namespace {
     using namespace openspace;
@@ -44,6 +48,9 @@ namespace {
 
     constexpr std::string_view BinarySuffix = ".bin";
 
+    // How far ahead [in seconds] the camera path is predicted when prefetching nodes
+    constexpr double PrefetchLookahead = 2.0;
+
     /**
      * \return The correct index of child node. Maps [1,1,1] to 0 and [-1,-1,-1] to 7
      */
@@ -236,28 +243,25 @@ namespace {
 
         // Recursively write children to file (in Morton order) if we're in an inner node
         if (!node.isLeaf) {
-            std::vector<std::thread> writeThreads(8);
+            const TaskScheduler::TaskGroup writeTasks;
             for (size_t i = 0; i < 8; i++) {
                 const std::string newOutFilePrefix = outFilePrefix + std::to_string(i);
                 if (threadWrites) {
-                    // Divide writing to new threads to speed up the process
-                    std::thread t(
+                    // Divide writing between the task workers to speed up the process
+                    global::taskScheduler->enqueue(
                         [newOutFilePrefix, n = node.children[i]]() {
                             writeNodeToMultipleFiles(newOutFilePrefix, *n, false);
-                        }
+                        },
+                        TaskScheduler::Priority::Normal,
+                        writeTasks
                     );
-                    writeThreads[i] = std::move(t);
                 }
                 else {
                     writeNodeToMultipleFiles(newOutFilePrefix, *node.children[i], false);
                 }
             }
-            if (threadWrites) {
-                // Make sure all threads are done
-                for (int thread = 0; thread < 8; thread++) {
-                    writeThreads[thread].join();
-                }
-            }
+            // Make sure all writes are done
+            writeTasks.wait();
         }
     }
 
@@ -368,8 +372,20 @@ namespace {
 
 namespace openspace {
 
+OctreeManager::~OctreeManager() {
+    // The streaming tasks reference this object, so they have to finish first
+    _streamingTasks.cancel();
+    _streamingTasks.wait();
+}
+
 void OctreeManager::initOctree(long long cpuRamBudget, int maxDist, int maxStarsPerNode) {
     if (_root) {
+        // Skip all loads that are still queued for the old Octree
+        _streamingTasks.cancel();
+        _streamingTasks.wait();
+        _streamingTasks = TaskScheduler::TaskGroup();
+        _container = nullptr;
+
         LDEBUG("Clear existing Octree");
         clearAllData();
     }
@@ -395,6 +411,8 @@ void OctreeManager::initOctree(long long cpuRamBudget, int maxDist, int maxStars
     _maxCpuRamBudget = cpuRamBudget;
     _cpuRamBudget = cpuRamBudget;
     _parentNodeOfCamera = 8;
+    _prefetchedParentNode = 8;
+    _cameraVelocity = glm::dvec3(0.0);
 
     if (maxDist > 0) {
         MAX_DIST = static_cast<size_t>(maxDist);
@@ -484,17 +502,24 @@ void OctreeManager::fetchSurroundingNodes(const glm::dvec3& cameraPos,
                     continue;
                 }
 
-                // Use multithreading to load files and detach thread from main execution
-                // so it can execute independently. Thread will be destroyed when finished
-                std::thread([this, n = child]() {
-                    fetchChildrenNodes(*n, -1);
-                }).detach();
+                // Load the files in the background. As the whole dataset is loaded, these
+                // tasks yield to the loads that are requested for the current view
+                global::taskScheduler->enqueue(
+                    [this, n = child]() { fetchChildrenNodes(*n, -1); },
+                    TaskScheduler::Priority::Low,
+                    _streamingTasks
+                );
             }
             _parentNodeOfCamera = 0;
         }
         return;
     }
 
+    // Page in the nodes along the predicted camera path before they are requested
+    if (_container) {
+        prefetchAlongCameraPath(cameraPos, additionalNodes.y);
+    }
+
     // Get leaf node in which the camera resides
     const glm::vec3 fCameraPos = cameraPos / (1000.0 * distanceconstants::Parsec);
     size_t idx = childIndex(fCameraPos);
@@ -568,21 +593,56 @@ void OctreeManager::fetchSurroundingNodes(const glm::dvec3& cameraPos,
         }
         // Use asynchronous removal
         if (!nodesToRemove.empty()) {
-            std::thread(&OctreeManager::removeNodesFromRam, this, nodesToRemove).detach();
+            global::taskScheduler->enqueue(
+                [this, nodes = std::move(nodesToRemove)]() { removeNodesFromRam(nodes); },
+                TaskScheduler::Priority::Low,
+                _streamingTasks
+            );
         }
     }
 }
 
 void OctreeManager::findAndFetchNeighborNode(unsigned long long firstParentId, int x,
                                              int y, int z, int additionalLevelsToFetch)
+{
+    // Fetch first layer children if we're already at root
+    if (firstParentId == 8) {
+        fetchChildrenNodes(*_root, 0);
+        return;
+    }
+
+    const std::shared_ptr<OctreeNode> node =
+        findNeighborNode(firstParentId, x, y, z, true);
+    if (!node) {
+        return;
+    }
+
+    // Fetch all children nodes from found parent asynchronously. The same neighbor is
+    // requested every frame until it is loaded, so only one task per node is queued at a
+    // time to keep fast camera movements from flooding the scheduler
+    if (node->hasPendingFetch.exchange(true)) {
+        return;
+    }
+    global::taskScheduler->enqueue(
+        [this, node, additionalLevelsToFetch]() {
+            fetchChildrenNodes(*node, additionalLevelsToFetch);
+            node->hasPendingFetch = false;
+        },
+        TaskScheduler::Priority::Normal,
+        _streamingTasks
+    );
+}
+
+std::shared_ptr<OctreeManager::OctreeNode> OctreeManager::findNeighborNode(
+                                                         unsigned long long firstParentId,
+                                                                    int x, int y, int z,
+                                                                            bool markPath)
 {
     unsigned long long parentId = firstParentId;
     std::stack<int> indexStack;
 
-    // Fetch first layer children if we're already at root
     if (parentId == 8) {
-        fetchChildrenNodes(*_root, 0);
-        return;
+        return _root;
     }
 
     // Change first index
@@ -646,7 +706,7 @@ void OctreeManager::findAndFetchNeighborNode(unsigned long long firstParentId, i
     // Take care of edge cases. If we got to the root but still need to switch to a common
     // parent then no neighbor exists in that direction
     if (needToSwitchX || needToSwitchY || needToSwitchZ) {
-        return;
+        return nullptr;
     }
 
     // Continue to root if we didn't reach it
@@ -660,16 +720,108 @@ void OctreeManager::findAndFetchNeighborNode(unsigned long long firstParentId, i
     std::shared_ptr<OctreeNode> node = _root;
     while (!indexStack.empty() && !node->children[indexStack.top()]->isLeaf) {
         node = node->children[indexStack.top()];
-        node->hasLoadedDescendant = true;
+        if (markPath) {
+            node->hasLoadedDescendant = true;
+        }
         indexStack.pop();
     }
+    return node;
+}
+
+void OctreeManager::prefetchAlongCameraPath(const glm::dvec3& cameraPos,
+                                            int additionalLevelsToFetch)
+{
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const double dt = std::chrono::duration<double>(now - _previousFetchTime).count();
+    const glm::dvec3 previousCameraPos = _previousCameraPos;
+    _previousFetchTime = now;
+    _previousCameraPos = cameraPos;
+
+    // Without a recent previous position (first frame or a stall) there is nothing to
+    // base a prediction on
+    if (dt <= 0.0 || dt > 1.0) {
+        _cameraVelocity = glm::dvec3(0.0);
+        return;
+    }
+
+    // Smooth the velocity so that single jittery frames don't change the prediction
+    const glm::dvec3 velocity = (cameraPos - previousCameraPos) / dt;
+    _cameraVelocity = glm::mix(_cameraVelocity, velocity, 0.25);
+
+    const glm::dvec3 predictedPos = cameraPos + _cameraVelocity * PrefetchLookahead;
+    const glm::vec3 fPredictedPos = predictedPos / (1000.0 * distanceconstants::Parsec);
+    if (glm::any(glm::greaterThanEqual(
+            glm::abs(fPredictedPos),
+            glm::vec3(static_cast<float>(MAX_DIST))
+        )))
+    {
+        // The camera is moving out of the Octree
+        return;
+    }
+
+    // Get the leaf node in which the camera will reside
+    std::shared_ptr<OctreeNode> node = _root->children[childIndex(fPredictedPos)];
+    while (!node->isLeaf) {
+        const glm::vec3 origin = glm::vec3(node->originX, node->originY, node->originZ);
+        node = node->children[childIndex(fPredictedPos, origin)];
+    }
+    const unsigned long long parentId = node->octreePositionIndex / 10;
 
-    // Fetch all children nodes from found parent. Use multithreading to load files
-    // asynchronously! Detach thread from main execution so it can execute independently.
-    // Thread will then be destroyed when it has finished
-    std::thread([this, node, additionalLevelsToFetch]() {
-        fetchChildrenNodes(*node, additionalLevelsToFetch);
-    }).detach();
+    // Nothing to do if the neighborhood has already been requested
+    if (parentId == _parentNodeOfCamera || parentId == _prefetchedParentNode) {
+        return;
+    }
+    _prefetchedParentNode = parentId;
+
+    // Collect the same nodes that findAndFetchNeighborNode will load once the camera has
+    // arrived, but limit the amount of data so that a fast camera doesn't cause the
+    // operating system to evict pages that are still needed
+    std::vector<size_t> indices;
+    long long budget = _maxCpuRamBudget / 10;
+    std::function<void(const OctreeNode&, int)> collect =
+        [this, &indices, &budget, &collect](const OctreeNode& parent, int nLevels) {
+            for (const std::shared_ptr<OctreeNode>& child : parent.children) {
+                const long long nBytes = static_cast<long long>(
+                    _container->nodes()[child->containerIndex].nValues * sizeof(float)
+                );
+                if (!child->isLoaded && nBytes > 0 && nBytes <= budget) {
+                    indices.push_back(child->containerIndex);
+                    budget -= nBytes;
+                }
+                if (nLevels != 0 && !child->isLeaf) {
+                    collect(*child, nLevels - 1);
+                }
+            }
+        };
+    // Close to the root, several directions can lead to the same node
+    std::set<const OctreeNode*> neighbors;
+    for (int x = -1; x <= 1; x += 1) {
+        for (int y = -2; y <= 2; y += 2) {
+            for (int z = -4; z <= 4; z += 4) {
+                const std::shared_ptr<OctreeNode> n =
+                    findNeighborNode(parentId, x, y, z, false);
+                if (n && !n->isLeaf && neighbors.insert(n.get()).second) {
+                    collect(*n, additionalLevelsToFetch);
+                }
+            }
+        }
+    }
+
+    if (indices.empty()) {
+        return;
+    }
+    global::taskScheduler->enqueue(
+        [this, indices = std::move(indices)]() {
+            for (size_t index : indices) {
+                if (_streamingTasks.isCancelled()) {
+                    return;
+                }
+                _container->prefetch(index);
+            }
+        },
+        TaskScheduler::Priority::Low,
+        _streamingTasks
+    );
 }
 
 std::map<int, std::vector<float>> OctreeManager::traverseData(const glm::dmat4& mvp,
@@ -715,7 +867,7 @@ std::map<int, std::vector<float>> OctreeManager::traverseData(const glm::dmat4&
     }
 
     // Check if entire tree is too small to see, and if so remove it
-    std::vector<glm::dvec4> corners(8);
+    std::array<glm::dvec4, 8> corners;
     const float fMaxDist = static_cast<float>(MAX_DIST);
     for (int i = 0; i < 8; i++) {
         const float x = (i % 2 == 0) ? fMaxDist : -fMaxDist;
@@ -848,18 +1000,7 @@ int OctreeManager::readFromFile(std::ifstream& inFileStream, bool readData,
 
     // Octree Manager root halfDistance must be updated before any nodes are created
     if (static_cast<int>(MAX_DIST) != oldMaxdist) {
-        for (size_t i = 0; i < 8; i++) {
-            _root->children[i]->halfDimension = MAX_DIST / 2.f;
-            _root->children[i]->originX = (i % 2 == 0) ?
-                _root->children[i]->halfDimension :
-                -_root->children[i]->halfDimension;
-            _root->children[i]->originY = (i % 4 < 2) ?
-                _root->children[i]->halfDimension :
-                -_root->children[i]->halfDimension;
-            _root->children[i]->originZ = (i < 4) ?
-                _root->children[i]->halfDimension :
-                -_root->children[i]->halfDimension;
-        }
+        updateRootChildren();
     }
 
     if (_valuesPerStar != (PosSize + ColSize + VelSize)) {
@@ -921,6 +1062,131 @@ int OctreeManager::readNodeFromFile(std::ifstream& inFileStream, OctreeNode& nod
     return numStars;
 }
 
+int OctreeManager::readFromContainer(const std::filesystem::path& path) {
+    _container = std::make_unique<OctreeContainer>(path);
+    _streamOctree = true;
+
+    const int oldMaxDist = static_cast<int>(MAX_DIST);
+    _valuesPerStar = _container->valuesPerStar();
+    MAX_STARS_PER_NODE = _container->maxStarsPerNode();
+    MAX_DIST = _container->maxDist();
+
+    LDEBUG(std::format(
+        "Max stars per node in Octree container: {} - Radius of root layer: {}",
+        MAX_STARS_PER_NODE, MAX_DIST
+    ));
+
+    if (static_cast<int>(MAX_DIST) != oldMaxDist) {
+        updateRootChildren();
+    }
+
+    if (_valuesPerStar != (PosSize + ColSize + VelSize)) {
+        LERROR("Octree container doesn't have the same structure of render parameters");
+    }
+
+    int nStarsRead = 0;
+    size_t index = 0;
+    for (const std::shared_ptr<OctreeNode>& child : _root->children) {
+        nStarsRead += readNodeFromContainer(*child, index);
+    }
+    return nStarsRead;
+}
+
+int OctreeManager::readNodeFromContainer(OctreeNode& node, size_t& index) {
+    const std::span<const OctreeContainer::NodeEntry> nodes = _container->nodes();
+    if (index >= nodes.size()) {
+        throw ghoul::RuntimeError(
+            "Octree container ended before the Octree was complete"
+        );
+    }
+
+    const OctreeContainer::NodeEntry& entry = nodes[index];
+    node.containerIndex = index;
+    node.isLeaf = entry.isLeaf != 0;
+    node.numStars = entry.numStars;
+    index++;
+
+    int numStars = entry.numStars;
+    if (!node.isLeaf) {
+        numStars = 0;
+        createNodeChildren(node);
+        for (const std::shared_ptr<OctreeNode>& child : node.children) {
+            numStars += readNodeFromContainer(*child, index);
+        }
+    }
+    return numStars;
+}
+
+void OctreeManager::writeToContainer(const std::filesystem::path& path) const {
+    // Collect all nodes in the same pre-order (Morton code / Z-order) as writeToFile
+    std::vector<const OctreeNode*> nodes;
+    std::stack<const OctreeNode*> stack;
+    for (auto it = _root->children.rbegin(); it != _root->children.rend(); it++) {
+        stack.push(it->get());
+    }
+    while (!stack.empty()) {
+        const OctreeNode* node = stack.top();
+        stack.pop();
+        nodes.push_back(node);
+        if (!node->isLeaf) {
+            for (auto it = node->children.rbegin(); it != node->children.rend(); it++) {
+                stack.push(it->get());
+            }
+        }
+    }
+
+    std::vector<OctreeContainer::NodeEntry> entries(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        entries[i].numStars = static_cast<int32_t>(nodes[i]->numStars);
+        entries[i].isLeaf = nodes[i]->isLeaf ? 1 : 0;
+    }
+
+    auto nodeData = [this, &nodes](size_t i) -> std::vector<float> {
+        const OctreeNode& node = *nodes[i];
+        if (_streamOctree && !node.isLoaded) {
+            if (_container) {
+                const std::span<const float> data = _container->nodeData(
+                    node.containerIndex
+                );
+                return std::vector<float>(data.begin(), data.end());
+            }
+            if (node.numStars == 0) {
+                return std::vector<float>();
+            }
+            return readNodeDataFile(node).value_or(std::vector<float>());
+        }
+
+        std::vector<float> data = node.posData;
+        data.insert(data.end(), node.colData.begin(), node.colData.end());
+        data.insert(data.end(), node.velData.begin(), node.velData.end());
+        return data;
+    };
+
+    OctreeContainer::write(
+        path,
+        static_cast<int32_t>(_valuesPerStar),
+        static_cast<int32_t>(MAX_STARS_PER_NODE),
+        static_cast<int32_t>(MAX_DIST),
+        std::move(entries),
+        nodeData
+    );
+}
+
+void OctreeManager::updateRootChildren() {
+    for (size_t i = 0; i < 8; i++) {
+        _root->children[i]->halfDimension = MAX_DIST / 2.f;
+        _root->children[i]->originX = (i % 2 == 0) ?
+            _root->children[i]->halfDimension :
+            -_root->children[i]->halfDimension;
+        _root->children[i]->originY = (i % 4 < 2) ?
+            _root->children[i]->halfDimension :
+            -_root->children[i]->halfDimension;
+        _root->children[i]->originZ = (i < 4) ?
+            _root->children[i]->halfDimension :
+            -_root->children[i]->halfDimension;
+    }
+}
+
 void OctreeManager::writeToMultipleFiles(const std::filesystem::path& outFolderPath,
                                          size_t branchIndex)
 {
@@ -937,6 +1203,11 @@ void OctreeManager::writeToMultipleFiles(const std::filesystem::path& outFolderP
 void OctreeManager::fetchChildrenNodes(OctreeNode& parentNode,
                                        int additionalLevelsToFetch)
 {
+    // Stop early if the Octree is being rebuilt or destroyed
+    if (_streamingTasks.isCancelled()) {
+        return;
+    }
+
     // Lock node to make sure nobody else are trying to load the same children
     const std::unique_lock lock(parentNode.loadingLock);
 
@@ -958,6 +1229,43 @@ void OctreeManager::fetchChildrenNodes(OctreeNode& parentNode,
 }
 
 void OctreeManager::fetchNodeDataFromFile(OctreeNode& node) {
+    // The data is either copied out of the mapped container or read from the file of
+    // the node
+    std::vector<float> readData;
+    std::span<const float> data;
+    if (_container) {
+        data = _container->nodeData(node.containerIndex);
+    }
+    else {
+        std::optional<std::vector<float>> fileData = readNodeDataFile(node);
+        if (!fileData.has_value()) {
+            return;
+        }
+        readData = std::move(*fileData);
+        data = readData;
+    }
+
+    const int nBytes = static_cast<int>(data.size() * sizeof(float));
+    const int starsInNode = static_cast<int>(data.size() / _valuesPerStar);
+    const auto posEnd = data.begin() + (starsInNode * PosSize);
+    const auto colEnd = posEnd + (starsInNode * ColSize);
+    const auto velEnd = colEnd + (starsInNode * VelSize);
+    node.posData = std::vector<float>(data.begin(), posEnd);
+    node.colData = std::vector<float>(posEnd, colEnd);
+    node.velData = std::vector<float>(colEnd, velEnd);
+
+    // Keep track of nodes that are loaded and update CPU RAM budget
+    node.isLoaded = true;
+    if (!_datasetFitInMemory) {
+        const std::unique_lock lock(_leastRecentlyFetchedNodesMutex);
+        _leastRecentlyFetchedNodes.push(node.octreePositionIndex);
+    }
+    _cpuRamBudget -= nBytes;
+}
+
+std::optional<std::vector<float>> OctreeManager::readNodeDataFile(
+                                                            const OctreeNode& node) const
+{
     // Remove root ID ("8") from index before loading file
     std::string posId = std::to_string(node.octreePositionIndex);
     posId.erase(posId.begin());
@@ -968,7 +1276,7 @@ void OctreeManager::fetchNodeDataFromFile(OctreeNode& node) {
     std::ifstream inFileStream = std::ifstream(inFilePath, std::ifstream::binary);
     if (!inFileStream.good()) {
         LERROR(std::format("Error opening node data file: {}", inFilePath));
-        return;
+        return std::nullopt;
     }
 
     // Read node data
@@ -978,26 +1286,11 @@ void OctreeManager::fetchNodeDataFromFile(OctreeNode& node) {
     inFileStream.read(reinterpret_cast<char*>(&nDataSize), sizeof(int32_t));
 
     std::vector<float> readData(nDataSize, 0.f);
-    const int nBytes = nDataSize * sizeof(float);
     if (nDataSize > 0) {
+        const size_t nBytes = nDataSize * sizeof(float);
         inFileStream.read(reinterpret_cast<char*>(readData.data()), nBytes);
     }
-
-    const int starsInNode = static_cast<int>(nDataSize / _valuesPerStar);
-    const auto posEnd = readData.begin() + (starsInNode * PosSize);
-    const auto colEnd = posEnd + (starsInNode * ColSize);
-    const auto velEnd = colEnd + (starsInNode * VelSize);
-    node.posData = std::vector<float>(readData.begin(), posEnd);
-    node.colData = std::vector<float>(posEnd, colEnd);
-    node.velData = std::vector<float>(colEnd, velEnd);
-
-    // Keep track of nodes that are loaded and update CPU RAM budget
-    node.isLoaded = true;
-    if (!_datasetFitInMemory) {
-        const std::unique_lock lock(_leastRecentlyFetchedNodesMutex);
-        _leastRecentlyFetchedNodes.push(node.octreePositionIndex);
-    }
-    _cpuRamBudget -= nBytes;
+    return readData;
 }
 
 void OctreeManager::removeNodesFromRam(
@@ -1043,6 +1336,11 @@ void OctreeManager::removeNode(OctreeNode& node) {
     node.velData.shrink_to_fit();
 }
 
+const OctreeManager::OctreeNode& OctreeManager::root() const {
+    ghoul_assert(_root, "Octree has not been initialized");
+    return *_root;
+}
+
 size_t OctreeManager::numLeafNodes() const {
     return _numLeafNodes;
 }
@@ -1151,7 +1449,7 @@ std::map<int, std::vector<float>> OctreeManager::checkNodeIntersection(OctreeNod
     std::map<int, std::vector<float>> fetchedData;
 
     // Calculate the corners of the node
-    std::vector<glm::dvec4> corners(8);
+    std::array<glm::dvec4, 8> corners;
     for (int i = 0; i < 8; i++) {
         const float x = (i % 2 == 0) ?
             node.originX + node.halfDimension :
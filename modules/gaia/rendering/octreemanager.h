@@ -26,14 +26,19 @@
 #define __OPENSPACE_MODULE_GAIA___OCTREEMANAGER___H__
 
 #include <modules/gaia/rendering/gaiaoptions.h>
+#include <modules/gaia/rendering/octreecontainer.h>
 #include <modules/gaia/rendering/octreeculler.h>
+#include <openspace/util/taskscheduler.h>
 #include <ghoul/glm.h>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <set>
 #include <stack>
@@ -64,12 +69,16 @@ public:
         bool isLoaded = false;
         bool hasLoadedDescendant = false;
         std::mutex loadingLock;
+        /// Set while a task that fetches the children of this node is queued or running
+        std::atomic_bool hasPendingFetch = false;
         int bufferIndex = DefaultIndex;
         unsigned long long octreePositionIndex = 0;
+        /// The index of the node in the OctreeContainer, if streaming from a container
+        size_t containerIndex = 0;
     };
 
     OctreeManager() = default;
-    ~OctreeManager() = default;
+    ~OctreeManager();
 
     /**
      * Initializes a one layer Octree with root and 8 children that covers all stars.
@@ -159,6 +168,30 @@ public:
     int readFromFile(std::ifstream& inFileStream, bool readData,
         const std::filesystem::path& folderPath = std::filesystem::path());
 
+    /**
+     * Reads the structure of an Octree from the container file at \p path. The file is
+     * kept memory-mapped and the star data of the nodes is streamed from it during
+     * runtime, equivalent to reading the structure with #readFromFile and streaming the
+     * nodes from individual files.
+     *
+     * \param path The path to the container file
+     * \return The total number of (distinct) stars read
+     *
+     * \throw ghoul::RuntimeError If the file is not a valid container file
+     */
+    int readFromContainer(const std::filesystem::path& path);
+
+    /**
+     * Writes the entire Octree, including all data, into a single container file that
+     * can be read with #readFromContainer. Nodes whose data is not loaded are read from
+     * their files if the Octree is streamed.
+     *
+     * \param path The path to which the container file will be written
+     *
+     * \throw ghoul::RuntimeError If the file could not be written
+     */
+    void writeToContainer(const std::filesystem::path& path) const;
+
     /**
      * Write specified part of Octree to multiple files, including all data.
      *
@@ -169,6 +202,12 @@ public:
     void writeToMultipleFiles(const std::filesystem::path& outFolderPath,
         size_t branchIndex);
 
+    /**
+     * \return The root node of the Octree
+     * \pre The Octree must have been initialized with #initOctree
+     */
+    const OctreeNode& root() const;
+
     size_t numLeafNodes() const;
     size_t numInnerNodes() const;
     size_t totalNodes() const;
@@ -261,6 +300,37 @@ private:
      */
     int readNodeFromFile(std::ifstream& inFileStream, OctreeNode& node, bool readData);
 
+    /**
+     * Reads the structure of a node and its potential children from the node table of
+     * the container.
+     *
+     * \param node The node whose structure will be read
+     * \param index The index of the next entry in the node table. Is incremented for
+     *        every node that is read
+     * \return Accumulated sum of all read stars in node and its descendants
+     */
+    int readNodeFromContainer(OctreeNode& node, size_t& index);
+
+    /**
+     * Updates the size of the first layer of children after MAX_DIST has changed.
+     */
+    void updateRootChildren();
+
+    /**
+     * Finds the neighboring node on the same level (or a higher level if there is no
+     * corresponding level) in the specified direction. Used by #findAndFetchNeighborNode.
+     *
+     * \param firstParentId The id of the first parent node that should be checked
+     * \param x The x coordinate of the node that should be found
+     * \param y The y coordinate of the node that should be found
+     * \param z The z coordinate of the node that should be found
+     * \param markPath If `true`, all nodes on the path to the found node are marked as
+     *        having a loaded descendant
+     * \return The found node or `nullptr` if there is no neighbor in that direction
+     */
+    std::shared_ptr<OctreeNode> findNeighborNode(unsigned long long firstParentId,
+        int x, int y, int z, bool markPath);
+
     /**
      * Finds the neighboring node on the same level (or a higher level if there is no
      * corresponding level) in the specified direction. Also fetches data from found node
@@ -294,6 +364,26 @@ private:
      */
     void fetchNodeDataFromFile(OctreeNode& node);
 
+    /**
+     * Reads the data of specified node from its own file in the streaming folder.
+     *
+     * \return The star data of the node or `std::nullopt` if the file could not be read
+     */
+    std::optional<std::vector<float>> readNodeDataFile(const OctreeNode& node) const;
+
+    /**
+     * Predicts where the camera will be in the near future based on its velocity and
+     * asks the OctreeContainer to page in the nodes around that position in the
+     * background, so that they are resident by the time #fetchChildrenNodes needs them.
+     * Only has an effect while streaming from a container.
+     *
+     * \param cameraPos The current position of the camera
+     * \param additionalLevelsToFetch The number of levels of descendants that are
+     *        fetched for each neighbor node
+     */
+    void prefetchAlongCameraPath(const glm::dvec3& cameraPos,
+        int additionalLevelsToFetch);
+
     /**
     * Loops though all nodes in \p nodesToRemove and clears them from RAM. Also checks if
     * any ancestor should change the `hasLoadedDescendant` flag by calling
@@ -316,6 +406,18 @@ private:
     std::queue<unsigned long long> _leastRecentlyFetchedNodes;
     std::mutex _leastRecentlyFetchedNodesMutex;
 
+    /// All streaming tasks that load or remove nodes in the background
+    TaskScheduler::TaskGroup _streamingTasks;
+
+    /// The container that the nodes are streamed from, if any
+    std::unique_ptr<OctreeContainer> _container;
+
+    // Camera movement that is used to predict which nodes should be prefetched
+    glm::dvec3 _previousCameraPos = glm::dvec3(0.0);
+    glm::dvec3 _cameraVelocity = glm::dvec3(0.0);
+    std::chrono::steady_clock::time_point _previousFetchTime;
+    unsigned long long _prefetchedParentNode = 8;
+
     size_t _totalDepth = 0;
     size_t _numLeafNodes = 0;
     size_t _numInnerNodes = 0;
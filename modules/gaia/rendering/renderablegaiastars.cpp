@@ -78,7 +78,9 @@ namespace {
         "construct an Octree and render it. 'BinaryOctree' will read a constructed "
         "Octree from binary file and render full data. 'StreamOctree' will read an index "
         "file with full Octree structure and then stream nodes during runtime. (This "
-        "option is suited for bigger datasets).",
+        "option is suited for bigger datasets). 'StreamOctreeContainer' will map a "
+        "single Octree container file and stream nodes from it during runtime, while "
+        "prefetching the nodes along the camera path in the background.",
         Property::Visibility::AdvancedUser
     };
 
@@ -281,7 +283,8 @@ namespace {
             Speck,
             BinaryRaw,
             BinaryOctree,
-            StreamOctree
+            StreamOctree,
+            StreamOctreeContainer
         };
         // [[codegen::verbatim(FileReaderOptionInfo.description)]]
         FileReader fileReaderOption;
@@ -416,7 +419,8 @@ RenderableGaiaStars::RenderableGaiaStars(const ghoul::Dictionary& dictionary)
         { FileReaderOption::Speck, "Speck" },
         { FileReaderOption::BinaryRaw, "BinaryRaw" },
         { FileReaderOption::BinaryOctree, "BinaryOctree" },
-        { FileReaderOption::StreamOctree, "StreamOctree" }
+        { FileReaderOption::StreamOctree, "StreamOctree" },
+        { FileReaderOption::StreamOctreeContainer, "StreamOctreeContainer" }
     });
     _fileReaderOption = codegen::map<FileReaderOption>(p.fileReaderOption);
 
@@ -673,7 +677,9 @@ void RenderableGaiaStars::render(const RenderData& data, RendererTasks&) {
     glGetIntegerv(GL_FRAMEBUFFER_BINDING, &defaultFbo);
 
     // Update which nodes are stored in memory as the camera moves around (if streaming)
-    if (_fileReaderOption == FileReaderOption::StreamOctree) {
+    if (_fileReaderOption == FileReaderOption::StreamOctree ||
+        _fileReaderOption == FileReaderOption::StreamOctreeContainer)
+    {
         const glm::dvec3 cameraPos = data.camera.position();
         const size_t chunkSizeBytes = _chunkSize * sizeof(GLfloat);
         _octreeManager.fetchSurroundingNodes(cameraPos, chunkSizeBytes, _additionalNodes);
@@ -1019,6 +1025,10 @@ bool RenderableGaiaStars::readDataFile() {
             // Read Octree structure from file, without data
             nReadStars = readBinaryOctreeStructureFile(file);
             break;
+        case FileReaderOption::StreamOctreeContainer:
+            // Map the Octree container and stream nodes from it
+            nReadStars = readOctreeContainerFile(file);
+            break;
     }
 
     _nRenderedStars.setMaxValue(nReadStars);
@@ -1123,4 +1133,14 @@ int RenderableGaiaStars::readBinaryOctreeStructureFile(
     return nReadStars;
 }
 
+int RenderableGaiaStars::readOctreeContainerFile(const std::filesystem::path& filePath) {
+    try {
+        return _octreeManager.readFromContainer(filePath);
+    }
+    catch (const ghoul::RuntimeError& e) {
+        LERRORC(e.component, e.message);
+        return 0;
+    }
+}
+
 } // namespace openspace
@@ -102,6 +102,14 @@ private:
      */
     int readBinaryOctreeStructureFile(const std::filesystem::path& folderPath);
 
+    /**
+     * Reads the structure of a pre-constructed octree from a container file, from which
+     * the data is streamed during runtime.
+     *
+     * \return The number of stars read
+     */
+    int readOctreeContainerFile(const std::filesystem::path& filePath);
+
     StringProperty _filePath;
     std::unique_ptr<ghoul::filesystem::File> _dataFile;
 
@@ -25,17 +25,19 @@
 #include <modules/gaia/tasks/constructoctreetask.h>
 
 #include <openspace/documentation/documentation.h>
+#include <openspace/engine/globals.h>
+#include <openspace/util/taskscheduler.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/format.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/dictionary.h>
+#include <ghoul/misc/exception.h>
 #include <cstdint>
 #include <cstdlib>
 #include <fstream>
 #include <limits>
 #include <optional>
 #include <string_view>
-#include <thread>
 #include <utility>
 
 namespace {
@@ -63,6 +65,13 @@ namespace {
         // folder and output multiple files for the Octree.
         std::optional<bool> singleFileInput;
 
+        // If true then the constructed Octree is also written into a single container
+        // file that can be streamed with the 'StreamOctreeContainer' file reader option.
+        // For a single file input the container is written next to the output file with
+        // the extension '.container', otherwise it is written to 'octree.container' in
+        // the output folder.
+        std::optional<bool> writeContainer;
+
         // If defined then only stars with Position X values between [min, max] will be
         // inserted into Octree (if min is set to 0.0 it is read as -Inf, if max is set to
         // 0.0 it is read as +Inf). If min = max then all values equal min|max will be
@@ -224,6 +233,7 @@ ConstructOctreeTask::ConstructOctreeTask(const ghoul::Dictionary& dictionary) {
     _maxDist = p.maxDist.value_or(_maxDist);
     _maxStarsPerNode = p.maxStarsPerNode.value_or(_maxStarsPerNode);
     _singleFileInput = p.singleFileInput.value_or(_singleFileInput);
+    _writeContainer = p.writeContainer.value_or(_writeContainer);
 
     _octreeManager = std::make_shared<OctreeManager>();
     _indexOctreeManager = std::make_shared<OctreeManager>();
@@ -393,6 +403,18 @@ void ConstructOctreeTask::constructOctreeFromSingleFile(
             "Error opening file '{}' as output data file", _outFileOrFolderPath
         ));
     }
+
+    if (_writeContainer) {
+        std::filesystem::path containerPath = _outFileOrFolderPath;
+        containerPath.replace_extension(".container");
+        LINFO(std::format("Writing Octree container '{}'", containerPath));
+        try {
+            _octreeManager->writeToContainer(containerPath);
+        }
+        catch (const ghoul::RuntimeError& e) {
+            LERRORC(e.component, e.message);
+        }
+    }
 }
 
 void ConstructOctreeTask::constructOctreeFromFolder(
@@ -422,7 +444,7 @@ void ConstructOctreeTask::constructOctreeFromFolder(
     int32_t nStars = 0;
     size_t nFilteredStars = 0;
     std::vector<float> filterValues;
-    std::vector<std::thread> writeThreads = std::vector<std::thread>(8);
+    const TaskScheduler::TaskGroup writeTasks;
     for (size_t idx = 0; idx < allInputFiles.size(); idx++) {
         std::filesystem::path inFilePath = allInputFiles[idx];
         int nStarsInfile = 0;
@@ -478,15 +500,15 @@ void ConstructOctreeTask::constructOctreeFromFolder(
             _indexOctreeManager->totalDepth()
         ));
 
-        // Write to 8 separate files in a separate thread. Data will be cleared after it
-        // has been written. Store joinable thread for later sync
-        std::thread t = std::thread(
-            &OctreeManager::writeToMultipleFiles,
-            _indexOctreeManager,
-            _outFileOrFolderPath,
-            idx
+        // Write to 8 separate files in the background. Data will be cleared after it
+        // has been written
+        global::taskScheduler->enqueue(
+            [manager = _indexOctreeManager, path = _outFileOrFolderPath, idx]() {
+                manager->writeToMultipleFiles(path, idx);
+            },
+            TaskScheduler::Priority::Normal,
+            writeTasks
         );
-        writeThreads[idx] = std::move(t);
     }
 
     LINFO(std::format(
@@ -510,9 +532,26 @@ void ConstructOctreeTask::constructOctreeFromFolder(
         ));
     }
 
-    // Make sure all threads are done
-    for (int i = 0; i < 8; i++) {
-        writeThreads[i].join();
+    // Make sure all writes are done
+    writeTasks.wait();
+
+    if (_writeContainer) {
+        const std::filesystem::path containerPath =
+            _outFileOrFolderPath / "octree.container";
+        LINFO(std::format("Writing Octree container '{}'", containerPath));
+
+        // Read the structure back so that the data of the nodes is streamed from the
+        // files that were just written
+        OctreeManager streamedOctree;
+        streamedOctree.initOctree(0, _maxDist, _maxStarsPerNode);
+        std::ifstream indexFile = std::ifstream(indexFileOutPath, std::ifstream::binary);
+        streamedOctree.readFromFile(indexFile, false, _outFileOrFolderPath);
+        try {
+            streamedOctree.writeToContainer(containerPath);
+        }
+        catch (const ghoul::RuntimeError& e) {
+            LERRORC(e.component, e.message);
+        }
     }
 }
 
@@ -84,6 +84,7 @@ private:
     int _maxDist = 0;
     int _maxStarsPerNode = 0;
     bool _singleFileInput = false;
+    bool _writeContainer = false;
 
     std::shared_ptr<OctreeManager> _octreeManager;
     std::shared_ptr<OctreeManager> _indexOctreeManager;
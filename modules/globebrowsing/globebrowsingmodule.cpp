@@ -26,6 +26,7 @@
 
 #include <modules/globebrowsing/src/basictypes.h>
 #include <modules/globebrowsing/src/dashboarditemglobelocation.h>
+#include <modules/globebrowsing/src/disktilecache.h>
 #include <modules/globebrowsing/src/gdalwrapper.h>
 #include <modules/globebrowsing/src/geodeticpatch.h>
 #include <modules/globebrowsing/src/geojson/geojsoncomponent.h>
@@ -38,6 +39,7 @@
 #include <modules/globebrowsing/src/ringscomponent.h>
 #include <modules/globebrowsing/src/shadowcomponent.h>
 #include <modules/globebrowsing/src/tileindex.h>
+#include <modules/globebrowsing/src/tileioscheduler.h>
 #include <modules/globebrowsing/src/tileprovider/defaulttileprovider.h>
 #include <modules/globebrowsing/src/tileprovider/imagesequencetileprovider.h>
 #include <modules/globebrowsing/src/tileprovider/singleimagetileprovider.h>
@@ -191,6 +193,26 @@ namespace {
 
         // [[codegen::verbatim(MRFCacheLocationInfo.description)]]
         std::optional<std::string> mrfCacheLocation [[codegen::key("MRFCacheLocation")]];
+
+        // The number of threads that are shared between all globes and layers to load
+        // tiles. This value limits the number of tiles that are read concurrently
+        std::optional<int> tileIOThreads [[codegen::greater(0)]];
+
+        // The maximum number of tile requests that a single layer can have waiting to be
+        // loaded. If more tiles are requested, the least important ones are cancelled
+        std::optional<int> tileIOMaxQueuedJobs [[codegen::greater(0)]];
+
+        // Determines whether loaded tiles of all layers are stored on the local disk, so
+        // that they do not have to be requested from their source again. In contrast to
+        // the MRF cache, this works for all types of datasets
+        std::optional<bool> tileDiskCacheEnabled;
+
+        // The folder in which the tiles of the disk cache are stored
+        std::optional<std::string> tileDiskCacheLocation;
+
+        // The maximum size of the disk cache in MB. If the cache grows larger than this,
+        // the tiles that have not been used for the longest time are removed
+        std::optional<int> tileDiskCacheSize [[codegen::greater(0)]];
     };
 } // namespace
 #include "globebrowsingmodule_codegen.cpp"
@@ -247,6 +269,19 @@ void GlobeBrowsingModule::internalInitialize(const ghoul::Dictionary& dict) {
     _mrfCacheEnabled = p.mrfCacheEnabled.value_or(_mrfCacheEnabled);
     _mrfCacheLocation = p.mrfCacheLocation.value_or(_mrfCacheLocation);
 
+    _tileIOScheduler = std::make_unique<TileIOScheduler>(
+        static_cast<unsigned int>(p.tileIOThreads.value_or(4)),
+        static_cast<size_t>(p.tileIOMaxQueuedJobs.value_or(16))
+    );
+
+    if (p.tileDiskCacheEnabled.value_or(false)) {
+        const uint64_t sizeMB = static_cast<uint64_t>(p.tileDiskCacheSize.value_or(4096));
+        _diskTileCache = std::make_unique<DiskTileCache>(
+            absPath(p.tileDiskCacheLocation.value_or("${BASE}/cache_tiles")),
+            sizeMB * 1024 * 1024
+        );
+    }
+
     // Initialize
     global::callback::initializeGL->emplace_back([this]() {
         ZoneScopedN("GlobeBrowsingModule");
@@ -276,7 +311,7 @@ void GlobeBrowsingModule::internalInitialize(const ghoul::Dictionary& dict) {
             ZoneScopedN("GlobeBrowsingModule");
 
             _tileCache->update();
-
+            _tileIOScheduler->update();
         }
     );
 
@@ -321,6 +356,14 @@ MemoryAwareTileCache* GlobeBrowsingModule::tileCache() {
     return _tileCache.get();
 }
 
+TileIOScheduler* GlobeBrowsingModule::tileIOScheduler() {
+    return _tileIOScheduler.get();
+}
+
+DiskTileCache* GlobeBrowsingModule::diskTileCache() {
+    return _diskTileCache.get();
+}
+
 std::vector<Documentation> GlobeBrowsingModule::documentations() const {
     return {
         openspace::Layer::Documentation(),
@@ -510,7 +553,8 @@ LuaLibrary GlobeBrowsingModule::luaLibrary() const {
             codegen::lua::DeleteGeoJson,
             codegen::lua::AddGeoJsonFromFile,
             codegen::lua::Globes,
-            codegen::lua::UrlInfo
+            codegen::lua::UrlInfo,
+            codegen::lua::TileIOStatistics
         },
         .scripts = {
             absPath("${MODULE_GLOBEBROWSING}/scripts/layer_support.lua"),
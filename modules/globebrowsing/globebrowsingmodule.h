@@ -36,9 +36,11 @@
 
 namespace openspace {
 
+class DiskTileCache;
 class MemoryAwareTileCache;
 class RenderableGlobe;
 class SceneGraphNode;
+class TileIOScheduler;
 
 class GlobeBrowsingModule : public OpenSpaceModule {
 public:
@@ -49,6 +51,13 @@ public:
     void goToChunk(const SceneGraphNode& globe, int x, int y, int level);
 
     MemoryAwareTileCache* tileCache();
+    TileIOScheduler* tileIOScheduler();
+
+    /**
+     * Returns the persistent cache for tiles on the local disk, or `nullptr` if the disk
+     * cache is disabled.
+     */
+    DiskTileCache* diskTileCache();
     LuaLibrary luaLibrary() const override;
     std::vector<openspace::Documentation> documentations() const override;
     static openspace::Documentation Documentation();
@@ -97,6 +106,8 @@ private:
     StringProperty _mrfCacheLocation;
 
     std::unique_ptr<MemoryAwareTileCache> _tileCache;
+    std::unique_ptr<TileIOScheduler> _tileIOScheduler;
+    std::unique_ptr<DiskTileCache> _diskTileCache;
 
     // name -> capabilities
     std::map<std::string, std::future<Capabilities>> _inFlightCapabilitiesMap;
@@ -595,6 +595,45 @@ namespace {
     return res;
 }
 
+/**
+ * Returns the statistics of the scheduler that loads the tiles of all globes. The
+ * returned table contains the number of queued (`queued`, `maxQueued`), currently loading
+ * (`running`), finished (`finished`), and cancelled (`cancelled`) tile requests, as well
+ * as the average and maximum time in milliseconds between the request of a tile and the
+ * end of its loading (`averageTimeToTile`, `maxTimeToTile`). If the disk cache is
+ * enabled, the table also contains the number of tiles that were (`diskCacheHits`) and
+ * were not (`diskCacheMisses`) found in the cache, and the size of the cache in bytes
+ * (`diskCacheSize`).
+ *
+ * \param reset If `true`, the statistics are reset after they have been returned
+ * \return A table with the statistics of the tile loading
+ */
+[[codegen::luawrap]] ghoul::Dictionary tileIOStatistics(bool reset = false) {
+    GlobeBrowsingModule* module = global::moduleEngine->module<GlobeBrowsingModule>();
+    TileIOScheduler* scheduler = module->tileIOScheduler();
+    ghoul_assert(scheduler, "No tile scheduler");
+    const TileIOScheduler::Statistics stats = scheduler->statistics();
+    if (reset) {
+        scheduler->resetStatistics();
+    }
+
+    ghoul::Dictionary res;
+    res.setValue("queued", static_cast<double>(stats.nQueuedJobs));
+    res.setValue("maxQueued", static_cast<double>(stats.maxQueuedJobs));
+    res.setValue("running", static_cast<double>(stats.nRunningJobs));
+    res.setValue("finished", static_cast<double>(stats.nFinishedJobs));
+    res.setValue("cancelled", static_cast<double>(stats.nCancelledJobs));
+    res.setValue("averageTimeToTile", stats.averageTimeToTile);
+    res.setValue("maxTimeToTile", stats.maxTimeToTile);
+
+    if (const DiskTileCache* cache = module->diskTileCache();  cache) {
+        res.setValue("diskCacheHits", static_cast<double>(cache->nHits()));
+        res.setValue("diskCacheMisses", static_cast<double>(cache->nMisses()));
+        res.setValue("diskCacheSize", static_cast<double>(cache->size()));
+    }
+    return res;
+}
+
 } // namespace
 
 #include "globebrowsingmodule_lua_codegen.cpp"
@@ -24,9 +24,8 @@
 
 #include <modules/globebrowsing/src/asynctiledataprovider.h>
 
-#include <modules/globebrowsing/src/lruthreadpool.h>
+#include <modules/globebrowsing/src/disktilecache.h>
 #include <modules/globebrowsing/src/rawtile.h>
-#include <modules/globebrowsing/src/tileloadjob.h>
 #include <ghoul/format.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/profiling.h>
@@ -42,16 +41,28 @@ namespace {
 namespace openspace {
 
 AsyncTileDataProvider::AsyncTileDataProvider(std::string name,
-                                     std::unique_ptr<RawTileDataReader> rawTileDataReader)
+                                     std::unique_ptr<RawTileDataReader> rawTileDataReader,
+                                                             TileIOScheduler& scheduler,
+                                                          DiskTileCache* diskTileCache,
+                                                             uint64_t diskTileCacheKey)
     : _name(std::move(name))
     , _rawTileDataReader(std::move(rawTileDataReader))
-    , _concurrentJobManager(LRUThreadPool<TileIndex::TileHashKey>(1, 10))
+    , _scheduler(scheduler)
+    , _schedulerId(_scheduler.registerProvider())
+    , _diskTileCache(diskTileCache)
+    , _diskTileCacheKey(diskTileCacheKey)
 {
     ZoneScoped;
 
     performReset(ResetRawTileDataReader::No);
 }
 
+AsyncTileDataProvider::~AsyncTileDataProvider() {
+    // The running jobs are using the reader, so we have to wait for them before the
+    // reader is destroyed
+    _scheduler.unregisterProvider(_schedulerId);
+}
+
 const RawTileDataReader& AsyncTileDataProvider::rawTileDataReader() const {
     return *_rawTileDataReader;
 }
@@ -60,14 +71,40 @@ bool AsyncTileDataProvider::enqueueTileIO(const TileIndex& tileIndex) {
     ZoneScoped;
 
     if (_resetMode == ResetMode::ShouldNotReset && satisfiesEnqueueCriteria(tileIndex)) {
-        auto job = std::make_unique<TileLoadJob>(*_rawTileDataReader, tileIndex);
-        _concurrentJobManager.enqueueJob(std::move(job), tileIndex.hashKey());
+        _scheduler.enqueue(
+            _schedulerId,
+            tileIndex.hashKey(),
+            TileIOScheduler::currentPriority(),
+            // The provider waits for all of its jobs before it is destroyed
+            [this, tileIndex]() { return loadTile(tileIndex); }
+        );
         _enqueuedTileRequests.insert(tileIndex.hashKey());
         return true;
     }
     return false;
 }
 
+RawTile AsyncTileDataProvider::loadTile(const TileIndex& tileIndex) const {
+    ZoneScoped;
+
+    if (_diskTileCache) {
+        std::optional<RawTile> tile = _diskTileCache->get(
+            _diskTileCacheKey,
+            tileIndex,
+            _rawTileDataReader->tileTextureInitData()
+        );
+        if (tile.has_value()) {
+            return std::move(*tile);
+        }
+    }
+
+    RawTile tile = _rawTileDataReader->readTileData(tileIndex);
+    if (_diskTileCache) {
+        _diskTileCache->put(_diskTileCacheKey, tile);
+    }
+    return tile;
+}
+
 void AsyncTileDataProvider::clearTiles() {
     std::optional<RawTile> finishedJob = popFinishedRawTile();
     while (finishedJob) {
@@ -76,9 +113,9 @@ void AsyncTileDataProvider::clearTiles() {
 }
 
 std::optional<RawTile> AsyncTileDataProvider::popFinishedRawTile() {
-    if (_concurrentJobManager.numFinishedJobs() > 0) {
-        // Now the tile load job looses ownerwhip of the data pointer
-        RawTile product = _concurrentJobManager.popFinishedJob()->product();
+    std::optional<RawTile> finished = _scheduler.popFinishedTile(_schedulerId);
+    if (finished.has_value()) {
+        RawTile product = std::move(*finished);
 
         const TileIndex::TileHashKey key = product.tileIndex.hashKey();
         // No longer enqueued. Remove from set of enqueued tiles
@@ -98,15 +135,20 @@ std::optional<RawTile> AsyncTileDataProvider::popFinishedRawTile() {
 bool AsyncTileDataProvider::satisfiesEnqueueCriteria(const TileIndex& tileIndex) {
     ZoneScoped;
 
-    // Only satisfies if it is not already enqueued. Also bumps the request to the top
-    const bool alreadyEnqueued = _concurrentJobManager.touch(tileIndex.hashKey());
+    // Only satisfies if it is not already enqueued. Also updates the priority of the
+    // request and marks it as still being needed
+    const bool alreadyEnqueued = _scheduler.touch(
+        _schedulerId,
+        tileIndex.hashKey(),
+        TileIOScheduler::currentPriority()
+    );
     // Early out so we don't need to check the already enqueued requests
     if (alreadyEnqueued) {
         return false;
     }
 
-    // Concurrent job manager can start jobs which will pop them from enqueued; however
-    // they are still in _enqueuedTileRequests until finished
+    // The scheduler can start jobs which will remove them from its queue; however they
+    // are still in _enqueuedTileRequests until finished
     const auto it = _enqueuedTileRequests.find(tileIndex.hashKey());
     const bool notFoundAmongEnqueued = it == _enqueuedTileRequests.end();
 
@@ -115,7 +157,7 @@ bool AsyncTileDataProvider::satisfiesEnqueueCriteria(const TileIndex& tileIndex)
 
 void AsyncTileDataProvider::endUnfinishedJobs() {
     const std::vector<TileIndex::TileHashKey> unfinishedJobs =
-        _concurrentJobManager.keysToUnfinishedJobs();
+        _scheduler.cancelledJobs(_schedulerId);
     for (const TileIndex::TileHashKey& unfinishedJob : unfinishedJobs) {
         // When erasing the job before
         _enqueuedTileRequests.erase(unfinishedJob);
@@ -124,7 +166,7 @@ void AsyncTileDataProvider::endUnfinishedJobs() {
 
 void AsyncTileDataProvider::endEnqueuedJobs() {
     const std::vector<TileIndex::TileHashKey> enqueuedJobs =
-        _concurrentJobManager.keysToEnqueuedJobs();
+        _scheduler.cancelQueuedJobs(_schedulerId);
     for (const TileIndex::TileHashKey& enqueuedJob : enqueuedJobs) {
         // When erasing the job before
         _enqueuedTileRequests.erase(enqueuedJob);
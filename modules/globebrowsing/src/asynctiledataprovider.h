@@ -25,9 +25,9 @@
 #ifndef __OPENSPACE_MODULE_GLOBEBROWSING___ASYNC_TILE_DATAPROVIDER___H__
 #define __OPENSPACE_MODULE_GLOBEBROWSING___ASYNC_TILE_DATAPROVIDER___H__
 
-#include <modules/globebrowsing/src/prioritizingconcurrentjobmanager.h>
 #include <modules/globebrowsing/src/rawtiledatareader.h>
 #include <modules/globebrowsing/src/tileindex.h>
+#include <modules/globebrowsing/src/tileioscheduler.h>
 #include <ghoul/misc/boolean.h>
 #include <memory>
 #include <optional>
@@ -36,11 +36,14 @@
 
 namespace openspace {
 
+class DiskTileCache;
 struct RawTile;
 
 /**
  * The responsibility of this class is to enqueue tile requests and fetching finished
- * `RawTile`s that has been asynchronously loaded.
+ * `RawTile`s that has been asynchronously loaded. The tiles are loaded by the
+ * TileIOScheduler that is shared between all providers, using the priority of the
+ * TileIOScheduler::PriorityScope that is active when the tile is requested.
  */
 class AsyncTileDataProvider {
 public:
@@ -48,9 +51,23 @@ public:
      * \param name The name for this provider
      * \param rawTileDataReader The reader that will be used for the asynchronous tile
      *        loading
+     * \param scheduler The scheduler that executes the loading of the tiles. It has to
+     *        outlive this provider
+     * \param diskTileCache The cache in which loaded tiles are stored and that is
+     *        checked before a tile is read. If it is `nullptr`, tiles are always read
+     *        through the \p rawTileDataReader. It has to outlive this provider
+     * \param diskTileCacheKey The key of the tiles of this provider in the
+     *        \p diskTileCache as returned by DiskTileCache::providerKey
      */
     AsyncTileDataProvider(std::string name,
-        std::unique_ptr<RawTileDataReader> rawTileDataReader);
+        std::unique_ptr<RawTileDataReader> rawTileDataReader,
+        TileIOScheduler& scheduler, DiskTileCache* diskTileCache = nullptr,
+        uint64_t diskTileCacheKey = 0);
+
+    /**
+     * Waits for all tiles of this provider that are currently being loaded.
+     */
+    ~AsyncTileDataProvider();
 
     /**
      * Creates a job which asynchronously loads a raw tile. This job is enqueued.
@@ -87,9 +104,9 @@ protected:
     bool satisfiesEnqueueCriteria(const TileIndex& tileIndex);
 
     /**
-     * An unfinished job is a load tile job that has been popped from the thread pool due
-     * to its low priority. Once it has been popped, it is marked as unfinished and needs
-     * to be explicitly ended.
+     * An unfinished job is a load tile job that has been cancelled by the scheduler,
+     * either because it was not requested anymore or because of its low priority. These
+     * jobs need to be explicitly ended so that the tile can be requested again.
      */
     void endUnfinishedJobs();
 
@@ -99,13 +116,22 @@ protected:
 
     void performReset(ResetRawTileDataReader resetRawTileDataReader);
 
+    /**
+     * Loads the tile with the \p tileIndex, either from the disk cache or by using the
+     * raw tile data reader. This function is executed on the threads of the scheduler.
+     */
+    RawTile loadTile(const TileIndex& tileIndex) const;
+
 private:
     const std::string _name;
     /// The reader used for asynchronous reading
     std::unique_ptr<RawTileDataReader> _rawTileDataReader;
 
-    PrioritizingConcurrentJobManager<RawTile, TileIndex::TileHashKey>
-        _concurrentJobManager;
+    TileIOScheduler& _scheduler;
+    const TileIOScheduler::ProviderId _schedulerId;
+
+    DiskTileCache* _diskTileCache = nullptr;
+    const uint64_t _diskTileCacheKey = 0;
 
     std::set<TileIndex::TileHashKey> _enqueuedTileRequests;
 
@@ -0,0 +1,184 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_GLOBEBROWSING___CHUNKTREE___H__
+#define __OPENSPACE_MODULE_GLOBEBROWSING___CHUNKTREE___H__
+
+#include <modules/globebrowsing/src/geodeticpatch.h>
+#include <modules/globebrowsing/src/tileindex.h>
+#include <ghoul/glm.h>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+class Ellipsoid;
+
+struct BoundingHeights {
+    float min;
+    float max;
+    bool isAvailable;
+    bool tileOK;
+};
+
+struct Chunk {
+    enum class Status : uint8_t {
+        DoNothing,
+        WantMerge,
+        WantSplit
+    };
+
+    explicit Chunk(const TileIndex& ti);
+
+    const TileIndex tileIndex;
+    const GeodeticPatch surfacePatch;
+
+    Status status;
+
+    bool isVisible = true;
+    bool colorTileOK = false;
+    bool heightTileOK = false;
+
+    /// The priority with which the tiles of this chunk are loaded, see TileIOScheduler
+    double tilePriority = 0.0;
+
+    std::array<glm::dvec4, 8> corners;
+    std::array<Chunk*, 4> children = { { nullptr, nullptr, nullptr, nullptr } };
+};
+
+/// The value for the level supported by the available tile data if it is unknown
+constexpr int UnknownDesiredLevel = -1;
+
+/**
+ * The parameters that are shared by all chunks of a globe when evaluating their level of
+ * detail and visibility in a single frame.
+ */
+struct ChunkLodSettings {
+    /// The model-view-projection matrix that is used for frustum culling
+    glm::dmat4 modelViewProjection = glm::dmat4(1.0);
+    /// The position of the camera in the model space of the globe
+    glm::dvec3 cameraPosition = glm::dvec3(0.0);
+    /// The scale factor that determines how detailed the chunks close to the camera are
+    double lodScaleFactor = 1.0;
+    /// The smallest and largest level that a chunk is allowed to request
+    int minLevel = 2;
+    int maxLevel = 22;
+
+    bool levelByProjectedArea = true;
+    bool performFrustumCulling = true;
+    bool performHorizonCulling = true;
+    /// If `true`, the bounding corners of each chunk are recomputed
+    bool updateCorners = false;
+};
+
+/**
+ * The information about a single chunk that has to be requested from the tile providers
+ * before its level of detail can be evaluated. As the tile providers are not thread-safe,
+ * this information is gathered up front so that the evaluation itself can happen in
+ * parallel.
+ */
+struct ChunkLodInput {
+    Chunk* chunk = nullptr;
+    BoundingHeights heights = {
+        .min = 0.f,
+        .max = 0.f,
+        .isAvailable = false,
+        .tileOK = true
+    };
+    /// The level that is supported by the loaded tile data, or UnknownDesiredLevel
+    int levelByAvailableData = UnknownDesiredLevel;
+};
+
+/**
+ * Returns whether the provided \p chunk does not have any children.
+ */
+bool isLeaf(const Chunk& chunk);
+
+/**
+ * Appends all chunks of the tree starting at \p root to the \p result in depth-first
+ * post-order, meaning that all children are added before their parent. This is the same
+ * order in which the chunks are visited when updating the chunk tree.
+ */
+void collectChunks(Chunk& root, std::vector<Chunk*>& result);
+
+/**
+ * Calculates the eight corners of a bounding box in model space that contains the
+ * \p chunk on the surface of the \p ellipsoid offset by the provided \p heights. The
+ * first four corners are at the minimum height, the last four at the maximum height.
+ */
+std::array<glm::dvec4, 8> boundingCornersForChunk(const Chunk& chunk,
+    const Ellipsoid& ellipsoid, const BoundingHeights& heights);
+
+/**
+ * Returns `true` if the bounding corners of the \p chunk are outside the view frustum
+ * described by the model-view-projection matrix \p mvp.
+ */
+bool isCullableByFrustum(const Chunk& chunk, const glm::dmat4& mvp);
+
+/**
+ * Returns `true` if the \p chunk is hidden behind the horizon of the \p ellipsoid when
+ * seen from the \p cameraPosition, which is provided in the model space of the globe.
+ */
+bool isCullableByHorizon(const Chunk& chunk, const Ellipsoid& ellipsoid,
+    const glm::dvec3& cameraPosition, const BoundingHeights& heights);
+
+/**
+ * Calculates the level that the \p chunk should have based on the distance between the
+ * \p cameraPosition and the closest point of the chunk.
+ */
+int desiredLevelByDistance(const Chunk& chunk, const Ellipsoid& ellipsoid,
+    const glm::dvec3& cameraPosition, const BoundingHeights& heights,
+    double lodScaleFactor);
+
+/**
+ * Calculates the level that the \p chunk should have based on its approximate area when
+ * projected onto a unit sphere around the \p cameraPosition.
+ */
+int desiredLevelByProjectedArea(const Chunk& chunk, const Ellipsoid& ellipsoid,
+    const glm::dvec3& cameraPosition, const BoundingHeights& heights,
+    double lodScaleFactor);
+
+/**
+ * Evaluates the visibility, the desired status, and the tile priority of the chunk in the
+ * \p input and stores the results in the chunk. Only the chunk itself is modified, so
+ * different chunks can be evaluated concurrently.
+ */
+void evaluateChunk(const ChunkLodInput& input, const Ellipsoid& ellipsoid,
+    const ChunkLodSettings& settings);
+
+/**
+ * Evaluates all of the \p inputs using the #evaluateChunk function. If \p parallel is
+ * `true` and there are enough chunks to make it worthwhile, the chunks are distributed
+ * across the workers of the global TaskScheduler. As every chunk is evaluated
+ * independently of all others, the result is identical to the sequential evaluation
+ * regardless of the number of threads.
+ */
+void evaluateChunks(std::span<const ChunkLodInput> inputs, const Ellipsoid& ellipsoid,
+    const ChunkLodSettings& settings, bool parallel);
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_GLOBEBROWSING___CHUNKTREE___H__
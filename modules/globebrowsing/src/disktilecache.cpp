@@ -0,0 +1,378 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/globebrowsing/src/disktilecache.h>
+
+#include <modules/globebrowsing/src/tiletextureinitdata.h>
+#include <openspace/util/memorymappedfile.h>
+#include <ghoul/format.h>
+#include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/exception.h>
+#include <ghoul/misc/profiling.h>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr std::string_view _loggerCat = "DiskTileCache";
+
+    constexpr std::array<char, 4> Magic = { 'O', 'S', 'T', 'C' };
+    constexpr uint32_t Version = 1;
+    constexpr std::string_view TileExtension = ".tile";
+    constexpr std::string_view TemporaryExtension = ".tmp";
+
+    // Everything in front of the image data of a tile file
+    struct FileHeader {
+        std::array<char, 4> magic = Magic;
+        uint32_t version = Version;
+        uint64_t providerKey = 0;
+        uint64_t dataSize = 0;
+        uint32_t x = 0;
+        uint32_t y = 0;
+        uint32_t level = 0;
+        std::array<uint8_t, 4> hasMissingData = {};
+        std::array<float, 4> maxValues = {};
+        std::array<float, 4> minValues = {};
+    };
+    static_assert(sizeof(FileHeader) == 72, "FileHeader must not contain padding");
+
+    // Finalizer of the SplitMix64 generator to spread the bits of the keys
+    uint64_t mix(uint64_t v) {
+        v = (v ^ (v >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        v = (v ^ (v >> 27)) * 0x94d049bb133111ebULL;
+        return v ^ (v >> 31);
+    }
+
+    uint64_t tileHash(uint64_t providerKey, const openspace::TileIndex& tileIndex) {
+        return mix(providerKey ^ mix(tileIndex.hashKey()));
+    }
+
+    std::optional<openspace::RawTile> readTile(const std::filesystem::path& path,
+                                               uint64_t providerKey,
+                                               const openspace::TileIndex& tileIndex,
+                                        const openspace::TileTextureInitData& initData)
+    {
+        const openspace::MemoryMappedFile file = openspace::MemoryMappedFile(path);
+        if (file.size() < sizeof(FileHeader)) {
+            return std::nullopt;
+        }
+
+        FileHeader header;
+        std::memcpy(&header, file.data(), sizeof(FileHeader));
+        const bool isValid =
+            header.magic == Magic && header.version == Version &&
+            header.providerKey == providerKey &&
+            header.x == tileIndex.x && header.y == tileIndex.y &&
+            header.level == tileIndex.level &&
+            header.dataSize == initData.totalNumBytes &&
+            file.size() == sizeof(FileHeader) + header.dataSize;
+        if (!isValid) {
+            return std::nullopt;
+        }
+
+        openspace::RawTile tile;
+        tile.imageData = std::unique_ptr<std::byte[]>(new std::byte[header.dataSize]);
+        std::memcpy(
+            tile.imageData.get(),
+            file.data() + sizeof(FileHeader),
+            header.dataSize
+        );
+        tile.tileMetaData.maxValues = header.maxValues;
+        tile.tileMetaData.minValues = header.minValues;
+        for (size_t i = 0; i < header.hasMissingData.size(); i++) {
+            tile.tileMetaData.hasMissingData[i] = header.hasMissingData[i] != 0;
+        }
+        tile.textureInitData = initData;
+        tile.tileIndex = tileIndex;
+        tile.error = openspace::RawTile::ReadError::None;
+        return tile;
+    }
+} // namespace
+
+namespace openspace {
+
+DiskTileCache::DiskTileCache(std::filesystem::path directory, uint64_t maxSize)
+    : _directory(std::move(directory))
+    , _maxSize(maxSize)
+{
+    ZoneScoped;
+
+    std::error_code ec;
+    std::filesystem::create_directories(_directory, ec);
+    if (ec) {
+        throw ghoul::RuntimeError(std::format(
+            "Could not create tile cache directory '{}': {}", _directory, ec.message()
+        ));
+    }
+
+    // Restore the tiles of previous runs in the order in which they were last used
+    using Time = std::filesystem::file_time_type;
+    std::vector<std::tuple<Time, uint64_t, uint64_t>> tiles;
+    namespace fs = std::filesystem;
+    for (auto it = fs::recursive_directory_iterator(_directory, ec);
+         !ec && it != fs::recursive_directory_iterator();
+         it.increment(ec))
+    {
+        if (!it->is_regular_file()) {
+            continue;
+        }
+
+        const fs::path& path = it->path();
+        if (path.extension() == TemporaryExtension) {
+            // Left behind by a write that was interrupted
+            fs::remove(path, ec);
+            continue;
+        }
+        if (path.extension() != TileExtension) {
+            continue;
+        }
+
+        const std::string stem = path.stem().string();
+        uint64_t hash = 0;
+        const std::from_chars_result res = std::from_chars(
+            stem.data(),
+            stem.data() + stem.size(),
+            hash,
+            16
+        );
+        if (res.ec != std::errc() || res.ptr != stem.data() + stem.size()) {
+            continue;
+        }
+        tiles.emplace_back(it->last_write_time(), hash, it->file_size());
+    }
+
+    std::sort(tiles.begin(), tiles.end());
+    const std::lock_guard lock(_mutex);
+    for (const auto& [time, hash, size] : tiles) {
+        insert(hash, size);
+    }
+    evict();
+
+    LINFO(std::format(
+        "Using tile cache '{}' with {} tiles ({} MB)",
+        _directory, _entries.size(), _size / (1024 * 1024)
+    ));
+}
+
+uint64_t DiskTileCache::providerKey(std::string_view identity) {
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char c : identity) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::optional<RawTile> DiskTileCache::get(uint64_t providerKey,
+                                          const TileIndex& tileIndex,
+                                          const TileTextureInitData& initData)
+{
+    ZoneScoped;
+
+    const uint64_t hash = tileHash(providerKey, tileIndex);
+    {
+        const std::lock_guard lock(_mutex);
+        auto it = _entries.find(hash);
+        if (it == _entries.end()) {
+            _nMisses++;
+            return std::nullopt;
+        }
+        _lru.splice(_lru.begin(), _lru, it->second.lruPosition);
+    }
+
+    const std::filesystem::path path = tilePath(hash);
+    std::optional<RawTile> tile;
+    try {
+        tile = readTile(path, providerKey, tileIndex, initData);
+    }
+    catch (const ghoul::RuntimeError&) {
+        // The file was removed or cannot be mapped, so we treat it as corrupted
+    }
+
+    if (tile.has_value()) {
+        // Persist the order of use for the next run
+        std::error_code ec;
+        std::filesystem::last_write_time(
+            path,
+            std::filesystem::file_time_type::clock::now(),
+            ec
+        );
+    }
+
+    const std::lock_guard lock(_mutex);
+    if (!tile.has_value()) {
+        _nMisses++;
+        remove(hash);
+        return std::nullopt;
+    }
+    _nHits++;
+    return tile;
+}
+
+void DiskTileCache::put(uint64_t providerKey, const RawTile& tile) {
+    ZoneScoped;
+
+    if (tile.error != RawTile::ReadError::None || !tile.imageData ||
+        !tile.textureInitData.has_value())
+    {
+        return;
+    }
+
+    FileHeader header;
+    header.providerKey = providerKey;
+    header.dataSize = tile.textureInitData->totalNumBytes;
+    header.x = tile.tileIndex.x;
+    header.y = tile.tileIndex.y;
+    header.level = tile.tileIndex.level;
+    for (size_t i = 0; i < header.hasMissingData.size(); i++) {
+        header.hasMissingData[i] = tile.tileMetaData.hasMissingData[i] ? 1 : 0;
+    }
+    header.maxValues = tile.tileMetaData.maxValues;
+    header.minValues = tile.tileMetaData.minValues;
+
+    const uint64_t hash = tileHash(providerKey, tile.tileIndex);
+    const std::filesystem::path path = tilePath(hash);
+    std::filesystem::path temporary = path;
+    {
+        const std::lock_guard lock(_mutex);
+        temporary.replace_extension(
+            std::format(".{}{}", _nextTemporaryFile, TemporaryExtension)
+        );
+        _nextTemporaryFile++;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    {
+        std::ofstream file = std::ofstream(temporary, std::ofstream::binary);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+        file.write(
+            reinterpret_cast<const char*>(tile.imageData.get()),
+            header.dataSize
+        );
+        if (!file.good()) {
+            file.close();
+            std::filesystem::remove(temporary, ec);
+            LWARNING(std::format("Could not write tile to '{}'", temporary));
+            return;
+        }
+    }
+
+    // Renaming replaces the file in one step, so readers never see a partial tile
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        std::filesystem::remove(temporary, ec);
+        return;
+    }
+
+    const std::lock_guard lock(_mutex);
+    insert(hash, sizeof(FileHeader) + header.dataSize);
+    evict();
+}
+
+void DiskTileCache::clear() {
+    const std::lock_guard lock(_mutex);
+    while (!_lru.empty()) {
+        remove(_lru.back());
+    }
+}
+
+void DiskTileCache::setMaxSize(uint64_t maxSize) {
+    const std::lock_guard lock(_mutex);
+    _maxSize = maxSize;
+    evict();
+}
+
+uint64_t DiskTileCache::maxSize() const {
+    const std::lock_guard lock(_mutex);
+    return _maxSize;
+}
+
+uint64_t DiskTileCache::size() const {
+    const std::lock_guard lock(_mutex);
+    return _size;
+}
+
+size_t DiskTileCache::nTiles() const {
+    const std::lock_guard lock(_mutex);
+    return _entries.size();
+}
+
+uint64_t DiskTileCache::nHits() const {
+    const std::lock_guard lock(_mutex);
+    return _nHits;
+}
+
+uint64_t DiskTileCache::nMisses() const {
+    const std::lock_guard lock(_mutex);
+    return _nMisses;
+}
+
+std::filesystem::path DiskTileCache::tilePath(uint64_t hash) const {
+    // Spreading the files over subdirectories keeps the individual directories small
+    const std::string name = std::format("{:016x}", hash);
+    return _directory / name.substr(0, 2) / std::format("{}{}", name, TileExtension);
+}
+
+void DiskTileCache::insert(uint64_t hash, uint64_t size) {
+    auto it = _entries.find(hash);
+    if (it != _entries.end()) {
+        _size -= it->second.size;
+        _lru.erase(it->second.lruPosition);
+        _entries.erase(it);
+    }
+
+    _lru.push_front(hash);
+    _entries[hash] = { .size = size, .lruPosition = _lru.begin() };
+    _size += size;
+}
+
+void DiskTileCache::remove(uint64_t hash) {
+    auto it = _entries.find(hash);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    _size -= it->second.size;
+    _lru.erase(it->second.lruPosition);
+    _entries.erase(it);
+
+    std::error_code ec;
+    std::filesystem::remove(tilePath(hash), ec);
+}
+
+void DiskTileCache::evict() {
+    while (_size > _maxSize && !_lru.empty()) {
+        remove(_lru.back());
+    }
+}
+
+} // namespace openspace
@@ -0,0 +1,167 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_GLOBEBROWSING___DISKTILECACHE___H__
+#define __OPENSPACE_MODULE_GLOBEBROWSING___DISKTILECACHE___H__
+
+#include <modules/globebrowsing/src/rawtile.h>
+#include <modules/globebrowsing/src/tileindex.h>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+namespace openspace {
+
+class TileTextureInitData;
+
+/**
+ * A persistent cache of loaded tiles on the local disk that is shared between all tile
+ * providers. Tiles are stored with their image data exactly as it is uploaded to the
+ * GPU, so a cached tile does not have to be requested, decoded, or reprojected again.
+ *
+ * Each tile is stored in a separate file whose name is derived from the provider key and
+ * the TileIndex of the tile. The provider key is a hash of everything that identifies
+ * the source of a tile, such as the dataset path, which for temporal datasets includes
+ * the time, and the format of the texture. Files are read through a memory mapping and
+ * written to a temporary file first, so that an interrupted write never leaves a
+ * partial tile behind. If the total size of all files exceeds the maximum size, the
+ * least recently used tiles are removed. As the time of the last use is stored as the
+ * modification time of the files, this order is kept between runs.
+ *
+ * All functions of this class are thread-safe.
+ */
+class DiskTileCache {
+public:
+    /**
+     * Creates a cache in the provided \p directory, which is created if it does not
+     * exist. Tiles that were stored in the directory by previous runs are available
+     * immediately.
+     *
+     * \param directory The directory in which the tiles are stored
+     * \param maxSize The maximum number of bytes that the files of the cache can occupy
+     *
+     * \throw ghoul::RuntimeError If the \p directory could not be created
+     */
+    DiskTileCache(std::filesystem::path directory, uint64_t maxSize);
+
+    /**
+     * Returns the key that identifies the tiles of the provider described by the
+     * \p identity, which has to be passed to #get and #put.
+     *
+     * \param identity A description of everything that influences the contents of the
+     *        tiles of a provider
+     */
+    static uint64_t providerKey(std::string_view identity);
+
+    /**
+     * Returns the tile at the \p tileIndex of the provider with the \p providerKey if it
+     * exists in the cache.
+     *
+     * \param providerKey The key of the provider as returned by #providerKey
+     * \param tileIndex The index of the requested tile
+     * \param initData The format of the texture of the tile. Tiles whose size does not
+     *        match this format are discarded
+     * \return The cached tile or `std::nullopt` if no such tile exists in the cache
+     */
+    std::optional<RawTile> get(uint64_t providerKey, const TileIndex& tileIndex,
+        const TileTextureInitData& initData);
+
+    /**
+     * Stores the \p tile for the provider with the \p providerKey. Tiles that have a
+     * read error or that do not contain any image data are ignored.
+     *
+     * \param providerKey The key of the provider as returned by #providerKey
+     * \param tile The tile that should be stored
+     */
+    void put(uint64_t providerKey, const RawTile& tile);
+
+    /**
+     * Removes all tiles from the cache.
+     */
+    void clear();
+
+    /**
+     * Sets the maximum number of bytes that the files of the cache can occupy and removes
+     * the least recently used tiles if the cache is larger than that.
+     */
+    void setMaxSize(uint64_t maxSize);
+
+    /**
+     * Returns the maximum number of bytes that the files of the cache can occupy.
+     */
+    uint64_t maxSize() const;
+
+    /**
+     * Returns the number of bytes that the files of the cache currently occupy.
+     */
+    uint64_t size() const;
+
+    /**
+     * Returns the number of tiles that are currently stored in the cache.
+     */
+    size_t nTiles() const;
+
+    /**
+     * Returns the number of calls to #get that returned a tile.
+     */
+    uint64_t nHits() const;
+
+    /**
+     * Returns the number of calls to #get that did not return a tile.
+     */
+    uint64_t nMisses() const;
+
+private:
+    struct Entry {
+        uint64_t size = 0;
+        std::list<uint64_t>::iterator lruPosition;
+    };
+
+    std::filesystem::path tilePath(uint64_t hash) const;
+    void insert(uint64_t hash, uint64_t size);
+    void remove(uint64_t hash);
+    void evict();
+
+    const std::filesystem::path _directory;
+    uint64_t _maxSize;
+    uint64_t _size = 0;
+
+    std::unordered_map<uint64_t, Entry> _entries;
+    /// The hashes of all cached tiles with the most recently used tile at the front
+    std::list<uint64_t> _lru;
+
+    uint64_t _nHits = 0;
+    uint64_t _nMisses = 0;
+    uint64_t _nextTemporaryFile = 0;
+
+    mutable std::mutex _mutex;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_GLOBEBROWSING___DISKTILECACHE___H__
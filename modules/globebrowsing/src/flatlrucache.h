@@ -0,0 +1,200 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_GLOBEBROWSING___FLAT_LRU_CACHE___H__
+#define __OPENSPACE_MODULE_GLOBEBROWSING___FLAT_LRU_CACHE___H__
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Templated class implementing a Least-Recently-Used Cache with the same interface as
+ * the LRUCache, but without any dynamic memory allocations once the cache has reached
+ * its working size.
+ *
+ * The items are stored in a pool of nodes that are reused after they were removed from
+ * the cache. The nodes are linked into the recency list through indices rather than
+ * pointers, and they are found through an open-addressing hash table with linear
+ * probing, so that looking up or bumping an item only touches two contiguous arrays.
+ *
+ * `KeyType` needs to be comparable with `operator==` and `HasherType` needs to return an
+ * integer hash for a key.
+ */
+template <typename KeyType, typename ValueType, typename HasherType>
+class FlatLRUCache {
+public:
+    using Item = std::pair<KeyType, ValueType>;
+
+    /**
+     * \param size This is the maximum size of the cache given in number of cached items
+     */
+    explicit FlatLRUCache(size_t size);
+
+    void put(KeyType key, ValueType value);
+    std::vector<Item> putAndFetchPopped(KeyType key, ValueType value);
+    void clear();
+    bool exist(const KeyType& key) const;
+
+    /**
+     * If value exists, the value is bumped to the front of the queue.
+     *
+     * \return `true` if value of this key exists
+     */
+    bool touch(const KeyType& key);
+    bool isEmpty() const;
+
+    /**
+     * Returns the value of the \p key and bumps it to the front of the queue.
+     *
+     * \pre An item with the \p key must exist in the cache
+     */
+    ValueType get(const KeyType& key);
+
+    /**
+     * Pops the front of the queue.
+     */
+    Item popMRU();
+
+    /**
+     * Pops the back of the queue.
+     */
+    Item popLRU();
+    size_t size() const;
+    size_t maximumCacheSize() const;
+
+private:
+    using Index = uint32_t;
+    static constexpr Index Invalid = static_cast<Index>(-1);
+
+    struct Node {
+        std::optional<Item> item;
+        uint64_t hash = 0;
+        Index previous = Invalid;
+        Index next = Invalid;
+    };
+
+    struct Slot {
+        Index node = Invalid;
+        /// The upper bits of the hash, to skip most key comparisons on collisions
+        uint32_t tag = 0;
+    };
+
+    static uint64_t hashOf(const KeyType& key);
+
+    /// Returns the slot of the \p key or `Invalid` if it is not in the cache
+    Index findSlot(const KeyType& key, uint64_t hash) const;
+    void insertSlot(Index node, uint64_t hash);
+    void eraseSlot(Index slot);
+    void growTable();
+
+    Index allocateNode(Item item, uint64_t hash);
+    Item releaseNode(Index node);
+
+    void link(Index node);
+    void unlink(Index node);
+
+    /// Removes the node at the back of the queue and returns its item
+    Item popBack();
+
+    std::vector<Node> _nodes;
+    std::vector<Slot> _slots;
+    Index _freeNodes = Invalid;
+    Index _head = Invalid;
+    Index _tail = Invalid;
+    size_t _size = 0;
+
+    size_t _maximumCacheSize;
+};
+
+/**
+ * A thread-safe Least-Recently-Used Cache that distributes its items over a number of
+ * independent FlatLRUCache shards, each of which is protected by its own mutex. As every
+ * read of an LRU cache also modifies the recency order, a single lock would serialize
+ * all readers; with sharding, readers only contend if their keys are in the same shard.
+ *
+ * Each shard has an equal part of the maximum size and evicts its own least recently
+ * used items, so the eviction order is only approximately LRU across the whole cache.
+ */
+template <typename KeyType, typename ValueType, typename HasherType>
+class ShardedLRUCache {
+public:
+    using Item = std::pair<KeyType, ValueType>;
+
+    /**
+     * \param size This is the maximum size of the cache given in number of cached items
+     * \param nShards The number of independent shards into which the cache is split
+     *
+     * \pre \p nShards must be bigger than 0
+     */
+    explicit ShardedLRUCache(size_t size, size_t nShards = 16);
+
+    void put(KeyType key, ValueType value);
+    std::vector<Item> putAndFetchPopped(KeyType key, ValueType value);
+    void clear();
+    bool exist(const KeyType& key) const;
+    bool touch(const KeyType& key);
+    bool isEmpty() const;
+
+    /**
+     * Returns the value of the \p key and bumps it to the front of the queue.
+     *
+     * \pre An item with the \p key must exist in the cache
+     */
+    ValueType get(const KeyType& key);
+
+    /**
+     * Returns the value of the \p key and bumps it to the front of the queue if it
+     * exists. As other threads might remove an item at any time, this function should be
+     * used instead of a call to #exist followed by a call to #get.
+     */
+    std::optional<ValueType> tryGet(const KeyType& key);
+
+    size_t size() const;
+    size_t maximumCacheSize() const;
+
+private:
+    struct Shard {
+        explicit Shard(size_t size);
+
+        mutable std::mutex mutex;
+        FlatLRUCache<KeyType, ValueType, HasherType> cache;
+    };
+
+    Shard& shard(const KeyType& key) const;
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _maximumCacheSize;
+};
+
+} // namespace openspace
+
+#include <modules/globebrowsing/src/flatlrucache.inl>
+
+#endif // __OPENSPACE_MODULE_GLOBEBROWSING___FLAT_LRU_CACHE___H__
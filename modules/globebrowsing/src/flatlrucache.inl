@@ -0,0 +1,421 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/profiling.h>
+#include <algorithm>
+
+namespace openspace {
+
+namespace internal {
+
+// Finalizer of the SplitMix64 generator. The hashers that are used for the tile keys
+// place most of the entropy in the higher bits, but the hash table uses the lower ones
+inline uint64_t mixLRUHash(uint64_t v) {
+    v = (v ^ (v >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    v = (v ^ (v >> 27)) * 0x94d049bb133111ebULL;
+    return v ^ (v >> 31);
+}
+
+} // namespace internal
+
+template <typename KeyType, typename ValueType, typename HasherType>
+FlatLRUCache<KeyType, ValueType, HasherType>::FlatLRUCache(size_t size)
+    : _maximumCacheSize(size)
+{}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+void FlatLRUCache<KeyType, ValueType, HasherType>::clear() {
+    // Keep the allocated memory around as the cache is usually filled up again
+    _nodes.clear();
+    std::fill(_slots.begin(), _slots.end(), Slot());
+    _freeNodes = Invalid;
+    _head = Invalid;
+    _tail = Invalid;
+    _size = 0;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+void FlatLRUCache<KeyType, ValueType, HasherType>::put(KeyType key, ValueType value) {
+    ZoneScoped;
+
+    const uint64_t hash = hashOf(key);
+    const Index slot = findSlot(key, hash);
+    if (slot != Invalid) {
+        const Index node = _slots[slot].node;
+        _nodes[node].item->second = std::move(value);
+        unlink(node);
+        link(node);
+        return;
+    }
+
+    if ((_size + 1) * 2 > _slots.size()) {
+        growTable();
+    }
+    const Index node = allocateNode(Item(std::move(key), std::move(value)), hash);
+    insertSlot(node, hash);
+    link(node);
+    _size++;
+
+    while (_size > _maximumCacheSize) {
+        popBack();
+    }
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+std::vector<std::pair<KeyType, ValueType>>
+FlatLRUCache<KeyType, ValueType, HasherType>::putAndFetchPopped(KeyType key,
+                                                                ValueType value)
+{
+    // Temporarily lift the limit so that we can collect the items that are pushed out
+    const size_t maximumSize = std::exchange(_maximumCacheSize, _size + 1);
+    put(std::move(key), std::move(value));
+    _maximumCacheSize = maximumSize;
+
+    std::vector<Item> res;
+    while (_size > _maximumCacheSize) {
+        res.push_back(popBack());
+    }
+    return res;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+bool FlatLRUCache<KeyType, ValueType, HasherType>::exist(const KeyType& key) const {
+    return findSlot(key, hashOf(key)) != Invalid;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+bool FlatLRUCache<KeyType, ValueType, HasherType>::touch(const KeyType& key) {
+    ZoneScoped;
+
+    const Index slot = findSlot(key, hashOf(key));
+    if (slot == Invalid) {
+        return false;
+    }
+
+    const Index node = _slots[slot].node;
+    if (node != _head) {
+        unlink(node);
+        link(node);
+    }
+    return true;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+bool FlatLRUCache<KeyType, ValueType, HasherType>::isEmpty() const {
+    return _size == 0;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+ValueType FlatLRUCache<KeyType, ValueType, HasherType>::get(const KeyType& key) {
+    const Index slot = findSlot(key, hashOf(key));
+    ghoul_assert(slot != Invalid, "Key must exist in the cache");
+
+    const Index node = _slots[slot].node;
+    if (node != _head) {
+        unlink(node);
+        link(node);
+    }
+    return _nodes[node].item->second;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+std::pair<KeyType, ValueType> FlatLRUCache<KeyType, ValueType, HasherType>::popMRU() {
+    ghoul_assert(_size > 0, "Cannot pop LRU cache. Ensure cache is not empty");
+
+    const Index node = _head;
+    eraseSlot(findSlot(_nodes[node].item->first, _nodes[node].hash));
+    unlink(node);
+    _size--;
+    return releaseNode(node);
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+std::pair<KeyType, ValueType> FlatLRUCache<KeyType, ValueType, HasherType>::popLRU() {
+    ghoul_assert(_size > 0, "Cannot pop LRU cache. Ensure cache is not empty");
+
+    return popBack();
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+size_t FlatLRUCache<KeyType, ValueType, HasherType>::size() const {
+    return _size;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+size_t FlatLRUCache<KeyType, ValueType, HasherType>::maximumCacheSize() const {
+    return _maximumCacheSize;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+uint64_t FlatLRUCache<KeyType, ValueType, HasherType>::hashOf(const KeyType& key) {
+    return internal::mixLRUHash(static_cast<uint64_t>(HasherType()(key)));
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+typename FlatLRUCache<KeyType, ValueType, HasherType>::Index
+FlatLRUCache<KeyType, ValueType, HasherType>::findSlot(const KeyType& key,
+                                                       uint64_t hash) const
+{
+    if (_slots.empty()) {
+        return Invalid;
+    }
+
+    // The table is never more than half full, so there is always an empty slot that
+    // terminates the search
+    const size_t mask = _slots.size() - 1;
+    const uint32_t tag = static_cast<uint32_t>(hash >> 32);
+    for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+        const Slot& s = _slots[i];
+        if (s.node == Invalid) {
+            return Invalid;
+        }
+        if (s.tag == tag && _nodes[s.node].item->first == key) {
+            return static_cast<Index>(i);
+        }
+    }
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+void FlatLRUCache<KeyType, ValueType, HasherType>::insertSlot(Index node, uint64_t hash) {
+    const size_t mask = _slots.size() - 1;
+    size_t i = hash & mask;
+    while (_slots[i].node != Invalid) {
+        i = (i + 1) & mask;
+    }
+    _slots[i] = { .node = node, .tag = static_cast<uint32_t>(hash >> 32) };
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+void FlatLRUCache<KeyType, ValueType, HasherType>::eraseSlot(Index slot) {
+    ghoul_assert(slot != Invalid, "Slot must be valid");
+
+    // Instead of leaving a tombstone, we move later entries of the same probe sequence
+    // into the hole so that lookups never have to skip over removed entries
+    const size_t mask = _slots.size() - 1;
+    size_t hole = slot;
+    size_t i = slot;
+    while (true) {
+        i = (i + 1) & mask;
+        if (_slots[i].node == Invalid) {
+            break;
+        }
+
+        const size_t home = _nodes[_slots[i].node].hash & mask;
+        const bool isBetween = (hole <= i) ?
+            (hole < home && home <= i) :
+            (hole < home || home <= i);
+        if (!isBetween) {
+            _slots[hole] = _slots[i];
+            hole = i;
+        }
+    }
+    _slots[hole] = Slot();
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+void FlatLRUCache<KeyType, ValueType, HasherType>::growTable() {
+    const size_t capacity = std::max<size_t>(_slots.size() * 2, 16);
+    _slots.assign(capacity, Slot());
+    for (Index node = _head; node != Invalid; node = _nodes[node].next) {
+        insertSlot(node, _nodes[node].hash);
+    }
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+typename FlatLRUCache<KeyType, ValueType, HasherType>::Index
+FlatLRUCache<KeyType, ValueType, HasherType>::allocateNode(Item item, uint64_t hash) {
+    if (_freeNodes != Invalid) {
+        const Index node = _freeNodes;
+        _freeNodes = _nodes[node].next;
+        _nodes[node].item.emplace(std::move(item));
+        _nodes[node].hash = hash;
+        return node;
+    }
+
+    ghoul_assert(_nodes.size() < Invalid, "Too many items in the cache");
+    _nodes.push_back({ .item = std::move(item), .hash = hash });
+    return static_cast<Index>(_nodes.size() - 1);
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+std::pair<KeyType, ValueType>
+FlatLRUCache<KeyType, ValueType, HasherType>::releaseNode(Index node)
+{
+    Item res = std::move(*_nodes[node].item);
+    _nodes[node].item.reset();
+    _nodes[node].previous = Invalid;
+    _nodes[node].next = _freeNodes;
+    _freeNodes = node;
+    return res;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+void FlatLRUCache<KeyType, ValueType, HasherType>::link(Index node) {
+    _nodes[node].previous = Invalid;
+    _nodes[node].next = _head;
+    if (_head != Invalid) {
+        _nodes[_head].previous = node;
+    }
+    _head = node;
+    if (_tail == Invalid) {
+        _tail = node;
+    }
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+void FlatLRUCache<KeyType, ValueType, HasherType>::unlink(Index node) {
+    const Index previous = _nodes[node].previous;
+    const Index next = _nodes[node].next;
+    if (previous != Invalid) {
+        _nodes[previous].next = next;
+    }
+    else {
+        _head = next;
+    }
+    if (next != Invalid) {
+        _nodes[next].previous = previous;
+    }
+    else {
+        _tail = previous;
+    }
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+std::pair<KeyType, ValueType> FlatLRUCache<KeyType, ValueType, HasherType>::popBack() {
+    const Index node = _tail;
+    eraseSlot(findSlot(_nodes[node].item->first, _nodes[node].hash));
+    unlink(node);
+    _size--;
+    return releaseNode(node);
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+ShardedLRUCache<KeyType, ValueType, HasherType>::Shard::Shard(size_t size)
+    : cache(size)
+{}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+ShardedLRUCache<KeyType, ValueType, HasherType>::ShardedLRUCache(size_t size,
+                                                                 size_t nShards)
+    : _maximumCacheSize(size)
+{
+    ghoul_assert(nShards > 0, "Need at least one shard");
+
+    // Round up so that the shards together can hold at least the requested size
+    const size_t shardSize = size / nShards + (size % nShards != 0 ? 1 : 0);
+    _shards.reserve(nShards);
+    for (size_t i = 0; i < nShards; i++) {
+        _shards.push_back(std::make_unique<Shard>(shardSize));
+    }
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+void ShardedLRUCache<KeyType, ValueType, HasherType>::put(KeyType key, ValueType value) {
+    Shard& s = shard(key);
+    const std::lock_guard lock(s.mutex);
+    s.cache.put(std::move(key), std::move(value));
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+std::vector<std::pair<KeyType, ValueType>>
+ShardedLRUCache<KeyType, ValueType, HasherType>::putAndFetchPopped(KeyType key,
+                                                                   ValueType value)
+{
+    Shard& s = shard(key);
+    const std::lock_guard lock(s.mutex);
+    return s.cache.putAndFetchPopped(std::move(key), std::move(value));
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+void ShardedLRUCache<KeyType, ValueType, HasherType>::clear() {
+    for (const std::unique_ptr<Shard>& s : _shards) {
+        const std::lock_guard lock(s->mutex);
+        s->cache.clear();
+    }
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+bool ShardedLRUCache<KeyType, ValueType, HasherType>::exist(const KeyType& key) const {
+    Shard& s = shard(key);
+    const std::lock_guard lock(s.mutex);
+    return s.cache.exist(key);
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+bool ShardedLRUCache<KeyType, ValueType, HasherType>::touch(const KeyType& key) {
+    Shard& s = shard(key);
+    const std::lock_guard lock(s.mutex);
+    return s.cache.touch(key);
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+bool ShardedLRUCache<KeyType, ValueType, HasherType>::isEmpty() const {
+    return size() == 0;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+ValueType ShardedLRUCache<KeyType, ValueType, HasherType>::get(const KeyType& key) {
+    Shard& s = shard(key);
+    const std::lock_guard lock(s.mutex);
+    return s.cache.get(key);
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+std::optional<ValueType>
+ShardedLRUCache<KeyType, ValueType, HasherType>::tryGet(const KeyType& key)
+{
+    Shard& s = shard(key);
+    const std::lock_guard lock(s.mutex);
+    if (!s.cache.exist(key)) {
+        return std::nullopt;
+    }
+    return s.cache.get(key);
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+size_t ShardedLRUCache<KeyType, ValueType, HasherType>::size() const {
+    size_t res = 0;
+    for (const std::unique_ptr<Shard>& s : _shards) {
+        const std::lock_guard lock(s->mutex);
+        res += s->cache.size();
+    }
+    return res;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+size_t ShardedLRUCache<KeyType, ValueType, HasherType>::maximumCacheSize() const {
+    return _maximumCacheSize;
+}
+
+template <typename KeyType, typename ValueType, typename HasherType>
+typename ShardedLRUCache<KeyType, ValueType, HasherType>::Shard&
+ShardedLRUCache<KeyType, ValueType, HasherType>::shard(const KeyType& key) const
+{
+    // Use the highest bits as the lower ones select the slot inside the shard
+    const uint64_t hash = internal::mixLRUHash(static_cast<uint64_t>(HasherType()(key)));
+    return *_shards[(hash >> 48) % _shards.size()];
+}
+
+} // namespace openspace
@@ -92,13 +92,7 @@ std::vector<Geodetic2> geodetic2FromVertexList(const RenderableGlobe& globe,
 std::vector<float> heightMapHeightsFromGeodetic2List(const RenderableGlobe& globe,
                                                      const std::vector<Geodetic2>& list)
 {
-    std::vector<float> res;
-    res.reserve(list.size());
-    for (const Geodetic2& geo : list) {
-        const float h = static_cast<float>(getHeightToReferenceSurface(geo, globe));
-        res.push_back(h);
-    }
-    return res;
+    return globe.surfaceHeights(list);
 }
 
 std::vector<rendering::VertexXYZNormal>
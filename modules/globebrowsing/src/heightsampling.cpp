@@ -0,0 +1,283 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/globebrowsing/src/heightsampling.h>
+
+#include <modules/globebrowsing/src/chunktree.h>
+#include <modules/globebrowsing/src/geodeticpatch.h>
+#include <modules/globebrowsing/src/layerrendersettings.h>
+#include <openspace/util/geodetic.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/profiling.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace {
+    using namespace openspace;
+
+    // The points of a tile are interpolated in fixed-size blocks whose intermediate
+    // values are stored as separate arrays so that the compiler can vectorize the loops
+    constexpr size_t BlockSize = 64;
+
+    const Chunk& findChunkNode(const Chunk& node, const Geodetic2& location) {
+        const Chunk* n = &node;
+
+        while (!isLeaf(*n)) {
+            const Geodetic2 center = n->surfacePatch.center();
+            int index = 0;
+            if (center.lon < location.lon) {
+                index++;
+            }
+            if (location.lat < center.lat) {
+                index++;
+                index++;
+            }
+            n = n->children[static_cast<Quad>(index)];
+        }
+        return *n;
+    }
+
+    // The leaf chunk that contains a point and the point's uv coordinates within that
+    // chunk. All points that share a chunk also share the tiles that are sampled
+    struct Location {
+        TileIndex::TileHashKey key;
+        uint32_t index;
+        TileIndex tileIndex;
+        glm::vec2 patchUV;
+    };
+
+    Location locate(const Geodetic2& geodeticPosition, uint32_t index,
+                    const Chunk& leftRoot, const Chunk& rightRoot)
+    {
+        const Chunk& node = geodeticPosition.lon < leftRoot.surfacePatch.maxLon() ?
+            findChunkNode(leftRoot, geodeticPosition) :
+            findChunkNode(rightRoot, geodeticPosition);
+        const int chunkLevel = node.tileIndex.level;
+
+        const int numIndicesAtLevel = 1 << chunkLevel;
+        const double u = 0.5 + geodeticPosition.lon / glm::two_pi<double>();
+        const double v = 0.25 - geodeticPosition.lat / glm::two_pi<double>();
+        const double xIndexSpace = u * numIndicesAtLevel;
+        const double yIndexSpace = v * numIndicesAtLevel;
+
+        const int x = static_cast<int>(floor(xIndexSpace));
+        const int y = static_cast<int>(floor(yIndexSpace));
+
+        ghoul_assert(chunkLevel < std::numeric_limits<uint8_t>::max(), "Too high level");
+        const TileIndex tileIndex(x, y, static_cast<uint8_t>(chunkLevel));
+        const GeodeticPatch patch = GeodeticPatch(tileIndex);
+
+        const Geodetic2 northEast = patch.corner(Quad::NORTH_EAST);
+        const Geodetic2 southWest = patch.corner(Quad::SOUTH_WEST);
+
+        const Geodetic2 geoDiffPatch = {
+            .lat = northEast.lat - southWest.lat,
+            .lon = northEast.lon - southWest.lon
+        };
+
+        const Geodetic2 geoDiffPoint = {
+            .lat = geodeticPosition.lat - southWest.lat,
+            .lon = geodeticPosition.lon - southWest.lon
+        };
+        const glm::vec2 patchUV = glm::vec2(
+            geoDiffPoint.lon / geoDiffPatch.lon,
+            geoDiffPoint.lat / geoDiffPatch.lat
+        );
+
+        return {
+            .key = tileIndex.hashKey(),
+            .index = index,
+            .tileIndex = tileIndex,
+            .patchUV = patchUV
+        };
+    }
+
+    void sampleTile(const HeightTileData& tile, std::span<const Location> locations,
+                    std::span<float> result)
+    {
+        ghoul_assert(tile.renderSettings, "No render settings provided");
+        ghoul_assert(tile.texels || tile.texel, "No texel access provided");
+
+        const glm::uvec2 dimensions = tile.dimensions;
+        const unsigned int maxX = dimensions.x - 1;
+        const unsigned int maxY = dimensions.y - 1;
+
+        std::array<float, BlockSize> fractX;
+        std::array<float, BlockSize> fractY;
+        std::array<float, BlockSize> s00;
+        std::array<float, BlockSize> s10;
+        std::array<float, BlockSize> s01;
+        std::array<float, BlockSize> s11;
+        std::array<float, BlockSize> samples;
+
+        for (size_t b = 0; b < locations.size(); b += BlockSize) {
+            const size_t n = std::min(BlockSize, locations.size() - b);
+
+            for (size_t i = 0; i < n; i++) {
+                // Transform the uv coordinates to the current tile texture
+                const glm::vec2 transformedUv =
+                    tile.uvTransform.uvOffset +
+                    tile.uvTransform.uvScale * locations[b + i].patchUV;
+
+                glm::vec2 samplePos = transformedUv * glm::vec2(dimensions);
+                // @TODO (emmbr, 2023-06-14) This 0.5f offset was added as a bandaid for
+                // issue #2696. It seems to improve the behavior, but I am not certain of
+                // why. And the underlying problem is still there and should at some point
+                // be looked at again
+                samplePos -= glm::vec2(0.5f);
+
+                glm::uvec2 samplePos00 = samplePos;
+                samplePos00 = glm::clamp(
+                    samplePos00,
+                    glm::uvec2(0, 0),
+                    glm::uvec2(maxX, maxY)
+                );
+                fractX[i] = samplePos.x - static_cast<float>(samplePos00.x);
+                fractY[i] = samplePos.y - static_cast<float>(samplePos00.y);
+
+                const unsigned int x0 = samplePos00.x;
+                const unsigned int y0 = samplePos00.y;
+                const unsigned int x1 = std::min(x0 + 1, maxX);
+                const unsigned int y1 = std::min(y0 + 1, maxY);
+
+                if (tile.texels) {
+                    s00[i] = tile.texels[y0 * dimensions.x + x0];
+                    s10[i] = tile.texels[y0 * dimensions.x + x1];
+                    s01[i] = tile.texels[y1 * dimensions.x + x0];
+                    s11[i] = tile.texels[y1 * dimensions.x + x1];
+                }
+                else {
+                    s00[i] = tile.texel(x0, y0);
+                    s10[i] = tile.texel(x1, y0);
+                    s01[i] = tile.texel(x0, y1);
+                    s11[i] = tile.texel(x1, y1);
+                }
+            }
+
+            for (size_t i = 0; i < n; i++) {
+                const float sample0 = s00[i] * (1.f - fractX[i]) + s10[i] * fractX[i];
+                const float sample1 = s01[i] * (1.f - fractX[i]) + s11[i] * fractX[i];
+                samples[i] = sample0 * (1.f - fractY[i]) + sample1 * fractY[i];
+            }
+
+            for (size_t i = 0; i < n; i++) {
+                // In case the texture has NaN or no data values don't use this height map
+                // for this point
+                const bool anySampleIsNaN =
+                    std::isnan(s00[i]) || std::isnan(s01[i]) ||
+                    std::isnan(s10[i]) || std::isnan(s11[i]);
+
+                const bool anySampleIsNoData =
+                    s00[i] == tile.noDataValue || s01[i] == tile.noDataValue ||
+                    s10[i] == tile.noDataValue || s11[i] == tile.noDataValue;
+
+                // Same as is used in the shader. This is not a perfect solution but if
+                // the sample is actually a no-data-value (min_float) the interpolated
+                // value might not be. Therefore we have a cut-off. Assuming no data value
+                // is smaller than -100000
+                if (anySampleIsNaN || anySampleIsNoData || samples[i] <= -100000) {
+                    continue;
+                }
+
+                // Perform depth transform to get the value in meters
+                float height =
+                    tile.depthTransform.offset + tile.depthTransform.scale * samples[i];
+                // Make sure that the height value follows the layer settings. For example
+                // if the multiplier is set to a value bigger than one, the sampled height
+                // should be modified as well
+                height = tile.renderSettings->performLayerSettings(height);
+                result[locations[b + i].index] = height;
+            }
+        }
+    }
+} // namespace
+
+namespace openspace {
+
+void sampleHeights(std::span<const Geodetic2> positions, const Chunk& leftRoot,
+                   const Chunk& rightRoot, size_t nLayers,
+                   const HeightTileLookup& tileLookup, std::span<float> result)
+{
+    ZoneScoped;
+
+    ghoul_assert(positions.size() == result.size(), "Mismatching number of results");
+
+    std::fill(result.begin(), result.end(), 0.f);
+    if (positions.empty() || nLayers == 0) {
+        return;
+    }
+
+    std::vector<Location> locations;
+    locations.reserve(positions.size());
+    for (size_t i = 0; i < positions.size(); i++) {
+        locations.push_back(
+            locate(positions[i], static_cast<uint32_t>(i), leftRoot, rightRoot)
+        );
+    }
+
+    if (locations.size() > 1) {
+        std::sort(
+            locations.begin(),
+            locations.end(),
+            [](const Location& lhs, const Location& rhs) {
+                return std::tie(lhs.key, lhs.index) < std::tie(rhs.key, rhs.index);
+            }
+        );
+    }
+
+    size_t groupBegin = 0;
+    while (groupBegin < locations.size()) {
+        size_t groupEnd = groupBegin + 1;
+        while (groupEnd < locations.size() &&
+               locations[groupEnd].key == locations[groupBegin].key)
+        {
+            groupEnd++;
+        }
+        const std::span<const Location> group = std::span(locations).subspan(
+            groupBegin,
+            groupEnd - groupBegin
+        );
+
+        for (size_t layer = 0; layer < nLayers; layer++) {
+            const std::optional<HeightTileData> tile =
+                tileLookup(layer, group.front().tileIndex);
+            if (!tile.has_value()) {
+                // Without data for any of the layers we can't provide a height
+                for (const Location& location : group) {
+                    result[location.index] = 0.f;
+                }
+                break;
+            }
+            sampleTile(*tile, group, result);
+        }
+
+        groupBegin = groupEnd;
+    }
+}
+
+} // namespace openspace
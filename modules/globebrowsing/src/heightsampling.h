@@ -0,0 +1,92 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_GLOBEBROWSING___HEIGHTSAMPLING___H__
+#define __OPENSPACE_MODULE_GLOBEBROWSING___HEIGHTSAMPLING___H__
+
+#include <modules/globebrowsing/src/basictypes.h>
+#include <modules/globebrowsing/src/tileindex.h>
+#include <ghoul/glm.h>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+
+namespace openspace {
+
+struct Chunk;
+struct Geodetic2;
+struct LayerRenderSettings;
+
+/**
+ * The tile of a single height layer for a single chunk with all the information that is
+ * needed to sample heights from it on the CPU.
+ */
+struct HeightTileData {
+    /// The number of texels of the tile in x and y direction
+    glm::uvec2 dimensions = glm::uvec2(0);
+    /// The texels of the tile if it is a single-channel float texture, or `nullptr`
+    const float* texels = nullptr;
+    /// Returns the value of the first channel of the texel at the provided x and y
+    /// position. This is only used if #texels is `nullptr`
+    std::function<float(unsigned int, unsigned int)> texel;
+    TileUvTransform uvTransform;
+    TileDepthTransform depthTransform;
+    float noDataValue = 0.f;
+    /// The settings of the layer that are applied to every sampled height
+    const LayerRenderSettings* renderSettings = nullptr;
+};
+
+/**
+ * Returns the tile of the height layer with the provided index for the chunk with the
+ * provided TileIndex, or `std::nullopt` if the tile has not been loaded yet.
+ */
+using HeightTileLookup =
+    std::function<std::optional<HeightTileData>(size_t, const TileIndex&)>;
+
+/**
+ * Samples the heights above the reference ellipsoid at all of the geodetic
+ * \p positions and writes them into \p result. The heights are sampled from the leaf
+ * chunks of the chunk trees with the \p leftRoot and the \p rightRoot that contain the
+ * positions. All positions that share a chunk are sampled together from the tiles that
+ * the \p tileLookup returns for the \p nLayers height layers of that chunk. Later layers
+ * overwrite the heights of earlier layers unless a texel is NaN or a no-data value. If
+ * the tile of any layer is not loaded, the height of all positions in that chunk is 0.
+ *
+ * \param positions The positions for which the heights are sampled
+ * \param leftRoot The root of the chunk tree of the western hemisphere
+ * \param rightRoot The root of the chunk tree of the eastern hemisphere
+ * \param nLayers The number of height layers
+ * \param tileLookup The function that provides the tile of a layer for a chunk
+ * \param result The location into which the heights are written
+ *
+ * \pre \p positions and \p result must have the same size
+ */
+void sampleHeights(std::span<const Geodetic2> positions, const Chunk& leftRoot,
+    const Chunk& rightRoot, size_t nLayers, const HeightTileLookup& tileLookup,
+    std::span<float> result);
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_GLOBEBROWSING___HEIGHTSAMPLING___H__
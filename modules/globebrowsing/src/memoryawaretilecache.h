@@ -25,7 +25,7 @@
 #ifndef __OPENSPACE_MODULE_GLOBEBROWSING___MEMORYAWARETILECACHE___H__
 #define __OPENSPACE_MODULE_GLOBEBROWSING___MEMORYAWARETILECACHE___H__
 
-#include <modules/globebrowsing/src/lrucache.h>
+#include <modules/globebrowsing/src/flatlrucache.h>
 #include <modules/globebrowsing/src/tileindex.h>
 #include <modules/globebrowsing/src/tiletextureinitdata.h>
 #include <openspace/properties/misc/triggerproperty.h>
@@ -143,7 +143,7 @@ private:
     void assureTextureContainerExists(const TileTextureInitData& initData);
     void resetTextureContainerSize(size_t numTexturesPerTextureType);
 
-    using TileCache = LRUCache<ProviderTileKey, Tile, ProviderTileHasher>;
+    using TileCache = FlatLRUCache<ProviderTileKey, Tile, ProviderTileHasher>;
     using TextureContainerTileCache = std::pair<
         std::unique_ptr<TextureContainer>,
         std::unique_ptr<TileCache>
@@ -724,4 +724,8 @@ float RawTileDataReader::noDataValueAsFloat() const {
     return _noDataValue;
 }
 
+const TileTextureInitData& RawTileDataReader::tileTextureInitData() const {
+    return _initData;
+}
+
 } // namespace openspace
@@ -65,6 +65,7 @@ public:
     void reset();
     int maxChunkLevel() const;
     float noDataValueAsFloat() const;
+    const TileTextureInitData& tileTextureInitData() const;
 
     RawTile readTileData(TileIndex tileIndex) const;
     const TileDepthTransform& depthTransform() const;
@@ -26,10 +26,12 @@
 
 #include <modules/debugging/rendering/debugrenderer.h>
 #include <modules/globebrowsing/src/basictypes.h>
+#include <modules/globebrowsing/src/heightsampling.h>
 #include <modules/globebrowsing/src/layer.h>
 #include <modules/globebrowsing/src/layergroup.h>
 #include <modules/globebrowsing/src/layergroupid.h>
 #include <modules/globebrowsing/src/layerrendersettings.h>
+#include <modules/globebrowsing/src/tileioscheduler.h>
 #include <modules/globebrowsing/src/tileprovider/tileprovider.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/engine/globals.h>
@@ -60,6 +62,7 @@
 #include <limits>
 #include <numeric>
 #include <optional>
+#include <span>
 #include <utility>
 #include <variant>
 
@@ -68,9 +71,6 @@ namespace {
 
     constexpr std::string_view _loggerCat = "RenderableGlobe";
 
-    // Global flags to modify the RenderableGlobe
-    constexpr bool LimitLevelByAvailableData = true;
-
     // Shadow structure
     struct ShadowRenderingStruct {
         double xu = 0.0;
@@ -82,10 +82,6 @@ namespace {
         bool isShadowing = false;
     };
 
-    const AABB3 CullingFrustum{
-        glm::vec3(-1.f, -1.f, 0.f),
-        glm::vec3( 1.f,  1.f, 1e35f)
-    };
     constexpr float DefaultHeight = 0.f;
 
     // I tried reducing this to 16, but it left the rendering with artifacts when the
@@ -96,10 +92,8 @@ namespace {
     // them at a cutoff level, and I think this might still be the best solution for the
     // time being.  --abock  2018-10-30
     constexpr int DefaultSkirtedGridSegments = 64;
-    constexpr int UnknownDesiredLevel = -1;
     constexpr int DefaultHeightTileResolution = 512;
 
-    const GeodeticPatch Coverage = GeodeticPatch(0.0, 0.0, 90.0, 180.0);
     const TileIndex LeftHemisphereIndex = TileIndex(0, 0, 1);
     const TileIndex RightHemisphereIndex = TileIndex(1, 0, 1);
 
@@ -132,6 +126,15 @@ namespace {
         Property::Visibility::AdvancedUser
     };
 
+    constexpr Property::PropertyInfo ParallelChunkUpdateInfo = {
+        "ParallelChunkUpdate",
+        "Parallel chunk update",
+        "If this value is set to 'true', the level of detail and the culling of the "
+        "chunks are evaluated on multiple threads. The resulting chunks are the same "
+        "regardless of this setting.",
+        Property::Visibility::Developer
+    };
+
     constexpr Property::PropertyInfo ResetTileProviderInfo = {
         "ResetTileProviders",
         "Reset tile providers",
@@ -269,28 +272,6 @@ namespace {
         Property::Visibility::User
     };
 
-    bool isLeaf(const Chunk& cn) {
-        return cn.children[0] == nullptr;
-    }
-
-    const Chunk& findChunkNode(const Chunk& node, const Geodetic2& location) {
-        const Chunk* n = &node;
-
-        while (!isLeaf(*n)) {
-            const Geodetic2 center = n->surfacePatch.center();
-            int index = 0;
-            if (center.lon < location.lon) {
-                index++;
-            }
-            if (location.lat < center.lat) {
-                index++;
-                index++;
-            }
-            n = n->children[static_cast<Quad>(index)];
-        }
-        return *n;
-    }
-
     #if defined(__linux__) && defined(__clang__)
     using ChunkTileVector = std::vector<std::pair<ChunkTile, const LayerRenderSettings*>>;
     #else // ^^^^ __linux__ && __clang__ // !(__linux__ && __clang__) vvvv
@@ -406,84 +387,11 @@ namespace {
         return true;
     }
 
-    std::array<glm::dvec4, 8> boundingCornersForChunk(const Chunk& chunk,
-                                                      const Ellipsoid& ellipsoid,
-                                                      const BoundingHeights& heights)
-    {
-        ZoneScoped;
-
-        // Assume worst case
-        const double patchCenterRadius = ellipsoid.maximumRadius();
-
-        const double maxCenterRadius = patchCenterRadius + heights.max;
-        const Geodetic2 halfSize = chunk.surfacePatch.halfSize();
-
-        // As the patch is curved, the maximum height offsets at the corners must be long
-        // enough to cover large enough to cover a heights.max at the center of the patch.
-        // Approximating scaleToCoverCenter by assuming the latitude and longitude angles
-        // of "halfSize" are equal to the angles they create from the center of the globe
-        // to the patch corners. This is true for the longitude direction when the
-        // ellipsoid can be approximated as a sphere and for the latitude for patches
-        // close to the equator. Close to the pole this will lead to a bigger than needed
-        // value for scaleToCoverCenter. However, this is a simple calculation and a good
-        // Approximation
-        const double y1 = tan(halfSize.lat);
-        const double y2 = tan(halfSize.lon);
-        const double scaleToCoverCenter = sqrt(1.0 + pow(y1, 2) + pow(y2, 2));
-
-        const double maxCornerHeight = maxCenterRadius * scaleToCoverCenter -
-            patchCenterRadius;
-
-        const bool chunkIsNorthOfEquator = chunk.surfacePatch.isNorthern();
-
-        // The minimum height offset, however, we can simply
-        const double minCornerHeight = heights.min;
-        std::array<glm::dvec4, 8> corners;
-
-        const double latCloseToEquator = chunk.surfacePatch.edgeLatitudeNearestEquator();
-        const Geodetic3 p1Geodetic = {
-            .geodetic2 = { .lat = latCloseToEquator, .lon = chunk.surfacePatch.minLon() },
-            .height = maxCornerHeight
-        };
-        const Geodetic3 p2Geodetic = {
-            .geodetic2 = { .lat = latCloseToEquator, .lon = chunk.surfacePatch.maxLon() },
-            .height = maxCornerHeight
-        };
-
-        const glm::vec3 p1 = ellipsoid.cartesianPosition(p1Geodetic);
-        const glm::vec3 p2 = ellipsoid.cartesianPosition(p2Geodetic);
-        const glm::vec3 p = 0.5f * (p1 + p2);
-        const Geodetic2 pGeodetic = ellipsoid.cartesianToGeodetic2(p);
-        const double latDiff = latCloseToEquator - pGeodetic.lat;
-
-        for (size_t i = 0; i < 8; i++) {
-            const Quad q = static_cast<Quad>(i % 4);
-            const double cornerHeight = i < 4 ? minCornerHeight : maxCornerHeight;
-            Geodetic3 cornerGeodetic = { chunk.surfacePatch.corner(q), cornerHeight };
-
-            const bool cornerIsNorthern = !((i / 2) % 2);
-            const bool cornerCloseToEquator = chunkIsNorthOfEquator ^ cornerIsNorthern;
-            if (cornerCloseToEquator) {
-                cornerGeodetic.geodetic2.lat += latDiff;
-            }
-
-            corners[i] = glm::dvec4(ellipsoid.cartesianPosition(cornerGeodetic), 1.0);
-        }
-
-        return corners;
-    }
-
     constexpr void expand(AABB3& bb, const glm::vec3& p) {
         bb.min = glm::min(bb.min, p);
         bb.max = glm::max(bb.max, p);
     }
 
-    constexpr bool intersects(const AABB3& bb, const AABB3& o) {
-        return (bb.min.x <= o.max.x) && (o.min.x <= bb.max.x) &&
-               (bb.min.y <= o.max.y) && (o.min.y <= bb.max.y) &&
-               (bb.min.z <= o.max.z) && (o.min.z <= bb.max.z);
-    }
-
     /**
      * Calculates the direction towards the local light source. If \p lightSource is a
      * `nullptr`, it is interpreted to be (0,0,0).
@@ -610,12 +518,6 @@ namespace {
 
 namespace openspace {
 
-Chunk::Chunk(const TileIndex& ti)
-    : tileIndex(ti)
-    , surfacePatch(ti)
-    , status(Status::DoNothing)
-{}
-
 Documentation RenderableGlobe::Documentation() {
     return codegen::doc<Parameters>("globebrowsing_renderable_globe");
 }
@@ -639,6 +541,7 @@ RenderableGlobe::RenderableGlobe(const ghoul::Dictionary& dictionary)
         .resetTileProviders = TriggerProperty(ResetTileProviderInfo),
         .performFrustumCulling = BoolProperty(PerformFrustumCullingInfo, true),
         .performHorizonCulling = BoolProperty(PerformHorizonCullingInfo, true),
+        .parallelChunkUpdate = BoolProperty(ParallelChunkUpdateInfo, true),
         .modelSpaceRenderingCutoffLevel = IntProperty(ModelSpaceRenderingInfo, 14, 1, 22),
         .dynamicLodIterationCount = IntProperty(DynamicLodIterationCountInfo, 16, 4, 128)
     })
@@ -762,6 +665,7 @@ RenderableGlobe::RenderableGlobe(const ghoul::Dictionary& dictionary)
     _debugPropertyOwner.addProperty(_debugProperties.resetTileProviders);
     _debugPropertyOwner.addProperty(_debugProperties.performFrustumCulling);
     _debugPropertyOwner.addProperty(_debugProperties.performHorizonCulling);
+    _debugPropertyOwner.addProperty(_debugProperties.parallelChunkUpdate);
     _debugProperties.modelSpaceRenderingCutoffLevel =
         p.modelSpaceRenderingCutoffLevel.value_or(
             _debugProperties.modelSpaceRenderingCutoffLevel
@@ -1228,9 +1132,43 @@ void RenderableGlobe::renderChunks(const RenderData& data, bool renderGeomOnly)
         viewTransform;
     const glm::dmat4 mvp = vp * _cachedModelTransform;
 
+    const ChunkLodSettings lodSettings = {
+        .modelViewProjection = mvp,
+        .cameraPosition = glm::dvec3(
+            _cachedInverseModelTransform * glm::dvec4(data.camera.position(), 1.0)
+        ),
+        .lodScaleFactor = _currentLodScaleFactor,
+        .minLevel = MinSplitDepth,
+        .maxLevel = MaxSplitDepth,
+        .levelByProjectedArea = _debugProperties.levelByProjectedAreaElseDistance,
+        .performFrustumCulling = _debugProperties.performFrustumCulling,
+        .performHorizonCulling = _debugProperties.performHorizonCulling,
+        .updateCorners = _chunkCornersDirty
+    };
+
     _allChunksAvailable = true;
-    updateChunkTree(_leftRoot, data, mvp);
-    updateChunkTree(_rightRoot, data, mvp);
+    if (_debugProperties.parallelChunkUpdate) {
+        // The tile providers are not thread-safe, so everything that is needed from them
+        // is requested first. Then the chunks are evaluated in parallel and the tree is
+        // split and merged in the same order as in the sequential case
+        _chunkUpdateBuffer.clear();
+        collectChunks(_leftRoot, _chunkUpdateBuffer);
+        collectChunks(_rightRoot, _chunkUpdateBuffer);
+
+        _chunkLodInputs.clear();
+        _chunkLodInputs.reserve(_chunkUpdateBuffer.size());
+        for (Chunk* chunk : _chunkUpdateBuffer) {
+            _chunkLodInputs.push_back(queryChunk(*chunk));
+        }
+        evaluateChunks(_chunkLodInputs, _ellipsoid, lodSettings, true);
+
+        updateChunkTree(_leftRoot, lodSettings, true);
+        updateChunkTree(_rightRoot, lodSettings, true);
+    }
+    else {
+        updateChunkTree(_leftRoot, lodSettings, false);
+        updateChunkTree(_rightRoot, lodSettings, false);
+    }
     _chunkCornersDirty = false;
     _iterationsOfAvailableData =
         (_allChunksAvailable ? _iterationsOfAvailableData + 1 : 0);
@@ -1457,6 +1395,7 @@ void RenderableGlobe::renderChunkGlobally(const Chunk& chunk, const RenderData&
     ZoneScoped;
     TracyGpuZone("renderChunkGlobally");
 
+    const TileIOScheduler::PriorityScope priority(chunk.tilePriority);
     const TileIndex& tileIndex = chunk.tileIndex;
     ghoul::opengl::ProgramObject& program = *_globalRenderer.program;
 
@@ -1583,6 +1522,7 @@ void RenderableGlobe::renderChunkLocally(const Chunk& chunk, const RenderData& d
     ZoneScoped;
     TracyGpuZone("renderChunkLocally");
 
+    const TileIOScheduler::PriorityScope priority(chunk.tilePriority);
     const TileIndex& tileIndex = chunk.tileIndex;
     ghoul::opengl::ProgramObject& program = *_localRenderer.program;
 
@@ -2077,184 +2017,74 @@ SurfacePositionHandle RenderableGlobe::calculateSurfacePositionHandle(
     };
 }
 
-bool RenderableGlobe::testIfCullable(const Chunk& chunk, const RenderData& renderData,
-                                     const BoundingHeights& heights,
-                                     const glm::dmat4& mvp) const
-{
+float RenderableGlobe::getHeight(const glm::dvec3& position) const {
     ZoneScoped;
 
-    const bool horizon = _debugProperties.performHorizonCulling &&
-        isCullableByHorizon(chunk, renderData, heights);
-    const bool frustum = _debugProperties.performFrustumCulling &&
-        isCullableByFrustum(chunk, renderData, mvp);
-
-    return horizon || frustum;
+    const Geodetic2 geodeticPosition = _ellipsoid.cartesianToGeodetic2(position);
+    float height = 0.f;
+    sampleHeights(std::span(&geodeticPosition, 1), std::span(&height, 1));
+    return height;
 }
 
-int RenderableGlobe::desiredLevel(const Chunk& chunk, const RenderData& renderData,
-                                  const BoundingHeights& heights) const
+std::vector<float> RenderableGlobe::surfaceHeights(
+                                               std::span<const Geodetic2> positions) const
 {
     ZoneScoped;
 
-    const int desiredLevel = _debugProperties.levelByProjectedAreaElseDistance ?
-        desiredLevelByProjectedArea(chunk, renderData, heights) :
-        desiredLevelByDistance(chunk, renderData, heights);
-    const int levelByAvailableData = desiredLevelByAvailableTileData(chunk);
-
-    if (LimitLevelByAvailableData && (levelByAvailableData != UnknownDesiredLevel)) {
-        const int l = std::min(desiredLevel, levelByAvailableData);
-        return std::clamp(l, MinSplitDepth, MaxSplitDepth);
-    }
-    else {
-        return std::clamp(desiredLevel, MinSplitDepth, MaxSplitDepth);
-    }
+    std::vector<float> res(positions.size(), 0.f);
+    sampleHeights(positions, res);
+    return res;
 }
 
-float RenderableGlobe::getHeight(const glm::dvec3& position) const {
+void RenderableGlobe::sampleHeights(std::span<const Geodetic2> positions,
+                                    std::span<float> result) const
+{
     ZoneScoped;
 
-    float height = 0;
-
-    // Get the uv coordinates to sample from
-    const Geodetic2 geodeticPosition = _ellipsoid.cartesianToGeodetic2(position);
-    const Chunk& node = geodeticPosition.lon < Coverage.center().lon ?
-        findChunkNode(_leftRoot, geodeticPosition) :
-        findChunkNode(_rightRoot, geodeticPosition);
-    const int chunkLevel = node.tileIndex.level;
-
-
-    const int numIndicesAtLevel = 1 << chunkLevel;
-    const double u = 0.5 + geodeticPosition.lon / glm::two_pi<double>();
-    const double v = 0.25 - geodeticPosition.lat / glm::two_pi<double>();
-    const double xIndexSpace = u * numIndicesAtLevel;
-    const double yIndexSpace = v * numIndicesAtLevel;
-
-    const int x = static_cast<int>(floor(xIndexSpace));
-    const int y = static_cast<int>(floor(yIndexSpace));
-
-    ghoul_assert(chunkLevel < std::numeric_limits<uint8_t>::max(), "Too high level");
-    const TileIndex tileIndex(x, y, static_cast<uint8_t>(chunkLevel));
-    const GeodeticPatch patch = GeodeticPatch(tileIndex);
-
-    const Geodetic2 northEast = patch.corner(Quad::NORTH_EAST);
-    const Geodetic2 southWest = patch.corner(Quad::SOUTH_WEST);
-
-    const Geodetic2 geoDiffPatch = {
-        .lat = northEast.lat - southWest.lat,
-        .lon = northEast.lon - southWest.lon
-    };
-
-    const Geodetic2 geoDiffPoint = {
-        .lat = geodeticPosition.lat - southWest.lat,
-        .lon = geodeticPosition.lon - southWest.lon
-    };
-    const glm::vec2 patchUV = glm::vec2(
-        geoDiffPoint.lon / geoDiffPatch.lon,
-        geoDiffPoint.lat / geoDiffPatch.lat
-    );
-
-    // Get the tile providers for the height maps
-    const std::vector<Layer*>& heightMapLayers =
+    // Get the tile providers for the height maps. Layers without a tile provider don't
+    // contribute to the height
+    std::vector<Layer*> heightMapLayers =
         _layerManager.layerGroup(layers::Group::ID::HeightLayers).activeLayers();
+    std::erase_if(heightMapLayers, [](Layer* l) { return !l->tileProvider(); });
 
-    for (Layer* layer : heightMapLayers) {
+    auto tileLookup = [&heightMapLayers](size_t layerIndex, const TileIndex& tileIndex)
+        -> std::optional<HeightTileData>
+    {
+        Layer* layer = heightMapLayers[layerIndex];
         TileProvider* tileProvider = layer->tileProvider();
-        if (!tileProvider) {
-            continue;
-        }
-        // Transform the uv coordinates to the current tile texture
         const ChunkTile chunkTile = tileProvider->chunkTile(tileIndex);
-        const Tile& tile = chunkTile.tile;
-        const TileUvTransform& uvTransform = chunkTile.uvTransform;
-        const TileDepthTransform& depthTransform = tileProvider->depthTransform();
-        if (tile.status != Tile::Status::OK) {
-            return 0;
+        ghoul::opengl::Texture* tileTexture = chunkTile.tile.texture;
+        if (chunkTile.tile.status != Tile::Status::OK || !tileTexture) {
+            return std::nullopt;
         }
 
-        ghoul::opengl::Texture* tileTexture = tile.texture;
-        if (!tileTexture) {
-            return 0;
-        }
-
-        const glm::vec2& transformedUv = layer->tileUvToTextureSamplePosition(
-            uvTransform,
-            patchUV
-        );
-
-        // Sample and do linear interpolation (could possibly be moved as a function in
-        // ghoul texture). Suggestion: a function in ghoul::opengl::Texture that takes uv
-        // coordinates in range [0,1] and uses the set interpolation method and clamping
-
-        const glm::uvec3 dimensions = tileTexture->dimensions();
-
-        glm::vec2 samplePos = transformedUv * glm::vec2(dimensions);
-        // @TODO (emmbr, 2023-06-14) This 0.5f offset was added as a bandaid for issue
-        // #2696. It seems to improve the behavior, but I am not certain of why. And the
-        // underlying problem is still there and should at some point be looked at again
-        samplePos -= glm::vec2(0.5f);
-
-        glm::uvec2 samplePos00 = samplePos;
-        samplePos00 = glm::clamp(
-            samplePos00,
-            glm::uvec2(0, 0),
-            glm::uvec2(dimensions) - glm::uvec2(1)
-        );
-        const glm::vec2 samplePosFract = samplePos - glm::vec2(samplePos00);
-
-        const glm::uvec2 samplePos10 = glm::min(
-            samplePos00 + glm::uvec2(1, 0),
-            glm::uvec2(dimensions) - glm::uvec2(1)
-        );
-        const glm::uvec2 samplePos01 = glm::min(
-            samplePos00 + glm::uvec2(0, 1),
-            glm::uvec2(dimensions) - glm::uvec2(1)
-        );
-        const glm::uvec2 samplePos11 = glm::min(
-            samplePos00 + glm::uvec2(1, 1),
-            glm::uvec2(dimensions) - glm::uvec2(1)
-        );
-
-        const float sample00 = tileTexture->texelAsFloat({ samplePos00, 0 }).x;
-        const float sample10 = tileTexture->texelAsFloat({ samplePos10, 0 }).x;
-        const float sample01 = tileTexture->texelAsFloat({ samplePos01, 0 }).x;
-        const float sample11 = tileTexture->texelAsFloat({ samplePos11, 0 }).x;
-
-        // In case the texture has NaN or no data values don't use this height map
-        const bool anySampleIsNaN =
-            std::isnan(sample00) || std::isnan(sample01) ||
-            std::isnan(sample10) || std::isnan(sample11);
-
-        const bool anySampleIsNoData =
-            sample00 == tileProvider->noDataValueAsFloat() ||
-            sample01 == tileProvider->noDataValueAsFloat() ||
-            sample10 == tileProvider->noDataValueAsFloat() ||
-            sample11 == tileProvider->noDataValueAsFloat();
-
-        if (anySampleIsNaN || anySampleIsNoData) {
-            continue;
-        }
+        // Single-channel float textures can be read directly instead of going through
+        // the per-texel format conversion
+        const bool isFloat =
+            tileTexture->format() == ghoul::opengl::Texture::Format::Red &&
+            tileTexture->dataType() == GL_FLOAT;
+        return HeightTileData {
+            .dimensions = glm::uvec2(tileTexture->dimensions()),
+            .texels =
+                isFloat ? static_cast<const float*>(tileTexture->pixelData()) : nullptr,
+            .texel = [tileTexture](unsigned int x, unsigned int y) {
+                return tileTexture->texelAsFloat({ x, y, 0 }).x;
+            },
+            .uvTransform = chunkTile.uvTransform,
+            .depthTransform = tileProvider->depthTransform(),
+            .noDataValue = tileProvider->noDataValueAsFloat(),
+            .renderSettings = &layer->renderSettings()
+        };
+    };
 
-        const float sample0 = sample00 * (1.f - samplePosFract.x) +
-            sample10 * samplePosFract.x;
-        const float sample1 = sample01 * (1.f - samplePosFract.x) +
-            sample11 * samplePosFract.x;
-
-        const float sample = sample0 * (1.f - samplePosFract.y) +
-            sample1 * samplePosFract.y;
-
-        // Same as is used in the shader. This is not a perfect solution but if the sample
-        // is actually a no-data-value (min_float) the interpolated value might not be.
-        // Therefore we have a cut-off. Assuming no data value is smaller than -100000
-        if (sample > -100000) {
-            // Perform depth transform to get the value in meters
-            height = depthTransform.offset + depthTransform.scale * sample;
-            // Make sure that the height value follows the layer settings. For example if
-            // the multiplier is set to a value bigger than one, the sampled height should
-            // be modified as well
-            height = layer->renderSettings().performLayerSettings(height);
-        }
-    }
-    return height;
+    openspace::sampleHeights(
+        positions,
+        _leftRoot,
+        _rightRoot,
+        heightMapLayers.size(),
+        tileLookup,
+        result
+    );
 }
 
 void RenderableGlobe::calculateEclipseShadows(ghoul::opengl::ProgramObject& programObject,
@@ -2401,129 +2231,6 @@ void RenderableGlobe::calculateEclipseShadows(ghoul::opengl::ProgramObject& prog
     }
 }
 
-int RenderableGlobe::desiredLevelByDistance(const Chunk& chunk, const RenderData& data,
-                                            const BoundingHeights& heights) const
-{
-    ZoneScoped;
-
-    // Calculations are done in the reference frame of the globe (model space). Hence, the
-    // camera position needs to be transformed with the inverse model matrix
-    const glm::dvec3 cameraPosition = glm::dvec3(
-        _cachedInverseModelTransform * glm::dvec4(data.camera.position(), 1.0)
-    );
-
-    const Geodetic2 pointOnPatch = chunk.surfacePatch.closestPoint(
-        _ellipsoid.cartesianToGeodetic2(cameraPosition)
-    );
-    const glm::dvec3 patchNormal = _ellipsoid.geodeticSurfaceNormal(pointOnPatch);
-    glm::dvec3 patchPosition = _ellipsoid.cartesianSurfacePosition(pointOnPatch);
-
-    const double heightToChunk = heights.min;
-
-    // Offset position according to height
-    patchPosition += patchNormal * heightToChunk;
-
-    const glm::dvec3 cameraToChunk = patchPosition - cameraPosition;
-
-    // Calculate desired level based on distance
-    const double distanceToPatch = glm::length(cameraToChunk);
-    const double distance = distanceToPatch;
-
-    const double scaleFactor = _currentLodScaleFactor * _ellipsoid.minimumRadius();
-    const double projectedScaleFactor = scaleFactor / distance;
-    const int desiredLevel = static_cast<int>(ceil(log2(projectedScaleFactor)));
-    return desiredLevel;
-}
-
-int RenderableGlobe::desiredLevelByProjectedArea(const Chunk& chunk,
-                                                 const RenderData& data,
-                                                 const BoundingHeights& heights) const
-{
-    ZoneScoped;
-
-    // Calculations are done in the reference frame of the globe (model space). Hence, the
-    // camera position needs to be transformed with the inverse model matrix
-    const glm::dvec3 cameraPosition = glm::dvec3(
-        _cachedInverseModelTransform * glm::dvec4(data.camera.position(), 1.0)
-    );
-
-    // Approach:
-    // The projected area of the chunk will be calculated based on a small area that is
-    // close to the camera, and the scaled up to represent the full area. The advantage of
-    // doing this is that it will better handle the cases where the full patch is very
-    // curved (e.g. stretches from latitude 0 to 90 deg)
-
-    const Geodetic2 closestCorner = chunk.surfacePatch.closestCorner(
-        _ellipsoid.cartesianToGeodetic2(cameraPosition)
-    );
-
-    //  Camera
-    //  |
-    //  V
-    //
-    //  oo
-    // [  ]<
-    //                     *geodetic space*
-    //
-    //   closestCorner
-    //    +-----------------+  <-- north east corner
-    //    |                 |
-    //    |      center     |
-    //    |                 |
-    //    +-----------------+  <-- south east corner
-
-    const Geodetic2 center = chunk.surfacePatch.center();
-    const Geodetic3 c = { .geodetic2 = center, .height = heights.min };
-    const Geodetic3 c1 = {
-        .geodetic2 = Geodetic2{ .lat = center.lat, .lon = closestCorner.lon },
-        .height = heights.min
-    };
-    const Geodetic3 c2 = {
-        .geodetic2 = Geodetic2{ .lat = closestCorner.lat, .lon = center.lon },
-        .height = heights.min
-    };
-
-    //  Camera
-    //  |
-    //  V
-    //
-    //  oo
-    // [  ]<
-    //                     *geodetic space*
-    //
-    //    +--------c2-------+  <-- north east corner
-    //    |                 |
-    //    c1       c        |
-    //    |                 |
-    //    +-----------------+  <-- south east corner
-
-
-    // Go from geodetic to cartesian space and project onto unit sphere
-    const glm::dvec3 camToCenter = -cameraPosition;
-    const glm::dvec3 A = glm::normalize(camToCenter + _ellipsoid.cartesianPosition(c));
-    const glm::dvec3 B = glm::normalize(camToCenter + _ellipsoid.cartesianPosition(c1));
-    const glm::dvec3 C = glm::normalize(camToCenter + _ellipsoid.cartesianPosition(c2));
-
-    // Camera                      *cartesian space*
-    // |                    +--------+---+
-    // V             __--''   __--''    /
-    //              C-------A--------- +
-    // oo          /       /          /
-    //[  ]<       +-------B----------+
-    //
-
-    // If the geodetic patch is small (i.e. has small width), that means the patch in
-    // cartesian space will be almost flat, and in turn, the triangle ABC will roughly
-    // correspond to 1/8 of the full area
-    const glm::dvec3 AB = B - A;
-    const glm::dvec3 AC = C - A;
-    const double areaABC = 0.5 * glm::length(glm::cross(AC, AB));
-    const double projectedChunkAreaApprox = 8 * areaABC;
-
-    const double scaledArea = _currentLodScaleFactor * projectedChunkAreaApprox;
-    return chunk.tileIndex.level + static_cast<int>(round(scaledArea - 1));
-}
-
 int RenderableGlobe::desiredLevelByAvailableTileData(const Chunk& chunk) const {
     ZoneScoped;
 
@@ -2546,93 +2253,6 @@ int RenderableGlobe::desiredLevelByAvailableTileData(const Chunk& chunk) const {
     return currLevel - 1;
 }
 
-bool RenderableGlobe::isCullableByFrustum(const Chunk& chunk, const RenderData&,
-                                          const glm::dmat4& mvp) const
-{
-    ZoneScoped;
-
-    const std::array<glm::dvec4, 8>& corners = chunk.corners;
-
-    // Create a bounding box that fits the patch corners
-    AABB3 bounds; // in screen space
-    for (size_t i = 0; i < 8; i++) {
-        const glm::dvec4 cornerClippingSpace = mvp * corners[i];
-        const glm::dvec3 ndc = glm::dvec3(
-            (1.f / glm::abs(cornerClippingSpace.w)) * cornerClippingSpace
-        );
-        expand(bounds, ndc);
-    }
-
-    return !(intersects(CullingFrustum, bounds));
-}
-
-bool RenderableGlobe::isCullableByHorizon(const Chunk& chunk,
-                                          const RenderData& renderData,
-                                          const BoundingHeights& heights) const
-{
-    ZoneScoped;
-
-    // Calculations are done in the reference frame of the globe. Hence, the camera
-    // position needs to be transformed with the inverse model matrix
-    const GeodeticPatch& patch = chunk.surfacePatch;
-    const float maxHeight = heights.max;
-    const glm::dvec3 globePos = glm::dvec3(0.0, 0.0, 0.0); // In model space it is 0
-    const double minimumGlobeRadius = _ellipsoid.minimumRadius();
-
-    const glm::dvec3 cameraPos = glm::dvec3(
-        _cachedInverseModelTransform * glm::dvec4(renderData.camera.position(), 1.0)
-    );
-
-    const glm::dvec3& globeToCamera = cameraPos;
-    const Geodetic2 camPosOnGlobe = _ellipsoid.cartesianToGeodetic2(globeToCamera);
-    const Geodetic2 closestPatchPoint = patch.closestPoint(camPosOnGlobe);
-    glm::dvec3 objectPos = _ellipsoid.cartesianSurfacePosition(closestPatchPoint);
-
-    // `objectPos` is closest in latlon space but not guaranteed to be closest in
-    // Castesian coordinates. Therefore we compare it to the corners and pick the real
-    // closest point
-    std::array<glm::dvec3, 4> corners = {
-        _ellipsoid.cartesianSurfacePosition(chunk.surfacePatch.corner(NORTH_WEST)),
-        _ellipsoid.cartesianSurfacePosition(chunk.surfacePatch.corner(NORTH_EAST)),
-        _ellipsoid.cartesianSurfacePosition(chunk.surfacePatch.corner(SOUTH_WEST)),
-        _ellipsoid.cartesianSurfacePosition(chunk.surfacePatch.corner(SOUTH_EAST))
-    };
-
-    for (int i = 0; i < 4; i++) {
-        const double distance = glm::length(cameraPos - corners[i]);
-        if (distance < glm::length(cameraPos - objectPos)) {
-            objectPos = corners[i];
-        }
-    }
-
-
-    const double objectP = std::pow(glm::length(objectPos - globePos), 2);
-    const double horizonP = std::pow(minimumGlobeRadius - maxHeight, 2);
-    if (objectP < horizonP) {
-        return false;
-    }
-
-    const double cameraP = std::pow(glm::length(cameraPos - globePos), 2);
-    const double minR = std::pow(minimumGlobeRadius, 2);
-    if (cameraP < minR) {
-        return false;
-    }
-
-    const double minimumAllowedDistanceToObjFromHorizon = std::sqrt(objectP - horizonP);
-    const double distanceToHorizon = std::sqrt(cameraP - minR);
-
-    // Minimum allowed for the object to be occluded
-    const double minimumAllowedDistanceToObjectSquared =
-        std::pow(distanceToHorizon + minimumAllowedDistanceToObjFromHorizon, 2) +
-        std::pow(maxHeight, 2);
-
-    const double distanceToObjectSquared = std::pow(
-        glm::length(objectPos - cameraPos),
-        2
-    );
-    return distanceToObjectSquared > minimumAllowedDistanceToObjectSquared;
-}
-
 void RenderableGlobe::splitChunkNode(Chunk& cn, int depth) {
     ZoneScoped;
 
@@ -2640,10 +2260,14 @@ void RenderableGlobe::splitChunkNode(Chunk& cn, int depth) {
         std::vector<void*> memory = _chunkPool.allocate(
             static_cast<int>(cn.children.size())
         );
+        // The children have not been evaluated yet, so the best guess for their priority
+        // is the priority of their parent
+        const TileIOScheduler::PriorityScope priority(cn.tilePriority);
         for (size_t i = 0; i < cn.children.size(); i++) {
             cn.children[i] = new (memory[i]) Chunk(
                 cn.tileIndex.child(static_cast<Quad>(i))
             );
+            cn.children[i]->tilePriority = cn.tilePriority;
             const BoundingHeights& heights = boundingHeightsForChunk(
                 *(cn.children[i]),
                 _layerManager
@@ -2687,8 +2311,8 @@ void RenderableGlobe::mergeChunkNode(Chunk& cn) {
     cn.children.fill(nullptr);
 }
 
-bool RenderableGlobe::updateChunkTree(Chunk& cn, const RenderData& data,
-                                      const glm::dmat4& mvp)
+bool RenderableGlobe::updateChunkTree(Chunk& cn, const ChunkLodSettings& settings,
+                                      bool isEvaluated)
 {
     ZoneScoped;
 
@@ -2699,7 +2323,9 @@ bool RenderableGlobe::updateChunkTree(Chunk& cn, const RenderData& data,
     // addition, this didn't even improve performance
     if (isLeaf(cn)) {
         ZoneScopedN("leaf");
-        updateChunk(cn, data, mvp);
+        if (!isEvaluated) {
+            updateChunk(cn, settings);
+        }
 
         if (cn.status == Chunk::Status::WantSplit) {
             splitChunkNode(cn, 1);
@@ -2715,13 +2341,15 @@ bool RenderableGlobe::updateChunkTree(Chunk& cn, const RenderData& data,
         ZoneScopedN("!leaf");
         char requestedMergeMask = 0;
         for (int i = 0; i < 4; i++) {
-            if (updateChunkTree(*cn.children[i], data, mvp)) {
+            if (updateChunkTree(*cn.children[i], settings, isEvaluated)) {
                 requestedMergeMask |= (1 << i);
             }
         }
 
         const bool allChildrenWantsMerge = requestedMergeMask == 0xf;
-        updateChunk(cn, data, mvp);
+        if (!isEvaluated) {
+            updateChunk(cn, settings);
+        }
 
         if (allChildrenWantsMerge && (cn.status != Chunk::Status::WantSplit)) {
             mergeChunkNode(cn);
@@ -2737,40 +2365,27 @@ bool RenderableGlobe::updateChunkTree(Chunk& cn, const RenderData& data,
     }
 }
 
-void RenderableGlobe::updateChunk(Chunk& chunk, const RenderData& data,
-                                  const glm::dmat4& mvp) const
-{
+ChunkLodInput RenderableGlobe::queryChunk(Chunk& chunk) const {
     ZoneScoped;
 
-    const BoundingHeights& heights = boundingHeightsForChunk(chunk, _layerManager);
+    // The tiles are requested with the priority that was determined in the previous frame
+    // as the priority depends on the heights that are being requested here
+    const TileIOScheduler::PriorityScope priority(chunk.tilePriority);
+    const BoundingHeights heights = boundingHeightsForChunk(chunk, _layerManager);
     chunk.heightTileOK = heights.tileOK;
     chunk.colorTileOK = colorAvailableForChunk(chunk, _layerManager);
 
-    if (_chunkCornersDirty) {
-        chunk.corners = boundingCornersForChunk(chunk, _ellipsoid, heights);
-
-        // The flag gets set to false globally after the updateChunkTree calls
-    }
-
-    if (testIfCullable(chunk, data, heights, mvp)) {
-        chunk.isVisible = false;
-        chunk.status = Chunk::Status::WantMerge;
-    }
-    else {
-        chunk.isVisible = true;
-    }
+    return {
+        .chunk = &chunk,
+        .heights = heights,
+        .levelByAvailableData = desiredLevelByAvailableTileData(chunk)
+    };
+}
 
-    const int dl = desiredLevel(chunk, data, heights);
+void RenderableGlobe::updateChunk(Chunk& chunk, const ChunkLodSettings& settings) const {
+    ZoneScoped;
 
-    if (dl < chunk.tileIndex.level) {
-        chunk.status = Chunk::Status::WantMerge;
-    }
-    else if (chunk.tileIndex.level < dl) {
-        chunk.status = Chunk::Status::WantSplit;
-    }
-    else {
-        chunk.status = Chunk::Status::DoNothing;
-    }
+    evaluateChunk(queryChunk(chunk), _ellipsoid, settings);
 }
 
 } // namespace openspace
@@ -28,6 +28,7 @@
 #include <openspace/rendering/renderable.h>
 #include <openspace/rendering/shadowmapping.h>
 
+#include <modules/globebrowsing/src/chunktree.h>
 #include <modules/globebrowsing/src/geodeticpatch.h>
 #include <modules/globebrowsing/src/geojson/geojsonmanager.h>
 #include <modules/globebrowsing/src/globelabelscomponent.h>
@@ -50,40 +51,12 @@
 #include <array>
 #include <cstdint>
 #include <memory>
+#include <span>
 
 namespace openspace {
 
 class Layer;
 
-struct BoundingHeights {
-    float min;
-    float max;
-    bool isAvailable;
-    bool tileOK;
-};
-
-struct Chunk {
-    enum class Status : uint8_t {
-        DoNothing,
-        WantMerge,
-        WantSplit
-    };
-
-    explicit Chunk(const TileIndex& ti);
-
-    const TileIndex tileIndex;
-    const GeodeticPatch surfacePatch;
-
-    Status status;
-
-    bool isVisible = true;
-    bool colorTileOK = false;
-    bool heightTileOK = false;
-
-    std::array<glm::dvec4, 8> corners;
-    std::array<Chunk*, 4> children = { { nullptr, nullptr, nullptr, nullptr } };
-};
-
 enum class ShadowCompType {
     GLOBAL_SHADOW,
     LOCAL_SHADOW
@@ -109,6 +82,19 @@ public:
     SurfacePositionHandle calculateSurfacePositionHandle(
         const glm::dvec3& targetModelSpace) const override;
 
+    /**
+     * Calculates the height from the surface of the reference ellipsoid to the height
+     * mapped surface for all of the provided \p positions. The result for each point is
+     * the same as the one returned from #calculateSurfacePositionHandle, but the points
+     * are grouped by the tile they fall into so that each tile only has to be looked up
+     * once per height layer, which makes this function much faster for large numbers of
+     * points.
+     *
+     * \param positions The geodetic positions for which the heights are calculated
+     * \return The heights for each of the \p positions, in the same order
+     */
+    std::vector<float> surfaceHeights(std::span<const Geodetic2> positions) const;
+
     bool renderedWithDesiredData() const override;
 
     Ellipsoid ellipsoid() const override;
@@ -133,27 +119,6 @@ private:
         glm::dmat4 viewProjection;
     };
 
-    /**
-     * Test if a specific chunk can safely be culled without affecting the rendered image.
-     *
-     * Goes through all available `ChunkCuller`s and check if any of them allows culling
-     * of the `Chunk`s in question.
-     */
-    bool testIfCullable(const Chunk& chunk, const RenderData& renderData,
-        const BoundingHeights& heights, const glm::dmat4& mvp) const;
-
-    /**
-     * Gets the desired level which can be used to determine if a chunk should split or
-     * merge.
-     *
-     * Using `ChunkLevelEvaluator`s, the desired level can be higher or lower than the
-     * current level of the `Chunks`s `TileIndex`. If the desired level is higher than
-     * that of the `Chunk`, it wants to split. If it is lower, it wants to merge with its
-     * siblings.
-     */
-    int desiredLevel(const Chunk& chunk, const RenderData& renderData,
-        const BoundingHeights& heights) const;
-
     /**
      * Calculates the height from the surface of the reference ellipsoid to the height
      * mapped surface.
@@ -166,6 +131,15 @@ private:
      */
     float getHeight(const glm::dvec3& position) const;
 
+    /**
+     * Samples the height maps for all \p positions and writes the resulting heights into
+     * \p result. Points that lie in the same chunk are evaluated together.
+     *
+     * \pre \p positions and \p result must have the same size
+     */
+    void sampleHeights(std::span<const Geodetic2> positions,
+        std::span<float> result) const;
+
     void renderChunks(const RenderData& data, bool renderGeomOnly = false);
 
     /**
@@ -198,15 +172,6 @@ private:
     void debugRenderChunk(const Chunk& chunk, const glm::dmat4& mvp,
         bool renderBounds) const;
 
-    bool isCullableByFrustum(const Chunk& chunk, const RenderData& renderData,
-        const glm::dmat4& mvp) const;
-    bool isCullableByHorizon(const Chunk& chunk, const RenderData& renderData,
-        const BoundingHeights& heights) const;
-
-    int desiredLevelByDistance(const Chunk& chunk, const RenderData& data,
-        const BoundingHeights& heights) const;
-    int desiredLevelByProjectedArea(const Chunk& chunk, const RenderData& data,
-        const BoundingHeights& heights) const;
     int desiredLevelByAvailableTileData(const Chunk& chunk) const;
 
 
@@ -220,8 +185,22 @@ private:
 
     void splitChunkNode(Chunk& cn, int depth);
     void mergeChunkNode(Chunk& cn);
-    bool updateChunkTree(Chunk& cn, const RenderData& data, const glm::dmat4& mvp);
-    void updateChunk(Chunk& chunk, const RenderData& data, const glm::dmat4& mvp) const;
+
+    /**
+     * Updates the chunk tree starting at \p cn by splitting and merging chunks based on
+     * their desired level. If \p isEvaluated is `true`, the level of detail of all chunks
+     * in the tree has already been evaluated, otherwise each chunk is evaluated just
+     * before it is used.
+     */
+    bool updateChunkTree(Chunk& cn, const ChunkLodSettings& settings, bool isEvaluated);
+
+    /**
+     * Requests all information about the \p chunk that is needed to evaluate its level
+     * of detail from the tile providers. This function must be called from the main
+     * thread as the tile providers are not thread-safe.
+     */
+    ChunkLodInput queryChunk(Chunk& chunk) const;
+    void updateChunk(Chunk& chunk, const ChunkLodSettings& settings) const;
     void freeChunkNode(Chunk* n);
 
     BoolProperty _performShading;
@@ -243,6 +222,7 @@ private:
         TriggerProperty resetTileProviders;
         BoolProperty performFrustumCulling;
         BoolProperty performHorizonCulling;
+        BoolProperty parallelChunkUpdate;
         IntProperty modelSpaceRenderingCutoffLevel;
         IntProperty dynamicLodIterationCount;
     } _debugProperties;
@@ -271,6 +251,8 @@ private:
     std::vector<const Chunk*> _globalChunkBuffer;
     std::vector<const Chunk*> _localChunkBuffer;
     std::vector<const Chunk*> _traversalMemory;
+    std::vector<Chunk*> _chunkUpdateBuffer;
+    std::vector<ChunkLodInput> _chunkLodInputs;
 
     Chunk _leftRoot;  // Covers all negative longitudes
     Chunk _rightRoot; // Covers all positive longitudes
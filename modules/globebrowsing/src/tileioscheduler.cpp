@@ -0,0 +1,325 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/globebrowsing/src/tileioscheduler.h>
+
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/profiling.h>
+#include <algorithm>
+#include <utility>
+
+namespace {
+    // The priority of the innermost PriorityScope of each thread
+    thread_local double CurrentPriority = 0.0;
+} // namespace
+
+namespace openspace {
+
+TileIOScheduler::PriorityScope::PriorityScope(double priority)
+    : _previousPriority(CurrentPriority)
+{
+    CurrentPriority = priority;
+}
+
+TileIOScheduler::PriorityScope::~PriorityScope() {
+    CurrentPriority = _previousPriority;
+}
+
+double TileIOScheduler::currentPriority() {
+    return CurrentPriority;
+}
+
+TileIOScheduler::TileIOScheduler(unsigned int nThreads, size_t maxQueuedJobsPerProvider)
+    : _maxQueuedJobsPerProvider(maxQueuedJobsPerProvider)
+    , _maxRunningJobsPerProvider(std::max<size_t>((nThreads + 1) / 2, 1))
+{
+    ghoul_assert(nThreads > 0, "Need at least one thread");
+    ghoul_assert(maxQueuedJobsPerProvider > 0, "Need to be able to queue jobs");
+
+    _workers.reserve(nThreads);
+    for (unsigned int i = 0; i < nThreads; i++) {
+        _workers.emplace_back(&TileIOScheduler::work, this);
+    }
+}
+
+TileIOScheduler::~TileIOScheduler() {
+    {
+        const std::lock_guard lock(_mutex);
+        _shouldStop = true;
+    }
+    _workCondition.notify_all();
+    for (std::thread& worker : _workers) {
+        worker.join();
+    }
+}
+
+TileIOScheduler::ProviderId TileIOScheduler::registerProvider() {
+    const std::lock_guard lock(_mutex);
+    const ProviderId id = _nextProviderId;
+    _nextProviderId++;
+    _providers[id] = Provider();
+    return id;
+}
+
+void TileIOScheduler::unregisterProvider(ProviderId provider) {
+    ZoneScoped;
+
+    std::unique_lock lock(_mutex);
+    auto it = _providers.find(provider);
+    ghoul_assert(it != _providers.end(), "Provider must be registered");
+
+    _nQueuedJobs -= it->second.queuedJobs.size();
+    it->second.queuedJobs.clear();
+
+    // The running jobs are still using the resources of the provider
+    _idleCondition.wait(lock, [&it]() { return it->second.nRunningJobs == 0; });
+    _providers.erase(it);
+}
+
+void TileIOScheduler::enqueue(ProviderId provider, Key key, double priority,
+                              std::function<RawTile()> job)
+{
+    {
+        const std::lock_guard lock(_mutex);
+        auto p = _providers.find(provider);
+        ghoul_assert(p != _providers.end(), "Provider must be registered");
+
+        auto [it, inserted] = p->second.queuedJobs.try_emplace(key);
+        Job& j = it->second;
+        j.priority = priority;
+        j.lastRequestedFrame = _frame;
+        if (!inserted) {
+            return;
+        }
+        j.function = std::move(job);
+        j.enqueueTime = Clock::now();
+        _nQueuedJobs++;
+        _statistics.maxQueuedJobs = std::max(_statistics.maxQueuedJobs, _nQueuedJobs);
+
+        if (p->second.queuedJobs.size() > _maxQueuedJobsPerProvider) {
+            // Make room by dropping the job that would be started last
+            std::map<Key, Job>& jobs = p->second.queuedJobs;
+            auto worst = std::min_element(
+                jobs.begin(),
+                jobs.end(),
+                [](const std::pair<const Key, Job>& lhs,
+                   const std::pair<const Key, Job>& rhs)
+                {
+                    if (lhs.second.priority != rhs.second.priority) {
+                        return lhs.second.priority < rhs.second.priority;
+                    }
+                    return lhs.second.lastRequestedFrame < rhs.second.lastRequestedFrame;
+                }
+            );
+            cancel(p->second, worst);
+        }
+    }
+    _workCondition.notify_one();
+}
+
+bool TileIOScheduler::touch(ProviderId provider, Key key, double priority) {
+    const std::lock_guard lock(_mutex);
+    auto p = _providers.find(provider);
+    ghoul_assert(p != _providers.end(), "Provider must be registered");
+
+    auto it = p->second.queuedJobs.find(key);
+    if (it == p->second.queuedJobs.end()) {
+        return false;
+    }
+    it->second.priority = priority;
+    it->second.lastRequestedFrame = _frame;
+    return true;
+}
+
+std::optional<RawTile> TileIOScheduler::popFinishedTile(ProviderId provider) {
+    const std::lock_guard lock(_mutex);
+    auto p = _providers.find(provider);
+    ghoul_assert(p != _providers.end(), "Provider must be registered");
+
+    if (p->second.finishedTiles.empty()) {
+        return std::nullopt;
+    }
+    RawTile tile = std::move(p->second.finishedTiles.front());
+    p->second.finishedTiles.pop_front();
+    return tile;
+}
+
+std::vector<TileIOScheduler::Key> TileIOScheduler::cancelledJobs(ProviderId provider) {
+    const std::lock_guard lock(_mutex);
+    auto p = _providers.find(provider);
+    ghoul_assert(p != _providers.end(), "Provider must be registered");
+
+    return std::exchange(p->second.cancelledJobs, std::vector<Key>());
+}
+
+std::vector<TileIOScheduler::Key> TileIOScheduler::cancelQueuedJobs(ProviderId provider) {
+    const std::lock_guard lock(_mutex);
+    auto p = _providers.find(provider);
+    ghoul_assert(p != _providers.end(), "Provider must be registered");
+
+    std::vector<Key> res;
+    res.reserve(p->second.queuedJobs.size());
+    for (const std::pair<const Key, Job>& job : p->second.queuedJobs) {
+        res.push_back(job.first);
+    }
+    _nQueuedJobs -= p->second.queuedJobs.size();
+    _statistics.nCancelledJobs += p->second.queuedJobs.size();
+    p->second.queuedJobs.clear();
+    return res;
+}
+
+void TileIOScheduler::update() {
+    ZoneScoped;
+
+    const std::lock_guard lock(_mutex);
+    _frame++;
+    if (_frame <= StaleFrameCount) {
+        return;
+    }
+
+    const uint64_t oldestValidFrame = _frame - StaleFrameCount;
+    for (std::pair<const ProviderId, Provider>& p : _providers) {
+        std::map<Key, Job>& jobs = p.second.queuedJobs;
+        for (auto it = jobs.begin(); it != jobs.end();) {
+            if (it->second.lastRequestedFrame < oldestValidFrame) {
+                // Nobody is interested in this tile anymore, for example because the
+                // chunk that needed it was merged
+                auto next = std::next(it);
+                cancel(p.second, it);
+                it = next;
+            }
+            else {
+                it++;
+            }
+        }
+    }
+}
+
+TileIOScheduler::Statistics TileIOScheduler::statistics() const {
+    const std::lock_guard lock(_mutex);
+    Statistics res = _statistics;
+    res.nQueuedJobs = _nQueuedJobs;
+    res.nRunningJobs = 0;
+    for (const std::pair<const ProviderId, Provider>& p : _providers) {
+        res.nRunningJobs += p.second.nRunningJobs;
+    }
+    if (res.nFinishedJobs > 0) {
+        res.averageTimeToTile = _totalTimeToTile / res.nFinishedJobs;
+    }
+    return res;
+}
+
+void TileIOScheduler::resetStatistics() {
+    const std::lock_guard lock(_mutex);
+    _statistics = Statistics();
+    _statistics.maxQueuedJobs = _nQueuedJobs;
+    _totalTimeToTile = 0.0;
+}
+
+unsigned int TileIOScheduler::nThreads() const {
+    return static_cast<unsigned int>(_workers.size());
+}
+
+bool TileIOScheduler::isPreferred(const Job& lhs, const Provider& lhsProvider,
+                                  const Job& rhs, const Provider& rhsProvider)
+{
+    if (lhs.priority != rhs.priority) {
+        return lhs.priority > rhs.priority;
+    }
+    if (lhs.lastRequestedFrame != rhs.lastRequestedFrame) {
+        return lhs.lastRequestedFrame > rhs.lastRequestedFrame;
+    }
+    // Give the provider that has waited the longest for a worker a turn
+    return lhsProvider.lastStartTicket < rhsProvider.lastStartTicket;
+}
+
+void TileIOScheduler::cancel(Provider& provider, std::map<Key, Job>::iterator it) {
+    provider.cancelledJobs.push_back(it->first);
+    provider.queuedJobs.erase(it);
+    _nQueuedJobs--;
+    _statistics.nCancelledJobs++;
+}
+
+void TileIOScheduler::work() {
+    std::unique_lock lock(_mutex);
+    while (true) {
+        if (_shouldStop) {
+            return;
+        }
+
+        // Find the most important job among all providers that are allowed to start
+        // another job
+        Provider* provider = nullptr;
+        std::map<Key, Job>::iterator job;
+        for (std::pair<const ProviderId, Provider>& p : _providers) {
+            if (p.second.nRunningJobs >= _maxRunningJobsPerProvider) {
+                continue;
+            }
+            for (auto it = p.second.queuedJobs.begin(); it != p.second.queuedJobs.end();
+                 it++)
+            {
+                if (!provider ||
+                    isPreferred(it->second, p.second, job->second, *provider))
+                {
+                    provider = &p.second;
+                    job = it;
+                }
+            }
+        }
+
+        if (!provider) {
+            _workCondition.wait(lock);
+            continue;
+        }
+
+        Job j = std::move(job->second);
+        provider->queuedJobs.erase(job);
+        _nQueuedJobs--;
+        provider->nRunningJobs++;
+        _nextStartTicket++;
+        provider->lastStartTicket = _nextStartTicket;
+
+        // The provider cannot be removed while it has running jobs, so the pointer
+        // remains valid while we are not holding the lock
+        lock.unlock();
+        RawTile tile = j.function();
+        const double ms = std::chrono::duration<double, std::milli>(
+            Clock::now() - j.enqueueTime
+        ).count();
+        lock.lock();
+
+        provider->finishedTiles.push_back(std::move(tile));
+        provider->nRunningJobs--;
+        _statistics.nFinishedJobs++;
+        _statistics.maxTimeToTile = std::max(_statistics.maxTimeToTile, ms);
+        _totalTimeToTile += ms;
+
+        _idleCondition.notify_all();
+        // Another worker might have been waiting for this provider to drop below its
+        // limit of running jobs
+        _workCondition.notify_one();
+    }
+}
+
+} // namespace openspace
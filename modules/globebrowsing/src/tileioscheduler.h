@@ -0,0 +1,265 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_GLOBEBROWSING___TILEIOSCHEDULER___H__
+#define __OPENSPACE_MODULE_GLOBEBROWSING___TILEIOSCHEDULER___H__
+
+#include <modules/globebrowsing/src/rawtile.h>
+#include <modules/globebrowsing/src/tileindex.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Loads the tiles for all tile providers of all globes on a shared, fixed set of worker
+ * threads, so that the number of concurrent reads is bounded by the number of workers
+ * rather than by the number of layers.
+ *
+ * Each job has a priority, with higher values being loaded first. Jobs are usually
+ * requested again every frame for as long as the chunk that needs them is part of the
+ * chunk tree. Requesting a job that is already queued updates its priority. Queued jobs
+ * that have not been requested for a few frames, for example because their chunk was
+ * merged away, are cancelled in #update. To keep a single slow provider from occupying
+ * all workers, each provider can only have a limited number of jobs running at the same
+ * time and only a limited number of jobs queued, with the lowest priority job being
+ * cancelled when that number is exceeded.
+ *
+ * The keys of cancelled jobs are reported back to the provider through #cancelledJobs so
+ * that they can be requested again later.
+ */
+class TileIOScheduler {
+public:
+    using ProviderId = uint32_t;
+    using Key = TileIndex::TileHashKey;
+
+    /// The number of frames after which a job that was not requested again is cancelled
+    static constexpr uint64_t StaleFrameCount = 3;
+
+    struct Statistics {
+        /// The number of jobs that are waiting to be started
+        size_t nQueuedJobs = 0;
+        /// The largest number of jobs that were waiting at the same time
+        size_t maxQueuedJobs = 0;
+        /// The number of jobs that are currently executed
+        size_t nRunningJobs = 0;
+        /// The number of jobs that were finished
+        uint64_t nFinishedJobs = 0;
+        /// The number of jobs that were cancelled before they were started
+        uint64_t nCancelledJobs = 0;
+        /// The average time in milliseconds between the first request and the end of
+        /// the job
+        double averageTimeToTile = 0.0;
+        /// The longest time in milliseconds between the first request and the end of a
+        /// job
+        double maxTimeToTile = 0.0;
+    };
+
+    /**
+     * Sets the priority that is used for all requests that are made from the current
+     * thread for as long as this object exists. This makes it possible for the code that
+     * knows about the importance of a chunk to pass it through the tile providers, which
+     * request the tiles without knowing about chunks.
+     */
+    class PriorityScope {
+    public:
+        explicit PriorityScope(double priority);
+        ~PriorityScope();
+
+        PriorityScope(const PriorityScope&) = delete;
+        PriorityScope& operator=(const PriorityScope&) = delete;
+
+    private:
+        const double _previousPriority;
+    };
+
+    /**
+     * Returns the priority of the innermost PriorityScope of the current thread, or 0 if
+     * there is none.
+     */
+    static double currentPriority();
+
+    /**
+     * Creates a new TileIOScheduler and starts the worker threads.
+     *
+     * \param nThreads The number of jobs that are executed concurrently
+     * \param maxQueuedJobsPerProvider The maximum number of jobs that a single provider
+     *        can have waiting
+     *
+     * \pre \p nThreads must be bigger than 0
+     * \pre \p maxQueuedJobsPerProvider must be bigger than 0
+     */
+    TileIOScheduler(unsigned int nThreads, size_t maxQueuedJobsPerProvider);
+
+    /**
+     * Stops all workers after their current job. Jobs that have not been started are
+     * discarded.
+     */
+    ~TileIOScheduler();
+
+    TileIOScheduler(const TileIOScheduler&) = delete;
+    TileIOScheduler& operator=(const TileIOScheduler&) = delete;
+
+    /**
+     * Registers a new provider and returns its identifier, which has to be passed to all
+     * other functions.
+     */
+    ProviderId registerProvider();
+
+    /**
+     * Removes the provider with the identifier \p provider, cancels its queued jobs, and
+     * blocks until all of its running jobs are finished. Afterwards, no job of the
+     * provider is accessing any of its resources anymore.
+     *
+     * \pre \p provider must have been registered
+     */
+    void unregisterProvider(ProviderId provider);
+
+    /**
+     * Adds the \p job that loads the tile identified by \p key for the \p provider. If a
+     * job with the same \p key is already queued for the \p provider, only its priority
+     * is updated.
+     *
+     * \param provider The provider to which the job belongs
+     * \param key The identifier of the tile that is loaded by the \p job
+     * \param priority The priority of the job, higher values are loaded first
+     * \param job The function that loads the tile
+     *
+     * \pre \p provider must have been registered
+     */
+    void enqueue(ProviderId provider, Key key, double priority,
+        std::function<RawTile()> job);
+
+    /**
+     * Marks the job with the \p key of the \p provider as requested in the current frame
+     * and updates its \p priority.
+     *
+     * \return `true` if a job with the \p key is queued, `false` otherwise
+     * \pre \p provider must have been registered
+     */
+    bool touch(ProviderId provider, Key key, double priority);
+
+    /**
+     * Returns one of the tiles that were loaded for the \p provider.
+     *
+     * \pre \p provider must have been registered
+     */
+    std::optional<RawTile> popFinishedTile(ProviderId provider);
+
+    /**
+     * Returns the keys of all of the jobs of the \p provider that were cancelled since
+     * the last call of this function.
+     *
+     * \pre \p provider must have been registered
+     */
+    std::vector<Key> cancelledJobs(ProviderId provider);
+
+    /**
+     * Cancels all queued jobs of the \p provider and returns their keys. Jobs that are
+     * already running are not affected.
+     *
+     * \pre \p provider must have been registered
+     */
+    std::vector<Key> cancelQueuedJobs(ProviderId provider);
+
+    /**
+     * Advances the frame counter and cancels all jobs that have not been requested in
+     * the last StaleFrameCount frames. This function should be called once per frame.
+     */
+    void update();
+
+    /**
+     * Returns the current statistics of the scheduler.
+     */
+    Statistics statistics() const;
+
+    /**
+     * Resets the counters and times of the statistics.
+     */
+    void resetStatistics();
+
+    /**
+     * Returns the number of worker threads.
+     */
+    unsigned int nThreads() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Job {
+        std::function<RawTile()> function;
+        double priority = 0.0;
+        uint64_t lastRequestedFrame = 0;
+        Clock::time_point enqueueTime;
+    };
+
+    struct Provider {
+        std::map<Key, Job> queuedJobs;
+        size_t nRunningJobs = 0;
+        /// Used to alternate between providers whose jobs have the same priority
+        uint64_t lastStartTicket = 0;
+        std::deque<RawTile> finishedTiles;
+        std::vector<Key> cancelledJobs;
+    };
+
+    /**
+     * Returns whether \p lhs should be started before \p rhs.
+     */
+    static bool isPreferred(const Job& lhs, const Provider& lhsProvider, const Job& rhs,
+        const Provider& rhsProvider);
+
+    void cancel(Provider& provider, std::map<Key, Job>::iterator it);
+    void work();
+
+    const size_t _maxQueuedJobsPerProvider;
+    const size_t _maxRunningJobsPerProvider;
+
+    std::map<ProviderId, Provider> _providers;
+    ProviderId _nextProviderId = 0;
+    uint64_t _frame = 0;
+    uint64_t _nextStartTicket = 0;
+
+    size_t _nQueuedJobs = 0;
+    Statistics _statistics;
+    double _totalTimeToTile = 0.0;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _workCondition;
+    std::condition_variable _idleCondition;
+    bool _shouldStop = false;
+
+    std::vector<std::thread> _workers;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_GLOBEBROWSING___TILEIOSCHEDULER___H__
@@ -25,6 +25,7 @@
 #include <modules/globebrowsing/src/tileprovider/defaulttileprovider.h>
 
 #include <modules/globebrowsing/globebrowsingmodule.h>
+#include <modules/globebrowsing/src/disktilecache.h>
 #include <modules/globebrowsing/src/memoryawaretilecache.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/engine/globals.h>
@@ -37,6 +38,7 @@
 #include <ghoul/misc/dictionary.h>
 #include <ghoul/misc/profiling.h>
 #include <algorithm>
+#include <filesystem>
 #include <optional>
 #include <utility>
 
@@ -202,6 +204,25 @@ void DefaultTileProvider::initAsyncTileDataReader(TileTextureInitData initData,
 {
     ZoneScoped;
 
+    GlobeBrowsingModule* module = global::moduleEngine->module<GlobeBrowsingModule>();
+
+    // Everything that influences the contents of the tiles has to be part of the key in
+    // the disk cache. For temporal datasets, the file path already contains the time
+    uint64_t diskTileCacheKey = 0;
+    if (module->diskTileCache()) {
+        std::string identity = std::format(
+            "{}|{}|{}", _filePath.value(), initData.hashKey, _performPreProcessing
+        );
+        std::error_code ec;
+        const std::filesystem::file_time_type modified =
+            std::filesystem::last_write_time(_filePath.value(), ec);
+        if (!ec) {
+            // Local files might be replaced with a different version
+            identity += std::format("|{}", modified.time_since_epoch().count());
+        }
+        diskTileCacheKey = DiskTileCache::providerKey(identity);
+    }
+
     _asyncTextureDataProvider = std::make_unique<AsyncTileDataProvider>(
         name,
         std::make_unique<RawTileDataReader>(
@@ -209,7 +230,10 @@ void DefaultTileProvider::initAsyncTileDataReader(TileTextureInitData initData,
             std::move(initData),
             std::move(cacheProperties),
             RawTileDataReader::PerformPreprocessing(_performPreProcessing)
-        )
+        ),
+        *module->tileIOScheduler(),
+        module->diskTileCache(),
+        diskTileCacheKey
     );
 }
 
@@ -46,7 +46,9 @@
 #include <ghoul/opengl/texture.h>
 #include <ghoul/opengl/textureunit.h>
 #include <fstream>
+#include <memory>
 #include <string_view>
+#include <vector>
 
 namespace {
     using namespace openspace;
@@ -54,6 +56,10 @@ namespace {
     constexpr std::string_view _loggerCat = "RenderableSolarImagery";
     constexpr size_t DefaultTextureSize = 32;
 
+    // The number of decoded frames that are kept in memory. Each full resolution frame
+    // is 16 MB, so this covers a few seconds of scrubbing
+    constexpr size_t FrameCacheSize = 8;
+
     enum FaceMode {
         FrontOnly = 0,
         SolidBack,
@@ -717,28 +723,63 @@ void RenderableSolarImagery::updateImageryTexture() {
         std::format("{}x{}", imageSize, imageSize)
     );
 
-    // If the current keyframe image has not yet been decoded and cached we'll just wait
-    // until it is available. The previous image will be shown until the new one is ready
-    if (std::filesystem::exists(cached)) {
-        // Load data from cache
-        DecodedImageData data = loadDecodedDataFromCache(
-            cached,
-            keyframe->data,
-            imageSize
+    // Recently used frames are still in memory, otherwise they have to be loaded from the
+    // disk cache
+    const std::string key = cached.string();
+    std::shared_ptr<const DecodedImageData> data = cachedFrame(key);
+    if (!data && std::filesystem::exists(cached)) {
+        data = std::make_shared<const DecodedImageData>(
+            loadDecodedDataFromCache(cached, keyframe->data, imageSize)
         );
+        addCachedFrame(key, data);
+    }
 
-        _isCoronaGraph = data.metadata.isCoronaGraph;
-        _currentScale = data.metadata.scale;
-        _currentCenterPixel = data.metadata.centerPixel;
+    // If the current keyframe image has not yet been decoded and cached we'll just wait
+    // until it is available. The previous image will be shown until the new one is ready
+    if (data) {
+        _isCoronaGraph = data->metadata.isCoronaGraph;
+        _currentScale = data->metadata.scale;
+        _currentCenterPixel = data->metadata.centerPixel;
         _currentKeyframe = keyframe->id;
 
-        _imageryTexture->resize(glm::uvec3(data.imageSize, data.imageSize, 1));
+        _imageryTexture->resize(glm::uvec3(data->imageSize, data->imageSize, 1));
         _imageryTexture->setPixelData(
-            reinterpret_cast<std::byte*>(data.buffer.data())
+            reinterpret_cast<const std::byte*>(data->buffer.data())
         );
     }
 }
 
+std::shared_ptr<const DecodedImageData> RenderableSolarImagery::cachedFrame(
+                                                                   const std::string& key)
+{
+    const std::lock_guard lock(_frameCacheMutex);
+    auto it = _frameCacheIndex.find(key);
+    if (it == _frameCacheIndex.end()) {
+        return nullptr;
+    }
+    _frameCache.splice(_frameCache.begin(), _frameCache, it->second);
+    return it->second->second;
+}
+
+void RenderableSolarImagery::addCachedFrame(const std::string& key,
+                                            std::shared_ptr<const DecodedImageData> frame)
+{
+    const std::lock_guard lock(_frameCacheMutex);
+    auto it = _frameCacheIndex.find(key);
+    if (it != _frameCacheIndex.end()) {
+        it->second->second = std::move(frame);
+        _frameCache.splice(_frameCache.begin(), _frameCache, it->second);
+        return;
+    }
+
+    _frameCache.emplace_front(key, std::move(frame));
+    _frameCacheIndex[key] = _frameCache.begin();
+    if (_frameCache.size() > FrameCacheSize) {
+        _frameCacheIndex.erase(_frameCache.back().first);
+        _frameCache.pop_back();
+    }
+}
+
 void RenderableSolarImagery::requestPredictiveFrames(
                                                   const Keyframe<ImageMetadata>* keyframe,
                                                                    const UpdateData& data)
@@ -794,7 +835,10 @@ void RenderableSolarImagery::requestPredictiveFrames(
         return;
     }
 
-    auto requestFrameIfNeeded = [this](const Keyframe<ImageMetadata>& kf) {
+    // The requests replace the ones of the previous prediction, so that the decodes of
+    // frames that are no longer in the prediction window are cancelled when scrubbing
+    std::vector<DecodeRequest> requests;
+    auto requestFrameIfNeeded = [this, &requests](const Keyframe<ImageMetadata>& kf) {
         // Check if the keyframe has already been decoded and exists in cache
         const int imageSize = kf.data.fullResolution /
             static_cast<int>(std::pow(2, _downsamplingLevel.value())
@@ -819,9 +863,13 @@ void RenderableSolarImagery::requestPredictiveFrames(
             _downsamplingLevel,
             [this, cacheFile](DecodedImageData&& decodedData) {
                 saveDecodedDataToCache(cacheFile, decodedData, _verboseMode);
+                addCachedFrame(
+                    cacheFile.string(),
+                    std::make_shared<const DecodedImageData>(std::move(decodedData))
+                );
             }
         );
-        _asyncDecoder->requestDecode(std::move(request));
+        requests.push_back(std::move(request));
     };
 
     // Request frames before and after the current keyframe
@@ -839,6 +887,8 @@ void RenderableSolarImagery::requestPredictiveFrames(
         requestFrameIfNeeded(*beforeIt);
     }
 
+    _asyncDecoder->replaceRequests(std::move(requests));
+
     _lastPredictedKeyframe = keyframe->id;
     _predictionIsDirty = false;
 }
@@ -35,7 +35,12 @@
 #include <openspace/properties/scalar/floatproperty.h>
 #include <openspace/properties/scalar/intproperty.h>
 #include <ghoul/opengl/uniformcache.h>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
 namespace ghoul::opengl { class Texture; }
 
@@ -93,6 +98,20 @@ private:
     void requestPredictiveFrames(const Keyframe<ImageMetadata>* keyframe,
         const UpdateData& data);
 
+    /**
+     * Returns the decoded frame that is stored under the \p key in the in-memory frame
+     * cache and marks it as the most recently used one, or `nullptr` if the frame is not
+     * in the cache.
+     */
+    std::shared_ptr<const DecodedImageData> cachedFrame(const std::string& key);
+
+    /**
+     * Adds the \p frame to the in-memory frame cache as the most recently used one. If
+     * the cache is full, the least recently used frame is removed from it.
+     */
+    void addCachedFrame(const std::string& key,
+        std::shared_ptr<const DecodedImageData> frame);
+
     void createPlaneAndFrustum(double moveDistance);
     void createPlane() const;
     void createFrustum() const;
@@ -126,6 +145,18 @@ private:
     ImageMetadataMap _imageMetadataMap;
     std::unordered_map<InstrumentName, std::shared_ptr<TransferFunction>> _tfMap;
 
+    // The most recently used decoded frames, keyed by their disk cache file, with the
+    // most recently used one at the front. The decoder keeps no frames, and scrubbing
+    // back and forth would otherwise read every frame from the disk cache again. The
+    // frames are shared, so a hit does not copy the image. As the decoder's callbacks
+    // add to it, the cache is declared before the decoder to outlive its threads
+    using FrameCacheEntry =
+        std::pair<std::string, std::shared_ptr<const DecodedImageData>>;
+    std::list<FrameCacheEntry> _frameCache;
+    std::unordered_map<std::string, std::list<FrameCacheEntry>::iterator>
+        _frameCacheIndex;
+    std::mutex _frameCacheMutex;
+
     // Decoder
     std::unique_ptr<AsyncImageDecoder> _asyncDecoder;
     size_t _lastPredictedKeyframe = NoActiveKeyframe;
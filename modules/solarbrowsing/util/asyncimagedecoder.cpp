@@ -25,6 +25,9 @@
 #include <modules/solarbrowsing/util/asyncimagedecoder.h>
 
 #include <modules/solarbrowsing/util/j2kcodec.h>
+#include <cmath>
+#include <cstdint>
+#include <format>
 
 namespace openspace {
 
@@ -38,6 +41,12 @@ AsyncImageDecoder::AsyncImageDecoder(size_t numThreads, bool verbose)
 }
 
 AsyncImageDecoder::~AsyncImageDecoder() {
+    {
+        std::lock_guard lock(_queueMutex);
+        for (const auto& [key, isCancelled] : _activeRequests) {
+            *isCancelled = true;
+        }
+    }
     _stopRequest = true;
     _queueCV.notify_all();
 
@@ -51,24 +60,57 @@ AsyncImageDecoder::~AsyncImageDecoder() {
 void AsyncImageDecoder::requestDecode(DecodeRequest request) {
     {
         std::lock_guard lock(_queueMutex);
-        const std::string key = std::format(
-            "{}_ds_{}", request.metadata.filePath, request.downsamplingLevel
-        );
-        if (_activeRequests.contains(key)) {
+        std::string key = requestKey(request);
+        auto active = _activeRequests.find(key);
+        const bool isActive = active != _activeRequests.end() && !*active->second;
+        if (isActive || _queuedRequests.contains(key)) {
             // Request is already being processed
             return;
         }
 
-        _activeRequests[key] = true;
-        _requestQueue.push(std::move(request));
+        _queuedRequests.insert(std::move(key));
+        _requestQueue.push_back(std::move(request));
     }
 
     _queueCV.notify_one();
 }
 
+void AsyncImageDecoder::replaceRequests(std::vector<DecodeRequest> requests) {
+    {
+        std::lock_guard lock(_queueMutex);
+        _requestQueue.clear();
+        _queuedRequests.clear();
+
+        std::unordered_set<std::string> keys;
+        for (DecodeRequest& request : requests) {
+            std::string key = requestKey(request);
+            auto active = _activeRequests.find(key);
+            const bool isActive = active != _activeRequests.end() && !*active->second;
+            keys.insert(key);
+            if (isActive || _queuedRequests.contains(key)) {
+                continue;
+            }
+
+            _queuedRequests.insert(std::move(key));
+            _requestQueue.push_back(std::move(request));
+        }
+
+        // Cancel the decodes that are no longer needed
+        for (const auto& [key, isCancelled] : _activeRequests) {
+            if (!keys.contains(key)) {
+                *isCancelled = true;
+            }
+        }
+    }
+
+    _queueCV.notify_all();
+}
+
 void AsyncImageDecoder::workerThread() {
     while (!_stopRequest) {
         DecodeRequest request;
+        std::string key;
+        std::shared_ptr<std::atomic<bool>> isCancelled;
         {
             // Acquire lock
             std::unique_lock lock(_queueMutex);
@@ -90,44 +132,78 @@ void AsyncImageDecoder::workerThread() {
                 continue;
             }
 
-            request = _requestQueue.front();
-            _requestQueue.pop();
+            request = std::move(_requestQueue.front());
+            _requestQueue.pop_front();
+            key = requestKey(request);
+            _queuedRequests.erase(key);
+
+            // Each decode gets its own flag, as a cancelled decode of the same image might
+            // still be running and must not remove this one when it finishes
+            isCancelled = std::make_shared<std::atomic<bool>>(false);
+            _activeRequests[key] = isCancelled;
         }
 
         // Decode request
-        decodeRequest(request);
+        decodeRequest(request, *isCancelled);
+
+        {
+            std::lock_guard lock(_queueMutex);
+            auto it = _activeRequests.find(key);
+            if (it != _activeRequests.end() && it->second == isCancelled) {
+                _activeRequests.erase(it);
+            }
+        }
     }
 }
 
-void AsyncImageDecoder::decodeRequest(const DecodeRequest& request) {
+void AsyncImageDecoder::decodeRequest(const DecodeRequest& request,
+                                      const std::atomic<bool>& isCancelled)
+{
     const unsigned int imageSize = static_cast<unsigned int>(
         request.metadata.fullResolution /
         std::pow(2, request.downsamplingLevel)
     );
+    std::pair<uint32_t, uint32_t> size = std::pair(imageSize, imageSize);
+    if (request.region.has_value()) {
+        size = J2kCodec::decodedSize(*request.region, request.downsamplingLevel);
+    }
+
     DecodedImageData decodedData = {
-        .buffer = std::vector<uint8_t>(imageSize * imageSize * sizeof(ImagePrecision)),
+        .buffer = std::vector<uint8_t>(
+            static_cast<size_t>(size.first) * size.second * sizeof(ImagePrecision)
+        ),
         .metadata = request.metadata,
-        .imageSize = imageSize
+        .imageSize = imageSize,
+        .region = request.region
     };
 
     J2kCodec j2c(_isVerbose);
-    j2c.decodeIntoBuffer(
+    const bool success = j2c.decode(
         request.metadata.filePath,
-        decodedData.buffer.data(),
-        request.downsamplingLevel
+        decodedData.buffer,
+        request.downsamplingLevel,
+        request.region,
+        &isCancelled
     );
+    if (!success) {
+        return;
+    }
 
     // Invoke callback and pass the image data back to caller thread
     request.callback(std::move(decodedData));
+}
 
-    // Once the callback is finished we're done with the request and can remove it
-    {
-        std::lock_guard lock(_queueMutex);
-        const std::string key = std::format(
-            "{}_ds_{}", request.metadata.filePath, request.downsamplingLevel
+std::string AsyncImageDecoder::requestKey(const DecodeRequest& request) {
+    if (request.region.has_value()) {
+        const ImageRegion& r = *request.region;
+        return std::format(
+            "{}_ds_{}_{}_{}_{}_{}",
+            request.metadata.filePath, request.downsamplingLevel, r.x, r.y, r.w, r.h
         );
-        _activeRequests.erase(key);
     }
+    return std::format(
+        "{}_ds_{}", request.metadata.filePath, request.downsamplingLevel
+    );
 }
 
 void AsyncImageDecoder::setVerboseFlag(bool verbose) {
@@ -29,12 +29,15 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <functional>
+#include <memory>
 #include <mutex>
-#include <queue>
+#include <string>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 // Implementation based on http://progsch.net/wordpress/?p=81
@@ -49,9 +52,12 @@ namespace openspace {
  * objects submitted through requestDecode(). Each request decodes a specific image at a
  * given downsampling level and delivers the resulting data through a callback function.
  *
- * Each decode operation is uniquely identified by the combination of image file path and
- * downsampling level. If multiple identical requests are issued while one is already
- * being processed, only a single decode operation will be performed.
+ * Each decode operation is uniquely identified by the combination of image file path,
+ * downsampling level, and region. If multiple identical requests are issued while one is
+ * already being processed, only a single decode operation will be performed. Decoded
+ * images are not kept by the decoder; callers that request the same image repeatedly are
+ * expected to cache the results themselves, as the RenderableSolarImagery does on disk
+ * and in memory.
  *
  * The decoder owns its worker threads for its entire lifetime and joins them during
  * destruction.
@@ -62,11 +68,13 @@ public:
      * Creates an asynchronous image decoder with \p numThreads worker threads.
      *
      * \param numThreads The number of background threads used for decoding
+     * \param verbose If `true`, the time that each decode takes is logged
      */
     explicit AsyncImageDecoder(size_t numThreads, bool verbose = false);
 
     /**
-     * Stops all worker threads and waits for them to finish.
+     * Stops all worker threads and waits for them to finish. Decodes that are in progress
+     * are cancelled.
      *
      * Pending requests in the queue may not be processed after destruction begins.
      */
@@ -82,6 +90,19 @@ public:
      * \param request The decode request to enqueue
      */
     void requestDecode(DecodeRequest request);
+
+    /**
+     * Replaces all requests that have not been started yet with the \p requests, which
+     * are processed in the order in which they are provided. Requests that are currently
+     * being decoded but that are not part of \p requests are cancelled and their
+     * callbacks are not invoked. This is used when scrubbing through an image sequence,
+     * where the previously requested images are no longer needed once the time has
+     * moved on.
+     *
+     * \param requests The decode requests that replace the queued requests
+     */
+    void replaceRequests(std::vector<DecodeRequest> requests);
+
     void setVerboseFlag(bool verbose);
 
 private:
@@ -97,11 +118,19 @@ private:
      * Performs the actual decoding for a single request.
      *
      * Decodes the requested image at the specified downsampling level and invokes the
-     * request callback with the resulting image data.
+     * request callback with the resulting image data, unless the decoding failed or was
+     * cancelled.
      *
      * \param request The decode request to process
+     * \param isCancelled Set to `true` when the request has been superseded
+     */
+    void decodeRequest(const DecodeRequest& request,
+        const std::atomic<bool>& isCancelled);
+
+    /**
+     * Returns the key that uniquely identifies the decode operation of \p request.
      */
-    void decodeRequest(const DecodeRequest& request);
+    static std::string requestKey(const DecodeRequest& request);
 
     bool _isVerbose = false;
 
@@ -112,8 +141,11 @@ private:
     // Request queue
     std::mutex _queueMutex;
     std::condition_variable _queueCV;
-    std::queue<DecodeRequest> _requestQueue;
-    std::unordered_map<std::filesystem::path, bool> _activeRequests;
+    std::deque<DecodeRequest> _requestQueue;
+    /// The keys of the requests in the queue
+    std::unordered_set<std::string> _queuedRequests;
+    /// The cancellation flags of the requests that are currently being decoded
+    std::unordered_map<std::string, std::shared_ptr<std::atomic<bool>>> _activeRequests;
 };
 
 } // namespace openspace
@@ -24,11 +24,14 @@
 
 #include <modules/solarbrowsing/util/j2kcodec.h>
 
+#include <openspace/util/memorymappedfile.h>
 #include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/exception.h>
 #include <format_defs.h>
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <format>
-#include <fstream>
 #include <optional>
 #include <vector>
 
@@ -87,21 +90,16 @@ namespace {
         return std::nullopt;
     }
 
-    // (anden88 2026-02-03): This function opens the file, reads some number of bytes from
-    // the metadata header and compares to some specific byte string. Further it compares
-    // that the read bytestring matches the extension. Imo, this is quite verbose, I think
-    // we could get away with only looking at the file extension. Did some measurements
-    // and it is in the ballpark of ~200-300 microseconds of work. Compared to setting up
-    // the `inFileStream` which is ~100ms
-    std::optional<FileFormat> infileFormat(const std::filesystem::path& filePath) {
-        std::ifstream file(filePath, std::ios::binary);
-        if (!file) {
-            return std::nullopt;
-        }
-
-        std::array<std::byte, 12> buffer;
-        file.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
-        if (!file) {
+    // (anden88 2026-02-03): This function reads some number of bytes from the metadata
+    // header and compares to some specific byte string. Further it compares that the read
+    // bytestring matches the extension. Imo, this is quite verbose, I think we could get
+    // away with only looking at the file extension. Did some measurements and it is in
+    // the ballpark of ~200-300 microseconds of work. Compared to setting up the
+    // `inFileStream` which is ~100ms
+    std::optional<FileFormat> infileFormat(const std::filesystem::path& filePath,
+                                           std::string_view content)
+    {
+        if (content.size() < 12) {
             return std::nullopt;
         }
 
@@ -112,17 +110,12 @@ namespace {
             return FileFormat::JPT;
         }
 
-        const std::string_view bufView = std::string_view(
-            reinterpret_cast<const char*>(buffer.data()),
-            buffer.size()
-        );
-
         // Try to read the magic bytes of the file
         std::optional<FileFormat> magicFormat;
-        if (bufView.starts_with(JP2_RFC3745_MAGIC) || bufView.starts_with(JP2_MAGIC)) {
+        if (content.starts_with(JP2_RFC3745_MAGIC) || content.starts_with(JP2_MAGIC)) {
             magicFormat = FileFormat::JP2;
         }
-        else if (bufView.starts_with(J2K_CODESTREAM_MAGIC)) {
+        else if (content.starts_with(J2K_CODESTREAM_MAGIC)) {
             magicFormat = FileFormat::J2K;
         }
         else {
@@ -138,6 +131,69 @@ namespace {
 
         return magicFormat;
     }
+
+    // The number of bytes that openjpeg requests from the stream at a time
+    constexpr OPJ_SIZE_T StreamChunkSize = 1024 * 1024;
+
+    // The state of an openjpeg stream that reads from a memory-mapped file
+    struct MappedStream {
+        std::string_view data;
+        size_t offset = 0;
+        const std::atomic<bool>* isCancelled = nullptr;
+    };
+
+    bool wasCancelled(const std::atomic<bool>* flag) {
+        return flag && flag->load(std::memory_order_relaxed);
+    }
+
+    OPJ_SIZE_T readStream(void* buffer, OPJ_SIZE_T nBytes, void* userData) {
+        MappedStream& stream = *reinterpret_cast<MappedStream*>(userData);
+
+        // Failing the read makes openjpeg abort, but only while it is still pulling bytes
+        // from the stream. openjpeg reads the complete data of a tile before it decodes
+        // it, so this does not interrupt the decoding of a tile that has been read
+        if (wasCancelled(stream.isCancelled) || stream.offset >= stream.data.size()) {
+            return static_cast<OPJ_SIZE_T>(-1);
+        }
+
+        const size_t n = std::min<size_t>(nBytes, stream.data.size() - stream.offset);
+        std::memcpy(buffer, stream.data.data() + stream.offset, n);
+        stream.offset += n;
+        return n;
+    }
+
+    OPJ_OFF_T skipStream(OPJ_OFF_T nBytes, void* userData) {
+        MappedStream& stream = *reinterpret_cast<MappedStream*>(userData);
+        if (wasCancelled(stream.isCancelled)) {
+            return -1;
+        }
+
+        const OPJ_OFF_T offset = static_cast<OPJ_OFF_T>(stream.offset);
+        const OPJ_OFF_T size = static_cast<OPJ_OFF_T>(stream.data.size());
+        const OPJ_OFF_T n = std::clamp(nBytes, -offset, size - offset);
+        stream.offset = static_cast<size_t>(offset + n);
+        return n;
+    }
+
+    OPJ_BOOL seekStream(OPJ_OFF_T position, void* userData) {
+        MappedStream& stream = *reinterpret_cast<MappedStream*>(userData);
+        if (wasCancelled(stream.isCancelled) || position < 0 ||
+            static_cast<size_t>(position) > stream.data.size())
+        {
+            return OPJ_FALSE;
+        }
+
+        stream.offset = static_cast<size_t>(position);
+        return OPJ_TRUE;
+    }
+
+    // Converts a coordinate on the reference grid of the image into the coordinate of a
+    // component with the subsampling \p d at the provided resolution level
+    uint32_t reduceCoordinate(uint32_t value, uint32_t d, int resolutionLevel) {
+        const uint32_t component = (value + d - 1) / d;
+        const uint32_t factor = 1u << resolutionLevel;
+        return (component + factor - 1) / factor;
+    }
 } // namespace
 
 namespace openspace {
@@ -150,36 +206,103 @@ J2kCodec::~J2kCodec() {
     destroy();
 }
 
-void J2kCodec::decodeIntoBuffer(const std::filesystem::path& path, unsigned char* buffer,
-                                int downsamplingLevel)
+bool J2kCodec::decode(const std::filesystem::path& path, std::span<unsigned char> buffer,
+                      int resolutionLevel, std::optional<ImageRegion> region,
+                      const std::atomic<bool>* isCancelled)
 {
     auto t1 = std::chrono::high_resolution_clock::now();
-    createInfileStream(path);
-    setupDecoder(downsamplingLevel);
-
-    // @TODO (mnoven): It's a waste of resources having to decode into the image object and
-    // then copy over the data to our buffer. Would be better if we could decode directly
-    // into the buffer
-    // See: https://github.com/uclouvain/openjpeg/issues/837
-    if (!opj_decode(_decoder, _infileStream, _image)) {
-        LERROR("Could not decode image");
+    destroy();
+    _filePath = path;
+
+    std::optional<MemoryMappedFile> file;
+    try {
+        file.emplace(path);
+    }
+    catch (const ghoul::RuntimeError& e) {
+        LERROR(std::format("Failed to open file '{}': {}", path, e.message));
+        return false;
+    }
+
+    // The stream reads straight from the mapped file and fails once the decoding has been
+    // cancelled, which stops openjpeg while it is reading the headers or the tile data
+    MappedStream stream = {
+        .data = file->view(),
+        .offset = 0,
+        .isCancelled = isCancelled
+    };
+    _infileStream = opj_stream_create(StreamChunkSize, OPJ_TRUE);
+    if (!_infileStream) {
+        LERROR(std::format("Failed to create stream from file '{}'", _filePath));
+        return false;
+    }
+    opj_stream_set_user_data(_infileStream, &stream, nullptr);
+    opj_stream_set_user_data_length(_infileStream, stream.data.size());
+    opj_stream_set_read_function(_infileStream, readStream);
+    opj_stream_set_skip_function(_infileStream, skipStream);
+    opj_stream_set_seek_function(_infileStream, seekStream);
+
+    if (!setupDecoder(stream.data, resolutionLevel)) {
         destroy();
-        return;
+        return false;
     }
 
-    if (!opj_end_decompress(_decoder, _infileStream)) {
-        LERROR("Could not end decompression");
+    const ImageRegion fullImage = {
+        .x = 0,
+        .y = 0,
+        .w = _image->x1 - _image->x0,
+        .h = _image->y1 - _image->y0
+    };
+    const ImageRegion area = region.value_or(fullImage);
+    if (area.w == 0 || area.h == 0 || area.x + area.w > fullImage.w ||
+        area.y + area.h > fullImage.h)
+    {
+        LERROR(std::format("Requested region is outside of image '{}'", _filePath));
         destroy();
-        return;
+        return false;
     }
 
-    // @TODO (mnoven): This is a waste. Can't specify decode precision in
-    // openjpeg. See: https://github.com/uclouvain/openjpeg/issues/836)
-    std::copy(
-        _image->comps[0].data,
-        _image->comps[0].data + _image->comps[0].w * _image->comps[0].h,
-        buffer
-    );
+    // The decoded size of a region depends on where it lies on the reference grid, which
+    // decodedSize assumes to start at the image origin
+    const ImageRegion onGrid = {
+        .x = _image->x0 + area.x,
+        .y = _image->y0 + area.y,
+        .w = area.w,
+        .h = area.h
+    };
+    if (decodedSize(onGrid, resolutionLevel) != decodedSize(area, resolutionLevel)) {
+        LERROR(std::format(
+            "Offset of image '{}' is not supported at resolution level {}",
+            _filePath, resolutionLevel
+        ));
+        destroy();
+        return false;
+    }
+
+    if (region.has_value()) {
+        const bool success = opj_set_decode_area(
+            _decoder,
+            _image,
+            static_cast<OPJ_INT32>(_image->x0 + area.x),
+            static_cast<OPJ_INT32>(_image->y0 + area.y),
+            static_cast<OPJ_INT32>(_image->x0 + area.x + area.w),
+            static_cast<OPJ_INT32>(_image->y0 + area.y + area.h)
+        );
+        if (!success) {
+            LERROR(std::format("Failed to set the decode area of '{}'", _filePath));
+            destroy();
+            return false;
+        }
+    }
+
+    const bool success = decodeTiles(buffer, resolutionLevel, isCancelled) &&
+        opj_end_decompress(_decoder, _infileStream);
+    destroy();
+    if (!success) {
+        if (!wasCancelled(isCancelled)) {
+            LERROR(std::format("Could not decode image '{}'", _filePath));
+        }
+        return false;
+    }
 
     auto t2 = std::chrono::high_resolution_clock::now();
     if (_shouldPrintTiming) {
@@ -188,30 +311,185 @@ void J2kCodec::decodeIntoBuffer(const std::filesystem::path& path, unsigned char
             path, std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count()
         ));
     }
+    return true;
 }
 
-void J2kCodec::destroy() {
-    opj_stream_destroy(_infileStream);
-    opj_destroy_codec(_decoder);
-    opj_image_destroy(_image);
+std::pair<uint32_t, uint32_t> J2kCodec::decodedSize(const ImageRegion& region,
+                                                    int resolutionLevel)
+{
+    return {
+        reduceCoordinate(region.x + region.w, 1, resolutionLevel) -
+            reduceCoordinate(region.x, 1, resolutionLevel),
+        reduceCoordinate(region.y + region.h, 1, resolutionLevel) -
+            reduceCoordinate(region.y, 1, resolutionLevel)
+    };
 }
 
-void J2kCodec::createInfileStream(const std::filesystem::path& path) {
-    _filePath = path;
-    _infileStream = opj_stream_create_default_file_stream(path.string().c_str(), OPJ_TRUE);
-    if (!_infileStream) {
-        LERROR(std::format("Failed to create stream from file '{}'", _filePath));
+bool J2kCodec::decodeTiles(std::span<unsigned char> buffer, int resolutionLevel,
+                           const std::atomic<bool>* isCancelled)
+{
+    const opj_image_comp_t& component = _image->comps[0];
+    auto reduceX = [&](uint32_t x) {
+        return reduceCoordinate(x, component.dx, resolutionLevel);
+    };
+    auto reduceY = [&](uint32_t y) {
+        return reduceCoordinate(y, component.dy, resolutionLevel);
+    };
+
+    // The requested region in pixels of the decoded component. opj_set_decode_area
+    // replaces the bounds of the image with the decoded area, so these are the bounds of
+    // the region if one was requested
+    const uint32_t x0 = reduceX(_image->x0);
+    const uint32_t x1 = reduceX(_image->x1);
+    const uint32_t y0 = reduceY(_image->y0);
+    const uint32_t y1 = reduceY(_image->y1);
+    const size_t width = x1 - x0;
+    const size_t height = y1 - y0;
+    if (buffer.size() < width * height) {
+        LERROR(std::format(
+            "Buffer of {} bytes is too small for {}x{} image",
+            buffer.size(), width, height
+        ));
+        return false;
+    }
+
+    // The tile data contains the samples with the precision of the image, which is
+    // rounded up to full bytes
+    size_t bytesPerSample = 4;
+    if (component.prec <= 8) {
+        bytesPerSample = 1;
+    }
+    else if (component.prec <= 16) {
+        bytesPerSample = 2;
+    }
+
+    std::vector<unsigned char> tileBuffer;
+    while (true) {
+        OPJ_UINT32 tileIndex = 0;
+        OPJ_UINT32 dataSize = 0;
+        OPJ_INT32 tileX0 = 0;
+        OPJ_INT32 tileY0 = 0;
+        OPJ_INT32 tileX1 = 0;
+        OPJ_INT32 tileY1 = 0;
+        OPJ_UINT32 nComponents = 0;
+        OPJ_BOOL shouldContinue = OPJ_FALSE;
+        const bool success = opj_read_tile_header(
+            _decoder,
+            _infileStream,
+            &tileIndex,
+            &dataSize,
+            &tileX0, &tileY0, &tileX1, &tileY1,
+            &nComponents,
+            &shouldContinue
+        );
+        if (!success) {
+            return false;
+        }
+        if (!shouldContinue) {
+            break;
+        }
+
+        // The bounds of the tile in pixels of the decoded component
+        const uint32_t rx0 = reduceX(static_cast<uint32_t>(tileX0));
+        const uint32_t rx1 = reduceX(static_cast<uint32_t>(tileX1));
+        const uint32_t ry0 = reduceY(static_cast<uint32_t>(tileY0));
+        const uint32_t ry1 = reduceY(static_cast<uint32_t>(tileY1));
+
+        // The part of the requested region that is covered by this tile
+        const uint32_t tx0 = std::max(rx0, x0);
+        const uint32_t tx1 = std::min(rx1, x1);
+        const uint32_t ty0 = std::max(ry0, y0);
+        const uint32_t ty1 = std::min(ry1, y1);
+        const size_t tileWidth = tx1 > tx0 ? tx1 - tx0 : 0;
+        const size_t tileHeight = ty1 > ty0 ? ty1 - ty0 : 0;
+
+        // If the tile is exactly the region and only contains 8-bit samples, it can be
+        // decoded directly into the buffer
+        const bool isDirect = nComponents == 1 && bytesPerSample == 1 &&
+            rx0 == x0 && rx1 == x1 && ry0 == y0 && ry1 == y1 &&
+            dataSize == width * height;
+
+        unsigned char* target = buffer.data();
+        if (!isDirect) {
+            tileBuffer.resize(std::max<size_t>(dataSize, 1));
+            target = tileBuffer.data();
+        }
+
+        // Once openjpeg has started to decode a tile, it can not be interrupted, which
+        // for the single-tile images of SDO is the majority of the decode time. So this
+        // is the last point at which a cancelled decode can be stopped cheaply
+        if (wasCancelled(isCancelled)) {
+            return false;
+        }
+        if (!opj_decode_tile_data(_decoder, tileIndex, target, dataSize, _infileStream)) {
+            return false;
+        }
+
+        if (isDirect || tileWidth == 0 || tileHeight == 0) {
+            continue;
+        }
+
+        // opj_set_decode_area only selects the tiles that are decoded, openjpeg 2.5 still
+        // writes the entire tile into the tile data. Only if the data is too small for
+        // that, it is expected to be cropped to the region
+        const size_t fullWidth = rx1 - rx0;
+        const size_t fullHeight = ry1 - ry0;
+        size_t stride = fullWidth;
+        size_t offset = (ty0 - ry0) * fullWidth + (tx0 - rx0);
+        if (dataSize < fullWidth * fullHeight * bytesPerSample) {
+            stride = tileWidth;
+            offset = 0;
+        }
+
+        // The samples of the first component are stored first in the tile data
+        const size_t nSamples = offset + (tileHeight - 1) * stride + tileWidth;
+        if (dataSize < nSamples * bytesPerSample) {
+            LERROR(std::format("Unexpected size of tile {}", tileIndex));
+            return false;
+        }
+        for (size_t row = 0; row < tileHeight; row++) {
+            const unsigned char* src = target + (offset + row * stride) * bytesPerSample;
+            unsigned char* dst = buffer.data() + (ty0 - y0 + row) * width + (tx0 - x0);
+            if (bytesPerSample == 1) {
+                std::memcpy(dst, src, tileWidth);
+                continue;
+            }
+
+            // Only keep the lowest byte of wider samples, which is the same conversion
+            // that copying the 32-bit samples of the opj_image_t would do
+            for (size_t i = 0; i < tileWidth; i++) {
+                uint32_t value = 0;
+                std::memcpy(&value, src + i * bytesPerSample, bytesPerSample);
+                dst[i] = static_cast<unsigned char>(value);
+            }
+        }
+    }
+    return true;
+}
+
+void J2kCodec::destroy() {
+    if (_infileStream) {
+        opj_stream_destroy(_infileStream);
+        _infileStream = nullptr;
+    }
+    if (_decoder) {
+        opj_destroy_codec(_decoder);
+        _decoder = nullptr;
+    }
+    if (_image) {
+        opj_image_destroy(_image);
+        _image = nullptr;
     }
 }
 
-void J2kCodec::setupDecoder(int downsamplingLevel) {
+bool J2kCodec::setupDecoder(std::string_view content, int downsamplingLevel) {
     opj_set_default_decoder_parameters(&_decoderParams);
     _decoderParams.cp_reduce = downsamplingLevel;
 
-    const std::optional<FileFormat> format = infileFormat(_filePath);
+    const std::optional<FileFormat> format = infileFormat(_filePath, content);
     if (!format.has_value()) {
         LERROR(std::format("Unrecognized format for input {}", _filePath));
-        return;
+        return false;
     }
     _decoderParams.decod_format = static_cast<int>(*format);
 
@@ -233,21 +511,22 @@ void J2kCodec::setupDecoder(int downsamplingLevel) {
             LERROR(std::format(
                 "Unsupported format {} for input {}",
                 toString(*format), _filePath));
-            return;
+            return false;
     }
 
     _decoder = opj_create_decompress(codec);
 
     if (!opj_setup_decoder(_decoder, &_decoderParams)) {
         LERROR("Failed to set up the decoder");
-        return;
+        return false;
     }
 
     // Read the main header of the codestream and if necessary the JP2 boxes
     if (!opj_read_header(_infileStream, _decoder, &_image)) {
         LERROR("Failed to read the header");
-        return;
+        return false;
     }
+    return true;
 }
 
 } // namespace openspace
@@ -25,10 +25,18 @@
 #ifndef __OPENSPACE_MODULE_SOLARBROWSING___J2KCODEC___H__
 #define __OPENSPACE_MODULE_SOLARBROWSING___J2KCODEC___H__
 
+#include <modules/solarbrowsing/util/structs.h>
+
 #include <openjpeg.h>
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <utility>
 
 namespace openspace {
 
@@ -42,9 +50,13 @@ namespace openspace {
  * 2. We want to be able to decode directly into our buffer without having to go through
  *    the opj_image_t object.
  *    See: https://github.com/uclouvain/openjpeg/issues/837
+ *    This is solved by decoding tile by tile, as openjpeg writes the decoded tiles into
+ *    a buffer that we provide.
  * 3. Decoding precison is always 32-bits integers, meaning conversion has to be done if
  *    8-bytes are preferred.
  *    See: https://github.com/uclouvain/openjpeg/issues/836
+ *    The tiles are decoded with the precision of the image, so 8-bit images do not
+ *    need to be converted.
  */
 
 struct ImageData {
@@ -58,14 +70,50 @@ public:
     explicit J2kCodec(bool shouldPrintTiming = false);
     ~J2kCodec();
 
-    // Decode into a client allocated buffer
-    void decodeIntoBuffer(const std::filesystem::path& path, unsigned char* buffer,
+    /**
+     * Decodes the first component of the image at \p path into the client allocated
+     * \p buffer, one byte per pixel and row by row. The file is memory-mapped and the
+     * image is decoded tile by tile. If the image consists of a single 8-bit component
+     * and a single tile is exactly the requested area, the samples are written directly
+     * into \p buffer. Otherwise each tile is decoded into a scratch buffer and the part
+     * that overlaps the requested area is copied into its place in \p buffer. Images
+     * whose origin is offset on the reference grid are only decoded if the offset does
+     * not change the size returned by #decodedSize.
+     *
+     * \param path The path to the JPEG 2000 file
+     * \param buffer The buffer that receives the image. It needs to have room for the
+     *        number of pixels returned by #decodedSize
+     * \param resolutionLevel The number of highest resolution levels that are discarded,
+     *        which divides the width and height of the image by `2^resolutionLevel`
+     * \param region The part of the image that is decoded. If no region is provided,
+     *        the full image is decoded
+     * \param isCancelled If this is provided and becomes `true` while the image is
+     *        decoded, the decoding is aborted while reading the file or before the next
+     *        tile is decoded. The decoding of a tile that has already started is always
+     *        finished
+     * \return `true` if the image was decoded, `false` if the decoding failed or was
+     *         cancelled, in which case the content of \p buffer is undefined
+     */
+    bool decode(const std::filesystem::path& path, std::span<unsigned char> buffer,
+        int resolutionLevel, std::optional<ImageRegion> region = std::nullopt,
+        const std::atomic<bool>* isCancelled = nullptr);
+
+    /**
+     * Returns the width and height in pixels of the \p region of an image when it is
+     * decoded with the provided \p resolutionLevel.
+     *
+     * \param region The part of the full resolution image
+     * \param resolutionLevel The number of discarded resolution levels
+     * \return The number of pixels in x and y direction
+     */
+    static std::pair<uint32_t, uint32_t> decodedSize(const ImageRegion& region,
         int resolutionLevel);
 
 private:
     void destroy();
-    void createInfileStream(const std::filesystem::path& path);
-    void setupDecoder(int resolutionLevel);
+    bool setupDecoder(std::string_view content, int resolutionLevel);
+    bool decodeTiles(std::span<unsigned char> buffer, int resolutionLevel,
+        const std::atomic<bool>* isCancelled);
 
     opj_codec_t* _decoder = nullptr;
     opj_dparameters_t _decoderParams;
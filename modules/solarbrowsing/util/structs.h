@@ -27,9 +27,14 @@
 
 #include <openspace/util/timeline.h>
 #include <ghoul/glm.h>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace openspace {
 
@@ -41,6 +46,16 @@ struct ImageMetadata {
     bool isCoronaGraph = false;
 };
 
+/**
+ * A rectangular part of an image, given in pixels of the full resolution image.
+ */
+struct ImageRegion {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t w = 0;
+    uint32_t h = 0;
+};
+
 using InstrumentName = std::string;
 using ImageMetadataMap = std::unordered_map<InstrumentName, Timeline<ImageMetadata>>;
 using ImagePrecision = unsigned char;
@@ -49,6 +64,9 @@ struct DecodedImageData {
     std::vector<uint8_t> buffer;
     ImageMetadata metadata;
     unsigned int imageSize = 0;
+    // If this is set, the buffer only contains this region of the image. Its size is
+    // given by J2kCodec::decodedSize
+    std::optional<ImageRegion> region;
 };
 
 using DecodeCompleteCallback = std::function<void(DecodedImageData&&)>;
@@ -58,6 +76,8 @@ struct DecodeRequest {
     int downsamplingLevel = 0;
     // Synchronous callback assumed, can lead to race conditions if async
     DecodeCompleteCallback callback;
+    // The part of the image that is decoded. If it is not set, the full image is decoded
+    std::optional<ImageRegion> region;
 };
 
 } // namespace openspace
@@ -44,7 +44,7 @@ namespace {
 
     // Values needed to construct the url for the http request to JPL Horizons API
     constexpr std::string_view VectorUrl = "https://ssd.jpl.nasa.gov/api/horizons.api?"
-        "format=json&MAKE_EPHEM='YES'&EPHEM_TYPE='VECTORS'&VEC_TABLE='1'&VEC_LABELS='NO'&"
+        "format=json&MAKE_EPHEM='YES'&EPHEM_TYPE='VECTORS'&VEC_TABLE='2'&VEC_LABELS='NO'&"
         "CSV_FORMAT='NO'";
     constexpr std::string_view ObserverUrl = "https://ssd.jpl.nasa.gov/api/horizons.api?"
         "format=json&MAKE_EPHEM='YES'&EPHEM_TYPE='OBSERVER'&QUANTITIES='20,33'&"
@@ -532,12 +532,21 @@ HorizonsResult readHorizonsVectorFile(std::filesystem::path file) {
 
     // The beginning of a Horizons file has a header with a lot of information about the
     // query that we do not care about. Ignore everything until data starts, including
-    // the row marked by $$SOE (i.e. Start Of Ephemerides)
+    // the row marked by $$SOE (i.e. Start Of Ephemerides). The only exception is the
+    // description of the columns, which contains a row starting with VX if the file
+    // contains the velocities as well
     std::string line;
     do {
         ghoul::getline(fileStream, line);
+        const size_t first = line.find_first_not_of(" \t");
+        if (first != std::string::npos && line.compare(first, 2, "VX") == 0) {
+            result.hasVelocities = true;
+        }
     } while (line[0] != '$');
 
+    const glm::dmat3 transform =
+        SpiceManager::ref().positionTransformMatrix("ECLIPJ2000", "GALACTIC", 0.0);
+
     // Read data line by line until $$EOE (i.e. End Of Ephemerides).
     // Skip the rest of the file
     ghoul::getline(fileStream, line); // Skip the line with the $$EOE
@@ -545,9 +554,10 @@ HorizonsResult readHorizonsVectorFile(std::filesystem::path file) {
         HorizonsKeyframe dataPoint;
         std::stringstream str1(line);
 
-        // File is structured as (data over two lines):
+        // File is structured as (data over two or three lines):
         // JulianDayNumber = A.D. YYYY-MM-DD HH:MM:SS TDB
         //   X Y Z
+        //   VX VY VZ (optional)
         std::string temp;
         std::string date;
         std::string time;
@@ -571,10 +581,25 @@ HorizonsResult readHorizonsVectorFile(std::filesystem::path file) {
         const std::string timeString = std::format("{} {}", date, time);
         const double timeInJ2000 = Time::convertTime(timeString);
         glm::dvec3 pos = glm::dvec3(1000 * xPos, 1000 * yPos, 1000 * zPos);
-        const glm::dmat3 transform =
-            SpiceManager::ref().positionTransformMatrix("ECLIPJ2000", "GALACTIC", 0.0);
         pos = transform * pos;
 
+        if (result.hasVelocities) {
+            ghoul::getline(fileStream, line);
+            if (!fileStream.good()) {
+                LERROR(std::format("Malformed Horizons file '{}'", file));
+                return HorizonsResult();
+            }
+            std::stringstream str3(line);
+
+            //   VX VY VZ
+            double xVel = 0.0;
+            double yVel = 0.0;
+            double zVel = 0.0;
+            str3 >> xVel >> yVel >> zVel;
+            const glm::dvec3 vel = glm::dvec3(1000 * xVel, 1000 * yVel, 1000 * zVel);
+            dataPoint.velocity = transform * vel;
+        }
+
         // Add position to stored data
         dataPoint.time = timeInJ2000;
         dataPoint.position = pos;
@@ -42,13 +42,15 @@ namespace openspace {
  * In case of Vector table data the implementation expects a file with format:
  * TIME(JulianDayNumber = A.D. YYYY-MM-DD HH:MM:SS TDB)
  *   X(km) Y(km) Z(km)
+ *   VX(km/s) VY(km/s) VZ(km/s)
  * TIME - Only the "YYYY-MM-DD HH:MM:SS" part is of interest, the rest is ignored
  * X - X position in kilometers in Ecliptic J2000 reference frame
  * Y - Y position in kilometers in Ecliptic J2000 reference frame
  * Z - Z position in kilometers in Ecliptic J2000 reference frame
+ * VX, VY, VZ - Optional velocity in kilometers per second in the same reference frame
  * Changes required in the "Table Settings" for compatible data:
- *   1. Under "Select Output Quantities" choose option "Position components {x, y, z}
- *      only"
+ *   1. Under "Select Output Quantities" choose option "State vector {x, y, z, vx, vy,
+ *      vz}" or "Position components {x, y, z} only"
  *   2. Uncheck the "Vector labels" options
  *
  * In case of Observer table data the implementation expects a file with format:
@@ -93,11 +95,14 @@ enum class HorizonsType {
 struct HorizonsKeyframe {
     double time = 0.0;   // J2000 seconds
     glm::dvec3 position; // GALACTIC cartesian coordinates in meters
+    glm::dvec3 velocity = glm::dvec3(0.0); // GALACTIC velocity in meters per second
 };
 
 struct HorizonsResult {
     HorizonsType type = HorizonsType::Invalid;
     HorizonsResultCode errorCode = HorizonsResultCode::UnknownError;
+    // Vector tables can contain the velocity in addition to the position
+    bool hasVelocities = false;
     std::vector<HorizonsKeyframe> data;
 };
 
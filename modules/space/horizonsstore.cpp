@@ -0,0 +1,439 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/space/horizonsstore.h>
+
+#include <openspace/util/sampledtimeline.h>
+#include <ghoul/format.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/exception.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <utility>
+
+namespace {
+    // Identifies a store file. The version has to be increased whenever the layout of
+    // the file changes
+    constexpr std::array<char, 4> Magic = { 'O', 'S', 'H', 'S' };
+    constexpr uint32_t CurrentVersion = 1;
+
+    // Each decimated level keeps every n-th sample of the level before it
+    constexpr size_t DecimationFactor = 4;
+    // No further levels are created once a level would have fewer samples than this
+    constexpr size_t MinimumLevelSamples = 64;
+    constexpr size_t MaximumLevels = 12;
+
+    struct FileHeader {
+        std::array<char, 4> magic;
+        uint32_t version;
+        uint32_t nLevels;
+        uint32_t hasVelocities;
+    };
+
+    struct LevelHeader {
+        double startTime;
+        double endTime;
+        double bucketWidth;
+        uint64_t nSamples;
+        uint64_t nBuckets;
+        uint64_t samplesOffset;
+        uint64_t bucketsOffset;
+    };
+
+    struct StoredSample {
+        double time;
+        std::array<double, 3> position;
+        std::array<double, 3> velocity;
+    };
+
+    // The headers and samples are written and read as raw bytes
+    static_assert(std::is_trivially_copyable_v<FileHeader>);
+    static_assert(std::is_trivially_copyable_v<LevelHeader>);
+    static_assert(std::is_trivially_copyable_v<StoredSample>);
+    static_assert(sizeof(FileHeader) % alignof(uint64_t) == 0);
+    static_assert(sizeof(LevelHeader) % alignof(uint64_t) == 0);
+    static_assert(sizeof(StoredSample) % alignof(uint64_t) == 0);
+
+    // Returns, for each of the nBuckets equally sized buckets, the interval that starts
+    // at or before the beginning of the bucket
+    std::vector<uint64_t> createBuckets(const std::vector<StoredSample>& samples,
+                                        size_t nBuckets, double bucketWidth)
+    {
+        const double startTime = samples.front().time;
+        const size_t lastInterval = samples.size() > 1 ? samples.size() - 2 : 0;
+
+        std::vector<uint64_t> buckets;
+        buckets.reserve(nBuckets);
+        size_t i = 0;
+        for (size_t b = 0; b < nBuckets; b++) {
+            const double bucketStart = startTime + static_cast<double>(b) * bucketWidth;
+            while (i < lastInterval && samples[i + 1].time <= bucketStart) {
+                i++;
+            }
+            buckets.push_back(i);
+        }
+        return buckets;
+    }
+} // namespace
+
+namespace openspace {
+
+void HorizonsStore::write(const std::filesystem::path& path,
+                          std::span<const HorizonsKeyframe> samples, bool hasVelocities)
+{
+    ghoul_assert(!samples.empty(), "Samples must not be empty");
+
+    std::vector<StoredSample> base;
+    base.reserve(samples.size());
+    for (const HorizonsKeyframe& s : samples) {
+        const glm::dvec3 v = hasVelocities ? s.velocity : glm::dvec3(0.0);
+        base.push_back({
+            s.time,
+            { s.position.x, s.position.y, s.position.z },
+            { v.x, v.y, v.z }
+        });
+    }
+
+    // Sort the samples and only keep the first sample for each time
+    std::stable_sort(
+        base.begin(),
+        base.end(),
+        [](const StoredSample& lhs, const StoredSample& rhs) {
+            return lhs.time < rhs.time;
+        }
+    );
+    base.erase(
+        std::unique(
+            base.begin(),
+            base.end(),
+            [](const StoredSample& lhs, const StoredSample& rhs) {
+                return lhs.time == rhs.time;
+            }
+        ),
+        base.end()
+    );
+
+    std::vector<std::vector<StoredSample>> levels;
+    levels.push_back(std::move(base));
+    while (levels.size() < MaximumLevels &&
+           levels.back().size() / DecimationFactor >= MinimumLevelSamples)
+    {
+        const std::vector<StoredSample>& previous = levels.back();
+        std::vector<StoredSample> level;
+        level.reserve(previous.size() / DecimationFactor + 2);
+        for (size_t i = 0; i < previous.size(); i += DecimationFactor) {
+            level.push_back(previous[i]);
+        }
+        // Keep the last sample so that all levels cover the same time range
+        if ((previous.size() - 1) % DecimationFactor != 0) {
+            level.push_back(previous.back());
+        }
+        levels.push_back(std::move(level));
+    }
+
+    std::vector<LevelHeader> levelHeaders;
+    std::vector<std::vector<uint64_t>> levelBuckets;
+    uint64_t offset = sizeof(FileHeader) + levels.size() * sizeof(LevelHeader);
+    for (const std::vector<StoredSample>& level : levels) {
+        const double startTime = level.front().time;
+        const double endTime = level.back().time;
+        // For regularly spaced samples, there is one sample at the start of each bucket
+        const size_t nBuckets = std::max<size_t>(level.size() - 1, 1);
+        const double bucketWidth = (endTime - startTime) / static_cast<double>(nBuckets);
+
+        LevelHeader header = {
+            .startTime = startTime,
+            .endTime = endTime,
+            .bucketWidth = bucketWidth,
+            .nSamples = level.size(),
+            .nBuckets = nBuckets,
+            .samplesOffset = offset,
+            .bucketsOffset = offset + level.size() * sizeof(StoredSample)
+        };
+        offset = header.bucketsOffset + nBuckets * sizeof(uint64_t);
+        levelHeaders.push_back(header);
+        levelBuckets.push_back(createBuckets(level, nBuckets, bucketWidth));
+    }
+
+    std::ofstream file = std::ofstream(path, std::ofstream::binary);
+    if (!file.good()) {
+        throw ghoul::RuntimeError(std::format("Error opening file '{}'", path));
+    }
+
+    const FileHeader header = {
+        .magic = Magic,
+        .version = CurrentVersion,
+        .nLevels = static_cast<uint32_t>(levels.size()),
+        .hasVelocities = hasVelocities ? 1u : 0u
+    };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+    file.write(
+        reinterpret_cast<const char*>(levelHeaders.data()),
+        levelHeaders.size() * sizeof(LevelHeader)
+    );
+    for (size_t i = 0; i < levels.size(); i++) {
+        file.write(
+            reinterpret_cast<const char*>(levels[i].data()),
+            levels[i].size() * sizeof(StoredSample)
+        );
+        file.write(
+            reinterpret_cast<const char*>(levelBuckets[i].data()),
+            levelBuckets[i].size() * sizeof(uint64_t)
+        );
+    }
+
+    if (!file.good()) {
+        throw ghoul::RuntimeError(std::format("Error writing file '{}'", path));
+    }
+}
+
+glm::dvec3 HorizonsStore::interpolate(const HorizonsKeyframe& s0,
+                                      const HorizonsKeyframe& s1, double time,
+                                      bool useVelocities)
+{
+    ghoul_assert(s1.time > s0.time, "Samples must be in increasing time");
+
+    if (useVelocities) {
+        return interpolateHermite(
+            s0.time, s0.position, s0.velocity,
+            s1.time, s1.position, s1.velocity,
+            time
+        );
+    }
+    const double s = (time - s0.time) / (s1.time - s0.time);
+    return s0.position * (1.0 - s) + s1.position * s;
+}
+
+HorizonsStore::HorizonsStore(std::filesystem::path path)
+    : _file(std::move(path))
+{
+    const std::byte* data = _file.data();
+    const size_t size = _file.size();
+
+    FileHeader header;
+    if (size < sizeof(FileHeader)) {
+        throw ghoul::RuntimeError(std::format(
+            "File '{}' is not a Horizons store", _file.path()
+        ));
+    }
+    std::memcpy(&header, data, sizeof(FileHeader));
+    if (header.magic != Magic) {
+        throw ghoul::RuntimeError(std::format(
+            "File '{}' is not a Horizons store", _file.path()
+        ));
+    }
+    if (header.version != CurrentVersion) {
+        throw ghoul::RuntimeError(std::format(
+            "Horizons store '{}' has version {} but version {} is required",
+            _file.path(), header.version, CurrentVersion
+        ));
+    }
+
+    const size_t levelsEnd = sizeof(FileHeader) + header.nLevels * sizeof(LevelHeader);
+    if (header.nLevels == 0 || header.nLevels > MaximumLevels || levelsEnd > size) {
+        throw ghoul::RuntimeError(std::format(
+            "Horizons store '{}' has an invalid number of levels", _file.path()
+        ));
+    }
+    _hasVelocities = header.hasVelocities != 0;
+
+    // Checks that the range starting at the offset is inside the file and is aligned
+    // so that it can be accessed directly
+    auto isValidRange = [size](uint64_t offset, uint64_t n, size_t elementSize) {
+        return offset % alignof(uint64_t) == 0 && offset <= size &&
+               n <= (size - offset) / elementSize;
+    };
+
+    _levels.reserve(header.nLevels);
+    for (uint32_t i = 0; i < header.nLevels; i++) {
+        LevelHeader lh;
+        std::memcpy(
+            &lh,
+            data + sizeof(FileHeader) + i * sizeof(LevelHeader),
+            sizeof(LevelHeader)
+        );
+
+        if (lh.nSamples == 0 || lh.nBuckets == 0 ||
+            !isValidRange(lh.samplesOffset, lh.nSamples, sizeof(StoredSample)) ||
+            !isValidRange(lh.bucketsOffset, lh.nBuckets, sizeof(uint64_t)) ||
+            !(lh.endTime >= lh.startTime))
+        {
+            throw ghoul::RuntimeError(std::format(
+                "Horizons store '{}' has an invalid level {}", _file.path(), i
+            ));
+        }
+
+        Level level;
+        level.samples = data + lh.samplesOffset;
+        level.buckets = reinterpret_cast<const uint64_t*>(data + lh.bucketsOffset);
+        level.nSamples = static_cast<size_t>(lh.nSamples);
+        level.nBuckets = static_cast<size_t>(lh.nBuckets);
+        level.startTime = lh.startTime;
+        level.endTime = lh.endTime;
+        level.bucketWidth = lh.bucketWidth;
+        level.sampleInterval = level.nSamples > 1 ?
+            (lh.endTime - lh.startTime) / static_cast<double>(level.nSamples - 1) :
+            0.0;
+        _levels.push_back(level);
+    }
+}
+
+size_t HorizonsStore::nLevels() const {
+    return _levels.size();
+}
+
+size_t HorizonsStore::nSamples(size_t level) const {
+    ghoul_assert(level < _levels.size(), "Level out of range");
+    return _levels[level].nSamples;
+}
+
+double HorizonsStore::sampleInterval(size_t level) const {
+    ghoul_assert(level < _levels.size(), "Level out of range");
+    return _levels[level].sampleInterval;
+}
+
+double HorizonsStore::startTime() const {
+    return _levels.front().startTime;
+}
+
+double HorizonsStore::endTime() const {
+    return _levels.front().endTime;
+}
+
+bool HorizonsStore::hasVelocities() const {
+    return _hasVelocities;
+}
+
+HorizonsKeyframe HorizonsStore::sample(size_t level, size_t index) const {
+    ghoul_assert(level < _levels.size(), "Level out of range");
+    ghoul_assert(index < _levels[level].nSamples, "Index out of range");
+
+    StoredSample s;
+    std::memcpy(
+        &s,
+        _levels[level].samples + index * sizeof(StoredSample),
+        sizeof(StoredSample)
+    );
+    return HorizonsKeyframe {
+        .time = s.time,
+        .position = glm::dvec3(s.position[0], s.position[1], s.position[2]),
+        .velocity = glm::dvec3(s.velocity[0], s.velocity[1], s.velocity[2])
+    };
+}
+
+HorizonsKeyframe HorizonsStore::first() const {
+    return sample(0, 0);
+}
+
+HorizonsKeyframe HorizonsStore::last() const {
+    return sample(0, _levels.front().nSamples - 1);
+}
+
+size_t HorizonsStore::levelForTimeStep(double timeStep) const {
+    const double step = std::abs(timeStep);
+    if (!(step > 0.0)) {
+        return 0;
+    }
+
+    size_t level = 0;
+    for (size_t i = 1; i < _levels.size(); i++) {
+        if (_levels[i].sampleInterval > step) {
+            break;
+        }
+        level = i;
+    }
+    return level;
+}
+
+size_t HorizonsStore::findInterval(double time, size_t level) const {
+    ghoul_assert(level < _levels.size(), "Level out of range");
+    const Level& l = _levels[level];
+    ghoul_assert(l.nSamples >= 2, "Level must contain at least two samples");
+
+    auto timeAt = [&l](size_t index) {
+        double t = 0.0;
+        std::memcpy(
+            &t,
+            l.samples + index * sizeof(StoredSample) + offsetof(StoredSample, time),
+            sizeof(double)
+        );
+        return t;
+    };
+
+    const size_t lastInterval = l.nSamples - 2;
+    double b = std::floor((time - l.startTime) / l.bucketWidth);
+    b = std::isnan(b) ? 0.0 : std::clamp(b, 0.0, static_cast<double>(l.nBuckets - 1));
+    const size_t bucket = static_cast<size_t>(b);
+
+    // The interval containing the time lies between the interval at the beginning of
+    // this bucket and the interval at the beginning of the next bucket
+    size_t lo = std::min<size_t>(l.buckets[bucket], lastInterval);
+    size_t hi = bucket + 1 < l.nBuckets ?
+        std::min<size_t>(l.buckets[bucket + 1], lastInterval) :
+        lastInterval;
+
+    // Rounding in the bucket computation can place times at the edge of a bucket in the
+    // neighboring one, in which case the search range is widened
+    if (lo > 0 && timeAt(lo) > time) {
+        lo = 0;
+    }
+    if (hi < lastInterval && timeAt(hi + 1) <= time) {
+        hi = lastInterval;
+    }
+    hi = std::max(lo, hi);
+
+    // Find the last sample in [lo, hi] whose time is not larger than the requested time
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo + 1) / 2;
+        if (timeAt(mid) <= time) {
+            lo = mid;
+        }
+        else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+glm::dvec3 HorizonsStore::position(double time, size_t level) const {
+    ghoul_assert(level < _levels.size(), "Level out of range");
+    const Level& l = _levels[level];
+
+    if (time <= l.startTime) {
+        return sample(level, 0).position;
+    }
+    if (time >= l.endTime) {
+        return sample(level, l.nSamples - 1).position;
+    }
+
+    const size_t i = findInterval(time, level);
+    return interpolate(sample(level, i), sample(level, i + 1), time, _hasVelocities);
+}
+
+} // namespace openspace
@@ -0,0 +1,196 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_SPACE___HORIZONSSTORE___H__
+#define __OPENSPACE_MODULE_SPACE___HORIZONSSTORE___H__
+
+#include <modules/space/horizonsfile.h>
+#include <openspace/util/memorymappedfile.h>
+#include <ghoul/glm.h>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A read-only store of Horizons samples that is memory mapped from a binary file, so
+ * only the parts of a long ephemeris that are actually used have to be resident in
+ * memory. The file contains the samples at the original resolution as well as a number
+ * of decimated levels, in which each level only keeps every fourth sample of the level
+ * before it. Every level also has an index that maps equally sized time buckets to
+ * samples, which makes finding the samples around an epoch a constant time operation.
+ *
+ * The level is chosen based on the time step with which the store is sampled, for
+ * example the simulation time that passes between two frames. If the time passes much
+ * faster than the original sample interval, most of the samples would be skipped anyway
+ * and a coarser level gives the same visual result while touching far less memory.
+ *
+ * The positions are interpolated with a cubic Hermite spline if the samples contain
+ * velocities, and linearly otherwise. Times outside the covered range return the
+ * position of the first or last sample, respectively.
+ */
+class HorizonsStore {
+public:
+    /**
+     * Writes the provided \p samples into a store file at \p path, together with the
+     * decimated levels and their indices. The samples do not need to be sorted and
+     * samples with a time that occurs more than once are only stored once.
+     *
+     * \param path The path to the file that is created
+     * \param samples The samples that are stored in the file
+     * \param hasVelocities Whether the velocities of the \p samples are valid
+     *
+     * \throw ghoul::RuntimeError If the file could not be written
+     * \pre \p samples must not be empty
+     */
+    static void write(const std::filesystem::path& path,
+        std::span<const HorizonsKeyframe> samples, bool hasVelocities);
+
+    /**
+     * Interpolates the position at \p time between the two samples \p s0 and \p s1.
+     *
+     * \param s0 The sample at the beginning of the interval
+     * \param s1 The sample at the end of the interval
+     * \param time The time at which the position is computed
+     * \param useVelocities If `true`, a Hermite spline is used, otherwise the positions
+     *        are interpolated linearly
+     * \return The interpolated position
+     *
+     * \pre The time of \p s1 must be larger than the time of \p s0
+     */
+    static glm::dvec3 interpolate(const HorizonsKeyframe& s0, const HorizonsKeyframe& s1,
+        double time, bool useVelocities);
+
+    /**
+     * Maps the store file at \p path into memory.
+     *
+     * \param path The path to a file that was created with #write
+     *
+     * \throw ghoul::RuntimeError If the file could not be mapped or it is not a valid
+     *        store file of the current version
+     */
+    explicit HorizonsStore(std::filesystem::path path);
+
+    /**
+     * Returns the number of resolution levels in the store, with level 0 being the
+     * original resolution.
+     */
+    size_t nLevels() const;
+
+    /**
+     * Returns the number of samples in the provided \p level.
+     */
+    size_t nSamples(size_t level) const;
+
+    /**
+     * Returns the average time in seconds between two samples in the provided \p level.
+     */
+    double sampleInterval(size_t level) const;
+
+    /**
+     * Returns the time of the first sample.
+     */
+    double startTime() const;
+
+    /**
+     * Returns the time of the last sample.
+     */
+    double endTime() const;
+
+    /**
+     * Returns whether the samples in the store contain velocities.
+     */
+    bool hasVelocities() const;
+
+    /**
+     * Returns the sample with the \p index in the provided \p level.
+     *
+     * \pre \p level must be smaller than #nLevels
+     * \pre \p index must be smaller than the #nSamples of the \p level
+     */
+    HorizonsKeyframe sample(size_t level, size_t index) const;
+
+    /**
+     * Returns the first sample of the store.
+     */
+    HorizonsKeyframe first() const;
+
+    /**
+     * Returns the last sample of the store.
+     */
+    HorizonsKeyframe last() const;
+
+    /**
+     * Returns the coarsest level whose sample interval is not larger than the absolute
+     * value of the provided \p timeStep. A time step of 0 returns the original
+     * resolution.
+     *
+     * \param timeStep The time in seconds between two successive evaluations
+     * \return The level that should be used for the \p timeStep
+     */
+    size_t levelForTimeStep(double timeStep) const;
+
+    /**
+     * Returns the index of the sample that starts the interval containing the \p time
+     * in the provided \p level. Times outside the covered range return the first or last
+     * interval.
+     *
+     * \pre \p level must be smaller than #nLevels
+     * \pre The \p level must contain at least two samples
+     */
+    size_t findInterval(double time, size_t level) const;
+
+    /**
+     * Returns the position at the provided \p time using the samples of the \p level.
+     *
+     * \param time The time in J2000 seconds
+     * \param level The resolution level that is used
+     * \return The interpolated position in meters
+     *
+     * \pre \p level must be smaller than #nLevels
+     */
+    glm::dvec3 position(double time, size_t level = 0) const;
+
+private:
+    struct Level {
+        const std::byte* samples = nullptr;
+        const uint64_t* buckets = nullptr;
+        size_t nSamples = 0;
+        size_t nBuckets = 0;
+        double startTime = 0.0;
+        double endTime = 0.0;
+        double bucketWidth = 0.0;
+        double sampleInterval = 0.0;
+    };
+
+    MemoryMappedFile _file;
+    std::vector<Level> _levels;
+    bool _hasVelocities = false;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_SPACE___HORIZONSSTORE___H__
@@ -178,7 +178,11 @@ void RenderableHabitableZone::updateUniformLocations() {
 }
 
 void RenderableHabitableZone::computeZone() {
-    glm::dvec4 distancesInAu = computeKopparapuZoneBoundaries(_teff, _luminosity);
+    glm::dvec4 distancesInAu = computeKopparapuZoneBoundaries(
+        _teff,
+        _luminosity,
+        _kopparapuTeffInterval
+    );
     constexpr double AU = distanceconstants::AstronomicalUnit;
     const double inner = distancesInAu[0] * AU;
     const double innerConservative = distancesInAu[1] * AU;
@@ -199,14 +203,14 @@ void RenderableHabitableZone::computeZone() {
 }
 
 glm::dvec4 RenderableHabitableZone::computeKopparapuZoneBoundaries(float teff,
-                                                                   float luminosity)
+                                                                   float luminosity,
+                                                                   glm::vec2 teffInterval)
 {
     // Kopparapu's formula only considers stars with teff in range [2600, 7200] K.
     // However, we want to use the formula for more stars, so add some flexibility to
     // the teff boundaries (see constructor). OBS! This also prevents problems with too
     // large teff values in the computation
-    const glm::vec2 teffBounds = _kopparapuTeffInterval;
-    if (teff > teffBounds.y || teff < teffBounds.x) {
+    if (teff > teffInterval.y || teff < teffInterval.x) {
         // For the other stars, use a method by Tom E. Morris:
         // https://www.planetarybiology.com/calculating_habitable_zone.html
         const double L = static_cast<double>(luminosity);
@@ -42,23 +42,27 @@ public:
 
     static openspace::Documentation Documentation();
 
-private:
-    void initializeShader() override;
-    void updateUniformLocations() override;
-    void computeZone();
-
     /**
      * Compute the inner and outer boundary of the habitable zone of a star, according to
      * formula and coefficients by Kopparapu et al. (2015).
      *
      * \param teff The effective temperature of the star, in Kelvin
      * \param luminosity The luminosity of the star, in solar luminosities
+     * \param teffInterval The effective temperatures for which Kopparapu's formula is
+     *        used. For stars outside this interval, a simpler approximation that is only
+     *        based on the \p luminosity is used instead
      * \return A vec4 with the boundaries in atronomical units, in the order: optimistic
      *         inner, conservative inner, conservative outer, optimistic outer
      *
      * \sa https://arxiv.org/abs/1404.5292
      */
-    glm::dvec4 computeKopparapuZoneBoundaries(float teff, float luminosity);
+    static glm::dvec4 computeKopparapuZoneBoundaries(float teff, float luminosity,
+        glm::vec2 teffInterval = glm::vec2(1000.f, 10000.f));
+
+private:
+    void initializeShader() override;
+    void updateUniformLocations() override;
+    void computeZone();
 
     FloatProperty _teff;
     FloatProperty _luminosity;
@@ -36,6 +36,7 @@
 #include <array>
 #include <cstring>
 #include <filesystem>
+#include <mutex>
 #include <optional>
 #include <variant>
 
@@ -431,6 +432,10 @@ bool TimeFrameKernel::initialize() {
         );
     }
 
+    // The kernels are loaded and unloaded by calling CSPICE directly, so we need to
+    // make sure that the SpiceService is not using CSPICE at the same time
+    const std::lock_guard lock(SpiceManager::ref().mutex());
+
     // Extract the SPK file/files if they were specified
     if (p.spk.has_value()) {
         std::vector<std::filesystem::path> kernels;
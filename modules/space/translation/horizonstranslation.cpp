@@ -36,12 +36,7 @@
 #include <ghoul/misc/dictionary.h>
 #include <ghoul/misc/exception.h>
 #include <algorithm>
-#include <cfloat>
-#include <cstdint>
-#include <deque>
-#include <fstream>
 #include <iterator>
-#include <type_traits>
 #include <utility>
 #include <variant>
 
@@ -49,7 +44,6 @@ namespace {
     using namespace openspace;
 
     constexpr std::string_view _loggerCat = "HorizonsTranslation";
-    constexpr int8_t CurrentCacheVersion = 2;
 
     constexpr Property::PropertyInfo HorizonsTextFileInfo = {
         "HorizonsTextFile",
@@ -64,8 +58,8 @@ namespace {
     // data over time rather than by an analytic orbit model.
     //
     // The class reads one or more Horizons text files and converts their contents into a
-    // time-ordered position timeline. At runtime, it evaluates the object's position by
-    // interpolating between the surrounding keyframes, which produces smooth motion
+    // time-ordered position store. At runtime, it evaluates the object's position by
+    // interpolating between the surrounding samples, which produces smooth motion
     // across the sampled interval. If the requested time falls outside the covered
     // range, it returns the nearest available position at the start or end of the
     // dataset.
@@ -77,15 +71,58 @@ namespace {
     // parameterization.
     //
     // The implementation also supports combining multiple Horizons files into a single
-    // translation timeline. New samples are merged while avoiding duplicate timestamps,
-    // which allows a trajectory to be assembled from multiple exports or extended over
-    // longer time spans.
+    // translation. Where the files overlap, the samples of the earlier file are used and
+    // gaps between files are interpolated, which allows a trajectory to be assembled
+    // from multiple exports or extended over longer time spans.
     struct [[codegen::Dictionary(HorizonsTranslation)]] Parameters {
         // [[codegen::verbatim(HorizonsTextFileInfo.description)]]
         std::variant<
             std::filesystem::path, std::vector<std::filesystem::path>
         > horizonsTextFile;
     };
+
+    // Returns the position at the time from the first store that covers it. The time
+    // step between two evaluations selects the resolution level of the store
+    glm::dvec3 evaluate(const std::vector<HorizonsStore>& stores, double time,
+                        double timeStep)
+    {
+        const HorizonsStore* before = nullptr;
+        const HorizonsStore* after = nullptr;
+        for (const HorizonsStore& store : stores) {
+            if (time >= store.startTime() && time <= store.endTime()) {
+                return store.position(time, store.levelForTimeStep(timeStep));
+            }
+            if (store.endTime() < time &&
+                (!before || store.endTime() > before->endTime()))
+            {
+                before = &store;
+            }
+            if (store.startTime() > time &&
+                (!after || store.startTime() < after->startTime()))
+            {
+                after = &store;
+            }
+        }
+
+        if (before && after) {
+            // The time is in a gap between two files
+            return HorizonsStore::interpolate(
+                before->last(),
+                after->first(),
+                time,
+                before->hasVelocities() && after->hasVelocities()
+            );
+        }
+        else if (before) {
+            // Requesting a time after the last value. Return last known position
+            return before->last().position;
+        }
+        else if (after) {
+            // Requesting a time before the first value. Return first known position
+            return after->first().position;
+        }
+        return glm::dvec3(0.0);
+    }
 } // namespace
 #include "horizonstranslation_codegen.cpp"
 
@@ -102,10 +139,12 @@ HorizonsTranslation::HorizonsTranslation(const ghoul::Dictionary& dictionary)
     const Parameters p = codegen::bake<Parameters>(dictionary);
 
     _horizonsFiles.onChange([this]() {
+        // The data has to be loaded before the observers are notified as trails take a
+        // snapshot of the stores through the concurrent position function
+        loadData();
         requireUpdate();
         notifyObservers();
-        loadData();
-        });
+    });
     addProperty(_horizonsFiles);
 
     if (std::holds_alternative<std::filesystem::path>(p.horizonsTextFile)) {
@@ -128,40 +167,39 @@ HorizonsTranslation::HorizonsTranslation(const ghoul::Dictionary& dictionary)
 }
 
 glm::dvec3 HorizonsTranslation::position(const UpdateData& data) const {
-    glm::dvec3 interpolatedPos = glm::dvec3(0.0);
-
-    const Keyframe<glm::dvec3>* lastBefore =
-        _timeline.lastKeyframeBefore(data.time.j2000Seconds(), true);
-    const Keyframe<glm::dvec3>* firstAfter =
-        _timeline.firstKeyframeAfter(data.time.j2000Seconds(), false);
-
-    if (lastBefore && firstAfter) {
-        // We're inbetween first and last value
-        const double timelineDiff = firstAfter->timestamp - lastBefore->timestamp;
-        const double timeDiff = data.time.j2000Seconds() - lastBefore->timestamp;
-        const double diff = (timelineDiff > DBL_EPSILON) ? timeDiff / timelineDiff : 0.0;
-
-        const glm::dvec3 dir = firstAfter->data - lastBefore->data;
-        interpolatedPos = lastBefore->data + dir * diff;
-    }
-    else if (lastBefore) {
-        // Requesting a time after last value. Return last known position
-        interpolatedPos = lastBefore->data;
-    }
-    else if (firstAfter) {
-        // Requesting a time before first value. Return last known position
-        interpolatedPos = firstAfter->data;
+    if (!_stores) {
+        return glm::dvec3(0.0);
     }
+    // Samples that are much closer together than the time that passes between two
+    // frames would be skipped anyway, so a coarser level of the stores is used
+    const double time = data.time.j2000Seconds();
+    const double timeStep = time - data.previousFrameTime.j2000Seconds();
+    return evaluate(*_stores, time, timeStep);
+}
 
-    return interpolatedPos;
+bool HorizonsTranslation::isThreadSafe() const {
+    return true;
+}
+
+Translation::PositionFunction HorizonsTranslation::concurrentPositionFunction() const {
+    // The stores are never modified, so they can be shared with the function
+    return [stores = _stores](std::span<const double> times,
+                              std::span<glm::dvec3> positions)
+    {
+        for (size_t i = 0; i < times.size(); i++) {
+            positions[i] = stores ? evaluate(*stores, times[i], 0.0) : glm::dvec3(0.0);
+        }
+    };
 }
 
 void HorizonsTranslation::loadData() {
+    auto stores = std::make_shared<std::vector<HorizonsStore>>();
+
     for (const std::string& filePath : _horizonsFiles.value()) {
         std::filesystem::path file = absPath(filePath);
         if (!std::filesystem::is_regular_file(file)) {
             LWARNING(std::format("The Horizons text file '{}' could not be found", file));
-            return;
+            break;
         }
 
         std::filesystem::path cachedFile = FileSys.cacheManager()->cachedFilename(file);
@@ -171,12 +209,14 @@ void HorizonsTranslation::loadData() {
                 "Cached file '{}' used for Horizon file '{}'", cachedFile, file
             ));
 
-            if (loadCachedFile(cachedFile)) {
+            try {
+                stores->emplace_back(cachedFile);
                 continue;
             }
-            else {
+            catch (const ghoul::RuntimeError& e) {
+                LINFO(std::format("Recreating cache: {}", e.message));
                 FileSys.cacheManager()->removeCacheFile(file);
-                // Intentional fall-through to the 'else' computation to generate the
+                // Intentional fall-through to the computation below to generate the
                 // cache file for the next run
             }
         }
@@ -186,135 +226,21 @@ void HorizonsTranslation::loadData() {
         LINFO(std::format("Loading Horizon file '{}'", file));
 
         HorizonsFile horizonsFile(file);
-        if (!readHorizonsTextFile(horizonsFile)) {
+        HorizonsResult result = readHorizonsFile(horizonsFile.file());
+        if (result.errorCode != HorizonsResultCode::Valid) {
+            horizonsFile.displayErrorMessage(result.errorCode);
+        }
+        if (result.errorCode != HorizonsResultCode::Valid || result.data.empty()) {
             LERROR(std::format("Could not read data from Horizons file '{}'", file));
-            return;
+            break;
         }
 
         LINFO("Saving cache");
-        saveCachedFile(cachedFile);
-    }
-}
-
-bool HorizonsTranslation::readHorizonsTextFile(HorizonsFile& horizonsFile) {
-    HorizonsResult result = readHorizonsFile(horizonsFile.file());
-    if (result.errorCode != HorizonsResultCode::Valid) {
-        horizonsFile.displayErrorMessage(result.errorCode);
-        return false;
+        HorizonsStore::write(cachedFile, result.data, result.hasVelocities);
+        stores->emplace_back(cachedFile);
     }
 
-    for (HorizonsKeyframe& keyframe : result.data) {
-        // Search if the keyframe already exist in the timeline
-        auto it = std::find_if(
-            _timeline.keyframes().begin(),
-            _timeline.keyframes().end(),
-            [keyframe](const Keyframe<glm::dvec3>& kf) {
-                return kf.timestamp == keyframe.time;
-            }
-        );
-
-        // If it doesn't exist in the timeline then add it, prevent duplicates
-        if (it == _timeline.keyframes().end()) {
-            _timeline.addKeyframe(keyframe.time, std::move(keyframe.position));
-        }
-    }
-    return true;
-}
-
-bool HorizonsTranslation::loadCachedFile(const std::filesystem::path& file) {
-    std::ifstream fileStream = std::ifstream(file, std::ifstream::binary);
-
-    if (!fileStream.good()) {
-        LERROR(std::format("Error opening file '{}' for loading cache file", file));
-        return false;
-    }
-
-    // Check the caching version
-    int8_t version = 0;
-    fileStream.read(reinterpret_cast<char*>(&version), sizeof(int8_t));
-    if (version != CurrentCacheVersion) {
-        LINFO("The format of the cached file has changed: deleting old cache");
-        fileStream.close();
-        FileSys.cacheManager()->removeCacheFile(file);
-        return false;
-    }
-
-    // Read how many keyframes to read
-    int32_t nKeyframes = 0;
-
-    fileStream.read(reinterpret_cast<char*>(&nKeyframes), sizeof(int32_t));
-    if (nKeyframes == 0) {
-        throw ghoul::RuntimeError("Error reading cache: No values were loaded");
-    }
-
-    // Read all data in one go
-    std::vector<CacheKeyframe> cacheKeyframes;
-    cacheKeyframes.resize(nKeyframes);
-    fileStream.read(
-        reinterpret_cast<char*>(cacheKeyframes.data()),
-        sizeof(CacheKeyframe) * nKeyframes
-    );
-
-    // Extract the data from the cache Keyframe vector
-    for (int i = 0; i < nKeyframes; i++) {
-        // Add keyframe in timeline
-        _timeline.addKeyframe(
-            cacheKeyframes[i].timestamp,
-            {
-                cacheKeyframes[i].position[0],
-                cacheKeyframes[i].position[1],
-                cacheKeyframes[i].position[2]
-            }
-        );
-    }
-
-    return fileStream.good();
-}
-
-void HorizonsTranslation::saveCachedFile(const std::filesystem::path& file) const {
-    std::ofstream fileStream = std::ofstream(file, std::ofstream::binary);
-    if (!fileStream.good()) {
-        LERROR(std::format("Error opening file '{}' for save cache file", file));
-        return;
-    }
-
-    // Write which version of caching that is used
-    fileStream.write(
-        reinterpret_cast<const char*>(&CurrentCacheVersion),
-        sizeof(int8_t)
-    );
-
-    // Write how many keyframes are to be written
-    int32_t nKeyframes = static_cast<int32_t>(_timeline.nKeyframes());
-    if (nKeyframes == 0) {
-        throw ghoul::RuntimeError("Error writing cache: No values were loaded");
-    }
-    fileStream.write(reinterpret_cast<const char*>(&nKeyframes), sizeof(int32_t));
-
-    // Transfer all data to a cache key frame vector, write it all in one go
-    std::deque<Keyframe<glm::dvec3>> keyframes = _timeline.keyframes();
-    std::vector<CacheKeyframe> cachKeyframes;
-    cachKeyframes.reserve(nKeyframes);
-    for (int i = 0; i < nKeyframes; i++) {
-        CacheKeyframe cacheKeyframe;
-        cacheKeyframe.timestamp = keyframes[i].timestamp;
-        cacheKeyframe.position[0] = keyframes[i].data.x;
-        cacheKeyframe.position[1] = keyframes[i].data.y;
-        cacheKeyframe.position[2] = keyframes[i].data.z;
-
-        cachKeyframes.push_back(cacheKeyframe);
-    }
-
-    // Write of entire vector will only work if the data is plain old data type, is_pod is
-    // deprecated in C++20 and replaced with both is_trivial and is_standard_layout
-    static_assert(std::is_trivial_v<CacheKeyframe>);
-    static_assert(std::is_standard_layout_v<CacheKeyframe>);
-
-    // Write data
-    fileStream.write(
-        reinterpret_cast<const char*>(cachKeyframes.data()),
-        sizeof(CacheKeyframe) * nKeyframes
-    );
+    _stores = std::move(stores);
 }
 
 } // namespace openspace
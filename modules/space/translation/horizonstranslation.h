@@ -27,16 +27,14 @@
 
 #include <openspace/scene/translation.h>
 
+#include <modules/space/horizonsstore.h>
 #include <openspace/properties/list/stringlistproperty.h>
-#include <openspace/util/timeline.h>
 #include <ghoul/lua/luastate.h>
-#include <array>
-#include <filesystem>
+#include <memory>
+#include <vector>
 
 namespace openspace {
 
-class HorizonsFile;
-
 /**
  * The HorizonsTranslation is based on text files generated from NASA JPL HORIZONS Website
  * (https://ssd.jpl.nasa.gov/horizons.cgi). The implementation supports both Vector and
@@ -45,13 +43,15 @@ class HorizonsFile;
  * In case of Vector table data the implementation expects a file with format:
  * TIME(JulianDayNumber = A.D. YYYY-MM-DD HH:MM:SS TDB)
  *   X(km) Y(km) Z(km)
+ *   VX(km/s) VY(km/s) VZ(km/s)
  * TIME - Only the "YYYY-MM-DD HH:MM:SS" part is of interest, the rest is ignored
  * X - X position in kilometers in Ecliptic J2000 reference frame
  * Y - Y position in kilometers in Ecliptic J2000 reference frame
  * Z - Z position in kilometers in Ecliptic J2000 reference frame
+ * VX, VY, VZ - Optional velocity in kilometers per second in the same reference frame
  * Changes required in the "Table Settings" for compatible data:
- *   1. Under "Select Output Quantities" choose option "Position components {x, y, z}
- *      only"
+ *   1. Under "Select Output Quantities" choose option "State vector {x, y, z, vx, vy,
+ *      vz}" or "Position components {x, y, z} only"
  *   2. Uncheck the "Vector labels" options
  *
  * In case of Observer table data the implementation expects a file with format:
@@ -64,29 +64,35 @@ class HorizonsFile;
  *      "Observer range & range-rate" and "Galactic longitude & latitude"
  *   2. Change "Range units" to "kilometers (km)" instead of "astronomical units (au)"
  *   3. Check the "Suppress range-rate" option
+ *
+ * If the Vector table contains the velocities, the positions are interpolated with a
+ * cubic Hermite spline, which requires far fewer samples for the same accuracy than the
+ * linear interpolation that is used otherwise.
+ *
+ * Each file is converted into a HorizonsStore in the cache, which is memory mapped, so
+ * long ephemerides do not have to be resident in memory. The resolution of the store
+ * that is used is chosen from the simulation time that passes between two frames.
  */
 class HorizonsTranslation : public Translation {
 public:
     explicit HorizonsTranslation(const ghoul::Dictionary& dictionary);
 
     glm::dvec3 position(const UpdateData& data) const override;
+    bool isThreadSafe() const override;
+    PositionFunction concurrentPositionFunction() const override;
 
     static openspace::Documentation Documentation();
 
 private:
-    struct CacheKeyframe {
-        double timestamp;
-        std::array<double, 3> position;
-    };
-
     void loadData();
-    bool readHorizonsTextFile(HorizonsFile& horizonsFile);
-    bool loadCachedFile(const std::filesystem::path& file);
-    void saveCachedFile(const std::filesystem::path& file) const;
 
     StringListProperty _horizonsFiles;
     ghoul::lua::LuaState _state;
-    Timeline<glm::dvec3> _timeline;
+
+    /// The stores of all loaded files in the order of the files. The list is replaced as
+    /// a whole when the files change, so that functions returned by
+    /// #concurrentPositionFunction can keep using the previous one
+    std::shared_ptr<const std::vector<HorizonsStore>> _stores;
 };
 
 } // namespace openspace
@@ -156,10 +156,16 @@ SpiceTranslation::SpiceTranslation(const ghoul::Dictionary& dictionary)
         else {
             _fixedEphemerisTime = SpiceManager::ref().ephemerisTimeFromDate(_fixedDate);
         }
+        requireUpdate();
+        notifyObservers();
     });
     _fixedDate = p.fixedDate.value_or(_fixedDate);
     addProperty(_fixedDate);
 
+    _timeOffset.onChange([this]() {
+        requireUpdate();
+        notifyObservers();
+    });
     _timeOffset = p.timeOffset.value_or(_timeOffset);
     addProperty(_timeOffset);
 
@@ -194,4 +200,25 @@ glm::dvec3 SpiceTranslation::position(const UpdateData& data) const {
     ) * 1000.0;
 }
 
+Translation::PositionFunction SpiceTranslation::concurrentPositionFunction() const {
+    // All calls into the SpiceManager are serialized internally, so it is enough to
+    // capture copies of the parameters to be independent of later property changes
+    return [target = _cachedTarget, observer = _cachedObserver, frame = _cachedFrame,
+            fixedTime = _fixedEphemerisTime, offset = static_cast<double>(_timeOffset)]
+        (std::span<const double> times, std::span<glm::dvec3> positions)
+    {
+        for (size_t i = 0; i < times.size(); i++) {
+            double lightTime = 0.0;
+            positions[i] = SpiceManager::ref().targetPosition(
+                target,
+                observer,
+                frame,
+                {},
+                fixedTime.value_or(times[i]) + offset,
+                lightTime
+            ) * 1000.0;
+        }
+    };
+}
+
 } // namespace openspace
@@ -38,6 +38,7 @@ public:
     explicit SpiceTranslation(const ghoul::Dictionary& dictionary);
 
     glm::dvec3 position(const UpdateData& data) const override;
+    PositionFunction concurrentPositionFunction() const override;
 
     static openspace::Documentation Documentation();
 
@@ -30,6 +30,7 @@
 #include <openspace/engine/globals.h>
 #include <openspace/engine/moduleengine.h>
 #include <openspace/rendering/renderengine.h>
+#include <openspace/util/spiceservice.h>
 #include <openspace/util/updatestructures.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/format.h>
@@ -42,6 +43,7 @@
 #include <optional>
 #include <algorithm>
 #include <cstddef>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <memory>
@@ -523,10 +525,68 @@ void RenderableFov::computeIntercepts(double time, const std::string& target,
         }
     };
 
+    // If the target is in the field of view, the surface intercepts of all boundary
+    // vectors and of the interpolated vectors between them are handed to the
+    // SpiceService as a single batch. The first entries of the batch are the boundary
+    // vectors, followed by 'InterpolationSteps' vectors for each of the boundaries
+    const size_t nBounds = _instrument.bounds.size();
+    std::vector<glm::dvec3> probes;
+    std::vector<SpiceManager::SurfaceInterceptResult> intercepts;
+    glm::dmat3 toInstrumentFrame = glm::dmat3(1.0);
+    if (isInFov) {
+        probes.reserve(nBounds + nBounds * InterpolationSteps);
+        probes.insert(probes.end(), _instrument.bounds.begin(), _instrument.bounds.end());
+        for (size_t i = 0; i < nBounds; i++) {
+            // Wrap around the array index to 0
+            const size_t j = (i == nBounds - 1) ? 0 : i + 1;
+            for (size_t m = 0; m < InterpolationSteps; m++) {
+                const double t = static_cast<double>(m) / InterpolationSteps;
+                probes.push_back(
+                    glm::mix(_instrument.bounds[i], _instrument.bounds[j], t)
+                );
+            }
+        }
+
+        const std::pair<std::string, bool> ref = makeBodyFixedReferenceFrame(
+            _instrument.referenceFrame
+        );
+        std::future<std::vector<SpiceManager::SurfaceInterceptResult>> results =
+            SpiceManager::ref().service().surfaceIntercepts(
+                target,
+                _instrument.spacecraft,
+                _instrument.name,
+                ref.first,
+                _instrument.aberrationCorrection,
+                time,
+                probes
+            );
+
+        // If we had to convert the reference frame into a body-fixed frame, we need to
+        // apply this change to the intercepts. The conversion is the same for all of them
+        // and is computed while the worker is busy with the batch
+        if (ref.second) {
+            toInstrumentFrame = SpiceManager::ref().frameTransformationMatrix(
+                ref.first,
+                _instrument.referenceFrame,
+                time
+            );
+        }
+        intercepts = results.get();
+    }
+
+    // Computes the intercept vector in meters in the reference frame of the instrument
+    // that contains a standoff distance offset, as we would otherwise end up *exactly* on
+    // the surface. SPICE uses a KM scale
+    auto interceptVector =
+        [&](const SpiceManager::SurfaceInterceptResult& r) -> glm::dvec3
+    {
+        return toInstrumentFrame * r.surfaceVector * 1000.0 * _standOffDistance.value();
+    };
+
     // First we fill the field-of-view bounds array by testing each bounds vector against
     // the object. We need to test it against the object (rather than using a fixed
     // distance) as the field of view rendering should stop at the surface
-    for (size_t i = 0; i < _instrument.bounds.size(); i++) {
+    for (size_t i = 0; i < nBounds; i++) {
         const glm::dvec3& bound = _instrument.bounds[i];
 
         RenderInformation::VBOData& first = _fieldOfViewBounds.data[2 * i];
@@ -549,56 +609,23 @@ void RenderableFov::computeIntercepts(double time, const std::string& target,
                 .color = RenderInformation::VertexColorTypeDefaultEnd
             };
         }
-        else {
-            // The target is in the field of view, but not the entire field of view has to
-            // be filled by the target
-            const std::pair<std::string, bool> ref = makeBodyFixedReferenceFrame(
-                _instrument.referenceFrame
-            );
+        else if (intercepts[i].interceptFound) {
+            // The target is in the field of view and this point intersected the target
+            first.color = RenderInformation::VertexColorTypeIntersectionStart;
 
-            SpiceManager::SurfaceInterceptResult r = SpiceManager::ref().surfaceIntercept(
-                target,
-                _instrument.spacecraft,
-                _instrument.name,
-                ref.first,
-                _instrument.aberrationCorrection,
-                time,
-                bound
-            );
-
-            if (r.interceptFound) {
-                // This point intersected the target
-                first.color = RenderInformation::VertexColorTypeIntersectionStart;
-
-                // If we had to convert the reference frame into a body-fixed frame, we
-                // need to apply this change here
-                if (ref.second) {
-                    r.surfaceVector = SpiceManager::ref().frameTransformationMatrix(
-                        ref.first,
-                        _instrument.referenceFrame,
-                        time
-                    ) * r.surfaceVector;
-                }
-
-                // Convert the KM scale that SPICE uses to meter
-                glm::vec3 srfVec = r.surfaceVector * 1000.0;
-
-                // Standoff distance, we would otherwise end up *exactly* on the surface
-                srfVec *= _standOffDistance.value();
-
-                second = {
-                    .position = { srfVec.x, srfVec.y, srfVec.z },
-                    .color = RenderInformation::VertexColorTypeIntersectionEnd
-                };
-            }
-            else {
-                // This point did not intersect the target though others did
-                const glm::vec3 o = orthogonalProjection(bound, time, target);
-                second = {
-                    .position = { o.x, o.y, o.z },
-                    .color = RenderInformation::VertexColorTypeInFieldOfView
-                };
-            }
+            const glm::vec3 srfVec = interceptVector(intercepts[i]);
+            second = {
+                .position = { srfVec.x, srfVec.y, srfVec.z },
+                .color = RenderInformation::VertexColorTypeIntersectionEnd
+            };
+        }
+        else {
+            // This point did not intersect the target though others did
+            const glm::vec3 o = orthogonalProjection(bound, time, target);
+            second = {
+                .position = { o.x, o.y, o.z },
+                .color = RenderInformation::VertexColorTypeInFieldOfView
+            };
         }
     }
 
@@ -619,7 +646,7 @@ void RenderableFov::computeIntercepts(double time, const std::string& target,
 
     // An early out for when the target is not in field of view
     if (!isInFov) {
-        for (size_t i = 0; i < _instrument.bounds.size(); i++) {
+        for (size_t i = 0; i < nBounds; i++) {
             // If none of the points are able to intersect with the target, we can just
             // copy the values from the field-of-view boundary. So we take each second
             // item (the first one is (0,0,0)) and replicate it 'InterpolationSteps' times
@@ -628,72 +655,15 @@ void RenderableFov::computeIntercepts(double time, const std::string& target,
     }
     else {
         // At least one point will intersect
-        for (size_t i = 0; i < _instrument.bounds.size(); i++) {
-            // Wrap around the array index to 0
-            const size_t j = (i == _instrument.bounds.size() - 1) ? 0 : i + 1;
-
-            const glm::dvec3& iBound = _instrument.bounds[i];
-            const glm::dvec3& jBound = _instrument.bounds[j];
-
-            auto intercepts = [&](const glm::dvec3& probe) -> bool {
-                return SpiceManager::ref().surfaceIntercept(
-                    target,
-                    _instrument.spacecraft,
-                    _instrument.name,
-                    makeBodyFixedReferenceFrame(_instrument.referenceFrame).first,
-                    _instrument.aberrationCorrection,
-                    time,
-                    probe
-                ).interceptFound;
+        for (size_t i = 0; i < indexForBounds(nBounds); i++) {
+            const SpiceManager::SurfaceInterceptResult& r = intercepts[nBounds + i];
+            const glm::vec3 p = r.interceptFound ?
+                interceptVector(r) :
+                orthogonalProjection(probes[nBounds + i], time, target);
+            _orthogonalPlane.data[i] = {
+                .position = { p.x, p.y, p.z },
+                .color = RenderInformation::VertexColorTypeSquare
             };
-
-            // Computes the intercept vector between the 'probe' and the target the
-            // intercept vector is in meter and contains a standoff distance offset
-            auto interceptVector = [&](const glm::dvec3& probe) -> glm::dvec3 {
-                auto ref = makeBodyFixedReferenceFrame(_instrument.referenceFrame);
-                SpiceManager::SurfaceInterceptResult r =
-                    SpiceManager::ref().surfaceIntercept(
-                        target,
-                        _instrument.spacecraft,
-                        _instrument.name,
-                        ref.first,
-                        _instrument.aberrationCorrection,
-                        time,
-                        probe
-                    );
-
-                if (ref.second) {
-                    r.surfaceVector = SpiceManager::ref().frameTransformationMatrix(
-                        ref.first,
-                        _instrument.referenceFrame,
-                        time
-                    ) * r.surfaceVector;
-                }
-
-                // Standoff distance, we would otherwise end up *exactly* on the surface.
-                // Convert the KM scale that SPICE uses to meter
-                return r.surfaceVector * 1000.0 * _standOffDistance.value();
-            };
-
-            for (size_t m = 0; m < InterpolationSteps; m++) {
-                const double t = static_cast<double>(m) / (InterpolationSteps);
-                const glm::dvec3 tBound = glm::mix(iBound, jBound, t);
-
-                if (intercepts(tBound)) {
-                    const glm::vec3 icpt = interceptVector(tBound);
-                    _orthogonalPlane.data[indexForBounds(i) + m] = {
-                        .position = { icpt.x, icpt.y, icpt.z },
-                        .color = RenderInformation::VertexColorTypeSquare
-                    };
-                }
-                else {
-                    const glm::vec3 o = orthogonalProjection(tBound, time, target);
-                    _orthogonalPlane.data[indexForBounds(i) + m] = {
-                        .position = { o.x, o.y, o.z },
-                        .color = RenderInformation::VertexColorTypeSquare
-                    };
-                }
-            }
         }
     }
 
@@ -76,6 +76,7 @@ public:
     void update();
 
     void preSync(bool isMaster) override;
+    bool isSnapshot() const override;
     void encode(SyncBuffer* syncBuffer) override;
     void decode(SyncBuffer* syncBuffer) override;
     void postSync(bool isMaster) override;
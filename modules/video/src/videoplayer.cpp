@@ -790,6 +790,10 @@ void VideoPlayer::preSync(bool isMaster) {
     _correctPlaybackTime = isMaster ? _currentVideoTime : -1.0;
 }
 
+bool VideoPlayer::isSnapshot() const {
+    return true;
+}
+
 void VideoPlayer::encode(SyncBuffer* syncBuffer) {
     syncBuffer->encode(_correctPlaybackTime);
 }
@@ -24,7 +24,10 @@
 
 #include <openspace/data/csvloader.h>
 
+#include <openspace/engine/globals.h>
+#include <openspace/util/memorymappedfile.h>
 #include <openspace/util/progressbar.h>
+#include <openspace/util/taskscheduler.h>
 #include <ghoul/format.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/assert.h>
@@ -37,6 +40,8 @@
 #include <limits>
 #include <fstream>
 #include <functional>
+#include <iterator>
+#include <locale>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -44,6 +49,301 @@
 
 namespace {
     constexpr std::string_view _loggerCat = "DataLoader: CSV";
+
+    using namespace openspace::dataloader;
+
+    // Describes how each column of the CSV file is used, as determined by the column
+    // names in the header and the data mapping
+    struct ColumnLayout {
+        enum class Role {
+            Data,
+            X,
+            Y,
+            Z,
+            Name,
+            Skip
+        };
+
+        Role role(size_t column) const {
+            // Columns that are not named in the header are treated as regular data
+            return column < roles.size() ? roles[column] : Role::Data;
+        }
+
+        std::vector<Role> roles;
+        std::optional<size_t> textureColumn;
+        int nDataColumns = 0;
+    };
+
+    ColumnLayout analyzeColumns(const std::vector<std::string>& columns,
+                                const std::optional<DataMapping>& specs, Dataset& res,
+                                const std::filesystem::path& filePath)
+    {
+        ColumnLayout layout;
+        layout.roles.resize(columns.size(), ColumnLayout::Role::Data);
+
+        bool hasX = false;
+        bool hasY = false;
+        bool hasZ = false;
+
+        const bool hasExcludeColumns = specs.has_value() && specs->hasExcludeColumns();
+        for (size_t i = 0; i < columns.size(); i++) {
+            const std::string& col = columns[i];
+
+            if (isPositionColumn(col, specs)) {
+                if (isColumnX(col, specs)) {
+                    layout.roles[i] = ColumnLayout::Role::X;
+                    hasX = true;
+                }
+                if (isColumnY(col, specs)) {
+                    layout.roles[i] = ColumnLayout::Role::Y;
+                    hasY = true;
+                }
+                if (isColumnZ(col, specs)) {
+                    layout.roles[i] = ColumnLayout::Role::Z;
+                    hasZ = true;
+                }
+            }
+            else if (isNameColumn(col, specs)) {
+                layout.roles[i] = ColumnLayout::Role::Name;
+            }
+            else if (hasExcludeColumns && specs->isExcludeColumn(col)) {
+                layout.roles[i] = ColumnLayout::Role::Skip;
+            }
+            else {
+                // Note that the texture column is also a regular column. Just save the
+                // index
+                if (isTextureColumn(col, specs)) {
+                    res.textureDataIndex = layout.nDataColumns;
+                    layout.textureColumn = i;
+                }
+
+                res.variables.push_back({
+                    .index = layout.nDataColumns,
+                    .name = col
+                });
+                layout.nDataColumns++;
+            }
+        }
+
+        // Some errors / warnings
+        if (specs.has_value()) {
+            bool hasAllProvided = specs->checkIfAllProvidedColumnsExist(columns);
+            if (!hasAllProvided) {
+                LERROR(std::format(
+                    "Error loading data file {}. Not all columns provided in data "
+                    "mapping exists in dataset", filePath
+                ));
+            }
+        }
+
+        bool hasProvidedTextureFile = specs.has_value() && specs->textureMap.has_value();
+        bool hasTextureIndex = (res.textureDataIndex >= 0);
+
+        if (hasProvidedTextureFile && !hasTextureIndex &&
+            !specs->textureColumn.has_value())
+        {
+            throw ghoul::RuntimeError(std::format(
+                "Error loading data file {}. No texture column was specified in the data "
+                "mapping", filePath
+            ));
+        }
+        if (!hasProvidedTextureFile && hasTextureIndex) {
+            throw ghoul::RuntimeError(std::format(
+                "Error loading data file {}. Missing texture map file location in data "
+                "mapping", filePath
+            ));
+        }
+
+        if (!hasX || !hasY || !hasZ) {
+            // One or more position columns weren't read
+            LERROR(std::format(
+                "Error loading data file '{}'. Missing X, Y or Z position column",
+                filePath
+            ));
+        }
+
+        return layout;
+    }
+
+    void storeValue(Dataset::Entry& entry, ColumnLayout::Role role,
+                    std::string_view strValue, float value)
+    {
+        switch (role) {
+            case ColumnLayout::Role::X:
+                entry.position.x = value;
+                break;
+            case ColumnLayout::Role::Y:
+                entry.position.y = value;
+                break;
+            case ColumnLayout::Role::Z:
+                entry.position.z = value;
+                break;
+            case ColumnLayout::Role::Name:
+                // Note that were we use the original string value, rather than the
+                // converted one
+                entry.comment = std::string(strValue);
+                break;
+            case ColumnLayout::Role::Data:
+                entry.data.push_back(value);
+                break;
+            case ColumnLayout::Role::Skip:
+                break;
+        }
+    }
+
+    // Load the textures. Skip textures that are not included in the dataset
+    void loadTextures(Dataset& res, const std::optional<DataMapping>& specs,
+                      const std::set<int>& uniqueTextureIndicesInData)
+    {
+        const bool hasProvidedTextureFile =
+            specs.has_value() && specs->textureMap.has_value();
+        if (!hasProvidedTextureFile) {
+            return;
+        }
+
+        const std::filesystem::path path = *specs->textureMap;
+        if (!std::filesystem::is_regular_file(path)) {
+            throw ghoul::RuntimeError(std::format(
+                "Failed to open texture map file {}", path
+            ));
+        }
+        res.textures = csv::loadTextureMapFile(path, uniqueTextureIndicesInData);
+    }
+
+    std::string_view trimLineEnding(std::string_view line) {
+        // Guard against wrong line endings (copying files between operating systems)
+        // causes lines to have a final \r
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        return line;
+    }
+
+    // Splits a single line of a CSV file into its comma-separated values. Commas inside
+    // double quotes are not treated as separators and the surrounding quotes are removed
+    // from the value. The strings in `values` are reused between calls to avoid
+    // allocating new memory for each line
+    void splitLine(std::string_view line, std::vector<std::string>& values) {
+        size_t nValues = 0;
+        auto nextValue = [&values, &nValues]() -> std::string& {
+            if (nValues == values.size()) {
+                values.emplace_back();
+            }
+            std::string& v = values[nValues];
+            v.clear();
+            nValues++;
+            return v;
+        };
+
+        std::string* current = &nextValue();
+        bool isInsideQuotes = false;
+        for (const char c : line) {
+            if (c == '"') {
+                isInsideQuotes = !isInsideQuotes;
+            }
+            else if (c == ',' && !isInsideQuotes) {
+                current = &nextValue();
+            }
+            else {
+                current->push_back(c);
+            }
+        }
+
+        values.resize(nValues);
+    }
+
+    // Reads the float value at the beginning of `str` independent of the current locale.
+    // Leading whitespace and a leading '+' are skipped, trailing characters that are not
+    // part of the number are ignored. Values that are not finite numbers return NaN
+    float parseFloat(std::string_view str) {
+        const size_t begin = str.find_first_not_of(" \t");
+        if (begin == std::string_view::npos) {
+            return std::numeric_limits<float>::quiet_NaN();
+        }
+        str.remove_prefix(begin);
+        if (str.size() > 1 && str[0] == '+' && str[1] != '-') {
+            str.remove_prefix(1);
+        }
+
+        float value = 0.f;
+#ifdef __cpp_lib_to_chars
+        const std::from_chars_result res = std::from_chars(
+            str.data(),
+            str.data() + str.size(),
+            value
+        );
+        if (res.ec != std::errc() || !std::isfinite(value)) {
+            return std::numeric_limits<float>::quiet_NaN();
+        }
+#else // ^^^^ __cpp_lib_to_chars // !__cpp_lib_to_chars vvvv
+        // Some standard libraries are missing floating point support for
+        // std::from_chars
+        std::istringstream stream = std::istringstream(std::string(str));
+        stream.imbue(std::locale::classic());
+        stream >> value;
+        if (stream.fail() || !std::isfinite(value)) {
+            return std::numeric_limits<float>::quiet_NaN();
+        }
+#endif // __cpp_lib_to_chars
+        return value;
+    }
+
+    struct ChunkResult {
+        std::vector<Dataset::Entry> entries;
+        float maxPositionComponent = 0.f;
+        std::set<int> textureIndices;
+    };
+
+    ChunkResult parseChunk(std::string_view chunk, const ColumnLayout& layout) {
+        ChunkResult res;
+
+        std::vector<std::string> values;
+        values.reserve(layout.roles.size());
+
+        size_t offset = 0;
+        while (offset < chunk.size()) {
+            const size_t newline = chunk.find('\n', offset);
+            const size_t end =
+                (newline == std::string_view::npos) ? chunk.size() : newline;
+            const std::string_view line = trimLineEnding(
+                chunk.substr(offset, end - offset)
+            );
+            offset = end + 1;
+
+            if (line.empty()) {
+                continue;
+            }
+
+            splitLine(line, values);
+
+            Dataset::Entry entry;
+            entry.data.reserve(layout.nDataColumns);
+
+            for (size_t i = 0; i < values.size(); i++) {
+                const ColumnLayout::Role role = layout.role(i);
+                if (role == ColumnLayout::Role::Skip) {
+                    continue;
+                }
+
+                const float value = parseFloat(values[i]);
+                storeValue(entry, role, values[i], value);
+
+                if (layout.textureColumn.has_value() && i == *layout.textureColumn) {
+                    res.textureIndices.emplace(static_cast<int>(value));
+                }
+            }
+
+            const glm::vec3 positive = glm::abs(entry.position);
+            res.maxPositionComponent = std::max(
+                res.maxPositionComponent,
+                glm::compMax(positive)
+            );
+
+            res.entries.push_back(std::move(entry));
+        }
+
+        return res;
+    }
 } // namespace
 
 namespace openspace::dataloader::csv {
@@ -87,89 +387,7 @@ Dataset loadCsvFile(std::filesystem::path filePath, std::optional<DataMapping> s
 
     // First row is the column names
     const std::vector<std::string>& columns = rows.front();
-
-    std::optional<size_t> xColumn;
-    std::optional<size_t> yColumn;
-    std::optional<size_t> zColumn;
-    std::optional<size_t> nameColumn;
-    std::optional<size_t> textureColumn;
-
-    int nDataColumns = 0;
-    const bool hasExcludeColumns = specs.has_value() && specs->hasExcludeColumns();
-    std::vector<size_t> skipColumns;
-    if (hasExcludeColumns) {
-        skipColumns.reserve((*specs).excludeColumns.size());
-    }
-
-    for (size_t i = 0; i < columns.size(); i++) {
-        const std::string& col = columns[i];
-
-        if (isPositionColumn(col, specs)) {
-            if (isColumnX(col, specs)) {
-                xColumn = i;
-            }
-            if (isColumnY(col, specs)) {
-                yColumn = i;
-            }
-            if (isColumnZ(col, specs)) {
-                zColumn = i;
-            }
-        }
-        else if (isNameColumn(col, specs)) {
-            nameColumn = i;
-        }
-        else if (hasExcludeColumns && specs->isExcludeColumn(col)) {
-            skipColumns.push_back(i);
-            continue;
-        }
-        else {
-            // Note that the texture column is also a regular column. Just save the index
-            if (isTextureColumn(col, specs)) {
-                res.textureDataIndex = nDataColumns;
-                textureColumn = i;
-            }
-
-            res.variables.push_back({
-                .index = nDataColumns,
-                .name = col
-            });
-            nDataColumns++;
-        }
-    }
-
-    // Some errors / warnings
-    if (specs.has_value()) {
-        bool hasAllProvided = specs->checkIfAllProvidedColumnsExist(columns);
-        if (!hasAllProvided) {
-            LERROR(std::format(
-                "Error loading data file {}. Not all columns provided in data mapping "
-                "exists in dataset", filePath
-            ));
-        }
-    }
-
-    bool hasProvidedTextureFile = specs.has_value() && specs->textureMap.has_value();
-    bool hasTextureIndex = (res.textureDataIndex >= 0);
-
-    if (hasProvidedTextureFile && !hasTextureIndex && !specs->textureColumn.has_value()) {
-        throw ghoul::RuntimeError(std::format(
-            "Error loading data file {}. No texture column was specified in the data "
-            "mapping", filePath
-        ));
-    }
-    if (!hasProvidedTextureFile && hasTextureIndex) {
-        throw ghoul::RuntimeError(std::format(
-            "Error loading data file {}. Missing texture map file location in data "
-            "mapping", filePath
-        ));
-    }
-
-    if (!xColumn.has_value() || !yColumn.has_value() || !zColumn.has_value()) {
-        // One or more position columns weren't read
-        LERROR(std::format(
-            "Error loading data file '{}'. Missing X, Y or Z position column", filePath
-        ));
-    }
+    const ColumnLayout layout = analyzeColumns(columns, specs, res, filePath);
 
     LINFO(std::format("Loading {} rows with {} columns", rows.size(), columns.size()));
     ProgressBar progress = ProgressBar(static_cast<int>(rows.size()));
@@ -181,14 +399,11 @@ Dataset loadCsvFile(std::filesystem::path filePath, std::optional<DataMapping> s
         const std::vector<std::string>& row = rows[rowIdx];
 
         Dataset::Entry entry;
-        entry.data.reserve(nDataColumns);
+        entry.data.reserve(layout.nDataColumns);
 
         for (size_t i = 0; i < row.size(); i++) {
-            // Check if column should be excluded. Note that list of indices is sorted so
-            // we can do a binary search
-            if (hasExcludeColumns &&
-                std::binary_search(skipColumns.begin(), skipColumns.end(), i))
-            {
+            const ColumnLayout::Role role = layout.role(i);
+            if (role == ColumnLayout::Role::Skip) {
                 continue;
             }
 
@@ -196,26 +411,9 @@ Dataset loadCsvFile(std::filesystem::path filePath, std::optional<DataMapping> s
 
             // For now, all values are converted to float
             const float value = readFloatData(strValue);
+            storeValue(entry, role, strValue, value);
 
-            if (xColumn.has_value() && i == *xColumn) {
-                entry.position.x = value;
-            }
-            else if (yColumn.has_value() && i == *yColumn) {
-                entry.position.y = value;
-            }
-            else if (zColumn.has_value() && i == *zColumn) {
-                entry.position.z = value;
-            }
-            else if (nameColumn.has_value() && i == *nameColumn) {
-                // Note that were we use the original stirng value, rather than the
-                // converted one
-                entry.comment = strValue;
-            }
-            else {
-                entry.data.push_back(value);
-            }
-
-            if (textureColumn.has_value() && i == *textureColumn) {
+            if (layout.textureColumn.has_value() && i == *layout.textureColumn) {
                 uniqueTextureIndicesInData.emplace(static_cast<int>(value));
             }
         }
@@ -231,17 +429,81 @@ Dataset loadCsvFile(std::filesystem::path filePath, std::optional<DataMapping> s
         progress.print(static_cast<int>(rowIdx + 1));
     }
 
-    // Load the textures. Skip textures that are not included in the dataset
-    if (hasProvidedTextureFile) {
-        const std::filesystem::path path = *specs->textureMap;
-        if (!std::filesystem::is_regular_file(path)) {
-            throw ghoul::RuntimeError(std::format(
-                "Failed to open texture map file {}", path
-            ));
+    loadTextures(res, specs, uniqueTextureIndicesInData);
+
+    return res;
+}
+
+Dataset loadCsvFileParallel(std::filesystem::path filePath,
+                            std::optional<DataMapping> specs, size_t minimumChunkSize)
+{
+    ghoul_assert(std::filesystem::exists(filePath), "File must exist");
+    ghoul_assert(minimumChunkSize > 0, "Chunk size must be positive");
+
+    LDEBUG("Parsing CSV file");
+
+    const MemoryMappedFile file = MemoryMappedFile(filePath);
+    const std::string_view content = file.view();
+
+    // The first non-empty line contains the column names
+    std::vector<std::string> columns;
+    size_t offset = 0;
+    while (offset < content.size() && columns.empty()) {
+        const size_t newline = content.find('\n', offset);
+        const size_t end = (newline == std::string_view::npos) ? content.size() : newline;
+        const std::string_view line = trimLineEnding(
+            content.substr(offset, end - offset)
+        );
+        if (!line.empty()) {
+            splitLine(line, columns);
         }
-        res.textures = loadTextureMapFile(path, uniqueTextureIndicesInData);
+        offset = end + 1;
     }
 
+    const std::string_view data = content.substr(std::min(offset, content.size()));
+    if (columns.empty() || data.find_first_not_of("\r\n") == std::string_view::npos) {
+        LWARNING(std::format(
+            "Error loading data file '{}'. No data items read", filePath
+        ));
+        return Dataset();
+    }
+
+    Dataset res;
+    const ColumnLayout layout = analyzeColumns(columns, specs, res, filePath);
+
+    LINFO(std::format("Loading {} bytes with {} columns", data.size(), columns.size()));
+
+    // Chunks are handed to the task scheduler, so there can be more chunks than worker
+    // threads. The surplus chunks balance the load if some chunks are faster to parse
+    const size_t nChunks = std::max(data.size() / minimumChunkSize, size_t(1));
+    const std::vector<std::string_view> chunks = splitAtLineBoundaries(data, nChunks);
+
+    std::vector<ChunkResult> results = std::vector<ChunkResult>(chunks.size());
+    global::taskScheduler->parallelFor(
+        chunks.size(),
+        [&](size_t i) { results[i] = parseChunk(chunks[i], layout); },
+        TaskScheduler::Priority::High
+    );
+
+    // Concatenate the chunks in order so that the entries keep the order of the file
+    size_t nEntries = 0;
+    for (const ChunkResult& r : results) {
+        nEntries += r.entries.size();
+    }
+    res.entries.reserve(nEntries);
+
+    std::set<int> uniqueTextureIndicesInData;
+    for (ChunkResult& r : results) {
+        res.maxPositionComponent = std::max(
+            res.maxPositionComponent,
+            r.maxPositionComponent
+        );
+        std::move(r.entries.begin(), r.entries.end(), std::back_inserter(res.entries));
+        uniqueTextureIndicesInData.merge(r.textureIndices);
+    }
+
+    loadTextures(res, specs, uniqueTextureIndicesInData);
+
     return res;
 }
 
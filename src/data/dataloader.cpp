@@ -36,12 +36,15 @@
 #include <ghoul/misc/profiling.h>
 #include <ghoul/misc/stringhelper.h>
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <functional>
 #include <limits>
+#include <memory>
+#include <span>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -53,6 +56,50 @@ namespace {
     constexpr int8_t LabelCacheFileVersion = 11;
     constexpr int8_t ColorCacheFileVersion = 11;
 
+    // The columnar cache files start with this identifier followed by the schema version.
+    // Increase the version whenever the layout of the file changes
+    constexpr std::array<char, 8> ColumnarCacheIdentifier = {
+        'O', 'S', 'C', 'O', 'L', 'D', 'A', 'T'
+    };
+    constexpr uint32_t ColumnarCacheFileVersion = 1;
+
+    // All sections of a columnar cache file start at a multiple of this value so that
+    // each column covers its own set of pages
+    constexpr uint64_t ColumnarCacheAlignment = 4096;
+
+    struct ColumnarCacheHeader {
+        std::array<char, 8> identifier = ColumnarCacheIdentifier;
+        uint32_t version = ColumnarCacheFileVersion;
+        uint32_t nColumns = 0;
+        uint64_t fileHash = 0;
+        uint64_t nEntries = 0;
+        int32_t textureDataIndex = -1;
+        int32_t orientationDataIndex = -1;
+        float maxPositionComponent = 0.f;
+        uint32_t padding = 0;
+
+        // Offsets of the sections, measured in bytes from the beginning of the file
+        uint64_t metadataOffset = 0;
+        uint64_t metadataSize = 0;
+        uint64_t positionsOffset = 0;
+        uint64_t columnTableOffset = 0;
+        // The comment offsets are 0 if none of the entries has a comment
+        uint64_t hasCommentOffset = 0;
+        uint64_t commentOffsetsOffset = 0;
+        uint64_t commentDataOffset = 0;
+        uint64_t commentDataSize = 0;
+    };
+    static_assert(std::is_trivially_copyable_v<ColumnarCacheHeader>);
+
+    void writePadding(std::ofstream& file) {
+        const uint64_t pos = static_cast<uint64_t>(file.tellp());
+        const uint64_t padding =
+            (ColumnarCacheAlignment - pos % ColumnarCacheAlignment) %
+            ColumnarCacheAlignment;
+        const std::array<char, ColumnarCacheAlignment> zeros = {};
+        file.write(zeros.data(), padding);
+    }
+
     template <typename T, typename U>
     void checkSize(U value, std::string_view message) {
         if (value > std::numeric_limits<U>::max()) {
@@ -126,7 +173,9 @@ namespace {
 namespace openspace::dataloader {
 
 namespace data {
-    Dataset loadFile(std::filesystem::path path, std::optional<DataMapping> specs) {
+    Dataset loadFile(std::filesystem::path path, std::optional<DataMapping> specs,
+                     LoadMode mode)
+    {
         ZoneScoped;
 
         ghoul_assert(std::filesystem::exists(path), "File must exist");
@@ -138,12 +187,18 @@ namespace data {
 
         const std::string extension = ghoul::toLowerCase(path.extension().string());
 
+        const bool isParallel = (mode == LoadMode::Parallel);
+
         Dataset res;
         if (extension == ".csv") {
-            res = csv::loadCsvFile(path, std::move(specs));
+            res = isParallel ?
+                csv::loadCsvFileParallel(path, std::move(specs)) :
+                csv::loadCsvFile(path, std::move(specs));
         }
         else if (extension == ".speck") {
-            res = speck::loadSpeckFile(path, std::move(specs));
+            res = isParallel ?
+                speck::loadSpeckFileParallel(path, std::move(specs)) :
+                speck::loadSpeckFile(path, std::move(specs));
         }
         else {
             LERRORC("DataLoader", std::format(
@@ -420,16 +475,372 @@ namespace data {
     }
 
     Dataset loadFileWithCache(std::filesystem::path path,
-                              std::optional<DataMapping> specs)
+                              std::optional<DataMapping> specs, LoadMode mode)
     {
         return internalLoadFileWithCache<Dataset>(
             std::move(path),
             std::move(specs),
-            &loadFile,
+            [mode](std::filesystem::path p, std::optional<DataMapping> s) {
+                return loadFile(std::move(p), std::move(s), mode);
+            },
             &loadCachedFile,
             &saveCachedFile
         );
     }
+
+    uint64_t fileMetadataHash(const std::filesystem::path& path,
+                              const std::optional<DataMapping>& specs)
+    {
+        // 64-bit FNV-1a hash over all properties that identify the file contents
+        uint64_t hash = 14695981039346656037ULL;
+        auto combine = [&hash](const void* data, size_t size) {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; i++) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ULL;
+            }
+        };
+
+        const uint64_t size = static_cast<uint64_t>(std::filesystem::file_size(path));
+        combine(&size, sizeof(uint64_t));
+
+        const int64_t time = static_cast<int64_t>(
+            std::filesystem::last_write_time(path).time_since_epoch().count()
+        );
+        combine(&time, sizeof(int64_t));
+
+        if (specs.has_value()) {
+            const std::string info = generateHashString(*specs);
+            combine(info.data(), info.size());
+        }
+
+        return hash;
+    }
+
+    std::optional<ColumnarDataset> loadColumnarCachedFile(
+                                                        const std::filesystem::path& path,
+                                                                        uint64_t fileHash)
+    {
+        ZoneScoped;
+
+        if (!std::filesystem::is_regular_file(path)) {
+            return std::nullopt;
+        }
+
+        std::shared_ptr<const MemoryMappedFile> file;
+        try {
+            file = std::make_shared<const MemoryMappedFile>(path);
+        }
+        catch (const ghoul::RuntimeError&) {
+            return std::nullopt;
+        }
+
+        const uint64_t fileSize = file->size();
+        if (fileSize < sizeof(ColumnarCacheHeader)) {
+            return std::nullopt;
+        }
+
+        ColumnarCacheHeader header;
+        std::memcpy(&header, file->data(), sizeof(ColumnarCacheHeader));
+        if (header.identifier != ColumnarCacheIdentifier ||
+            header.version != ColumnarCacheFileVersion ||
+            header.fileHash != fileHash)
+        {
+            // Either this is not a columnar cache file, it was written with a different
+            // layout, or the source file has changed since the cache was written
+            return std::nullopt;
+        }
+
+        // Make sure that none of the sections are reaching beyond the end of the file,
+        // which would be the case for a cache file that was only partially written. The
+        // sections are accessed through typed pointers into the mapping, so they also
+        // have to be aligned for their type
+        auto isInFile = [fileSize](uint64_t offset, uint64_t size) {
+            return offset <= fileSize && size <= fileSize - offset;
+        };
+        const uint64_t nEntries = header.nEntries;
+        const uint64_t nColumns = header.nColumns;
+        if (nEntries > fileSize || nColumns > fileSize ||
+            !isInFile(header.metadataOffset, header.metadataSize) ||
+            header.positionsOffset % alignof(glm::vec3) != 0 ||
+            !isInFile(header.positionsOffset, nEntries * sizeof(glm::vec3)) ||
+            !isInFile(header.columnTableOffset, nColumns * sizeof(uint64_t)))
+        {
+            return std::nullopt;
+        }
+
+        const bool hasComments = header.hasCommentOffset != 0;
+        if (hasComments &&
+            (!isInFile(header.hasCommentOffset, nEntries) ||
+             header.commentOffsetsOffset % alignof(uint64_t) != 0 ||
+             !isInFile(header.commentOffsetsOffset, (nEntries + 1) * sizeof(uint64_t)) ||
+             !isInFile(header.commentDataOffset, header.commentDataSize)))
+        {
+            return std::nullopt;
+        }
+
+        ColumnarDataset result;
+        result.textureDataIndex = header.textureDataIndex;
+        result.orientationDataIndex = header.orientationDataIndex;
+        result.maxPositionComponent = header.maxPositionComponent;
+        result._nEntries = nEntries;
+        result._nColumns = nColumns;
+
+        //
+        // Read variables and textures. These are the only parts that are copied out of
+        // the file right away
+        const std::byte* metadata = file->data() + header.metadataOffset;
+        uint64_t cursor = 0;
+        auto read = [&](void* destination, uint64_t size) {
+            if (size > header.metadataSize - cursor) {
+                return false;
+            }
+            std::memcpy(destination, metadata + cursor, size);
+            cursor += size;
+            return true;
+        };
+        auto readNamedIndex = [&](int& index, std::string& name) {
+            int16_t idx = 0;
+            uint16_t len = 0;
+            if (!read(&idx, sizeof(int16_t)) || !read(&len, sizeof(uint16_t))) {
+                return false;
+            }
+            index = idx;
+            name.resize(len);
+            return read(name.data(), len);
+        };
+
+        uint16_t nVariables = 0;
+        if (!read(&nVariables, sizeof(uint16_t))) {
+            return std::nullopt;
+        }
+        result.variables.resize(nVariables);
+        for (Dataset::Variable& var : result.variables) {
+            if (!readNamedIndex(var.index, var.name)) {
+                return std::nullopt;
+            }
+        }
+
+        uint16_t nTextures = 0;
+        if (!read(&nTextures, sizeof(uint16_t))) {
+            return std::nullopt;
+        }
+        result.textures.resize(nTextures);
+        for (Dataset::Texture& tex : result.textures) {
+            if (!readNamedIndex(tex.index, tex.file)) {
+                return std::nullopt;
+            }
+        }
+
+        //
+        // Point the storage to the sections in the mapped file
+        ColumnarDataset::Storage& storage = result._storage;
+        storage.positionsOffset = header.positionsOffset;
+        storage.columns.resize(nColumns);
+        storage.columnOffsets.resize(nColumns);
+        std::memcpy(
+            storage.columnOffsets.data(),
+            file->data() + header.columnTableOffset,
+            nColumns * sizeof(uint64_t)
+        );
+        for (const size_t offset : storage.columnOffsets) {
+            if (offset % alignof(float) != 0 ||
+                !isInFile(offset, nEntries * sizeof(float)))
+            {
+                return std::nullopt;
+            }
+        }
+
+        if (hasComments) {
+            // The comments are accessed through these offsets without any further checks,
+            // so they have to be increasing and stay inside of the comment data
+            const uint64_t* commentOffsets = reinterpret_cast<const uint64_t*>(
+                file->data() + header.commentOffsetsOffset
+            );
+            for (uint64_t i = 0; i < nEntries; i++) {
+                if (commentOffsets[i] > commentOffsets[i + 1]) {
+                    return std::nullopt;
+                }
+            }
+            if (commentOffsets[nEntries] > header.commentDataSize) {
+                return std::nullopt;
+            }
+
+            storage.hasCommentOffset = header.hasCommentOffset;
+            storage.commentOffsetsOffset = header.commentOffsetsOffset;
+            storage.commentDataOffset = header.commentDataOffset;
+        }
+
+        storage.file = std::move(file);
+        return result;
+    }
+
+    void saveColumnarCachedFile(const ColumnarDataset& dataset,
+                                const std::filesystem::path& path, uint64_t fileHash)
+    {
+        ZoneScoped;
+
+        std::ofstream file = std::ofstream(path, std::ofstream::binary);
+
+        ColumnarCacheHeader header;
+        header.fileHash = fileHash;
+        checkSize<uint32_t>(dataset.nColumns(), "Too many data columns");
+        header.nColumns = static_cast<uint32_t>(dataset.nColumns());
+        header.nEntries = dataset.nEntries();
+        header.textureDataIndex = dataset.textureDataIndex;
+        header.orientationDataIndex = dataset.orientationDataIndex;
+        header.maxPositionComponent = dataset.maxPositionComponent;
+
+        // Write a preliminary header that gets overwritten at the end once all of the
+        // section offsets are known
+        file.write(reinterpret_cast<const char*>(&header), sizeof(ColumnarCacheHeader));
+
+        //
+        // Store variables and textures
+        header.metadataOffset = static_cast<uint64_t>(file.tellp());
+        auto writeNamedIndex = [&file](int index, const std::string& name) {
+            checkSize<int16_t>(index, "Index too large");
+            int16_t idx = static_cast<int16_t>(index);
+            file.write(reinterpret_cast<const char*>(&idx), sizeof(int16_t));
+
+            checkSize<uint16_t>(name.size(), "Name too long");
+            uint16_t len = static_cast<uint16_t>(name.size());
+            file.write(reinterpret_cast<const char*>(&len), sizeof(uint16_t));
+            file.write(name.data(), len);
+        };
+
+        checkSize<uint16_t>(dataset.variables.size(), "Too many variables");
+        uint16_t nVariables = static_cast<uint16_t>(dataset.variables.size());
+        file.write(reinterpret_cast<const char*>(&nVariables), sizeof(uint16_t));
+        for (const Dataset::Variable& var : dataset.variables) {
+            writeNamedIndex(var.index, var.name);
+        }
+
+        checkSize<uint16_t>(dataset.textures.size(), "Too many textures");
+        uint16_t nTextures = static_cast<uint16_t>(dataset.textures.size());
+        file.write(reinterpret_cast<const char*>(&nTextures), sizeof(uint16_t));
+        for (const Dataset::Texture& tex : dataset.textures) {
+            writeNamedIndex(tex.index, tex.file);
+        }
+        header.metadataSize =
+            static_cast<uint64_t>(file.tellp()) - header.metadataOffset;
+
+        //
+        // Store positions
+        writePadding(file);
+        header.positionsOffset = static_cast<uint64_t>(file.tellp());
+        const std::span<const glm::vec3> positions = dataset.positions();
+        file.write(
+            reinterpret_cast<const char*>(positions.data()),
+            positions.size_bytes()
+        );
+
+        //
+        // Store the data columns, each starting on its own page, followed by the table
+        // with the offsets to each of the columns
+        std::vector<uint64_t> columnOffsets;
+        columnOffsets.reserve(dataset.nColumns());
+        for (size_t i = 0; i < dataset.nColumns(); i++) {
+            writePadding(file);
+            columnOffsets.push_back(static_cast<uint64_t>(file.tellp()));
+            const std::span<const float> values = dataset.column(i);
+            file.write(reinterpret_cast<const char*>(values.data()), values.size_bytes());
+        }
+
+        writePadding(file);
+        header.columnTableOffset = static_cast<uint64_t>(file.tellp());
+        file.write(
+            reinterpret_cast<const char*>(columnOffsets.data()),
+            columnOffsets.size() * sizeof(uint64_t)
+        );
+
+        //
+        // Store comments, if there are any
+        std::vector<uint8_t> hasComment;
+        std::vector<uint64_t> commentOffsets;
+        std::string commentData;
+        for (size_t i = 0; i < dataset.nEntries(); i++) {
+            const std::optional<std::string_view> comment = dataset.comment(i);
+            hasComment.push_back(comment.has_value() ? 1 : 0);
+            commentOffsets.push_back(commentData.size());
+            if (comment.has_value()) {
+                commentData.append(*comment);
+            }
+        }
+        commentOffsets.push_back(commentData.size());
+
+        const bool hasComments = std::any_of(
+            hasComment.begin(),
+            hasComment.end(),
+            [](uint8_t v) { return v != 0; }
+        );
+        if (hasComments) {
+            writePadding(file);
+            header.hasCommentOffset = static_cast<uint64_t>(file.tellp());
+            file.write(
+                reinterpret_cast<const char*>(hasComment.data()),
+                hasComment.size()
+            );
+
+            writePadding(file);
+            header.commentOffsetsOffset = static_cast<uint64_t>(file.tellp());
+            file.write(
+                reinterpret_cast<const char*>(commentOffsets.data()),
+                commentOffsets.size() * sizeof(uint64_t)
+            );
+
+            header.commentDataOffset = static_cast<uint64_t>(file.tellp());
+            header.commentDataSize = commentData.size();
+            file.write(commentData.data(), commentData.size());
+        }
+
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(ColumnarCacheHeader));
+    }
+
+    ColumnarDataset loadColumnarFileWithCache(std::filesystem::path path,
+                                              std::optional<DataMapping> specs,
+                                              LoadMode mode)
+    {
+        ZoneScoped;
+
+        std::string info = "columnar";
+        if (specs.has_value()) {
+            info += generateHashString(*specs);
+        }
+        const std::filesystem::path cached = FileSys.cacheManager()->cachedFilename(
+            path,
+            info
+        );
+
+        const uint64_t hash = fileMetadataHash(path, specs);
+        if (std::filesystem::exists(cached)) {
+            LINFOC(
+                "DataLoader",
+                std::format("Cached file {} used for file {}", cached, path)
+            );
+
+            std::optional<ColumnarDataset> dataset = loadColumnarCachedFile(cached, hash);
+            if (dataset.has_value()) {
+                return std::move(*dataset);
+            }
+            else {
+                FileSys.cacheManager()->removeCacheFile(cached);
+            }
+        }
+
+        LINFOC("DataLoader", std::format("Loading file '{}'", path));
+        ColumnarDataset dataset = ColumnarDataset::createFromDataset(
+            loadFile(path, specs, mode)
+        );
+
+        if (dataset.nEntries() > 0) {
+            LINFOC("DataLoader", "Saving cache");
+            saveColumnarCachedFile(dataset, cached, hash);
+        }
+
+        return dataset;
+    }
 } // namespace data
 
 namespace label {
@@ -573,6 +984,25 @@ namespace label {
 
         return res;
     }
+
+    Labelset loadFromDataset(const ColumnarDataset& dataset) {
+        Labelset res;
+        res.entries.reserve(dataset.nEntries());
+
+        const std::span<const glm::vec3> positions = dataset.positions();
+        for (size_t i = 0; i < dataset.nEntries(); i++) {
+            const std::optional<std::string_view> comment = dataset.comment(i);
+            Labelset::Entry label = {
+                .position = positions[i],
+                // @TODO: make is possible to configure this identifier?
+                .identifier = std::format("Point-{}", i),
+                .text = std::string(comment.value_or("MISSING LABEL"))
+            };
+            res.entries.push_back(std::move(label));
+        }
+
+        return res;
+    }
 } // namespace label
 
 namespace color {
@@ -802,4 +1232,297 @@ glm::vec2 Dataset::findValueRange(std::string_view variableName) const {
     return findValueRange(idx);
 }
 
+ColumnarDataset ColumnarDataset::createFromDataset(const Dataset& dataset) {
+    ZoneScoped;
+
+    ColumnarDataset res;
+    res.variables = dataset.variables;
+    res.textures = dataset.textures;
+    res.textureDataIndex = dataset.textureDataIndex;
+    res.orientationDataIndex = dataset.orientationDataIndex;
+    res.maxPositionComponent = dataset.maxPositionComponent;
+
+    const size_t nEntries = dataset.entries.size();
+    res._nEntries = nEntries;
+    res._nColumns = dataset.entries.empty() ? 0 : dataset.entries[0].data.size();
+
+    const bool hasComments = std::any_of(
+        dataset.entries.begin(),
+        dataset.entries.end(),
+        [](const Dataset::Entry& e) { return e.comment.has_value(); }
+    );
+
+    Storage& storage = res._storage;
+    storage.positions.resize(nEntries);
+    storage.columns.resize(res._nColumns, std::vector<float>(nEntries));
+    if (hasComments) {
+        storage.hasComment.resize(nEntries, 0);
+        storage.commentOffsets.resize(nEntries + 1, 0);
+    }
+
+    for (size_t i = 0; i < nEntries; i++) {
+        const Dataset::Entry& e = dataset.entries[i];
+        ghoul_assert(
+            e.data.size() == res._nColumns,
+            "All entries must have the same number of values"
+        );
+
+        storage.positions[i] = e.position;
+        for (size_t j = 0; j < res._nColumns; j++) {
+            storage.columns[j][i] = e.data[j];
+        }
+
+        if (hasComments) {
+            storage.commentOffsets[i] = storage.commentData.size();
+            if (e.comment.has_value()) {
+                storage.hasComment[i] = 1;
+                storage.commentData.insert(
+                    storage.commentData.end(),
+                    e.comment->begin(),
+                    e.comment->end()
+                );
+            }
+        }
+    }
+    if (hasComments) {
+        storage.commentOffsets[nEntries] = storage.commentData.size();
+    }
+
+    return res;
+}
+
+Dataset ColumnarDataset::toDataset() const {
+    ZoneScoped;
+
+    Dataset res;
+    res.variables = variables;
+    res.textures = textures;
+    res.textureDataIndex = textureDataIndex;
+    res.orientationDataIndex = orientationDataIndex;
+    res.maxPositionComponent = maxPositionComponent;
+
+    const std::span<const glm::vec3> pos = positions();
+    res.entries.resize(_nEntries);
+    for (size_t i = 0; i < _nEntries; i++) {
+        Dataset::Entry& e = res.entries[i];
+        e.position = pos[i];
+        e.data.resize(_nColumns);
+        std::optional<std::string_view> c = comment(i);
+        if (c.has_value()) {
+            e.comment = std::string(*c);
+        }
+    }
+
+    for (size_t j = 0; j < _nColumns; j++) {
+        const std::span<const float> values = column(j);
+        for (size_t i = 0; i < _nEntries; i++) {
+            res.entries[i].data[j] = values[i];
+        }
+    }
+
+    return res;
+}
+
+bool ColumnarDataset::isEmpty() const {
+    return variables.empty() || _nEntries == 0;
+}
+
+size_t ColumnarDataset::nEntries() const {
+    return _nEntries;
+}
+
+size_t ColumnarDataset::nColumns() const {
+    return _nColumns;
+}
+
+std::span<const glm::vec3> ColumnarDataset::positions() const {
+    if (_storage.file && _storage.positions.empty()) {
+        const std::byte* data = _storage.file->data() + _storage.positionsOffset;
+        return std::span<const glm::vec3>(
+            reinterpret_cast<const glm::vec3*>(data),
+            _nEntries
+        );
+    }
+    return _storage.positions;
+}
+
+std::span<const float> ColumnarDataset::column(size_t columnIndex) const {
+    ghoul_assert(columnIndex < _nColumns, "Column index out of range");
+
+    if (_storage.file && _storage.columns[columnIndex].empty()) {
+        const std::byte* data = _storage.file->data() +
+            _storage.columnOffsets[columnIndex];
+        return std::span<const float>(reinterpret_cast<const float*>(data), _nEntries);
+    }
+    return _storage.columns[columnIndex];
+}
+
+std::span<float> ColumnarDataset::mutableColumn(size_t columnIndex) {
+    ghoul_assert(columnIndex < _nColumns, "Column index out of range");
+
+    std::vector<float>& values = _storage.columns[columnIndex];
+    if (_storage.file && values.empty() && _nEntries > 0) {
+        // The file is mapped read-only, so we need our own copy of the column
+        const std::span<const float> mapped = std::as_const(*this).column(columnIndex);
+        values.assign(mapped.begin(), mapped.end());
+    }
+    return values;
+}
+
+std::optional<std::string_view> ColumnarDataset::comment(size_t entryIndex) const {
+    ghoul_assert(entryIndex < _nEntries, "Entry index out of range");
+
+    const uint8_t* hasComment = nullptr;
+    const uint64_t* offsets = nullptr;
+    const char* data = nullptr;
+    if (!_storage.hasComment.empty()) {
+        hasComment = _storage.hasComment.data();
+        offsets = _storage.commentOffsets.data();
+        data = _storage.commentData.data();
+    }
+    else if (_storage.file && _storage.hasCommentOffset != 0) {
+        const std::byte* base = _storage.file->data();
+        hasComment = reinterpret_cast<const uint8_t*>(base + _storage.hasCommentOffset);
+        offsets = reinterpret_cast<const uint64_t*>(base + _storage.commentOffsetsOffset);
+        data = reinterpret_cast<const char*>(base + _storage.commentDataOffset);
+    }
+
+    if (!hasComment || hasComment[entryIndex] == 0) {
+        return std::nullopt;
+    }
+    return std::string_view(
+        data + offsets[entryIndex],
+        offsets[entryIndex + 1] - offsets[entryIndex]
+    );
+}
+
+void ColumnarDataset::removeFirstEntries(size_t nEntries) {
+    nEntries = std::min(nEntries, _nEntries);
+    if (nEntries == 0) {
+        return;
+    }
+
+    auto eraseFront = [nEntries]<typename T>(std::vector<T>& values) {
+        if (!values.empty()) {
+            values.erase(values.begin(), values.begin() + nEntries);
+        }
+    };
+
+    // Data that lives in the mapped file is skipped by moving its offset, everything that
+    // was already copied into memory is erased
+    if (_storage.file && _storage.positions.empty()) {
+        _storage.positionsOffset += nEntries * sizeof(glm::vec3);
+    }
+    eraseFront(_storage.positions);
+    for (size_t i = 0; i < _nColumns; i++) {
+        if (_storage.file && _storage.columns[i].empty()) {
+            _storage.columnOffsets[i] += nEntries * sizeof(float);
+        }
+        eraseFront(_storage.columns[i]);
+    }
+
+    // The comment offsets point into the comment data, which is left untouched
+    if (!_storage.hasComment.empty()) {
+        eraseFront(_storage.hasComment);
+        eraseFront(_storage.commentOffsets);
+    }
+    else if (_storage.file && _storage.hasCommentOffset != 0) {
+        _storage.hasCommentOffset += nEntries;
+        _storage.commentOffsetsOffset += nEntries * sizeof(uint64_t);
+    }
+
+    _nEntries -= nEntries;
+}
+
+int ColumnarDataset::index(std::string_view variableName) const {
+    for (const Dataset::Variable& v : variables) {
+        if (v.name == variableName) {
+            return v.index;
+        }
+    }
+    return -1;
+}
+
+bool ColumnarDataset::normalizeVariable(std::string_view variableName) {
+    const int idx = index(variableName);
+
+    if (idx == -1) {
+        // We didn't find the variable that was specified
+        return false;
+    }
+
+    std::span<float> columnValues = mutableColumn(idx);
+    normalizeValues(columnValues, dataloader::findValueRange(columnValues));
+    return true;
+}
+
+glm::vec2 ColumnarDataset::findValueRange(size_t variableIndex) const {
+    if (_nEntries == 0) {
+        // Can't find range if there are no entries
+        return glm::vec2(0.f);
+    }
+
+    if (variableIndex >= _nColumns) {
+        // The index is not a valid variable index
+        return glm::vec2(0.f);
+    }
+
+    return dataloader::findValueRange(column(variableIndex));
+}
+
+glm::vec2 ColumnarDataset::findValueRange(std::string_view variableName) const {
+    const int idx = index(variableName);
+
+    if (idx == -1) {
+        // We didn't find the variable that was specified
+        return glm::vec2(0.f);
+    }
+
+    return findValueRange(idx);
+}
+
+glm::vec2 findValueRange(std::span<const float> values) {
+    // Keep a separate running minimum and maximum for a number of lanes. The lanes are
+    // independent of each other, which lets the compiler map the inner loop onto SIMD
+    // instructions without having to reorder any of the floating point comparisons
+    constexpr size_t Lanes = 8;
+    std::array<float, Lanes> minValues;
+    minValues.fill(std::numeric_limits<float>::max());
+    std::array<float, Lanes> maxValues;
+    maxValues.fill(-std::numeric_limits<float>::max());
+
+    const size_t nBlocks = values.size() / Lanes;
+    for (size_t b = 0; b < nBlocks; b++) {
+        const float* block = values.data() + b * Lanes;
+        for (size_t l = 0; l < Lanes; l++) {
+            // NaN values fail both comparisons and leave the lanes untouched
+            const float v = block[l];
+            minValues[l] = v < minValues[l] ? v : minValues[l];
+            maxValues[l] = v > maxValues[l] ? v : maxValues[l];
+        }
+    }
+
+    float minValue = std::numeric_limits<float>::max();
+    float maxValue = -std::numeric_limits<float>::max();
+    for (size_t l = 0; l < Lanes; l++) {
+        minValue = std::min(minValue, minValues[l]);
+        maxValue = std::max(maxValue, maxValues[l]);
+    }
+    for (size_t i = nBlocks * Lanes; i < values.size(); i++) {
+        const float v = values[i];
+        minValue = v < minValue ? v : minValue;
+        maxValue = v > maxValue ? v : maxValue;
+    }
+
+    return glm::vec2(minValue, maxValue);
+}
+
+void normalizeValues(std::span<float> values, glm::vec2 range) {
+    // NaN values propagate through the arithmetic, so they don't need a separate branch
+    const float extent = range.y - range.x;
+    for (float& v : values) {
+        v = (v - range.x) / extent;
+    }
+}
+
 } // namespace openspace::dataloader
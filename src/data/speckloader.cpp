@@ -25,14 +25,21 @@
 #include <openspace/data/speckloader.h>
 
 #include <openspace/data/dataloader.h>
+#include <openspace/engine/globals.h>
+#include <openspace/util/memorymappedfile.h>
+#include <openspace/util/taskscheduler.h>
 #include <ghoul/misc/assert.h>
 #include <ghoul/misc/exception.h>
 #include <ghoul/misc/stringhelper.h>
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cmath>
 #include <cstdlib>
 #include <fstream>
+#include <iterator>
 #include <limits>
+#include <locale>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -40,6 +47,8 @@
 #include <vector>
 
 namespace {
+    using namespace openspace::dataloader;
+
     bool startsWith(std::string lhs, std::string_view rhs) noexcept {
         lhs = ghoul::toLowerCase(lhs);
         return (rhs.size() <= lhs.size()) && (lhs.substr(0, rhs.size()) == rhs);
@@ -67,28 +76,16 @@ namespace {
             line = line.substr(0, line.size() - 1);
         }
     }
-} // namespace
-
-namespace openspace::dataloader::speck {
-
-Dataset loadSpeckFile(std::filesystem::path path, std::optional<DataMapping> specs) {
-    ghoul_assert(std::filesystem::exists(path), "File must exist");
-
-    std::ifstream file = std::ifstream(path);
-    if (!file.good()) {
-        throw ghoul::RuntimeError(std::format("Failed to open speck file '{}'", path));
-    }
-
-    Dataset res;
-
-    int nDataValues = 0;
-    int currentLineNumber = 0;
-
-    std::string line;
-    // First phase: Loading the header information
-    while (ghoul::getline(file, line)) {
-        currentLineNumber++;
 
+    /**
+     * Parses a single line of the header of a SPECK file and stores the information into
+     * the passed \p res dataset. Returns `true` if the line is the first line of the data
+     * section, in which case the \p line has already been stripped and the header is
+     * finished.
+     */
+    bool parseHeaderLine(std::string& line, int currentLineNumber, int& nDataValues,
+                         Dataset& res, const std::filesystem::path& path)
+    {
         // Guard against wrong line endings (copying files between operating systems)
         // causes lines to have a final \r
         if (!line.empty() && line.back() == '\r') {
@@ -97,7 +94,7 @@ Dataset loadSpeckFile(std::filesystem::path path, std::optional<DataMapping> spe
 
         // Ignore empty line or commented-out lines
         if (line.empty() || line[0] == '#') {
-            continue;
+            return false;
         }
 
         strip(line);
@@ -105,10 +102,9 @@ Dataset loadSpeckFile(std::filesystem::path path, std::optional<DataMapping> spe
         // If the first character is a digit, we have left the preamble and are in the
         // data section of the file
         if (std::isdigit(line[0]) || line[0] == '-') {
-            break;
+            return true;
         }
 
-
         if (startsWith(line, "datavar")) {
             // Each datavar line is following the form:
             // datavar <idx> <description>
@@ -121,7 +117,7 @@ Dataset loadSpeckFile(std::filesystem::path path, std::optional<DataMapping> spe
 
             nDataValues += 1;
             res.variables.push_back(v);
-            continue;
+            return false;
         }
 
         if (startsWith(line, "texturevar")) {
@@ -138,7 +134,7 @@ Dataset loadSpeckFile(std::filesystem::path path, std::optional<DataMapping> spe
             std::string dummy;
             str >> dummy >> res.textureDataIndex;
 
-            continue;
+            return false;
         }
 
         if (startsWith(line, "polyorivar")) {
@@ -167,7 +163,7 @@ Dataset loadSpeckFile(std::filesystem::path path, std::optional<DataMapping> spe
             // corresponding 'datavar' section) here
             nDataValues += 5;
 
-            continue;
+            return false;
         }
 
         if (startsWith(line, "texture")) {
@@ -213,12 +209,12 @@ Dataset loadSpeckFile(std::filesystem::path path, std::optional<DataMapping> spe
             }
 
             res.textures.push_back(texture);
-            continue;
+            return false;
         }
 
         if (startsWith(line, "maxcomment")) {
             // Ignoring this comment as we don't need it
-            continue;
+            return false;
         }
 
         // If we get this far, we had an illegal header as it wasn't an empty line and
@@ -231,19 +227,250 @@ Dataset loadSpeckFile(std::filesystem::path path, std::optional<DataMapping> spe
         ));
     }
 
-    std::sort(
-        res.variables.begin(), res.variables.end(),
-        [](const Dataset::Variable& lhs, const Dataset::Variable& rhs) {
-            return lhs.index < rhs.index;
+    void sortHeaderInformation(Dataset& res) {
+        std::sort(
+            res.variables.begin(), res.variables.end(),
+            [](const Dataset::Variable& lhs, const Dataset::Variable& rhs) {
+                return lhs.index < rhs.index;
+            }
+        );
+
+        std::sort(
+            res.textures.begin(), res.textures.end(),
+            [](const Dataset::Texture& lhs, const Dataset::Texture& rhs) {
+                return lhs.index < rhs.index;
+            }
+        );
+    }
+
+    // Same as the `strip` function above, but without modifying or copying the line
+    std::string_view stripView(std::string_view line) noexcept {
+        while (!line.empty() && (line.front() == ' ' || line.front() == '\t')) {
+            line.remove_prefix(1);
         }
-    );
 
-    std::sort(
-        res.textures.begin(), res.textures.end(),
-        [](const Dataset::Texture& lhs, const Dataset::Texture& rhs) {
-            return lhs.index < rhs.index;
+        if (!line.empty() && line.front() == '#') {
+            line.remove_prefix(1);
         }
-    );
+
+        while (!line.empty() && (line.front() == ' ' || line.front() == '\t')) {
+            line.remove_prefix(1);
+        }
+
+        while (!line.empty() && (line.back() == ' ' || line.back() == '\t')) {
+            line.remove_suffix(1);
+        }
+
+        return line;
+    }
+
+    struct ChunkResult {
+        enum class ErrorType {
+            Intermixed,
+            Position,
+            Value
+        };
+
+        struct Error {
+            ErrorType type;
+            // The line number relative to the beginning of the chunk (0-based)
+            int line = 0;
+            // The index of the data value that failed to parse for `ErrorType::Value`
+            int valueIndex = 0;
+        };
+
+        std::vector<Dataset::Entry> entries;
+        float maxPositionComponent = 0.f;
+        // Only the first error in each chunk is recorded as parsing of the chunk stops
+        std::optional<Error> error;
+    };
+
+    // Returns the next whitespace-separated token in `line` and removes everything up to
+    // the end of the token from `line`
+    std::string_view nextToken(std::string_view& line) noexcept {
+        auto isSpace = [](char c) { return std::isspace(static_cast<unsigned char>(c)); };
+
+        size_t begin = 0;
+        while (begin < line.size() && isSpace(line[begin])) {
+            begin++;
+        }
+        size_t end = begin;
+        while (end < line.size() && !isSpace(line[end])) {
+            end++;
+        }
+        const std::string_view token = line.substr(begin, end - begin);
+        line.remove_prefix(end);
+        return token;
+    }
+
+    // Reads the float value at the beginning of the `token` independent of the current
+    // locale. Any trailing characters that are not part of the number are ignored, which
+    // matches the behavior of reading a float out of a stringstream. Just as for the
+    // stringstream, values that are out of range or not finite numbers are rejected
+    bool parseFloat(std::string_view token, float& value) {
+        if (token.size() > 1 && token[0] == '+' && token[1] != '-') {
+            token.remove_prefix(1);
+        }
+        if (token.empty()) {
+            return false;
+        }
+
+#ifdef __cpp_lib_to_chars
+        const std::from_chars_result res = std::from_chars(
+            token.data(),
+            token.data() + token.size(),
+            value
+        );
+        return res.ec == std::errc() && std::isfinite(value);
+#else // ^^^^ __cpp_lib_to_chars // !__cpp_lib_to_chars vvvv
+        // Some standard libraries are missing floating point support for
+        // std::from_chars
+        std::istringstream stream = std::istringstream(std::string(token));
+        stream.imbue(std::locale::classic());
+        stream >> value;
+        return !stream.fail() && std::isfinite(value);
+#endif // __cpp_lib_to_chars
+    }
+
+    ChunkResult parseDataChunk(std::string_view chunk, int nDataValues,
+                               std::optional<float> missingDataValue)
+    {
+        ChunkResult res;
+        // Roughly estimate the number of entries to prevent too many reallocations
+        res.entries.reserve(chunk.size() / (16 + 8 * nDataValues));
+
+        int lineNumber = -1;
+        size_t offset = 0;
+        while (offset < chunk.size()) {
+            lineNumber++;
+
+            const size_t newline = chunk.find('\n', offset);
+            const size_t end =
+                (newline == std::string_view::npos) ? chunk.size() : newline;
+            std::string_view line = chunk.substr(offset, end - offset);
+            offset = end + 1;
+
+            // Ignore empty line or commented-out lines
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+
+            // Guard against wrong line endings (copying files between operating systems)
+            // causes lines to have a final \r
+            if (line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+
+            line = stripView(line);
+
+            if (line.empty()) {
+                continue;
+            }
+
+            if (!std::isdigit(static_cast<unsigned char>(line[0])) && line[0] != '-') {
+                res.error = {
+                    .type = ChunkResult::ErrorType::Intermixed,
+                    .line = lineNumber
+                };
+                return res;
+            }
+
+            bool allZero = true;
+
+            Dataset::Entry entry;
+            for (int i = 0; i < 3; i++) {
+                if (!parseFloat(nextToken(line), entry.position[i])) {
+                    res.error = {
+                        .type = ChunkResult::ErrorType::Position,
+                        .line = lineNumber
+                    };
+                    return res;
+                }
+            }
+            allZero &= (entry.position == glm::vec3(0.0));
+
+            const glm::vec3 positive = glm::abs(entry.position);
+            res.maxPositionComponent = std::max(
+                res.maxPositionComponent,
+                glm::compMax(positive)
+            );
+
+            entry.data.resize(nDataValues);
+            for (int i = 0; i < nDataValues; i++) {
+                const std::string_view value = nextToken(line);
+                if (value == "nan" || value == "NaN") {
+                    entry.data[i] = std::numeric_limits<float>::quiet_NaN();
+                    continue;
+                }
+
+                if (!parseFloat(value, entry.data[i])) {
+                    res.error = {
+                        .type = ChunkResult::ErrorType::Value,
+                        .line = lineNumber,
+                        .valueIndex = i
+                    };
+                    return res;
+                }
+
+                // Check if value corresponds to a missing value
+                if (missingDataValue.has_value()) {
+                    const float diff = std::abs(entry.data[i] - *missingDataValue);
+                    if (diff < std::numeric_limits<float>::epsilon()) {
+                        entry.data[i] = std::numeric_limits<float>::quiet_NaN();
+                    }
+                }
+
+                allZero &= (entry.data[i] == 0.0);
+            }
+
+            if (allZero) {
+                continue;
+            }
+
+            if (!line.empty()) {
+                entry.comment = std::string(stripView(line));
+            }
+
+            res.entries.push_back(std::move(entry));
+        }
+
+        return res;
+    }
+} // namespace
+
+namespace openspace::dataloader::speck {
+
+Dataset loadSpeckFile(std::filesystem::path path, std::optional<DataMapping> specs) {
+    ghoul_assert(std::filesystem::exists(path), "File must exist");
+
+    std::ifstream file = std::ifstream(path);
+    if (!file.good()) {
+        throw ghoul::RuntimeError(std::format("Failed to open speck file '{}'", path));
+    }
+
+    Dataset res;
+
+    int nDataValues = 0;
+    int currentLineNumber = 0;
+
+    std::string line;
+    // First phase: Loading the header information
+    while (ghoul::getline(file, line)) {
+        currentLineNumber++;
+
+        const bool isDataLine = parseHeaderLine(
+            line,
+            currentLineNumber,
+            nDataValues,
+            res,
+            path
+        );
+        if (isDataLine) {
+            break;
+        }
+    }
+
+    sortHeaderInformation(res);
 
     // For the first line, we already loaded it and rejected it above, so if we do another
     // ghoul::getline, we'd miss the first data value line
@@ -368,6 +595,121 @@ Dataset loadSpeckFile(std::filesystem::path path, std::optional<DataMapping> spe
     return res;
 }
 
+Dataset loadSpeckFileParallel(std::filesystem::path path,
+                              std::optional<DataMapping> specs, size_t minimumChunkSize)
+{
+    ghoul_assert(std::filesystem::exists(path), "File must exist");
+    ghoul_assert(minimumChunkSize > 0, "Chunk size must be positive");
+
+    const MemoryMappedFile file = MemoryMappedFile(path);
+    const std::string_view content = file.view();
+
+    Dataset res;
+
+    int nDataValues = 0;
+    int currentLineNumber = 0;
+
+    // First phase: Loading the header information. The header is usually only a few
+    // dozen lines long, so it is parsed sequentially with the same code as the regular
+    // loader
+    size_t dataOffset = content.size();
+    size_t offset = 0;
+    while (offset < content.size()) {
+        currentLineNumber++;
+
+        const size_t newline = content.find('\n', offset);
+        const size_t end = (newline == std::string_view::npos) ? content.size() : newline;
+        std::string line = std::string(content.substr(offset, end - offset));
+
+        const bool isDataLine = parseHeaderLine(
+            line,
+            currentLineNumber,
+            nDataValues,
+            res,
+            path
+        );
+        if (isDataLine) {
+            dataOffset = offset;
+            break;
+        }
+
+        offset = end + 1;
+    }
+
+    sortHeaderInformation(res);
+
+    // Second phase: Split the data section into line-aligned chunks that are then parsed
+    // concurrently. The results are concatenated in chunk order, so the order of the
+    // entries is the same as in the file
+    const std::string_view data = content.substr(dataOffset);
+    // Chunks are handed to the task scheduler, so there can be more chunks than worker
+    // threads. The surplus chunks balance the load if some chunks are faster to parse
+    const size_t nChunks = std::max(data.size() / minimumChunkSize, size_t(1));
+    const std::vector<std::string_view> chunks = splitAtLineBoundaries(data, nChunks);
+
+    std::optional<float> missingDataValue;
+    if (specs.has_value()) {
+        missingDataValue = specs->missingDataValue;
+    }
+
+    std::vector<ChunkResult> results = std::vector<ChunkResult>(chunks.size());
+    global::taskScheduler->parallelFor(
+        chunks.size(),
+        [&](size_t i) {
+            results[i] = parseDataChunk(chunks[i], nDataValues, missingDataValue);
+        },
+        TaskScheduler::Priority::High
+    );
+
+    size_t nEntries = 0;
+    for (size_t i = 0; i < results.size(); i++) {
+        const std::optional<ChunkResult::Error>& error = results[i].error;
+        if (!error.has_value()) {
+            nEntries += results[i].entries.size();
+            continue;
+        }
+
+        // Reconstruct the line number in the file by counting the lines in the chunks
+        // that came before the one with the error. This only happens on failure, so we
+        // don't need to keep track of it while parsing
+        int lineNumber = currentLineNumber + error->line;
+        for (size_t j = 0; j < i; j++) {
+            lineNumber += static_cast<int>(
+                std::count(chunks[j].begin(), chunks[j].end(), '\n')
+            );
+        }
+
+        switch (error->type) {
+            case ChunkResult::ErrorType::Intermixed:
+                throw ghoul::RuntimeError(std::format(
+                    "Error loading speck file '{}': Header information and datasegment "
+                    "intermixed", path
+                ));
+            case ChunkResult::ErrorType::Position:
+                throw ghoul::RuntimeError(std::format(
+                    "Error loading position information out of data line {} in file "
+                    "'{}'. Value was not a number", lineNumber, path
+                ));
+            case ChunkResult::ErrorType::Value:
+                throw ghoul::RuntimeError(std::format(
+                    "Error loading data value {} out of data line {} in file '{}'. "
+                    "Value was not a number", error->valueIndex, lineNumber, path
+                ));
+        }
+    }
+
+    res.entries.reserve(nEntries);
+    for (ChunkResult& r : results) {
+        res.maxPositionComponent = std::max(
+            res.maxPositionComponent,
+            r.maxPositionComponent
+        );
+        std::move(r.entries.begin(), r.entries.end(), std::back_inserter(res.entries));
+    }
+
+    return res;
+}
+
 Labelset loadLabelFile(std::filesystem::path path) {
     ghoul_assert(std::filesystem::exists(path), "File must exist");
 
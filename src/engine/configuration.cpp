@@ -350,6 +350,52 @@ namespace {
         // Values in this table describe the behavior of the loading screen that is
         // displayed while the scene graph is created and initialized.
         std::optional<LoadingScreen> loadingScreen;
+
+        struct Synchronization {
+            // If this value is set to 'true', the master node only sends the data of
+            // synchronized values that have changed since the previous frame to the
+            // client nodes, rather than the full state in every frame. This value has no
+            // effect on single-node setups. This defaults to 'false'.
+            std::optional<bool> deltaEncoding;
+
+            // The number of frames after which the full state is sent to the client
+            // nodes again when using the delta encoding. This defaults to 60.
+            std::optional<int> keyframeInterval [[codegen::greater(0)]];
+
+            // If this value is set to 'true', the data that is sent to the client nodes
+            // each frame is compressed. This reduces the network traffic for large
+            // payloads at the expense of a small amount of processing time on all nodes.
+            // This defaults to 'false'.
+            std::optional<bool> compression;
+        };
+        // Values in this table control how the state is synchronized between the nodes
+        // of a cluster.
+        std::optional<Synchronization> synchronization;
+
+        struct EphemerisCache {
+            // If this value is set to 'true', the positions and rotations that are
+            // computed by SPICE are approximated with piecewise polynomials that are
+            // reused between frames instead of calling SPICE for every query. This
+            // defaults to 'false'.
+            std::optional<bool> enabled;
+
+            // The largest error of the cached positions in km. This defaults to 0.001.
+            std::optional<double> positionTolerance [[codegen::greater(0.0)]];
+
+            // The largest error of each element of the cached rotation matrices. This
+            // defaults to 1e-9.
+            std::optional<double> rotationTolerance [[codegen::greater(0.0)]];
+
+            // If this value is set to 'true', every cached value is compared against the
+            // value computed by SPICE and the largest error is reported through the
+            // 'openspace.spice.ephemerisCacheStatistics' function. This is slower than
+            // not using the cache at all and is only meant for testing. This defaults to
+            // 'false'.
+            std::optional<bool> validation;
+        };
+        // Values in this table control the cache for the ephemerides that are computed
+        // by SPICE.
+        std::optional<EphemerisCache> ephemerisCache;
     };
 } // namespace
 #include "configuration_codegen.cpp"
@@ -436,6 +482,34 @@ ghoul::Dictionary Configuration::createDictionary() {
         res.setValue("LoadingScreen", loadingScreenDict);
     }
 
+    {
+        ghoul::Dictionary synchronizationDict;
+        synchronizationDict.setValue("DeltaEncoding", synchronization.useDeltaEncoding);
+        synchronizationDict.setValue(
+            "KeyframeInterval",
+            synchronization.keyframeInterval
+        );
+        synchronizationDict.setValue("Compression", synchronization.useCompression);
+
+        res.setValue("Synchronization", synchronizationDict);
+    }
+
+    {
+        ghoul::Dictionary ephemerisCacheDict;
+        ephemerisCacheDict.setValue("Enabled", ephemerisCache.isEnabled);
+        ephemerisCacheDict.setValue(
+            "PositionTolerance",
+            ephemerisCache.positionTolerance
+        );
+        ephemerisCacheDict.setValue(
+            "RotationTolerance",
+            ephemerisCache.rotationTolerance
+        );
+        ephemerisCacheDict.setValue("Validation", ephemerisCache.isValidating);
+
+        res.setValue("EphemerisCache", ephemerisCacheDict);
+    }
+
     res.setValue("IsCheckingOpenGLState", isCheckingOpenGLState);
     res.setValue("IsLoggingOpenGLCalls", isLoggingOpenGLCalls);
     res.setValue("IsPrintingEvents", isPrintingEvents);
@@ -640,6 +714,27 @@ void parseLuaState(Configuration& configuration) {
             l.showLogMessages.value_or(c.loadingScreen.isShowingLogMessages);
     }
 
+    if (p.synchronization.has_value()) {
+        const Parameters::Synchronization& sync = *p.synchronization;
+        c.synchronization.useDeltaEncoding =
+            sync.deltaEncoding.value_or(c.synchronization.useDeltaEncoding);
+        c.synchronization.keyframeInterval =
+            sync.keyframeInterval.value_or(c.synchronization.keyframeInterval);
+        c.synchronization.useCompression =
+            sync.compression.value_or(c.synchronization.useCompression);
+    }
+
+    if (p.ephemerisCache.has_value()) {
+        const Parameters::EphemerisCache& e = *p.ephemerisCache;
+        c.ephemerisCache.isEnabled = e.enabled.value_or(c.ephemerisCache.isEnabled);
+        c.ephemerisCache.positionTolerance =
+            e.positionTolerance.value_or(c.ephemerisCache.positionTolerance);
+        c.ephemerisCache.rotationTolerance =
+            e.rotationTolerance.value_or(c.ephemerisCache.rotationTolerance);
+        c.ephemerisCache.isValidating =
+            e.validation.value_or(c.ephemerisCache.isValidating);
+    }
+
     // ModuleConfigurations depend on the list of modules that are added, which has to be
     // done dynamically. Hence we can't have it written directly into the struct
     if (d.hasValue<ghoul::Dictionary>("ModuleConfigurations")) {
@@ -53,6 +53,7 @@
 #include <openspace/topic/server.h>
 #include <openspace/util/downloadeventengine.h>
 #include <openspace/util/memorymanager.h>
+#include <openspace/util/taskscheduler.h>
 #include <openspace/util/timemanager.h>
 #include <openspace/util/versionchecker.h>
 #include <ghoul/misc/assert.h>
@@ -61,6 +62,7 @@
 #include <ghoul/misc/profiling.h>
 #include <algorithm>
 #include <array>
+#include <thread>
 
 namespace openspace {
 namespace {
@@ -88,6 +90,7 @@ namespace {
         sizeof(RenderEngine) +
         sizeof(std::vector<std::unique_ptr<ScreenSpaceRenderable>>) +
         sizeof(SyncEngine) +
+        sizeof(TaskScheduler) +
         sizeof(TimeManager) +
         sizeof(VersionChecker) +
         sizeof(WindowDelegate) +
@@ -259,6 +262,17 @@ void create() {
     syncEngine = new SyncEngine(4096);
 #endif // WIN32
 
+    // Leave one core for the main thread, which is always busy rendering
+    const unsigned int nTaskThreads =
+        std::max(std::thread::hardware_concurrency(), 2u) - 1;
+#ifdef WIN32
+    taskScheduler = new (currentPos) TaskScheduler(nTaskThreads);
+    ghoul_assert(taskScheduler, "No taskScheduler");
+    currentPos += sizeof(TaskScheduler);
+#else // ^^^^ WIN32 / !WIN32 vvvv
+    taskScheduler = new TaskScheduler(nTaskThreads);
+#endif // WIN32
+
 #ifdef WIN32
     timeManager = new (currentPos) TimeManager;
     ghoul_assert(timeManager, "No timeManager");
@@ -527,6 +541,13 @@ void destroy() {
     delete timeManager;
 #endif // WIN32
 
+    LDEBUGC("Globals", "Destroying 'TaskScheduler'");
+#ifdef WIN32
+    taskScheduler->~TaskScheduler();
+#else // ^^^^ WIN32 / !WIN32 vvvv
+    delete taskScheduler;
+#endif // WIN32
+
     LDEBUGC("Globals", "Destroying 'SyncEngine'");
 #ifdef WIN32
     syncEngine->~SyncEngine();
@@ -432,6 +432,25 @@ void OpenSpaceEngine::initialize() {
 
     global::server->initialize(global::configuration->server);
 
+    global::syncEngine->setDeltaEncoding(
+        global::configuration->synchronization.useDeltaEncoding,
+        global::configuration->synchronization.keyframeInterval
+    );
+    global::syncEngine->setCompression(
+        global::configuration->synchronization.useCompression
+    );
+
+    SpiceManager::ref().setEphemerisCacheTolerance(
+        global::configuration->ephemerisCache.positionTolerance,
+        global::configuration->ephemerisCache.rotationTolerance
+    );
+    SpiceManager::ref().setEphemerisCacheValidation(
+        global::configuration->ephemerisCache.isValidating
+    );
+    SpiceManager::ref().setEphemerisCacheEnabled(
+        global::configuration->ephemerisCache.isEnabled
+    );
+
     // Register modules
     global::moduleEngine->initialize(global::configuration->moduleConfigurations);
 
@@ -24,14 +24,57 @@
 
 #include <openspace/engine/syncengine.h>
 
+#include <openspace/util/blockcompression.h>
 #include <openspace/util/syncable.h>
+#include <ghoul/format.h>
+#include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/assert.h>
 #include <ghoul/misc/profiling.h>
 #include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <memory>
 
+namespace {
+    constexpr std::string_view _loggerCat = "SyncEngine";
+
+    // In the delta encoding, each frame starts with a flag whether it is a keyframe and
+    // the number of records that follow. Each record consists of the index of the
+    // Syncable, the number of bytes, and the data as it was encoded by the Syncable
+    struct FrameHeader {
+        uint32_t isKeyframe = 0;
+        uint32_t nRecords = 0;
+    };
+
+    struct RecordHeader {
+        uint32_t index = 0;
+        uint32_t size = 0;
+    };
+
+    // If compression is enabled, every frame starts with this header followed by the
+    // compressed (or stored, if compression did not reduce the size) frame data
+    struct CompressionHeader {
+        uint32_t isCompressed = 0;
+        uint32_t rawSize = 0;
+    };
+
+    template <typename T>
+    void append(std::vector<std::byte>& data, const T& value) {
+        const size_t offset = data.size();
+        data.resize(offset + sizeof(T));
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+} // namespace
+
 namespace openspace {
 
+double SyncEngine::Statistics::dirtyRatio() const {
+    if (nSyncables == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(nDirtySyncables) / static_cast<double>(nSyncables);
+}
+
 SyncEngine::SyncEngine(unsigned int syncBufferSize)
     : _syncBuffer(syncBufferSize)
 {
@@ -40,23 +83,193 @@ SyncEngine::SyncEngine(unsigned int syncBufferSize)
 
 // Will be called on SGCT master
 std::vector<std::byte> SyncEngine::encodeSyncables() {
-    for (Syncable* syncable : _syncables) {
-        syncable->encode(&_syncBuffer);
+    ZoneScoped;
+
+    const auto begin = std::chrono::steady_clock::now();
+
+    std::span<const std::byte> frame;
+    if (_useDeltaEncoding) {
+        encodeDelta();
+        frame = _frame;
     }
+    else {
+        for (Syncable* syncable : _syncables) {
+            syncable->encode(&_syncBuffer);
+        }
+        frame = _syncBuffer.data();
 
-    std::vector<std::byte> data = _syncBuffer.data();
+        _statistics.nSyncables = _syncables.size();
+        _statistics.nDirtySyncables = _syncables.size();
+        _statistics.nKeyframes++;
+    }
+
+    std::vector<std::byte> data;
+    if (_useCompression) {
+        CompressionHeader header;
+        header.rawSize = static_cast<uint32_t>(frame.size());
+        compressBlock(frame, _compressed);
+
+        // Incompressible data is sent as-is to not make the frame even larger
+        header.isCompressed = _compressed.size() < frame.size() ? 1 : 0;
+        const std::span<const std::byte> payload =
+            header.isCompressed ? std::span<const std::byte>(_compressed) : frame;
+        data.reserve(sizeof(CompressionHeader) + payload.size());
+        append(data, header);
+        data.insert(data.end(), payload.begin(), payload.end());
+    }
+    else {
+        data.assign(frame.begin(), frame.end());
+    }
+
+    _statistics.rawBytes = frame.size();
+    _statistics.frameBytes = data.size();
+    _statistics.totalBytes += data.size();
+    _statistics.nFrames++;
     _syncBuffer.reset();
+
+    _statistics.encodeTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin
+    );
     return data;
 }
 
 // Will be called on SGCT clients
 void SyncEngine::decodeSyncables(std::vector<std::byte> data) {
-    _syncBuffer.setData(std::move(data));
-    for (Syncable* syncable : _syncables) {
-        syncable->decode(&_syncBuffer);
+    ZoneScoped;
+
+    const auto begin = std::chrono::steady_clock::now();
+
+    if (_useCompression) {
+        if (data.size() < sizeof(CompressionHeader)) {
+            LERROR("Received incomplete synchronization data");
+            return;
+        }
+        CompressionHeader header;
+        std::memcpy(&header, data.data(), sizeof(CompressionHeader));
+        const std::span<const std::byte> payload =
+            std::span<const std::byte>(data).subspan(sizeof(CompressionHeader));
+
+        if (header.isCompressed) {
+            if (!decompressBlock(payload, _compressed, header.rawSize)) {
+                LERROR("Received malformed compressed synchronization data");
+                return;
+            }
+        }
+        else {
+            _compressed.assign(payload.begin(), payload.end());
+        }
+        // Swapping leaves the received buffer in the scratch space so that its memory
+        // gets reused for the next frame
+        std::swap(data, _compressed);
     }
 
-    _syncBuffer.reset();
+    if (_useDeltaEncoding) {
+        decodeDelta(data);
+    }
+    else {
+        _syncBuffer.setData(std::move(data));
+        for (Syncable* syncable : _syncables) {
+            syncable->decode(&_syncBuffer);
+        }
+
+        _syncBuffer.reset();
+    }
+
+    _statistics.decodeTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin
+    );
+}
+
+void SyncEngine::encodeDelta() {
+    const bool isKeyframe = _needsKeyframe || _framesSinceKeyframe >= _keyframeInterval;
+    if (isKeyframe) {
+        _framesSinceKeyframe = 1;
+        _needsKeyframe = false;
+    }
+    else {
+        _framesSinceKeyframe++;
+    }
+    _snapshots.resize(_syncables.size());
+
+    _frame.clear();
+    FrameHeader header;
+    header.isKeyframe = isKeyframe ? 1 : 0;
+    append(_frame, header);
+
+    for (size_t i = 0; i < _syncables.size(); i++) {
+        Syncable* syncable = _syncables[i];
+        syncable->encode(&_syncBuffer);
+        const std::span<const std::byte> bytes = _syncBuffer.data();
+
+        const bool isSnapshot = syncable->isSnapshot();
+        if (!isKeyframe && isSnapshot && std::ranges::equal(bytes, _snapshots[i])) {
+            // The client nodes still have the same state, so we don't need to send it
+            _syncBuffer.reset();
+            continue;
+        }
+
+        RecordHeader record;
+        record.index = static_cast<uint32_t>(i);
+        record.size = static_cast<uint32_t>(bytes.size());
+        append(_frame, record);
+        _frame.insert(_frame.end(), bytes.begin(), bytes.end());
+        header.nRecords++;
+
+        if (isSnapshot) {
+            _snapshots[i].assign(bytes.begin(), bytes.end());
+        }
+        _syncBuffer.reset();
+    }
+
+    // Now that we know the number of records, we can update the header
+    std::memcpy(_frame.data(), &header, sizeof(FrameHeader));
+
+    _statistics.nSyncables = _syncables.size();
+    _statistics.nDirtySyncables = header.nRecords;
+    if (isKeyframe) {
+        _statistics.nKeyframes++;
+    }
+}
+
+void SyncEngine::decodeDelta(const std::vector<std::byte>& data) {
+    if (data.size() < sizeof(FrameHeader)) {
+        LERROR("Received incomplete synchronization data");
+        return;
+    }
+
+    FrameHeader header;
+    std::memcpy(&header, data.data(), sizeof(FrameHeader));
+    size_t offset = sizeof(FrameHeader);
+
+    for (uint32_t i = 0; i < header.nRecords; i++) {
+        if (data.size() - offset < sizeof(RecordHeader)) {
+            LERROR("Received incomplete synchronization data");
+            return;
+        }
+        RecordHeader record;
+        std::memcpy(&record, data.data() + offset, sizeof(RecordHeader));
+        offset += sizeof(RecordHeader);
+
+        if (data.size() - offset < record.size) {
+            LERROR("Received incomplete synchronization data");
+            return;
+        }
+        if (record.index >= _syncables.size()) {
+            LERROR(std::format(
+                "Received synchronization data for unknown Syncable {}", record.index
+            ));
+            offset += record.size;
+            continue;
+        }
+
+        // Syncables for which no record was sent keep the state they decoded last
+        _syncBuffer.setData(
+            std::span<const std::byte>(data).subspan(offset, record.size)
+        );
+        _syncables[record.index]->decode(&_syncBuffer);
+        _syncBuffer.reset();
+        offset += record.size;
+    }
 }
 
 void SyncEngine::preSynchronization(IsMaster isMaster) {
@@ -83,6 +296,7 @@ void SyncEngine::addSyncable(Syncable* syncable) {
     ghoul_assert(syncable, "Syncable must not be nullptr");
 
     _syncables.push_back(syncable);
+    _needsKeyframe = true;
 }
 
 void SyncEngine::addSyncables(const std::vector<Syncable*>& syncables) {
@@ -97,6 +311,11 @@ void SyncEngine::removeSyncable(Syncable* syncable) {
         std::remove(_syncables.begin(), _syncables.end(), syncable),
         _syncables.end()
     );
+
+    // Removing a Syncable shifts the indices of the ones behind it, so the stored
+    // snapshots no longer match
+    _snapshots.clear();
+    _needsKeyframe = true;
 }
 
 void SyncEngine::removeSyncables(const std::vector<Syncable*>& syncables) {
@@ -105,4 +324,29 @@ void SyncEngine::removeSyncables(const std::vector<Syncable*>& syncables) {
     }
 }
 
+void SyncEngine::setDeltaEncoding(bool enabled, int keyframeInterval) {
+    ghoul_assert(keyframeInterval > 0, "keyframeInterval must be bigger than 0");
+
+    _useDeltaEncoding = enabled;
+    _keyframeInterval = keyframeInterval;
+    _snapshots.clear();
+    _needsKeyframe = true;
+}
+
+bool SyncEngine::isDeltaEncoding() const {
+    return _useDeltaEncoding;
+}
+
+void SyncEngine::setCompression(bool enabled) {
+    _useCompression = enabled;
+}
+
+bool SyncEngine::isCompressing() const {
+    return _useCompression;
+}
+
+const SyncEngine::Statistics& SyncEngine::statistics() const {
+    return _statistics;
+}
+
 } // namespace openspace
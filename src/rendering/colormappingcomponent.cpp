@@ -350,7 +350,7 @@ ghoul::opengl::Texture* ColorMappingComponent::texture() const {
     return _texture.get();
 }
 
-void ColorMappingComponent::initialize(const dataloader::Dataset& dataset,
+void ColorMappingComponent::initialize(const dataloader::ColumnarDataset& dataset,
                                        bool useCaching)
 {
     ZoneScoped;
@@ -416,7 +416,9 @@ void ColorMappingComponent::initializeTexture() {
     );
 }
 
-void ColorMappingComponent::update(const dataloader::Dataset& dataset, bool useCaching) {
+void ColorMappingComponent::update(const dataloader::ColumnarDataset& dataset,
+                                   bool useCaching)
+{
     if (_colorMapFileIsDirty) {
         initialize(dataset, useCaching);
         _colorMapTextureIsDirty = true;
@@ -458,7 +460,9 @@ glm::vec4 ColorMappingComponent::colorFromColorMap(float valueToColorFrom) const
     return _colorMap.entries[colorIndex];
 }
 
-void ColorMappingComponent::initializeParameterData(const dataloader::Dataset& dataset) {
+void ColorMappingComponent::initializeParameterData(
+                                         const dataloader::ColumnarDataset& dataset)
+{
     if (dataset.isEmpty()) {
         return;
     }
@@ -478,7 +482,7 @@ void ColorMappingComponent::initializeParameterData(const dataloader::Dataset& d
     int indexOfProvidedOption = -1;
 
     // If no options were added, add each dataset parameter and its range as options
-    if (dataColumn.options().empty() && !dataset.entries.empty()) {
+    if (dataColumn.options().empty() && dataset.nEntries() > 0) {
         int i = 0;
         _colorRangeData.reserve(dataset.variables.size());
         for (const dataloader::Dataset::Variable& v : dataset.variables) {
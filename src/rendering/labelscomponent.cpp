@@ -240,7 +240,7 @@ void LabelsComponent::initialize() {
     loadLabels();
 }
 
-void LabelsComponent::loadLabelsFromDataset(const dataloader::Dataset& dataset,
+void LabelsComponent::loadLabelsFromDataset(const dataloader::ColumnarDataset& dataset,
                                             DistanceUnit unit)
 {
     ZoneScoped;
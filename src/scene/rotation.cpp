@@ -119,4 +119,8 @@ void Rotation::update(const UpdateData& data) {
     }
 }
 
+bool Rotation::isThreadSafe() const {
+    return false;
+}
+
 } // namespace openspace
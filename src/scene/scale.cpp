@@ -117,4 +117,8 @@ void Scale::update(const UpdateData& data) {
     }
 }
 
+bool Scale::isThreadSafe() const {
+    return false;
+}
+
 } // namespace openspace
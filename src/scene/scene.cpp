@@ -65,6 +65,16 @@ namespace {
     constexpr std::string_view KeyParent = "Parent";
     constexpr const char* RootNodeIdentifier = "Root";
 
+    constexpr Property::PropertyInfo ParallelUpdateInfo = {
+        "ParallelUpdate",
+        "Parallel update",
+        "If this value is enabled, the transformations of scene graph nodes that do not "
+        "depend on each other are updated concurrently on multiple threads. Nodes whose "
+        "transformations can only be computed on the main thread, for example those "
+        "using SPICE or Lua scripts, are always updated on the main thread.",
+        Property::Visibility::Developer
+    };
+
 #ifdef TRACY_ENABLE
     constexpr const char* renderBinToString(int renderBin) {
         // Synced with Renderable::RenderBin
@@ -307,7 +317,10 @@ Scene::Scene(std::unique_ptr<SceneInitializer> initializer)
     : PropertyOwner({ "Scene", "Scene" })
     , _camera(std::make_unique<Camera>())
     , _initializer(std::move(initializer))
+    , _parallelUpdate(ParallelUpdateInfo, true)
 {
+    addProperty(_parallelUpdate);
+
     _rootNode.setIdentifier(RootNodeIdentifier);
     _rootNode.setScene(this);
     _rootNode.setGuiHintHidden(true);
@@ -389,6 +402,28 @@ void Scene::updateNodeRegistry() {
     ZoneScoped;
 
     sortTopologically();
+
+    // Each node has to wait for its parent and the nodes it depends on
+    std::unordered_map<const SceneGraphNode*, uint32_t> indices;
+    std::vector<SceneUpdateScheduler::Node> nodes;
+    nodes.reserve(_topologicallySortedNodes.size());
+    for (SceneGraphNode* node : _topologicallySortedNodes) {
+        SceneUpdateScheduler::Node n;
+        if (const auto it = indices.find(node->parent());  it != indices.end()) {
+            n.predecessors.push_back(it->second);
+        }
+        for (const SceneGraphNode* dependency : node->dependencies()) {
+            if (const auto it = indices.find(dependency);  it != indices.end()) {
+                n.predecessors.push_back(it->second);
+            }
+        }
+        n.isConcurrent = node->supportsConcurrentUpdate();
+
+        indices[node] = static_cast<uint32_t>(nodes.size());
+        nodes.push_back(std::move(n));
+    }
+    _updateScheduler.build(nodes);
+
     _dirtyNodeRegistry = false;
 }
 
@@ -492,14 +527,29 @@ void Scene::update(const UpdateData& data) {
         updateNodeRegistry();
     }
     _camera->setAtmosphereDimmingFactor(1.f);
-    for (SceneGraphNode* node : _topologicallySortedNodes) {
-        try {
-            node->update(data);
-        }
-        catch (const ghoul::RuntimeError& e) {
-            LERRORC(e.component, e.what());
-        }
-    }
+
+    // The transformations of independent nodes might be computed on worker threads, but
+    // the renderables are always updated on this thread after all of the nodes they might
+    // depend on have finished
+    _updateScheduler.run(
+        [this, &data](uint32_t i) {
+            try {
+                _topologicallySortedNodes[i]->updateTransform(data);
+            }
+            catch (const ghoul::RuntimeError& e) {
+                LERRORC(e.component, e.what());
+            }
+        },
+        [this, &data](uint32_t i) {
+            try {
+                _topologicallySortedNodes[i]->updateRenderable(data);
+            }
+            catch (const ghoul::RuntimeError& e) {
+                LERRORC(e.component, e.what());
+            }
+        },
+        _parallelUpdate
+    );
 }
 
 void Scene::render(const RenderData& data, RendererTasks& tasks) {
@@ -789,12 +789,13 @@ void SceneGraphNode::traversePostOrder(const std::function<void(SceneGraphNode*)
 }
 
 void SceneGraphNode::update(const UpdateData& data) {
+    updateTransform(data);
+    updateRenderable(data);
+}
+
+void SceneGraphNode::updateTransform(const UpdateData& data) {
     ZoneScoped;
     ZoneName(identifier().c_str(), identifier().size());
-#ifdef TRACY_ENABLE
-    TracyPlot("RAM", static_cast<int64_t>(global::openSpaceEngine->ramInUse()));
-    TracyPlot("VRAM", static_cast<int64_t>(global::openSpaceEngine->vramInUse()));
-#endif // TRACY_ENABLE
 
     if (_state != State::GLInitialized) {
         return;
@@ -816,27 +817,36 @@ void SceneGraphNode::update(const UpdateData& data) {
 
     ghoul_assert(_transform.scale, "No scale exists");
     _transform.scale->update(data);
-    UpdateData newUpdateData = data;
 
     // Assumes _worldRotationCached and _worldScaleCached have been calculated for parent
     _worldPositionCached = calculateWorldPosition();
     _worldRotationCached = calculateWorldRotation();
     _worldScaleCached = calculateWorldScale();
 
+    const glm::dmat4 translation = glm::translate(glm::dmat4(1.0), _worldPositionCached);
+    const glm::dmat4 rotation = glm::dmat4(_worldRotationCached);
+    const glm::dmat4 scaling = glm::scale(glm::dmat4(1.0), _worldScaleCached);
+
+    _modelTransformCached = translation * rotation * scaling;
+}
+
+void SceneGraphNode::updateRenderable(const UpdateData& data) {
+    ZoneScoped;
+    ZoneName(identifier().c_str(), identifier().size());
+#ifdef TRACY_ENABLE
+    TracyPlot("RAM", static_cast<int64_t>(global::openSpaceEngine->ramInUse()));
+    TracyPlot("VRAM", static_cast<int64_t>(global::openSpaceEngine->vramInUse()));
+#endif // TRACY_ENABLE
+
+    if (_state != State::GLInitialized || !isTimeFrameActive()) {
+        return;
+    }
+
+    UpdateData newUpdateData = data;
     newUpdateData.modelTransform.translation = _worldPositionCached;
     newUpdateData.modelTransform.rotation = _worldRotationCached;
     newUpdateData.modelTransform.scale = _worldScaleCached;
 
-    const glm::dmat4 translation = glm::translate(
-        glm::dmat4(1.0),
-        newUpdateData.modelTransform.translation
-    );
-    const glm::dmat4 rotation = glm::dmat4(newUpdateData.modelTransform.rotation);
-    const glm::dmat4 scaling =
-        glm::scale(glm::dmat4(1.0), newUpdateData.modelTransform.scale);
-
-    _modelTransformCached = translation * rotation * scaling;
-
     if (_renderable &&
         (_renderable->isEnabled() || _renderable->shouldUpdateIfDisabled()))
     {
@@ -844,6 +854,16 @@ void SceneGraphNode::update(const UpdateData& data) {
     }
 }
 
+bool SceneGraphNode::supportsConcurrentUpdate() const {
+    ghoul_assert(_transform.translation, "No translation exists");
+    ghoul_assert(_transform.rotation, "No rotation exists");
+    ghoul_assert(_transform.scale, "No scale exists");
+
+    return _transform.translation->isThreadSafe() &&
+           _transform.rotation->isThreadSafe() &&
+           _transform.scale->isThreadSafe();
+}
+
 void SceneGraphNode::render(const RenderData& data, RendererTasks& tasks) {
     ZoneScoped;
     ZoneName(identifier().c_str(), identifier().size());
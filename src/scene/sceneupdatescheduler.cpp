@@ -0,0 +1,122 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <openspace/scene/sceneupdatescheduler.h>
+
+#include <openspace/engine/globals.h>
+#include <openspace/util/taskscheduler.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/profiling.h>
+#include <algorithm>
+
+namespace openspace {
+
+void SceneUpdateScheduler::build(std::span<const Node> nodes) {
+    ZoneScoped;
+
+    _levels.clear();
+    _nNodes = nodes.size();
+
+    std::vector<uint32_t> nodeLevels = std::vector<uint32_t>(nodes.size(), 0);
+    for (size_t i = 0; i < nodes.size(); i++) {
+        uint32_t level = 0;
+        for (const uint32_t p : nodes[i].predecessors) {
+            ghoul_assert(p < i, "Predecessors must come before the node");
+            level = std::max(level, nodeLevels[p] + 1);
+        }
+        nodeLevels[i] = level;
+
+        if (level >= _levels.size()) {
+            _levels.resize(level + 1);
+        }
+        Level& l = _levels[level];
+        const uint32_t index = static_cast<uint32_t>(i);
+        l.nodes.push_back(index);
+        if (nodes[i].isConcurrent) {
+            l.concurrent.push_back(index);
+        }
+        else {
+            l.serial.push_back(index);
+        }
+    }
+}
+
+void SceneUpdateScheduler::run(const std::function<void(uint32_t)>& transform,
+                               const std::function<void(uint32_t)>& finalize,
+                               bool parallel) const
+{
+    ZoneScoped;
+
+    if (!parallel) {
+        for (uint32_t i = 0; i < _nNodes; i++) {
+            transform(i);
+            finalize(i);
+        }
+        return;
+    }
+
+    for (const Level& level : _levels) {
+        if (level.concurrent.size() < MinParallelNodes) {
+            for (const uint32_t i : level.nodes) {
+                transform(i);
+            }
+        }
+        else {
+            // The workers of the task scheduler process the concurrent nodes while this
+            // thread takes care of the nodes that have to be updated on it. The call with
+            // index 0 always happens on the calling thread, so it is used for the serial
+            // lane if there is one
+            const size_t offset = level.serial.empty() ? 0 : 1;
+            global::taskScheduler->parallelFor(
+                level.concurrent.size() + offset,
+                [&transform, &level, offset](size_t i) {
+                    if (i < offset) {
+                        for (const uint32_t j : level.serial) {
+                            transform(j);
+                        }
+                    }
+                    else {
+                        ZoneScopedN("Concurrent Node");
+                        transform(level.concurrent[i - offset]);
+                    }
+                },
+                TaskScheduler::Priority::High
+            );
+        }
+
+        for (const uint32_t i : level.nodes) {
+            finalize(i);
+        }
+    }
+}
+
+std::span<const SceneUpdateScheduler::Level> SceneUpdateScheduler::levels() const {
+    return _levels;
+}
+
+size_t SceneUpdateScheduler::nNodes() const {
+    return _nNodes;
+}
+
+} // namespace openspace
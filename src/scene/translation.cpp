@@ -119,6 +119,14 @@ glm::dvec3 Translation::position() const {
     return _cachedPosition;
 }
 
+bool Translation::isThreadSafe() const {
+    return false;
+}
+
+Translation::PositionFunction Translation::concurrentPositionFunction() const {
+    return PositionFunction();
+}
+
 void Translation::notifyObservers() const {
     if (_onParameterChangeCallback) {
         _onParameterChangeCallback();
@@ -0,0 +1,236 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+#include <openspace/util/blockcompression.h>
+
+#include <ghoul/misc/profiling.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+    // Each sequence consists of a token, literals, and a back-reference. The upper four
+    // bits of the token contain the number of literals, the lower four bits the length
+    // of the match minus MinMatch. A value of 15 in either half means that additional
+    // length bytes follow, which are added until a byte other than 255 is encountered
+    constexpr size_t MinMatch = 4;
+    constexpr size_t MaxOffset = 65535;
+    constexpr uint8_t RunMask = 15;
+
+    // The final bytes of the input are always stored as literals, which means that the
+    // matching never has to check against the end of the input when comparing 4 bytes
+    constexpr size_t LastLiterals = 5;
+    constexpr size_t MinInputSize = 13;
+
+    constexpr int HashLog = 12;
+
+    uint32_t read32(const uint8_t* p) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(uint32_t));
+        return v;
+    }
+
+    uint32_t hash(uint32_t sequence) {
+        return (sequence * 2654435761U) >> (32 - HashLog);
+    }
+
+    void writeLength(std::vector<std::byte>& destination, size_t length) {
+        while (length >= 255) {
+            destination.push_back(std::byte(255));
+            length -= 255;
+        }
+        destination.push_back(std::byte(length));
+    }
+
+    void writeSequence(std::vector<std::byte>& destination, const uint8_t* literals,
+                       size_t nLiterals, size_t offset, size_t matchLength)
+    {
+        const size_t matchCode = matchLength - MinMatch;
+        const uint8_t token = static_cast<uint8_t>(
+            (std::min<size_t>(nLiterals, RunMask) << 4) |
+            std::min<size_t>(matchCode, RunMask)
+        );
+        destination.push_back(std::byte(token));
+        if (nLiterals >= RunMask) {
+            writeLength(destination, nLiterals - RunMask);
+        }
+
+        const std::byte* begin = reinterpret_cast<const std::byte*>(literals);
+        destination.insert(destination.end(), begin, begin + nLiterals);
+
+        destination.push_back(std::byte(offset & 0xFF));
+        destination.push_back(std::byte((offset >> 8) & 0xFF));
+        if (matchCode >= RunMask) {
+            writeLength(destination, matchCode - RunMask);
+        }
+    }
+
+    void writeLastLiterals(std::vector<std::byte>& destination, const uint8_t* literals,
+                           size_t nLiterals)
+    {
+        const uint8_t token =
+            static_cast<uint8_t>(std::min<size_t>(nLiterals, RunMask) << 4);
+        destination.push_back(std::byte(token));
+        if (nLiterals >= RunMask) {
+            writeLength(destination, nLiterals - RunMask);
+        }
+        const std::byte* begin = reinterpret_cast<const std::byte*>(literals);
+        destination.insert(destination.end(), begin, begin + nLiterals);
+    }
+
+    bool readLength(std::span<const std::byte> source, size_t& cursor, size_t& length) {
+        uint8_t v = 255;
+        while (v == 255) {
+            if (cursor >= source.size()) {
+                return false;
+            }
+            v = static_cast<uint8_t>(source[cursor]);
+            cursor++;
+            length += v;
+        }
+        return true;
+    }
+} // namespace
+
+namespace openspace {
+
+void compressBlock(std::span<const std::byte> source, std::vector<std::byte>& destination)
+{
+    ZoneScoped;
+
+    destination.clear();
+    destination.reserve(source.size() + source.size() / 255 + 16);
+
+    const uint8_t* in = reinterpret_cast<const uint8_t*>(source.data());
+    const size_t size = source.size();
+    if (size < MinInputSize) {
+        writeLastLiterals(destination, in, size);
+        return;
+    }
+
+    // Stores the last position + 1 at which each hashed 4-byte sequence was encountered,
+    // so that 0 denotes an empty slot
+    std::array<uint32_t, 1 << HashLog> table = {};
+
+    const size_t matchLimit = size - LastLiterals;
+    size_t anchor = 0;
+    size_t i = 0;
+    while (i + MinMatch <= matchLimit) {
+        const uint32_t sequence = read32(in + i);
+        const uint32_t h = hash(sequence);
+        const size_t candidate = table[h];
+        table[h] = static_cast<uint32_t>(i + 1);
+
+        if (candidate == 0 || i - (candidate - 1) > MaxOffset ||
+            read32(in + candidate - 1) != sequence)
+        {
+            i++;
+            continue;
+        }
+
+        const size_t match = candidate - 1;
+        size_t length = MinMatch;
+        while (i + length < matchLimit && in[match + length] == in[i + length]) {
+            length++;
+        }
+
+        writeSequence(destination, in + anchor, i - anchor, i - match, length);
+        i += length;
+        anchor = i;
+    }
+
+    writeLastLiterals(destination, in + anchor, size - anchor);
+}
+
+bool decompressBlock(std::span<const std::byte> source,
+                     std::vector<std::byte>& destination, size_t decompressedSize)
+{
+    ZoneScoped;
+
+    destination.resize(decompressedSize);
+    std::byte* out = destination.data();
+
+    size_t cursor = 0;
+    size_t written = 0;
+    while (cursor < source.size()) {
+        const uint8_t token = static_cast<uint8_t>(source[cursor]);
+        cursor++;
+
+        size_t nLiterals = token >> 4;
+        if (nLiterals == RunMask && !readLength(source, cursor, nLiterals)) {
+            return false;
+        }
+        if (nLiterals > source.size() - cursor ||
+            nLiterals > decompressedSize - written)
+        {
+            return false;
+        }
+        if (nLiterals > 0) {
+            std::memcpy(out + written, source.data() + cursor, nLiterals);
+        }
+        cursor += nLiterals;
+        written += nLiterals;
+
+        if (cursor == source.size()) {
+            // The last sequence only consists of literals
+            break;
+        }
+
+        if (source.size() - cursor < 2) {
+            return false;
+        }
+        const size_t offset = static_cast<size_t>(source[cursor]) |
+                              (static_cast<size_t>(source[cursor + 1]) << 8);
+        cursor += 2;
+        if (offset == 0 || offset > written) {
+            return false;
+        }
+
+        size_t length = token & RunMask;
+        if (length == RunMask && !readLength(source, cursor, length)) {
+            return false;
+        }
+        length += MinMatch;
+        if (length > decompressedSize - written) {
+            return false;
+        }
+
+        // The match can overlap with the bytes that are being written, so we have to
+        // copy byte by byte in that case
+        const std::byte* match = out + written - offset;
+        if (offset >= length) {
+            std::memcpy(out + written, match, length);
+        }
+        else {
+            for (size_t j = 0; j < length; j++) {
+                out[written + j] = match[j];
+            }
+        }
+        written += length;
+    }
+
+    return written == decompressedSize;
+}
+
+} // namespace openspace
@@ -0,0 +1,234 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <openspace/util/ephemeriscache.h>
+
+#include <ghoul/misc/assert.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <utility>
+
+namespace {
+    constexpr int NCoefficients = openspace::EphemerisCache::Degree + 1;
+
+    // Maps the time into the [-1, 1] range of the Chebyshev polynomials of a segment
+    double normalizedTime(double time, double begin, double end) {
+        const double x = (2.0 * time - begin - end) / (end - begin);
+        return std::clamp(x, -1.0, 1.0);
+    }
+
+    // Evaluates the Chebyshev series with the provided coefficients at x using the
+    // Clenshaw recurrence
+    double clenshaw(const double* coefficients, double x) {
+        double b1 = 0.0;
+        double b2 = 0.0;
+        for (int k = NCoefficients - 1; k >= 1; k--) {
+            const double b = coefficients[k] + 2.0 * x * b1 - b2;
+            b2 = b1;
+            b1 = b;
+        }
+        return coefficients[0] + x * b1 - b2;
+    }
+} // namespace
+
+namespace openspace {
+
+EphemerisCache::EphemerisCache(size_t nComponents, double tolerance,
+                               std::vector<std::pair<double, double>> coverage,
+                               double windowLength)
+    : _nComponents(nComponents)
+    , _tolerance(tolerance)
+    , _coverage(std::move(coverage))
+    , _windowLength(windowLength)
+{
+    ghoul_assert(_nComponents > 0, "Need at least one component");
+    ghoul_assert(_tolerance > 0.0, "Tolerance must be positive");
+    ghoul_assert(_windowLength > 0.0, "Window length must be positive");
+}
+
+bool EphemerisCache::evaluate(double time, std::span<double> result,
+                              const Function& function)
+{
+    ghoul_assert(result.size() == _nComponents, "Wrong number of components");
+
+    // Check if there already is a segment that contains the requested time
+    auto it = _segments.upper_bound(time);
+    if (it != _segments.begin()) {
+        it--;
+        if (time <= it->second.end) {
+            if (!it->second.isValid) {
+                _nMisses++;
+                return false;
+            }
+            evaluate(it->second, it->first, time, result);
+            _nHits++;
+            return true;
+        }
+    }
+
+    // Find the coverage interval that contains the time, outside of which we must not
+    // fit any polynomial as the function might be discontinuous or undefined there
+    auto coverage = std::find_if(
+        _coverage.cbegin(),
+        _coverage.cend(),
+        [time](const std::pair<double, double>& c) {
+            return time >= c.first && time <= c.second;
+        }
+    );
+    if (coverage == _coverage.cend() || !std::isfinite(time)) {
+        _nMisses++;
+        return false;
+    }
+
+    if (_segments.size() >= MaxSegments) {
+        // We don't want to grow without bounds if someone scrubs through decades of time
+        clear();
+    }
+
+    const double windowBegin = std::floor(time / _windowLength) * _windowLength;
+    double begin = std::max(windowBegin, coverage->first);
+    double end = std::min(windowBegin + _windowLength, coverage->second);
+    if (end <= begin) {
+        // Degenerate coverage intervals can't be approximated
+        _nMisses++;
+        return false;
+    }
+
+    // Halve the window towards the requested time until the polynomial is accurate
+    // enough. Since all segments are created by halving the same windows, a segment is
+    // either disjoint to all other segments or contains one of them, but in the latter
+    // case it has been tried and failed before which is recorded in _failedIntervals
+    for (int i = 0; i <= MaxSubdivisions; i++) {
+        if (!_failedIntervals.contains({ begin, end })) {
+            Segment segment = fit(begin, end, function);
+            if (segment.isValid) {
+                auto [s, _] = _segments.emplace(begin, std::move(segment));
+                evaluate(s->second, begin, time, result);
+                _nHits++;
+                return true;
+            }
+            _failedIntervals.emplace(begin, end);
+        }
+
+        const double mid = begin + (end - begin) / 2.0;
+        if (time < mid) {
+            end = mid;
+        }
+        else {
+            begin = mid;
+        }
+    }
+
+    // The function is not smooth enough around this time, so we remember that we don't
+    // need to try again
+    Segment invalid;
+    invalid.end = end;
+    invalid.isValid = false;
+    _segments.emplace(begin, std::move(invalid));
+    _nMisses++;
+    return false;
+}
+
+EphemerisCache::Segment EphemerisCache::fit(double begin, double end,
+                                            const Function& function) const
+{
+    const double mid = (begin + end) / 2.0;
+    const double halfLength = (end - begin) / 2.0;
+
+    Segment segment;
+    segment.end = end;
+
+    // Sample the function at the Chebyshev nodes of the interval
+    std::vector<double> samples(NCoefficients * _nComponents);
+    for (int k = 0; k < NCoefficients; k++) {
+        const double x = std::cos(std::numbers::pi * (k + 0.5) / NCoefficients);
+        std::span<double> s = std::span(samples).subspan(k * _nComponents, _nComponents);
+        if (!function(mid + halfLength * x, s)) {
+            return segment;
+        }
+    }
+
+    segment.coefficients.resize(NCoefficients * _nComponents, 0.0);
+    for (size_t c = 0; c < _nComponents; c++) {
+        double* coefficients = &segment.coefficients[c * NCoefficients];
+        for (int j = 0; j < NCoefficients; j++) {
+            double sum = 0.0;
+            for (int k = 0; k < NCoefficients; k++) {
+                sum += samples[k * _nComponents + c] *
+                    std::cos(std::numbers::pi * j * (k + 0.5) / NCoefficients);
+            }
+            coefficients[j] = 2.0 * sum / NCoefficients;
+        }
+        coefficients[0] /= 2.0;
+    }
+
+    // The polynomial is exact at the nodes, so we check the error in between them and at
+    // the ends of the interval, where the interpolation error is the largest
+    std::vector<double> expected(_nComponents);
+    for (int k = 0; k <= NCoefficients; k++) {
+        const double x = std::cos(std::numbers::pi * k / NCoefficients);
+        if (!function(mid + halfLength * x, expected)) {
+            return segment;
+        }
+        for (size_t c = 0; c < _nComponents; c++) {
+            const double v = clenshaw(&segment.coefficients[c * NCoefficients], x);
+            if (!(std::abs(v - expected[c]) <= _tolerance)) {
+                return segment;
+            }
+        }
+    }
+
+    segment.isValid = true;
+    return segment;
+}
+
+void EphemerisCache::evaluate(const Segment& segment, double begin, double time,
+                              std::span<double> result) const
+{
+    const double x = normalizedTime(time, begin, segment.end);
+    for (size_t c = 0; c < _nComponents; c++) {
+        result[c] = clenshaw(&segment.coefficients[c * NCoefficients], x);
+    }
+}
+
+void EphemerisCache::clear() {
+    _segments.clear();
+    _failedIntervals.clear();
+}
+
+uint64_t EphemerisCache::nHits() const {
+    return _nHits;
+}
+
+uint64_t EphemerisCache::nMisses() const {
+    return _nMisses;
+}
+
+size_t EphemerisCache::nSegments() const {
+    return _segments.size();
+}
+
+} // namespace openspace
@@ -0,0 +1,694 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <openspace/util/expression.h>
+
+#include <ghoul/format.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/exception.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <locale>
+#include <numbers>
+#include <sstream>
+
+namespace {
+    using namespace openspace;
+    using OpCode = Expression::OpCode;
+    using Instruction = Expression::Instruction;
+
+    // The number of evaluations that are processed together by the batched evaluation.
+    // The stack for a block has to fit comfortably into the L1 cache
+    constexpr size_t BlockSize = 64;
+
+    // Protects against stack overflows in the parser for deeply nested expressions
+    constexpr int MaxNestingDepth = 256;
+
+    bool isSpace(char c) {
+        return std::isspace(static_cast<unsigned char>(c));
+    }
+
+    bool isDigit(char c) {
+        return std::isdigit(static_cast<unsigned char>(c));
+    }
+
+    bool isIdentifierStart(char c) {
+        return std::isalpha(static_cast<unsigned char>(c)) || c == '_';
+    }
+
+    bool isIdentifier(char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+    }
+
+    struct Function {
+        std::string_view name;
+        OpCode code;
+        int nArguments;
+    };
+
+    constexpr std::array<Function, 27> Functions = {
+        Function { "sin", OpCode::Sin, 1 },
+        Function { "cos", OpCode::Cos, 1 },
+        Function { "tan", OpCode::Tan, 1 },
+        Function { "asin", OpCode::Asin, 1 },
+        Function { "acos", OpCode::Acos, 1 },
+        Function { "atan", OpCode::Atan, 1 },
+        Function { "atan2", OpCode::Atan2, 2 },
+        Function { "sinh", OpCode::Sinh, 1 },
+        Function { "cosh", OpCode::Cosh, 1 },
+        Function { "tanh", OpCode::Tanh, 1 },
+        Function { "sqrt", OpCode::Sqrt, 1 },
+        Function { "cbrt", OpCode::Cbrt, 1 },
+        Function { "abs", OpCode::Abs, 1 },
+        Function { "exp", OpCode::Exp, 1 },
+        Function { "log", OpCode::Log, 1 },
+        Function { "log2", OpCode::Log2, 1 },
+        Function { "log10", OpCode::Log10, 1 },
+        Function { "floor", OpCode::Floor, 1 },
+        Function { "ceil", OpCode::Ceil, 1 },
+        Function { "round", OpCode::Round, 1 },
+        Function { "sign", OpCode::Sign, 1 },
+        Function { "min", OpCode::Min, 2 },
+        Function { "max", OpCode::Max, 2 },
+        Function { "pow", OpCode::Power, 2 },
+        Function { "mod", OpCode::Modulo, 2 },
+        Function { "hypot", OpCode::Hypot, 2 },
+        Function { "clamp", OpCode::Clamp, 3 }
+    };
+
+    int arity(OpCode code) {
+        switch (code) {
+            case OpCode::Constant:
+            case OpCode::Variable:
+                return 0;
+            case OpCode::Negate:
+            case OpCode::Sin:
+            case OpCode::Cos:
+            case OpCode::Tan:
+            case OpCode::Asin:
+            case OpCode::Acos:
+            case OpCode::Atan:
+            case OpCode::Sinh:
+            case OpCode::Cosh:
+            case OpCode::Tanh:
+            case OpCode::Sqrt:
+            case OpCode::Cbrt:
+            case OpCode::Abs:
+            case OpCode::Exp:
+            case OpCode::Log:
+            case OpCode::Log2:
+            case OpCode::Log10:
+            case OpCode::Floor:
+            case OpCode::Ceil:
+            case OpCode::Round:
+            case OpCode::Sign:
+                return 1;
+            case OpCode::Add:
+            case OpCode::Subtract:
+            case OpCode::Multiply:
+            case OpCode::Divide:
+            case OpCode::Modulo:
+            case OpCode::Power:
+            case OpCode::Atan2:
+            case OpCode::Min:
+            case OpCode::Max:
+            case OpCode::Hypot:
+                return 2;
+            case OpCode::Clamp:
+                return 3;
+        }
+        throw ghoul::MissingCaseException();
+    }
+
+    // Each of these applies an operation to `n` lanes. The operands are stored in the
+    // rows `a`, `b`, and `c` of the stack and the result replaces the first operand. The
+    // loops are kept trivial so that the compiler can vectorize them
+    template <typename F>
+    void apply(double* a, size_t n, F f) {
+        for (size_t i = 0; i < n; i++) {
+            a[i] = f(a[i]);
+        }
+    }
+
+    template <typename F>
+    void apply(double* a, const double* b, size_t n, F f) {
+        for (size_t i = 0; i < n; i++) {
+            a[i] = f(a[i], b[i]);
+        }
+    }
+
+    template <typename F>
+    void apply(double* a, const double* b, const double* c, size_t n, F f) {
+        for (size_t i = 0; i < n; i++) {
+            a[i] = f(a[i], b[i], c[i]);
+        }
+    }
+
+    // Runs the `instructions` for `n` lanes at the same time. The stack consists of rows
+    // that are `stride` values apart and the value of the variable `i` for the lanes is
+    // read from `columns[i]`. The result is left in the first row of the stack
+    void execute(std::span<const Instruction> instructions,
+                 std::span<const double* const> columns, size_t n, double* stack,
+                 size_t stride)
+    {
+        size_t depth = 0;
+        for (const Instruction& inst : instructions) {
+            const int nArguments = arity(inst.code);
+            if (nArguments == 0) {
+                double* dst = stack + depth * stride;
+                if (inst.code == OpCode::Constant) {
+                    std::fill_n(dst, n, inst.value);
+                }
+                else {
+                    std::copy_n(columns[inst.index], n, dst);
+                }
+                depth++;
+                continue;
+            }
+
+            depth -= nArguments;
+            double* a = stack + depth * stride;
+            const double* b = a + stride;
+            const double* c = b + stride;
+            depth++;
+
+            switch (inst.code) {
+                case OpCode::Negate:
+                    apply(a, n, [](double x) { return -x; });
+                    break;
+                case OpCode::Sin:
+                    apply(a, n, [](double x) { return std::sin(x); });
+                    break;
+                case OpCode::Cos:
+                    apply(a, n, [](double x) { return std::cos(x); });
+                    break;
+                case OpCode::Tan:
+                    apply(a, n, [](double x) { return std::tan(x); });
+                    break;
+                case OpCode::Asin:
+                    apply(a, n, [](double x) { return std::asin(x); });
+                    break;
+                case OpCode::Acos:
+                    apply(a, n, [](double x) { return std::acos(x); });
+                    break;
+                case OpCode::Atan:
+                    apply(a, n, [](double x) { return std::atan(x); });
+                    break;
+                case OpCode::Sinh:
+                    apply(a, n, [](double x) { return std::sinh(x); });
+                    break;
+                case OpCode::Cosh:
+                    apply(a, n, [](double x) { return std::cosh(x); });
+                    break;
+                case OpCode::Tanh:
+                    apply(a, n, [](double x) { return std::tanh(x); });
+                    break;
+                case OpCode::Sqrt:
+                    apply(a, n, [](double x) { return std::sqrt(x); });
+                    break;
+                case OpCode::Cbrt:
+                    apply(a, n, [](double x) { return std::cbrt(x); });
+                    break;
+                case OpCode::Abs:
+                    apply(a, n, [](double x) { return std::abs(x); });
+                    break;
+                case OpCode::Exp:
+                    apply(a, n, [](double x) { return std::exp(x); });
+                    break;
+                case OpCode::Log:
+                    apply(a, n, [](double x) { return std::log(x); });
+                    break;
+                case OpCode::Log2:
+                    apply(a, n, [](double x) { return std::log2(x); });
+                    break;
+                case OpCode::Log10:
+                    apply(a, n, [](double x) { return std::log10(x); });
+                    break;
+                case OpCode::Floor:
+                    apply(a, n, [](double x) { return std::floor(x); });
+                    break;
+                case OpCode::Ceil:
+                    apply(a, n, [](double x) { return std::ceil(x); });
+                    break;
+                case OpCode::Round:
+                    apply(a, n, [](double x) { return std::round(x); });
+                    break;
+                case OpCode::Sign:
+                    apply(a, n, [](double x) {
+                        return static_cast<double>((x > 0.0) - (x < 0.0));
+                    });
+                    break;
+                case OpCode::Add:
+                    apply(a, b, n, [](double x, double y) { return x + y; });
+                    break;
+                case OpCode::Subtract:
+                    apply(a, b, n, [](double x, double y) { return x - y; });
+                    break;
+                case OpCode::Multiply:
+                    apply(a, b, n, [](double x, double y) { return x * y; });
+                    break;
+                case OpCode::Divide:
+                    apply(a, b, n, [](double x, double y) { return x / y; });
+                    break;
+                case OpCode::Modulo:
+                    apply(a, b, n, [](double x, double y) { return std::fmod(x, y); });
+                    break;
+                case OpCode::Power:
+                    apply(a, b, n, [](double x, double y) { return std::pow(x, y); });
+                    break;
+                case OpCode::Atan2:
+                    apply(a, b, n, [](double y, double x) { return std::atan2(y, x); });
+                    break;
+                case OpCode::Min:
+                    apply(a, b, n, [](double x, double y) { return std::min(x, y); });
+                    break;
+                case OpCode::Max:
+                    apply(a, b, n, [](double x, double y) { return std::max(x, y); });
+                    break;
+                case OpCode::Hypot:
+                    apply(a, b, n, [](double x, double y) { return std::hypot(x, y); });
+                    break;
+                case OpCode::Clamp:
+                    apply(a, b, c, n, [](double x, double lower, double upper) {
+                        return std::min(std::max(x, lower), upper);
+                    });
+                    break;
+                default:
+                    throw ghoul::MissingCaseException();
+            }
+        }
+    }
+
+    // Recursive descent parser that emits the instructions in postfix order while
+    // parsing. Operations whose operands are all constant are evaluated directly
+    class Compiler {
+    public:
+        Compiler(std::string_view source, const std::vector<std::string>& variables)
+            : _source(source)
+            , _variables(variables)
+        {}
+
+        std::vector<Instruction> compile() {
+            skipWhitespace();
+            if (_pos == _source.size()) {
+                error("Expression is empty");
+            }
+            parseAdditive();
+            if (_pos != _source.size()) {
+                error(std::format("Unexpected character '{}'", _source[_pos]));
+            }
+            return std::move(_instructions);
+        }
+
+    private:
+        [[noreturn]] void error(std::string_view message) const {
+            throw ghoul::RuntimeError(std::format(
+                "Error in expression '{}' at position {}: {}", _source, _pos, message
+            ));
+        }
+
+        void skipWhitespace() {
+            while (_pos < _source.size() && isSpace(_source[_pos])) {
+                _pos++;
+            }
+        }
+
+        bool accept(char c) {
+            if (_pos < _source.size() && _source[_pos] == c) {
+                _pos++;
+                skipWhitespace();
+                return true;
+            }
+            return false;
+        }
+
+        void expect(char c) {
+            if (!accept(c)) {
+                error(std::format("Expected '{}'", c));
+            }
+        }
+
+        void emit(Instruction inst) {
+            const int nArguments = arity(inst.code);
+            const size_t n = _instructions.size();
+            const bool isFoldable =
+                nArguments > 0 && n >= static_cast<size_t>(nArguments) &&
+                std::all_of(
+                    _instructions.end() - nArguments,
+                    _instructions.end(),
+                    [](const Instruction& i) { return i.code == OpCode::Constant; }
+                );
+
+            if (!isFoldable) {
+                _instructions.push_back(inst);
+                return;
+            }
+
+            // All operands are known, so we can replace them with the result
+            std::array<Instruction, 4> program;
+            std::copy(
+                _instructions.end() - nArguments,
+                _instructions.end(),
+                program.begin()
+            );
+            program[nArguments] = inst;
+            std::array<double, 4> stack = {};
+            execute(
+                std::span(program.data(), nArguments + 1),
+                std::span<const double* const>(),
+                1,
+                stack.data(),
+                1
+            );
+            _instructions.resize(n - nArguments);
+            _instructions.push_back({ .code = OpCode::Constant, .value = stack[0] });
+        }
+
+        void parseAdditive() {
+            parseMultiplicative();
+            while (true) {
+                if (accept('+')) {
+                    parseMultiplicative();
+                    emit({ .code = OpCode::Add });
+                }
+                else if (accept('-')) {
+                    parseMultiplicative();
+                    emit({ .code = OpCode::Subtract });
+                }
+                else {
+                    return;
+                }
+            }
+        }
+
+        void parseMultiplicative() {
+            parseUnary();
+            while (true) {
+                if (accept('*')) {
+                    parseUnary();
+                    emit({ .code = OpCode::Multiply });
+                }
+                else if (accept('/')) {
+                    parseUnary();
+                    emit({ .code = OpCode::Divide });
+                }
+                else if (accept('%')) {
+                    parseUnary();
+                    emit({ .code = OpCode::Modulo });
+                }
+                else {
+                    return;
+                }
+            }
+        }
+
+        void parseUnary() {
+            if (_nesting > MaxNestingDepth) {
+                error("Expression is nested too deeply");
+            }
+            _nesting++;
+            if (accept('-')) {
+                parseUnary();
+                emit({ .code = OpCode::Negate });
+            }
+            else if (accept('+')) {
+                parseUnary();
+            }
+            else {
+                parsePower();
+            }
+            _nesting--;
+        }
+
+        void parsePower() {
+            parsePrimary();
+            if (accept('^')) {
+                // The exponent is parsed as a unary expression, which makes the operator
+                // right-associative and allows for negative exponents
+                parseUnary();
+                emit({ .code = OpCode::Power });
+            }
+        }
+
+        void parsePrimary() {
+            if (_pos == _source.size()) {
+                error("Unexpected end of expression");
+            }
+
+            const char c = _source[_pos];
+            if (isDigit(c) || c == '.') {
+                parseNumber();
+            }
+            else if (isIdentifierStart(c)) {
+                parseIdentifier();
+            }
+            else if (accept('(')) {
+                parseAdditive();
+                expect(')');
+            }
+            else {
+                error(std::format("Unexpected character '{}'", c));
+            }
+        }
+
+        void parseNumber() {
+            const size_t begin = _pos;
+            auto skipDigits = [this]() {
+                size_t n = 0;
+                while (_pos < _source.size() && isDigit(_source[_pos])) {
+                    _pos++;
+                    n++;
+                }
+                return n;
+            };
+
+            size_t nDigits = skipDigits();
+            if (_pos < _source.size() && _source[_pos] == '.') {
+                _pos++;
+                nDigits += skipDigits();
+            }
+            if (nDigits == 0) {
+                error("Invalid number");
+            }
+
+            // The exponent is only consumed if it is complete, so that `2e` is not
+            // silently interpreted as a number
+            if (_pos < _source.size() && (_source[_pos] == 'e' || _source[_pos] == 'E')) {
+                size_t p = _pos + 1;
+                if (p < _source.size() && (_source[p] == '+' || _source[p] == '-')) {
+                    p++;
+                }
+                if (p < _source.size() && isDigit(_source[p])) {
+                    _pos = p;
+                    skipDigits();
+                }
+            }
+
+            // The number is parsed independently of the current locale, which might use
+            // a different decimal separator
+            const std::string_view number = _source.substr(begin, _pos - begin);
+            double value = 0.0;
+#ifdef __cpp_lib_to_chars
+            const std::from_chars_result res = std::from_chars(
+                number.data(),
+                number.data() + number.size(),
+                value
+            );
+            if (res.ec == std::errc::result_out_of_range) {
+                error(std::format("Number '{}' is out of range", number));
+            }
+            if (res.ec != std::errc() || res.ptr != number.data() + number.size()) {
+                error(std::format("Invalid number '{}'", number));
+            }
+#else // ^^^^ __cpp_lib_to_chars // !__cpp_lib_to_chars vvvv
+            // Some standard libraries are missing floating point support for
+            // std::from_chars
+            std::istringstream stream = std::istringstream(std::string(number));
+            stream.imbue(std::locale::classic());
+            stream >> value;
+            if (stream.fail() || !std::isfinite(value)) {
+                error(std::format("Number '{}' is out of range", number));
+            }
+#endif // __cpp_lib_to_chars
+            skipWhitespace();
+            emit({ .code = OpCode::Constant, .value = value });
+        }
+
+        void parseIdentifier() {
+            const size_t begin = _pos;
+            while (_pos < _source.size() && isIdentifier(_source[_pos])) {
+                _pos++;
+            }
+            const std::string_view name = _source.substr(begin, _pos - begin);
+            skipWhitespace();
+
+            if (accept('(')) {
+                auto it = std::find_if(
+                    Functions.begin(),
+                    Functions.end(),
+                    [name](const Function& f) { return f.name == name; }
+                );
+                if (it == Functions.end()) {
+                    error(std::format("Unknown function '{}'", name));
+                }
+
+                int nArguments = 0;
+                if (!accept(')')) {
+                    do {
+                        parseAdditive();
+                        nArguments++;
+                    } while (accept(','));
+                    expect(')');
+                }
+                if (nArguments != it->nArguments) {
+                    error(std::format(
+                        "Function '{}' expects {} arguments, got {}",
+                        name, it->nArguments, nArguments
+                    ));
+                }
+                emit({ .code = it->code });
+                return;
+            }
+
+            auto it = std::find(_variables.begin(), _variables.end(), name);
+            if (it != _variables.end()) {
+                const uint32_t index =
+                    static_cast<uint32_t>(std::distance(_variables.begin(), it));
+                emit({ .code = OpCode::Variable, .index = index });
+            }
+            else if (name == "pi") {
+                emit({ .code = OpCode::Constant, .value = std::numbers::pi });
+            }
+            else if (name == "e") {
+                emit({ .code = OpCode::Constant, .value = std::numbers::e });
+            }
+            else {
+                error(std::format("Unknown name '{}'", name));
+            }
+        }
+
+        std::string_view _source;
+        const std::vector<std::string>& _variables;
+        size_t _pos = 0;
+        int _nesting = 0;
+        std::vector<Instruction> _instructions;
+    };
+} // namespace
+
+namespace openspace {
+
+Expression::Expression(std::string_view source, std::vector<std::string> variables)
+    : _source(source)
+    , _variables(std::move(variables))
+{
+    ghoul_assert(_variables.size() <= MaxVariables, "Too many variables");
+
+    _instructions = Compiler(_source, _variables).compile();
+
+    int depth = 0;
+    for (const Instruction& inst : _instructions) {
+        depth += 1 - arity(inst.code);
+        _stackDepth = std::max(_stackDepth, depth);
+    }
+    ghoul_assert(depth == 1, "Expression must leave exactly one value on the stack");
+    if (_stackDepth > MaxStackDepth) {
+        throw ghoul::RuntimeError(std::format(
+            "Expression '{}' is too complex to be evaluated", _source
+        ));
+    }
+}
+
+double Expression::evaluate(std::span<const double> values) const {
+    ghoul_assert(values.size() == _variables.size(), "Wrong number of values");
+
+    if (_instructions.size() == 1 && _instructions[0].code == OpCode::Constant) {
+        return _instructions[0].value;
+    }
+
+    std::array<const double*, MaxVariables> columns;
+    for (size_t i = 0; i < values.size(); i++) {
+        columns[i] = &values[i];
+    }
+    std::array<double, MaxStackDepth> stack;
+    execute(
+        _instructions,
+        std::span(columns.data(), values.size()),
+        1,
+        stack.data(),
+        1
+    );
+    return stack[0];
+}
+
+void Expression::evaluate(std::span<const std::span<const double>> columns,
+                          std::span<double> results) const
+{
+    ghoul_assert(columns.size() == _variables.size(), "Wrong number of columns");
+    ghoul_assert(
+        std::all_of(
+            columns.begin(),
+            columns.end(),
+            [&results](std::span<const double> c) { return c.size() == results.size(); }
+        ),
+        "All columns must have the same size as the results"
+    );
+
+    std::array<const double*, MaxVariables> blockColumns;
+    std::array<double, MaxStackDepth * BlockSize> stack;
+    for (size_t offset = 0; offset < results.size(); offset += BlockSize) {
+        const size_t n = std::min(BlockSize, results.size() - offset);
+        for (size_t i = 0; i < columns.size(); i++) {
+            blockColumns[i] = columns[i].data() + offset;
+        }
+        execute(
+            _instructions,
+            std::span(blockColumns.data(), columns.size()),
+            n,
+            stack.data(),
+            BlockSize
+        );
+        std::copy_n(stack.begin(), n, results.begin() + offset);
+    }
+}
+
+const std::string& Expression::source() const {
+    return _source;
+}
+
+const std::vector<std::string>& Expression::variables() const {
+    return _variables;
+}
+
+bool Expression::isConstant() const {
+    return _instructions.size() == 1 && _instructions[0].code == OpCode::Constant;
+}
+
+std::span<const Expression::Instruction> Expression::instructions() const {
+    return _instructions;
+}
+
+} // namespace openspace
@@ -0,0 +1,206 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <openspace/util/memorymappedfile.h>
+
+#include <ghoul/format.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/exception.h>
+#include <algorithm>
+#include <utility>
+
+#ifdef WIN32
+#include <Windows.h>
+#else // ^^^^ WIN32 // !WIN32 vvvv
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // WIN32
+
+namespace openspace {
+
+MemoryMappedFile::MemoryMappedFile(std::filesystem::path path)
+    : _path(std::move(path))
+{
+    ghoul_assert(!_path.empty(), "Path must not be empty");
+
+    if (!std::filesystem::is_regular_file(_path)) {
+        throw ghoul::RuntimeError(std::format("Could not find file '{}'", _path));
+    }
+
+    _size = static_cast<size_t>(std::filesystem::file_size(_path));
+    if (_size == 0) {
+        // Mapping an empty file is not supported by either operating system, but we can
+        // represent it just fine without a mapping
+        return;
+    }
+
+#ifdef WIN32
+    HANDLE file = CreateFileW(
+        _path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE) {
+        throw ghoul::RuntimeError(std::format("Failed to open file '{}'", _path));
+    }
+    _fileHandle = file;
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        unmap();
+        throw ghoul::RuntimeError(std::format("Failed to map file '{}'", _path));
+    }
+    _mappingHandle = mapping;
+
+    void* ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!ptr) {
+        unmap();
+        throw ghoul::RuntimeError(std::format("Failed to map file '{}'", _path));
+    }
+    _data = reinterpret_cast<const std::byte*>(ptr);
+#else // ^^^^ WIN32 // !WIN32 vvvv
+    const int fd = open(_path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw ghoul::RuntimeError(std::format("Failed to open file '{}'", _path));
+    }
+
+    void* ptr = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file, so we can close the descriptor
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        throw ghoul::RuntimeError(std::format("Failed to map file '{}'", _path));
+    }
+    _data = reinterpret_cast<const std::byte*>(ptr);
+#endif // WIN32
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    unmap();
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+    : _path(std::move(other._path))
+    , _data(std::exchange(other._data, nullptr))
+    , _size(std::exchange(other._size, 0))
+#ifdef WIN32
+    , _fileHandle(std::exchange(other._fileHandle, nullptr))
+    , _mappingHandle(std::exchange(other._mappingHandle, nullptr))
+#endif // WIN32
+{}
+
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        _path = std::move(other._path);
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+#ifdef WIN32
+        _fileHandle = std::exchange(other._fileHandle, nullptr);
+        _mappingHandle = std::exchange(other._mappingHandle, nullptr);
+#endif // WIN32
+    }
+    return *this;
+}
+
+const std::byte* MemoryMappedFile::data() const {
+    return _data;
+}
+
+size_t MemoryMappedFile::size() const {
+    return _size;
+}
+
+std::string_view MemoryMappedFile::view() const {
+    if (!_data) {
+        return std::string_view();
+    }
+    return std::string_view(reinterpret_cast<const char*>(_data), _size);
+}
+
+const std::filesystem::path& MemoryMappedFile::path() const {
+    return _path;
+}
+
+void MemoryMappedFile::unmap() {
+#ifdef WIN32
+    if (_data) {
+        UnmapViewOfFile(_data);
+    }
+    if (_mappingHandle) {
+        CloseHandle(_mappingHandle);
+    }
+    if (_fileHandle) {
+        CloseHandle(_fileHandle);
+    }
+    _mappingHandle = nullptr;
+    _fileHandle = nullptr;
+#else // ^^^^ WIN32 // !WIN32 vvvv
+    if (_data) {
+        munmap(const_cast<std::byte*>(_data), _size);
+    }
+#endif // WIN32
+    _data = nullptr;
+    _size = 0;
+}
+
+std::vector<std::string_view> splitAtLineBoundaries(std::string_view data,
+                                                    size_t nChunks)
+{
+    ghoul_assert(nChunks > 0, "Need at least one chunk");
+
+    std::vector<std::string_view> res;
+    if (data.empty()) {
+        return res;
+    }
+    res.reserve(nChunks);
+
+    const size_t targetSize = std::max<size_t>(data.size() / nChunks, 1);
+    size_t begin = 0;
+    while (begin < data.size()) {
+        size_t end = begin + targetSize;
+        if (end >= data.size() || res.size() == nChunks - 1) {
+            // Either we reached the end of the data or this is the final chunk that has
+            // to pick up all the remaining bytes
+            end = data.size();
+        }
+        else {
+            // Advance the split point to the character after the next newline
+            const size_t newline = data.find('\n', end - 1);
+            end = (newline == std::string_view::npos) ? data.size() : newline + 1;
+        }
+
+        res.push_back(data.substr(begin, end - begin));
+        begin = end;
+    }
+
+    return res;
+}
+
+} // namespace openspace
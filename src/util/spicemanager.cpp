@@ -25,6 +25,8 @@
 #include <openspace/util/spicemanager.h>
 
 #include <openspace/scripting/lualibrary.h>
+#include <openspace/util/ephemeriscache.h>
+#include <openspace/util/spiceservice.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/format.h>
 #include <ghoul/logging/logmanager.h>
@@ -33,6 +35,8 @@
 #include <cstring>
 #include <iterator>
 #include <fstream>
+#include <limits>
+#include <span>
 #include <string_view>
 #include <utility>
 
@@ -48,6 +52,53 @@ namespace {
     // as the maximum message length
     constexpr unsigned SpiceErrorBufferSize = 1841;
 
+    // Light times are cached as the equivalent distance so that the same tolerance can be
+    // used for all components of the position cache
+    constexpr double SpeedOfLight = 299792.458; // km/s
+
+    using Intervals = std::vector<std::pair<double, double>>;
+
+    const Intervals UnboundedCoverage = {
+        { std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max() }
+    };
+
+    // Sorts the intervals and combines all of the intervals that overlap or touch
+    Intervals mergedIntervals(Intervals intervals) {
+        std::sort(intervals.begin(), intervals.end());
+        Intervals res;
+        for (const std::pair<double, double>& i : intervals) {
+            if (!res.empty() && i.first <= res.back().second) {
+                res.back().second = std::max(res.back().second, i.second);
+            }
+            else {
+                res.push_back(i);
+            }
+        }
+        return res;
+    }
+
+    // Returns the intervals that are covered by both lists. Both lists have to be sorted
+    // and must not contain overlapping intervals
+    Intervals intersectedIntervals(const Intervals& lhs, const Intervals& rhs) {
+        Intervals res;
+        auto l = lhs.cbegin();
+        auto r = rhs.cbegin();
+        while (l != lhs.cend() && r != rhs.cend()) {
+            const double begin = std::max(l->first, r->first);
+            const double end = std::min(l->second, r->second);
+            if (begin < end) {
+                res.emplace_back(begin, end);
+            }
+            if (l->second < r->second) {
+                l++;
+            }
+            else {
+                r++;
+            }
+        }
+        return res;
+    }
+
     const char* toString(SpiceManager::FieldOfViewMethod m) {
         switch (m) {
             case SpiceManager::FieldOfViewMethod::Ellipsoid: return "ELLIPSOID";
@@ -167,6 +218,9 @@ SpiceManager::SpiceManager() {
 }
 
 SpiceManager::~SpiceManager() {
+    // The worker of the service might still be using the SpiceManager
+    _service = nullptr;
+
     for (const KernelInformation& i : _loadedKernels) {
         const std::string p = i.path.string();
         unload_c(p.c_str());
@@ -214,6 +268,7 @@ void throwSpiceError(const std::string& errorMessage) {
 }
 
 SpiceManager::KernelHandle SpiceManager::loadKernel(std::filesystem::path filePath) {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!filePath.empty(), "Empty file path");
     ghoul_assert(
         std::filesystem::is_regular_file(filePath),
@@ -272,6 +327,8 @@ SpiceManager::KernelHandle SpiceManager::loadKernel(std::filesystem::path filePa
         findSpkCoverage(filePath);
     }
 
+    clearEphemerisCache();
+
     const KernelHandle kernelId = ++_lastAssignedKernel;
     ghoul_assert(kernelId != 0, "Kernel Handle wrapped around to 0");
     _loadedKernels.push_back({ std::move(filePath), kernelId, 1 });
@@ -279,6 +336,7 @@ SpiceManager::KernelHandle SpiceManager::loadKernel(std::filesystem::path filePa
 }
 
 void SpiceManager::unloadKernel(KernelHandle kernelId) {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(kernelId <= _lastAssignedKernel, "Invalid unassigned kernel");
     ghoul_assert(kernelId != KernelHandle(0), "Invalid zero handle");
 
@@ -296,6 +354,7 @@ void SpiceManager::unloadKernel(KernelHandle kernelId) {
             const std::string p = it->path.string();
             unload_c(p.c_str());
             _loadedKernels.erase(it);
+            clearEphemerisCache();
         }
         // Otherwise, we hold on to it, but reduce the reference counter by 1
         else {
@@ -306,6 +365,7 @@ void SpiceManager::unloadKernel(KernelHandle kernelId) {
 }
 
 void SpiceManager::unloadKernel(std::filesystem::path filePath) {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!filePath.empty(), "Empty filename");
 
     const auto it = std::find_if(
@@ -331,6 +391,7 @@ void SpiceManager::unloadKernel(std::filesystem::path filePath) {
         const std::string p = filePath.string();
         unload_c(p.c_str());
         _loadedKernels.erase(it);
+        clearEphemerisCache();
     }
     else {
         // Otherwise, we hold on to it, but reduce the reference counter by 1
@@ -340,6 +401,7 @@ void SpiceManager::unloadKernel(std::filesystem::path filePath) {
 }
 
 std::vector<std::filesystem::path> SpiceManager::loadedKernels() const {
+    const std::lock_guard lock(_mutex);
     std::vector<std::filesystem::path> res;
     res.reserve(_loadedKernels.size());
     for (const KernelInformation& info : _loadedKernels) {
@@ -349,6 +411,7 @@ std::vector<std::filesystem::path> SpiceManager::loadedKernels() const {
 }
 
 bool SpiceManager::hasSpkCoverage(const std::string& target, double et) const {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!target.empty(), "Empty target");
 
     const int id = naifId(target);
@@ -372,6 +435,7 @@ bool SpiceManager::hasSpkCoverage(const std::string& target, double et) const {
 std::vector<std::pair<double, double>> SpiceManager::spkCoverage(
                                                           const std::string& target) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!target.empty(), "Empty target");
 
     const int id = naifId(target);
@@ -386,6 +450,7 @@ std::vector<std::pair<double, double>> SpiceManager::spkCoverage(
 }
 
 bool SpiceManager::hasCkCoverage(const std::string& frame, double et) const {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!frame.empty(), "Empty target");
 
     const int id = frameId(frame);
@@ -404,6 +469,7 @@ bool SpiceManager::hasCkCoverage(const std::string& frame, double et) const {
 std::vector<std::pair<double, double>> SpiceManager::ckCoverage(
                                                           const std::string& target) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!target.empty(), "Empty target");
 
     int id = naifId(target);
@@ -427,6 +493,7 @@ std::vector<std::pair<double, double>> SpiceManager::ckCoverage(
 std::vector<std::pair<int, std::string>> SpiceManager::spiceBodies(
                                                                  bool builtInFrames) const
 {
+    const std::lock_guard lock(_mutex);
     std::vector<std::pair<int, std::string>> bodies;
 
     static std::array<SpiceInt, SPICE_CELL_CTRLSZ + 8192> idsetBuffer;
@@ -479,6 +546,7 @@ std::vector<std::pair<int, std::string>> SpiceManager::spiceBodies(
 }
 
 int SpiceManager::naifId(const std::string& body) const {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!body.empty(), "Empty body");
 
     SpiceBoolean success = SPICEFALSE;
@@ -491,6 +559,7 @@ int SpiceManager::naifId(const std::string& body) const {
 }
 
 bool SpiceManager::hasNaifId(const std::string& body) const {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!body.empty(), "Empty body");
 
     SpiceBoolean success = SPICEFALSE;
@@ -501,6 +570,7 @@ bool SpiceManager::hasNaifId(const std::string& body) const {
 }
 
 int SpiceManager::frameId(const std::string& frame) const {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!frame.empty(), "Empty frame");
 
     SpiceInt id = 0;
@@ -512,6 +582,7 @@ int SpiceManager::frameId(const std::string& frame) const {
 }
 
 bool SpiceManager::hasFrameId(const std::string& frame) const {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!frame.empty(), "Empty frame");
 
     SpiceInt id = 0;
@@ -522,6 +593,7 @@ bool SpiceManager::hasFrameId(const std::string& frame) const {
 double SpiceManager::spacecraftClockToET(const std::string& craft,
                                          double craftTicks) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!craft.empty(), "Empty craft");
 
     const int craftId = naifId(craft);
@@ -541,6 +613,7 @@ double SpiceManager::ephemerisTimeFromDate(const std::string& timeString) const
 }
 
 double SpiceManager::ephemerisTimeFromDate(const char* timeString) const {
+    const std::lock_guard lock(_mutex);
     double et = 0.0;
     str2et_c(timeString, &et);
     if (failed_c()) {
@@ -551,6 +624,7 @@ double SpiceManager::ephemerisTimeFromDate(const char* timeString) const {
 
 std::string SpiceManager::dateFromEphemerisTime(double ephemerisTime, const char* format)
 {
+    const std::lock_guard lock(_mutex);
     constexpr int BufferSize = 128;
     std::array<char, BufferSize> Buffer;
     std::memset(Buffer.data(), char(0), BufferSize);
@@ -574,6 +648,7 @@ std::string SpiceManager::dateFromEphemerisTime(double ephemerisTime, const char
 void SpiceManager::dateFromEphemerisTime(double ephemerisTime, char* outBuf,
                                          int bufferSize, const std::string& format) const
 {
+    const std::lock_guard lock(_mutex);
     timout_c(ephemerisTime, format.c_str(), bufferSize, outBuf);
     if (failed_c()) {
         throwSpiceError(std::format(
@@ -594,10 +669,97 @@ glm::dvec3 SpiceManager::targetPosition(const std::string& target,
                                         AberrationCorrection aberrationCorrection,
                                         double ephemerisTime, double& lightTime) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!target.empty(), "Target is not empty");
     ghoul_assert(!observer.empty(), "Observer is not empty");
     ghoul_assert(!referenceFrame.empty(), "Reference frame is not empty");
 
+    if (!_isEphemerisCacheEnabled) {
+        return uncachedTargetPosition(
+            target,
+            observer,
+            referenceFrame,
+            aberrationCorrection,
+            ephemerisTime,
+            lightTime
+        );
+    }
+
+    EphemerisCache& cache = positionCache(
+        target,
+        observer,
+        referenceFrame,
+        aberrationCorrection
+    );
+    std::array<double, 4> values;
+    const bool isCached = cache.evaluate(
+        ephemerisTime,
+        values,
+        [&](double time, std::span<double> result) {
+            try {
+                double lt = 0.0;
+                const glm::dvec3 p = uncachedTargetPosition(
+                    target,
+                    observer,
+                    referenceFrame,
+                    aberrationCorrection,
+                    time,
+                    lt
+                );
+                result[0] = p.x;
+                result[1] = p.y;
+                result[2] = p.z;
+                result[3] = lt * SpeedOfLight;
+                return true;
+            }
+            catch (const SpiceException&) {
+                return false;
+            }
+        }
+    );
+
+    if (!isCached) {
+        return uncachedTargetPosition(
+            target,
+            observer,
+            referenceFrame,
+            aberrationCorrection,
+            ephemerisTime,
+            lightTime
+        );
+    }
+
+    const glm::dvec3 position = glm::dvec3(values[0], values[1], values[2]);
+    if (_isEphemerisCacheValidating) {
+        const glm::dvec3 direct = uncachedTargetPosition(
+            target,
+            observer,
+            referenceFrame,
+            aberrationCorrection,
+            ephemerisTime,
+            lightTime
+        );
+        const glm::dvec3 diff = glm::abs(direct - position);
+        const double error = std::max({ diff.x, diff.y, diff.z });
+        _ephemerisCacheStatistics.maxPositionError =
+            std::max(_ephemerisCacheStatistics.maxPositionError, error);
+        if (error > _positionCacheTolerance) {
+            _ephemerisCacheStatistics.nValidationFailures++;
+        }
+        return direct;
+    }
+
+    lightTime = values[3] / SpeedOfLight;
+    return position;
+}
+
+glm::dvec3 SpiceManager::uncachedTargetPosition(const std::string& target,
+                                                const std::string& observer,
+                                                const std::string& referenceFrame,
+                                                AberrationCorrection aberrationCorrection,
+                                                double ephemerisTime,
+                                                double& lightTime) const
+{
     const bool targetHasCoverage = hasSpkCoverage(target, ephemerisTime);
     const bool observerHasCoverage = hasSpkCoverage(observer, ephemerisTime);
     if (!targetHasCoverage && !observerHasCoverage) {
@@ -677,6 +839,7 @@ glm::dmat3 SpiceManager::frameTransformationMatrix(const std::string& from,
                                                    const std::string& to,
                                                    double ephemerisTime) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!from.empty(), "From must not be empty");
     ghoul_assert(!to.empty(), "To must not be empty");
 
@@ -711,6 +874,7 @@ SpiceManager::SurfaceInterceptResult SpiceManager::surfaceIntercept(
                                                                      double ephemerisTime,
                                                   const glm::dvec3& directionVector) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!target.empty(), "Target must not be empty");
     ghoul_assert(!observer.empty(), "Observer must not be empty");
     ghoul_assert(target != observer, "Target and observer must be different");
@@ -757,6 +921,7 @@ bool SpiceManager::isTargetInFieldOfView(const std::string& target,
                                          AberrationCorrection aberrationCorrection,
                                          double& ephemerisTime) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!target.empty(), "Target must not be empty");
     ghoul_assert(!observer.empty(), "Observer must not be empty");
     ghoul_assert(target != observer, "Target and observer must be different");
@@ -791,6 +956,7 @@ SpiceManager::TargetStateResult SpiceManager::targetState(const std::string& tar
                                                 AberrationCorrection aberrationCorrection,
                                                                double ephemerisTime) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!target.empty(), "Target must not be empty");
     ghoul_assert(!observer.empty(), "Observer must not be empty");
     ghoul_assert(!referenceFrame.empty(), "Reference frame must not be empty");
@@ -828,6 +994,7 @@ SpiceManager::TransformMatrix SpiceManager::stateTransformMatrix(
                                                       const std::string& destinationFrame,
                                                                double ephemerisTime) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!sourceFrame.empty(), "sourceFrame must not be empty");
     ghoul_assert(!destinationFrame.empty(), "toFrame must not be empty");
 
@@ -852,9 +1019,75 @@ glm::dmat3 SpiceManager::positionTransformMatrix(const std::string& sourceFrame,
                                                  const std::string& destinationFrame,
                                                  double ephemerisTime) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!sourceFrame.empty(), "sourceFrame must not be empty");
     ghoul_assert(!destinationFrame.empty(), "destinationFrame must not be empty");
 
+    if (!_isEphemerisCacheEnabled) {
+        return uncachedPositionTransformMatrix(
+            sourceFrame,
+            destinationFrame,
+            ephemerisTime
+        );
+    }
+
+    EphemerisCache& cache = rotationCache(sourceFrame, destinationFrame);
+    glm::dmat3 result = glm::dmat3(1.0);
+    const bool isCached = cache.evaluate(
+        ephemerisTime,
+        std::span<double>(glm::value_ptr(result), 9),
+        [&](double time, std::span<double> values) {
+            try {
+                const glm::dmat3 m = uncachedPositionTransformMatrix(
+                    sourceFrame,
+                    destinationFrame,
+                    time
+                );
+                std::copy_n(glm::value_ptr(m), 9, values.begin());
+                return true;
+            }
+            catch (const SpiceException&) {
+                return false;
+            }
+        }
+    );
+
+    if (!isCached) {
+        return uncachedPositionTransformMatrix(
+            sourceFrame,
+            destinationFrame,
+            ephemerisTime
+        );
+    }
+
+    if (_isEphemerisCacheValidating) {
+        const glm::dmat3 direct = uncachedPositionTransformMatrix(
+            sourceFrame,
+            destinationFrame,
+            ephemerisTime
+        );
+        double error = 0.0;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                error = std::max(error, std::abs(direct[i][j] - result[i][j]));
+            }
+        }
+        _ephemerisCacheStatistics.maxRotationError =
+            std::max(_ephemerisCacheStatistics.maxRotationError, error);
+        if (error > _rotationCacheTolerance) {
+            _ephemerisCacheStatistics.nValidationFailures++;
+        }
+        return direct;
+    }
+
+    return result;
+}
+
+glm::dmat3 SpiceManager::uncachedPositionTransformMatrix(
+                                                      const std::string& sourceFrame,
+                                                      const std::string& destinationFrame,
+                                                      double ephemerisTime) const
+{
     glm::dmat3 result = glm::dmat3(1.0);
     pxform_c(
         sourceFrame.c_str(),
@@ -884,6 +1117,7 @@ glm::dmat3 SpiceManager::positionTransformMatrix(const std::string& sourceFrame,
                                                  double ephemerisTimeFrom,
                                                  double ephemerisTimeTo) const
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!sourceFrame.empty(), "sourceFrame must not be empty");
     ghoul_assert(!destinationFrame.empty(), "destinationFrame must not be empty");
 
@@ -914,6 +1148,7 @@ SpiceManager::fieldOfView(const std::string& instrument) const
 }
 
 SpiceManager::FieldOfViewResult SpiceManager::fieldOfView(int instrument) const {
+    const std::lock_guard lock(_mutex);
     constexpr int MaxBoundsSize = 64;
     constexpr int BufferSize = 128;
 
@@ -969,6 +1204,7 @@ SpiceManager::TerminatorEllipseResult SpiceManager::terminatorEllipse(
                                                                      double ephemerisTime,
                                                              int numberOfTerminatorPoints)
 {
+    const std::lock_guard lock(_mutex);
     ghoul_assert(!target.empty(), "Target must not be empty");
     ghoul_assert(!observer.empty(), "Observer must not be empty");
     ghoul_assert(!frame.empty(), "Frame must not be empty");
@@ -1638,6 +1874,151 @@ SpiceManager::UseException SpiceManager::exceptionHandling() const {
     return _useExceptions;
 }
 
+EphemerisCache& SpiceManager::positionCache(
+                                          const std::string& target,
+                                          const std::string& observer,
+                                          const std::string& referenceFrame,
+                                          AberrationCorrection aberrationCorrection) const
+{
+    std::string key = std::format(
+        "{}|{}|{}|{}",
+        target, observer, referenceFrame, static_cast<const char*>(aberrationCorrection)
+    );
+    auto it = _positionCaches.find(key);
+    if (it != _positionCaches.end()) {
+        return *it->second;
+    }
+
+    // Outside of the SPK coverage the positions are estimated, which is not smooth, so
+    // we only cache the times during which both bodies are covered
+    auto spkCoverage = [this](const std::string& body) -> Intervals {
+        if (!hasNaifId(body)) {
+            return Intervals();
+        }
+        const int id = naifId(body);
+        if (id == 0) {
+            // The solar system barycenter is implicitly covered at all times
+            return UnboundedCoverage;
+        }
+        const auto i = _spkIntervals.find(id);
+        return i != _spkIntervals.end() ? mergedIntervals(i->second) : Intervals();
+    };
+
+    auto cache = std::make_unique<EphemerisCache>(
+        4,
+        _positionCacheTolerance,
+        intersectedIntervals(spkCoverage(target), spkCoverage(observer))
+    );
+    EphemerisCache& res = *cache;
+    _positionCaches.emplace(std::move(key), std::move(cache));
+    return res;
+}
+
+EphemerisCache& SpiceManager::rotationCache(const std::string& sourceFrame,
+                                            const std::string& destinationFrame) const
+{
+    std::string key = std::format("{}|{}", sourceFrame, destinationFrame);
+    auto it = _rotationCaches.find(key);
+    if (it != _rotationCaches.end()) {
+        return *it->second;
+    }
+
+    // Frames that are not based on CK kernels, such as the body-fixed frames from PCK
+    // kernels, are defined at all times
+    auto ckCoverage = [this](const std::string& frame) -> Intervals {
+        if (!hasFrameId(frame)) {
+            return Intervals();
+        }
+        const auto i = _ckIntervals.find(frameId(frame));
+        return i != _ckIntervals.end() ? mergedIntervals(i->second) : UnboundedCoverage;
+    };
+
+    auto cache = std::make_unique<EphemerisCache>(
+        9,
+        _rotationCacheTolerance,
+        intersectedIntervals(ckCoverage(sourceFrame), ckCoverage(destinationFrame))
+    );
+    EphemerisCache& res = *cache;
+    _rotationCaches.emplace(std::move(key), std::move(cache));
+    return res;
+}
+
+SpiceService& SpiceManager::service() {
+    const std::lock_guard lock(_mutex);
+    if (!_service) {
+        _service = std::make_unique<SpiceService>(*this);
+    }
+    return *_service;
+}
+
+std::recursive_mutex& SpiceManager::mutex() const {
+    return _mutex;
+}
+
+void SpiceManager::setEphemerisCacheEnabled(bool enabled) {
+    const std::lock_guard lock(_mutex);
+    _isEphemerisCacheEnabled = enabled;
+    if (!enabled) {
+        clearEphemerisCache();
+    }
+}
+
+bool SpiceManager::isEphemerisCacheEnabled() const {
+    const std::lock_guard lock(_mutex);
+    return _isEphemerisCacheEnabled;
+}
+
+void SpiceManager::setEphemerisCacheTolerance(double positionTolerance,
+                                              double rotationTolerance)
+{
+    const std::lock_guard lock(_mutex);
+    ghoul_assert(positionTolerance > 0.0, "Position tolerance must be positive");
+    ghoul_assert(rotationTolerance > 0.0, "Rotation tolerance must be positive");
+
+    _positionCacheTolerance = positionTolerance;
+    _rotationCacheTolerance = rotationTolerance;
+    clearEphemerisCache();
+}
+
+void SpiceManager::setEphemerisCacheValidation(bool enabled) {
+    const std::lock_guard lock(_mutex);
+    _isEphemerisCacheValidating = enabled;
+}
+
+SpiceManager::EphemerisCacheStatistics SpiceManager::ephemerisCacheStatistics() const {
+    const std::lock_guard lock(_mutex);
+    EphemerisCacheStatistics res = _ephemerisCacheStatistics;
+    for (const auto& [key, cache] : _positionCaches) {
+        res.nHits += cache->nHits();
+        res.nMisses += cache->nMisses();
+        res.nSegments += cache->nSegments();
+    }
+    for (const auto& [key, cache] : _rotationCaches) {
+        res.nHits += cache->nHits();
+        res.nMisses += cache->nMisses();
+        res.nSegments += cache->nSegments();
+    }
+    return res;
+}
+
+void SpiceManager::resetEphemerisCacheStatistics() {
+    const std::lock_guard lock(_mutex);
+    clearEphemerisCache();
+    _ephemerisCacheStatistics = EphemerisCacheStatistics();
+}
+
+void SpiceManager::clearEphemerisCache() {
+    const std::lock_guard lock(_mutex);
+    // Keep the counters of the caches that are removed so that the statistics are not
+    // reset every time a kernel is loaded
+    EphemerisCacheStatistics stats = ephemerisCacheStatistics();
+    stats.nSegments = 0;
+    _ephemerisCacheStatistics = stats;
+
+    _positionCaches.clear();
+    _rotationCaches.clear();
+}
+
 LuaLibrary SpiceManager::luaLibrary() {
     return {
         "spice",
@@ -1648,7 +2029,8 @@ LuaLibrary SpiceManager::luaLibrary() {
             codegen::lua::SpiceBodies,
             codegen::lua::RotationMatrix,
             codegen::lua::Position,
-            codegen::lua::ConvertTLEtoSPK
+            codegen::lua::ConvertTLEtoSPK,
+            codegen::lua::EphemerisCacheStatistics
         }
     };
 }
@@ -22,6 +22,7 @@
  * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
  ****************************************************************************************/
 
+#include <ghoul/misc/dictionary.h>
 #include <ghoul/misc/exception.h>
 #include <ghoul/misc/stringhelper.h>
 #include <ghoul/format.h>
@@ -296,6 +297,29 @@ namespace {
     return bodyId;
 }
 
+/**
+ * Returns the statistics of the ephemeris cache as a table with the number of queries
+ * that were served from the cache (`Hits`) and that had to be passed on to SPICE
+ * (`Misses`), the number of currently cached polynomial segments (`Segments`) as well as
+ * the results of the validation mode, which are the number of cached values that were
+ * less accurate than the tolerance (`ValidationFailures`) and the largest position error
+ * in km (`MaxPositionError`) and rotation matrix element error (`MaxRotationError`).
+ */
+[[codegen::luawrap]] ghoul::Dictionary ephemerisCacheStatistics() {
+    const SpiceManager::EphemerisCacheStatistics stats =
+        SpiceManager::ref().ephemerisCacheStatistics();
+
+    ghoul::Dictionary res;
+    res.setValue("Enabled", SpiceManager::ref().isEphemerisCacheEnabled());
+    res.setValue("Hits", static_cast<double>(stats.nHits));
+    res.setValue("Misses", static_cast<double>(stats.nMisses));
+    res.setValue("Segments", static_cast<double>(stats.nSegments));
+    res.setValue("ValidationFailures", static_cast<double>(stats.nValidationFailures));
+    res.setValue("MaxPositionError", stats.maxPositionError);
+    res.setValue("MaxRotationError", stats.maxRotationError);
+    return res;
+}
+
 } // namespace
 
 #include "spicemanager_lua_codegen.cpp"
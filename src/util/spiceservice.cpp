@@ -0,0 +1,225 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <openspace/util/spiceservice.h>
+
+#include <memory>
+#include <utility>
+
+namespace openspace {
+
+SpiceService::SpiceService(const SpiceManager& spice)
+    : _spice(spice)
+    , _worker(&SpiceService::work, this)
+{}
+
+SpiceService::~SpiceService() {
+    {
+        const std::lock_guard lock(_mutex);
+        _shouldStop = true;
+    }
+    _condition.notify_one();
+    _worker.join();
+}
+
+template <typename T>
+std::future<T> SpiceService::submit(std::function<T()> batch) {
+    // std::function requires a copyable target, so the task has to be shared
+    auto task = std::make_shared<std::packaged_task<T()>>(std::move(batch));
+    std::future<T> res = task->get_future();
+    {
+        const std::lock_guard lock(_mutex);
+        _batches.emplace_back([task]() { (*task)(); });
+    }
+    _condition.notify_one();
+    return res;
+}
+
+std::future<std::vector<glm::dvec3>> SpiceService::targetPositions(std::string target,
+                                                                std::string observer,
+                                                          std::string referenceFrame,
+                              SpiceManager::AberrationCorrection aberrationCorrection,
+                                                  std::vector<double> ephemerisTimes)
+{
+    return submit<std::vector<glm::dvec3>>(
+        [this, target = std::move(target), observer = std::move(observer),
+         referenceFrame = std::move(referenceFrame), aberrationCorrection,
+         ephemerisTimes = std::move(ephemerisTimes)]()
+        {
+            std::vector<glm::dvec3> res;
+            res.reserve(ephemerisTimes.size());
+            for (const double et : ephemerisTimes) {
+                res.push_back(_spice.targetPosition(
+                    target,
+                    observer,
+                    referenceFrame,
+                    aberrationCorrection,
+                    et
+                ));
+            }
+            return res;
+        }
+    );
+}
+
+std::future<std::vector<SpiceManager::TargetStateResult>> SpiceService::targetStates(
+                                                                   std::string target,
+                                                                 std::string observer,
+                                                           std::string referenceFrame,
+                              SpiceManager::AberrationCorrection aberrationCorrection,
+                                                  std::vector<double> ephemerisTimes)
+{
+    return submit<std::vector<SpiceManager::TargetStateResult>>(
+        [this, target = std::move(target), observer = std::move(observer),
+         referenceFrame = std::move(referenceFrame), aberrationCorrection,
+         ephemerisTimes = std::move(ephemerisTimes)]()
+        {
+            std::vector<SpiceManager::TargetStateResult> res;
+            res.reserve(ephemerisTimes.size());
+            for (const double et : ephemerisTimes) {
+                res.push_back(_spice.targetState(
+                    target,
+                    observer,
+                    referenceFrame,
+                    aberrationCorrection,
+                    et
+                ));
+            }
+            return res;
+        }
+    );
+}
+
+std::future<std::vector<glm::dmat3>> SpiceService::positionTransformMatrices(
+                                                              std::string sourceFrame,
+                                                         std::string destinationFrame,
+                                                  std::vector<double> ephemerisTimes)
+{
+    return submit<std::vector<glm::dmat3>>(
+        [this, sourceFrame = std::move(sourceFrame),
+         destinationFrame = std::move(destinationFrame),
+         ephemerisTimes = std::move(ephemerisTimes)]()
+        {
+            std::vector<glm::dmat3> res;
+            res.reserve(ephemerisTimes.size());
+            for (const double et : ephemerisTimes) {
+                res.push_back(
+                    _spice.positionTransformMatrix(sourceFrame, destinationFrame, et)
+                );
+            }
+            return res;
+        }
+    );
+}
+
+std::future<std::vector<bool>> SpiceService::targetsInFieldOfView(
+                                                     std::vector<std::string> targets,
+                                                                 std::string observer,
+                                                           std::string referenceFrame,
+                                                               std::string instrument,
+                                               SpiceManager::FieldOfViewMethod method,
+                              SpiceManager::AberrationCorrection aberrationCorrection,
+                                                                 double ephemerisTime)
+{
+    return submit<std::vector<bool>>(
+        [this, targets = std::move(targets), observer = std::move(observer),
+         referenceFrame = std::move(referenceFrame), instrument = std::move(instrument),
+         method, aberrationCorrection, ephemerisTime]()
+        {
+            std::vector<bool> res;
+            res.reserve(targets.size());
+            for (const std::string& target : targets) {
+                // isTargetInFieldOfView takes the time by reference
+                double et = ephemerisTime;
+                res.push_back(_spice.isTargetInFieldOfView(
+                    target,
+                    observer,
+                    referenceFrame,
+                    instrument,
+                    method,
+                    aberrationCorrection,
+                    et
+                ));
+            }
+            return res;
+        }
+    );
+}
+
+std::future<std::vector<SpiceManager::SurfaceInterceptResult>>
+SpiceService::surfaceIntercepts(std::string target, std::string observer,
+                                std::string fovFrame, std::string referenceFrame,
+                                SpiceManager::AberrationCorrection aberrationCorrection,
+                                double ephemerisTime,
+                                std::vector<glm::dvec3> directionVectors)
+{
+    return submit<std::vector<SpiceManager::SurfaceInterceptResult>>(
+        [this, target = std::move(target), observer = std::move(observer),
+         fovFrame = std::move(fovFrame), referenceFrame = std::move(referenceFrame),
+         aberrationCorrection, ephemerisTime,
+         directionVectors = std::move(directionVectors)]()
+        {
+            std::vector<SpiceManager::SurfaceInterceptResult> res;
+            res.reserve(directionVectors.size());
+            for (const glm::dvec3& direction : directionVectors) {
+                res.push_back(_spice.surfaceIntercept(
+                    target,
+                    observer,
+                    fovFrame,
+                    referenceFrame,
+                    aberrationCorrection,
+                    ephemerisTime,
+                    direction
+                ));
+            }
+            return res;
+        }
+    );
+}
+
+size_t SpiceService::nQueuedBatches() const {
+    const std::lock_guard lock(_mutex);
+    return _batches.size();
+}
+
+void SpiceService::work() {
+    while (true) {
+        std::function<void()> batch;
+        {
+            std::unique_lock lock(_mutex);
+            _condition.wait(lock, [this]() { return _shouldStop || !_batches.empty(); });
+            if (_shouldStop) {
+                return;
+            }
+            batch = std::move(_batches.front());
+            _batches.pop_front();
+        }
+
+        // Each call into the SpiceManager locks it individually, so the main thread only
+        // ever has to wait for a single query rather than for the whole batch
+        batch();
+    }
+}
+
+} // namespace openspace
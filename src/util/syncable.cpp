@@ -28,6 +28,10 @@ namespace openspace {
 
 void Syncable::preSync(bool) {}
 
+bool Syncable::isSnapshot() const {
+    return false;
+}
+
 void Syncable::postSync(bool) {}
 
 } // namespace openspace
@@ -112,9 +112,12 @@ void SyncBuffer::setData(std::vector<std::byte> data) {
     _dataStream = std::move(data);
 }
 
-std::vector<std::byte> SyncBuffer::data() {
-    _dataStream.resize(_encodeOffset);
-    return _dataStream;
+void SyncBuffer::setData(std::span<const std::byte> data) {
+    _dataStream.assign(data.begin(), data.end());
+}
+
+std::span<const std::byte> SyncBuffer::data() const {
+    return std::span<const std::byte>(_dataStream.data(), _encodeOffset);
 }
 
 void SyncBuffer::reset() {
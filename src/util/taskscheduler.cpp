@@ -0,0 +1,284 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+#include <openspace/util/taskscheduler.h>
+
+#include <ghoul/format.h>
+#include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/exception.h>
+#include <ghoul/misc/profiling.h>
+#include <chrono>
+#include <exception>
+#include <utility>
+
+namespace {
+    constexpr std::string_view _loggerCat = "TaskScheduler";
+
+    // Identifies the scheduler and the worker index if the current thread is one of the
+    // workers, which is used to keep tasks that are enqueued from a task on the same
+    // worker and to let waiting workers help out
+    thread_local openspace::TaskScheduler* currentScheduler = nullptr;
+    thread_local unsigned int currentWorker = 0;
+} // namespace
+
+namespace openspace {
+
+TaskScheduler::TaskGroup::TaskGroup()
+    : _state(std::make_shared<State>())
+{}
+
+void TaskScheduler::TaskGroup::cancel() {
+    _state->isCancelled = true;
+}
+
+bool TaskScheduler::TaskGroup::isCancelled() const {
+    return _state->isCancelled;
+}
+
+size_t TaskScheduler::TaskGroup::nOutstandingTasks() const {
+    const std::unique_lock lock(_state->mutex);
+    return _state->nOutstanding;
+}
+
+void TaskScheduler::TaskGroup::wait() const {
+    ZoneScoped;
+
+    if (currentScheduler) {
+        // We are running on a worker thread, so instead of blocking the worker, we keep
+        // it busy with other tasks. These might be the ones we are waiting for
+        while (nOutstandingTasks() > 0) {
+            Task task;
+            if (currentScheduler->pop(currentWorker, task)) {
+                currentScheduler->execute(task);
+            }
+            else {
+                std::unique_lock lock(_state->mutex);
+                _state->condition.wait_for(
+                    lock,
+                    std::chrono::milliseconds(1),
+                    [this]() { return _state->nOutstanding == 0; }
+                );
+            }
+        }
+    }
+    else {
+        std::unique_lock lock(_state->mutex);
+        _state->condition.wait(lock, [this]() { return _state->nOutstanding == 0; });
+    }
+}
+
+TaskScheduler::TaskScheduler(unsigned int nThreads) {
+    ghoul_assert(nThreads > 0, "nThreads must be bigger than 0");
+
+    _queues.reserve(nThreads);
+    for (unsigned int i = 0; i < nThreads; i++) {
+        _queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    _workers.reserve(nThreads);
+    for (unsigned int i = 0; i < nThreads; i++) {
+        _workers.emplace_back(&TaskScheduler::work, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        const std::unique_lock lock(_sleepMutex);
+        _shouldStop = true;
+    }
+    _sleepCondition.notify_all();
+
+    for (std::thread& worker : _workers) {
+        worker.join();
+    }
+
+    // Release everyone that is still waiting for tasks that will never run
+    for (const std::unique_ptr<WorkerQueue>& queue : _queues) {
+        for (std::deque<Task>& tasks : queue->tasks) {
+            for (const Task& task : tasks) {
+                if (task.group) {
+                    const std::unique_lock lock(task.group->mutex);
+                    task.group->nOutstanding--;
+                    task.group->condition.notify_all();
+                }
+            }
+        }
+    }
+}
+
+void TaskScheduler::enqueue(std::function<void()> task, Priority priority) {
+    push({ std::move(task), nullptr }, priority);
+}
+
+void TaskScheduler::enqueue(std::function<void()> task, Priority priority,
+                            const TaskGroup& group)
+{
+    {
+        const std::unique_lock lock(group._state->mutex);
+        group._state->nOutstanding++;
+    }
+    push({ std::move(task), group._state }, priority);
+}
+
+void TaskScheduler::parallelFor(size_t n, const std::function<void(size_t)>& function,
+                                Priority priority)
+{
+    ZoneScoped;
+
+    if (n == 0) {
+        return;
+    }
+
+    TaskGroup group;
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    auto call = [&](size_t i) {
+        try {
+            function(i);
+        }
+        catch (...) {
+            const std::unique_lock lock(exceptionMutex);
+            if (!exception) {
+                exception = std::current_exception();
+            }
+            group.cancel();
+        }
+    };
+
+    for (size_t i = 1; i < n; i++) {
+        enqueue([&call, i]() { call(i); }, priority, group);
+    }
+    call(0);
+    group.wait();
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+unsigned int TaskScheduler::nThreads() const {
+    return static_cast<unsigned int>(_workers.size());
+}
+
+size_t TaskScheduler::nQueuedTasks() const {
+    return _nQueued;
+}
+
+void TaskScheduler::push(Task task, Priority priority) {
+    const unsigned int worker = currentScheduler == this ?
+        currentWorker :
+        _nextQueue++ % static_cast<unsigned int>(_queues.size());
+
+    {
+        // Taking the lock guarantees that a worker that is about to fall asleep either
+        // sees the new task or is already waiting to be notified. The counter is
+        // increased first so that it never drops below zero when the task is popped
+        const std::unique_lock lock(_sleepMutex);
+        _nQueued++;
+    }
+
+    WorkerQueue& queue = *_queues[worker];
+    {
+        const std::unique_lock lock(queue.mutex);
+        queue.tasks[static_cast<int>(priority)].push_back(std::move(task));
+    }
+    _sleepCondition.notify_one();
+}
+
+bool TaskScheduler::pop(unsigned int worker, Task& task) {
+    const size_t nQueues = _queues.size();
+    for (size_t priority = 0; priority < 3; priority++) {
+        // Our own queue first, taking the newest task
+        {
+            WorkerQueue& queue = *_queues[worker];
+            const std::unique_lock lock(queue.mutex);
+            std::deque<Task>& tasks = queue.tasks[priority];
+            if (!tasks.empty()) {
+                task = std::move(tasks.back());
+                tasks.pop_back();
+                _nQueued--;
+                return true;
+            }
+        }
+
+        // Then try to steal the oldest task from one of the other workers
+        for (size_t i = 1; i < nQueues; i++) {
+            WorkerQueue& queue = *_queues[(worker + i) % nQueues];
+            const std::unique_lock lock(queue.mutex);
+            std::deque<Task>& tasks = queue.tasks[priority];
+            if (!tasks.empty()) {
+                task = std::move(tasks.front());
+                tasks.pop_front();
+                _nQueued--;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::execute(Task& task) {
+    ZoneScoped;
+
+    if (!task.group || !task.group->isCancelled) {
+        try {
+            task.function();
+        }
+        catch (const ghoul::RuntimeError& e) {
+            LERRORC(e.component, e.message);
+        }
+        catch (const std::exception& e) {
+            LERROR(std::format("Task failed: {}", e.what()));
+        }
+    }
+
+    if (task.group) {
+        const std::unique_lock lock(task.group->mutex);
+        task.group->nOutstanding--;
+        if (task.group->nOutstanding == 0) {
+            task.group->condition.notify_all();
+        }
+    }
+}
+
+void TaskScheduler::work(unsigned int worker) {
+    currentScheduler = this;
+    currentWorker = worker;
+
+    while (true) {
+        Task task;
+        if (pop(worker, task)) {
+            execute(task);
+            continue;
+        }
+
+        std::unique_lock lock(_sleepMutex);
+        _sleepCondition.wait(lock, [this]() { return _shouldStop || _nQueued > 0; });
+        if (_shouldStop) {
+            return;
+        }
+    }
+}
+
+} // namespace openspace
@@ -0,0 +1,325 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <modules/globebrowsing/src/chunktree.h>
+#include <openspace/util/ellipsoid.h>
+#include <openspace/util/geodetic.h>
+#include <ghoul/glm.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    const glm::dvec3 EarthRadii = glm::dvec3(6378137.0, 6378137.0, 6356752.314245);
+    constexpr int MaxLevel = 16;
+
+    // Deterministic heights that vary between the tiles
+    BoundingHeights syntheticHeights(const TileIndex& tileIndex) {
+        return {
+            .min = -100.f * static_cast<float>(tileIndex.x % 7),
+            .max = 1000.f + 500.f * static_cast<float>(tileIndex.y % 5),
+            .isAvailable = true,
+            .tileOK = true
+        };
+    }
+
+    // A globe without any tile providers that splits and merges its chunks in the same
+    // way as the RenderableGlobe does
+    class SyntheticGlobe {
+    public:
+        SyntheticGlobe()
+            : ellipsoid(EarthRadii)
+            , _left(std::make_unique<Chunk>(TileIndex(0, 0, 1)))
+            , _right(std::make_unique<Chunk>(TileIndex(1, 0, 1)))
+        {
+            _left->corners = boundingCornersForChunk(
+                *_left,
+                ellipsoid,
+                syntheticHeights(_left->tileIndex)
+            );
+            _right->corners = boundingCornersForChunk(
+                *_right,
+                ellipsoid,
+                syntheticHeights(_right->tileIndex)
+            );
+        }
+
+        ~SyntheticGlobe() {
+            merge(*_left);
+            merge(*_right);
+        }
+
+        std::vector<Chunk*> chunks() {
+            std::vector<Chunk*> res;
+            collectChunks(*_left, res);
+            collectChunks(*_right, res);
+            return res;
+        }
+
+        std::vector<ChunkLodInput> inputs() {
+            std::vector<ChunkLodInput> res;
+            for (Chunk* chunk : chunks()) {
+                res.push_back({
+                    .chunk = chunk,
+                    .heights = syntheticHeights(chunk->tileIndex),
+                    .levelByAvailableData = UnknownDesiredLevel
+                });
+            }
+            return res;
+        }
+
+        void apply() {
+            apply(*_left);
+            apply(*_right);
+        }
+
+        void update(const ChunkLodSettings& settings, bool parallel) {
+            const std::vector<ChunkLodInput> in = inputs();
+            evaluateChunks(in, ellipsoid, settings, parallel);
+            apply();
+        }
+
+        const Ellipsoid ellipsoid;
+
+    private:
+        void split(Chunk& chunk) {
+            for (size_t i = 0; i < chunk.children.size(); i++) {
+                const TileIndex ti = chunk.tileIndex.child(static_cast<Quad>(i));
+                chunk.children[i] = new Chunk(ti);
+                chunk.children[i]->corners = boundingCornersForChunk(
+                    *chunk.children[i],
+                    ellipsoid,
+                    syntheticHeights(chunk.children[i]->tileIndex)
+                );
+            }
+        }
+
+        void merge(Chunk& chunk) {
+            for (Chunk*& child : chunk.children) {
+                if (child) {
+                    merge(*child);
+                    delete child;
+                    child = nullptr;
+                }
+            }
+        }
+
+        bool apply(Chunk& chunk) {
+            if (isLeaf(chunk)) {
+                if (chunk.status == Chunk::Status::WantSplit) {
+                    split(chunk);
+                }
+                return chunk.status == Chunk::Status::WantMerge;
+            }
+
+            int mergeMask = 0;
+            for (int i = 0; i < 4; i++) {
+                if (apply(*chunk.children[i])) {
+                    mergeMask |= (1 << i);
+                }
+            }
+            if (mergeMask == 0xf && chunk.status != Chunk::Status::WantSplit) {
+                merge(chunk);
+            }
+            return false;
+        }
+
+        std::unique_ptr<Chunk> _left;
+        std::unique_ptr<Chunk> _right;
+    };
+
+    ChunkLodSettings settingsFor(const glm::dvec3& cameraPosition,
+                                 const glm::dvec3& lookAt)
+    {
+        const glm::dvec3 up =
+            std::abs(glm::normalize(cameraPosition - lookAt).z) > 0.99 ?
+            glm::dvec3(1.0, 0.0, 0.0) :
+            glm::dvec3(0.0, 0.0, 1.0);
+        const glm::dmat4 view = glm::lookAt(cameraPosition, lookAt, up);
+        const glm::dmat4 projection = glm::perspective(
+            glm::radians(60.0),
+            16.0 / 9.0,
+            1.0,
+            1e10
+        );
+
+        return {
+            .modelViewProjection = projection * view,
+            .cameraPosition = cameraPosition,
+            .lodScaleFactor = 15.0,
+            .minLevel = 2,
+            .maxLevel = MaxLevel,
+            .updateCorners = false
+        };
+    }
+
+    // The camera starts far away from the globe, descends towards the surface, and then
+    // flies along the equator while looking ahead
+    std::vector<ChunkLodSettings> cameraPath(const Ellipsoid& ellipsoid, int nFrames) {
+        std::vector<ChunkLodSettings> res;
+        res.reserve(nFrames);
+        const double radius = ellipsoid.maximumRadius();
+        for (int i = 0; i < nFrames; i++) {
+            const double t = static_cast<double>(i) / static_cast<double>(nFrames - 1);
+            if (t < 0.5) {
+                // Descent from 10 radii to 10 km above the surface
+                const double altitude = glm::mix(10.0 * radius, 10000.0, 2.0 * t);
+                const glm::dvec3 direction = glm::normalize(glm::dvec3(1.0, 0.2, 0.3));
+                res.push_back(
+                    settingsFor(direction * (radius + altitude), glm::dvec3(0.0))
+                );
+            }
+            else {
+                // Flyover at 10 km altitude looking towards the horizon
+                const double lon = glm::mix(0.2, 1.2, 2.0 * (t - 0.5));
+                const Geodetic3 camera = {
+                    .geodetic2 = Geodetic2{ .lat = 0.3, .lon = lon },
+                    .height = 10000.0
+                };
+                const Geodetic3 target = {
+                    .geodetic2 = Geodetic2{ .lat = 0.3, .lon = lon + 0.05 },
+                    .height = 0.0
+                };
+                res.push_back(settingsFor(
+                    ellipsoid.cartesianPosition(camera),
+                    ellipsoid.cartesianPosition(target)
+                ));
+            }
+        }
+        return res;
+    }
+} // namespace
+
+TEST_CASE("ChunkTree: Collect Chunks", "[chunktree]") {
+    Chunk root = Chunk(TileIndex(0, 0, 1));
+    std::vector<std::unique_ptr<Chunk>> children;
+    for (size_t i = 0; i < root.children.size(); i++) {
+        children.push_back(
+            std::make_unique<Chunk>(root.tileIndex.child(static_cast<Quad>(i)))
+        );
+        root.children[i] = children.back().get();
+    }
+
+    std::vector<Chunk*> chunks;
+    collectChunks(root, chunks);
+    REQUIRE(chunks.size() == 5);
+    for (size_t i = 0; i < 4; i++) {
+        CHECK(chunks[i] == children[i].get());
+    }
+    // The parent is visited after its children
+    CHECK(chunks[4] == &root);
+}
+
+TEST_CASE("ChunkTree: Level Of Detail", "[chunktree]") {
+    SyntheticGlobe globe;
+    const glm::dvec3 direction = glm::dvec3(1.0, 0.0, 0.0);
+    const double radius = globe.ellipsoid.maximumRadius();
+
+    SECTION("Far away") {
+        const ChunkLodSettings settings =
+            settingsFor(direction * 1000.0 * radius, glm::dvec3(0.0));
+        for (int i = 0; i < MaxLevel; i++) {
+            globe.update(settings, false);
+        }
+        // Far away from the globe only the coarsest chunks are used
+        for (const Chunk* chunk : globe.chunks()) {
+            CHECK(chunk->tileIndex.level <= 2);
+        }
+    }
+
+    SECTION("Close to the surface") {
+        const ChunkLodSettings settings =
+            settingsFor(direction * (radius + 1000.0), glm::dvec3(0.0));
+        for (int i = 0; i < MaxLevel; i++) {
+            globe.update(settings, false);
+        }
+
+        int maxLevel = 0;
+        bool hasCulledChunks = false;
+        for (const Chunk* chunk : globe.chunks()) {
+            maxLevel = std::max(maxLevel, static_cast<int>(chunk->tileIndex.level));
+            hasCulledChunks |= !chunk->isVisible;
+            if (!chunk->isVisible) {
+                CHECK(chunk->tilePriority == 0.0);
+            }
+            else {
+                CHECK(chunk->tilePriority >= 1.0);
+            }
+        }
+        CHECK(maxLevel > 10);
+        CHECK(hasCulledChunks);
+    }
+}
+
+TEST_CASE("ChunkTree: Parallel Evaluation Is Deterministic", "[chunktree]") {
+    SyntheticGlobe sequential;
+    SyntheticGlobe parallel;
+
+    for (const ChunkLodSettings& settings : cameraPath(sequential.ellipsoid, 60)) {
+        sequential.update(settings, false);
+        parallel.update(settings, true);
+
+        const std::vector<Chunk*> seqChunks = sequential.chunks();
+        const std::vector<Chunk*> parChunks = parallel.chunks();
+        REQUIRE(seqChunks.size() == parChunks.size());
+        for (size_t i = 0; i < seqChunks.size(); i++) {
+            const Chunk& s = *seqChunks[i];
+            const Chunk& p = *parChunks[i];
+            REQUIRE(s.tileIndex.hashKey() == p.tileIndex.hashKey());
+            REQUIRE(s.status == p.status);
+            REQUIRE(s.isVisible == p.isVisible);
+            REQUIRE(s.tilePriority == p.tilePriority);
+            REQUIRE(s.corners == p.corners);
+        }
+    }
+}
+
+TEST_CASE("ChunkTree: Benchmark", "[chunktree][.benchmark]") {
+    constexpr int NFrames = 400;
+
+    // Fly along the camera path to end up with the large chunk tree of a low flyover
+    SyntheticGlobe globe;
+    const std::vector<ChunkLodSettings> path = cameraPath(globe.ellipsoid, NFrames);
+    for (const ChunkLodSettings& settings : path) {
+        globe.update(settings, true);
+    }
+
+    // Recomputing the corners is the worst case that happens whenever the height layers
+    // change
+    ChunkLodSettings settings = path.back();
+    settings.updateCorners = true;
+    const std::vector<ChunkLodInput> in = globe.inputs();
+
+    BENCHMARK("Sequential") {
+        evaluateChunks(in, globe.ellipsoid, settings, false);
+    };
+    BENCHMARK("Parallel") {
+        evaluateChunks(in, globe.ellipsoid, settings, true);
+    };
+}
@@ -0,0 +1,427 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <openspace/data/csvloader.h>
+#include <openspace/data/dataloader.h>
+#include <openspace/data/speckloader.h>
+#include <openspace/util/memorymappedfile.h>
+#include <ghoul/filesystem/filesystem.h>
+#include <ghoul/format.h>
+#include <ghoul/misc/exception.h>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace openspace;
+using namespace openspace::dataloader;
+
+namespace {
+    void writeSpeckFile(const std::filesystem::path& path, int nRows) {
+        std::ofstream file = std::ofstream(path);
+        file << "# Synthetic dataset\n";
+        file << "datavar 0 colorb_v\n";
+        file << "datavar 1 lum\n";
+        file << "datavar 2 absmag\n";
+        file << "texturevar 2\n";
+        file << "texture -M 1 halo.sgi\n";
+        file << "\n";
+
+        std::mt19937 gen = std::mt19937(1337);
+        std::uniform_real_distribution<float> dist(-1000.f, 1000.f);
+        for (int i = 0; i < nRows; i++) {
+            file << dist(gen) << ' ' << dist(gen) << ' ' << dist(gen) << ' ';
+            if (i % 97 == 0) {
+                file << "nan ";
+            }
+            else {
+                file << dist(gen) << ' ';
+            }
+            file << dist(gen) << ' ' << dist(gen);
+            if (i % 3 == 0) {
+                file << " # Star " << i;
+            }
+            // Mix in Windows line endings and comment lines
+            file << ((i % 5 == 0) ? "\r\n" : "\n");
+            if (i % 1000 == 0) {
+                file << "# A comment\n";
+            }
+        }
+        // Also include a row that is filtered out because all values are zero
+        file << "0 0 0 0 0 0";
+    }
+
+    void writeCsvFile(const std::filesystem::path& path, int nRows) {
+        std::ofstream file = std::ofstream(path);
+        file << "x,y,z,name,value,other\n";
+
+        std::mt19937 gen = std::mt19937(1337);
+        std::uniform_real_distribution<float> dist(-1000.f, 1000.f);
+        for (int i = 0; i < nRows; i++) {
+            file << dist(gen) << ',' << dist(gen) << ',' << dist(gen) << ',';
+            file << "Star " << i << ',';
+            if (i % 13 == 0) {
+                file << ",";
+            }
+            else {
+                file << dist(gen) << ',';
+            }
+            file << dist(gen) << '\n';
+        }
+    }
+
+    void compareDatasets(const Dataset& lhs, const Dataset& rhs) {
+        REQUIRE(lhs.variables.size() == rhs.variables.size());
+        for (size_t i = 0; i < lhs.variables.size(); i++) {
+            CHECK(lhs.variables[i].index == rhs.variables[i].index);
+            CHECK(lhs.variables[i].name == rhs.variables[i].name);
+        }
+
+        REQUIRE(lhs.textures.size() == rhs.textures.size());
+        for (size_t i = 0; i < lhs.textures.size(); i++) {
+            CHECK(lhs.textures[i].index == rhs.textures[i].index);
+            CHECK(lhs.textures[i].file == rhs.textures[i].file);
+        }
+
+        CHECK(lhs.textureDataIndex == rhs.textureDataIndex);
+        CHECK(lhs.orientationDataIndex == rhs.orientationDataIndex);
+        CHECK(lhs.maxPositionComponent == rhs.maxPositionComponent);
+
+        REQUIRE(lhs.entries.size() == rhs.entries.size());
+        for (size_t i = 0; i < lhs.entries.size(); i++) {
+            const Dataset::Entry& l = lhs.entries[i];
+            const Dataset::Entry& r = rhs.entries[i];
+            CHECK(l.position == r.position);
+            CHECK(l.comment == r.comment);
+            REQUIRE(l.data.size() == r.data.size());
+            for (size_t j = 0; j < l.data.size(); j++) {
+                if (std::isnan(l.data[j])) {
+                    CHECK(std::isnan(r.data[j]));
+                }
+                else {
+                    CHECK(l.data[j] == r.data[j]);
+                }
+            }
+        }
+    }
+} // namespace
+
+TEST_CASE("DataLoader: Parallel Speck", "[dataloader]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/parallel.speck");
+    writeSpeckFile(path, 25000);
+
+    const Dataset sequential = speck::loadSpeckFile(path);
+    const Dataset parallel = speck::loadSpeckFileParallel(path);
+    CHECK(sequential.entries.size() == 25000);
+    compareDatasets(sequential, parallel);
+
+    DataMapping mapping;
+    mapping.missingDataValue = sequential.entries[1].data[0];
+    const Dataset sequentialMissing = speck::loadSpeckFile(path, mapping);
+    const Dataset parallelMissing = speck::loadSpeckFileParallel(path, mapping);
+    CHECK(std::isnan(parallelMissing.entries[1].data[0]));
+    compareDatasets(sequentialMissing, parallelMissing);
+
+    // Small chunks split the file into hundreds of pieces that have to be concatenated
+    const Dataset chunked = speck::loadSpeckFileParallel(path, std::nullopt, 4096);
+    compareDatasets(sequential, chunked);
+    const Dataset chunkedMissing = speck::loadSpeckFileParallel(path, mapping, 4096);
+    compareDatasets(sequentialMissing, chunkedMissing);
+}
+
+TEST_CASE("DataLoader: Parallel Speck Error", "[dataloader]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/parallel-error.speck");
+    {
+        std::ofstream file = std::ofstream(path);
+        file << "datavar 0 value\n";
+        file << "1 2 3 4\n";
+        file << "1 2 3 abc\n";
+    }
+
+    CHECK_THROWS_AS(speck::loadSpeckFileParallel(path), ghoul::RuntimeError);
+
+    // The line number reported for an error in a later chunk has to account for the
+    // lines in all chunks before it
+    {
+        std::ofstream file = std::ofstream(path);
+        file << "datavar 0 value\n";
+        for (int i = 0; i < 5000; i++) {
+            file << "1 2 3 4\n";
+        }
+        file << "1 2 3 abc\n";
+        for (int i = 0; i < 100; i++) {
+            file << "1 2 3 4\n";
+        }
+    }
+
+    constexpr std::string_view Message = "data line 5002";
+    CHECK_THROWS_WITH(
+        speck::loadSpeckFile(path),
+        Catch::Matchers::ContainsSubstring(std::string(Message))
+    );
+    CHECK_THROWS_WITH(
+        speck::loadSpeckFileParallel(path, std::nullopt, 1024),
+        Catch::Matchers::ContainsSubstring(std::string(Message))
+    );
+}
+
+TEST_CASE("DataLoader: Parallel CSV", "[dataloader]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/parallel.csv");
+    writeCsvFile(path, 25000);
+
+    const Dataset sequential = csv::loadCsvFile(path);
+    const Dataset parallel = csv::loadCsvFileParallel(path);
+    CHECK(sequential.entries.size() == 25000);
+    compareDatasets(sequential, parallel);
+
+    const Dataset chunked = csv::loadCsvFileParallel(path, std::nullopt, 4096);
+    compareDatasets(sequential, chunked);
+}
+
+TEST_CASE("DataLoader: Split At Line Boundaries", "[dataloader]") {
+    auto join = [](const std::vector<std::string_view>& pieces) {
+        std::string res;
+        for (std::string_view piece : pieces) {
+            res += piece;
+        }
+        return res;
+    };
+
+    constexpr std::string_view Data = "a\nbb\nccc\ndddd\neeeee\nf";
+    for (size_t nChunks = 1; nChunks <= Data.size() + 2; nChunks++) {
+        const std::vector<std::string_view> pieces = splitAtLineBoundaries(
+            Data,
+            nChunks
+        );
+        CHECK(pieces.size() <= nChunks);
+        CHECK(join(pieces) == Data);
+        for (size_t i = 0; i + 1 < pieces.size(); i++) {
+            CHECK(!pieces[i].empty());
+            CHECK(pieces[i].back() == '\n');
+        }
+    }
+
+    // A single long line cannot be split
+    const std::vector<std::string_view> single = splitAtLineBoundaries("abcdefgh", 4);
+    REQUIRE(single.size() == 1);
+    CHECK(single[0] == "abcdefgh");
+
+    // Data that ends with a newline does not produce an empty trailing piece
+    const std::vector<std::string_view> trailing = splitAtLineBoundaries("ab\ncd\n", 2);
+    REQUIRE(trailing.size() == 2);
+    CHECK(trailing[0] == "ab\n");
+    CHECK(trailing[1] == "cd\n");
+
+    CHECK(splitAtLineBoundaries("", 3).empty());
+}
+
+TEST_CASE("DataLoader: Columnar Roundtrip", "[dataloader]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/columnar.speck");
+    writeSpeckFile(path, 1000);
+
+    const Dataset dataset = speck::loadSpeckFile(path);
+    const ColumnarDataset columnar = ColumnarDataset::createFromDataset(dataset);
+    CHECK(columnar.nEntries() == dataset.entries.size());
+    CHECK(columnar.nColumns() == dataset.entries[0].data.size());
+    CHECK(columnar.comment(0) == dataset.entries[0].comment);
+    CHECK_FALSE(columnar.comment(1).has_value());
+
+    for (size_t i = 0; i < columnar.nColumns(); i++) {
+        CHECK(columnar.column(i).size() == dataset.entries.size());
+        CHECK(columnar.column(i)[5] == dataset.entries[5].data[i]);
+    }
+
+    compareDatasets(dataset, columnar.toDataset());
+}
+
+TEST_CASE("DataLoader: Columnar Range And Normalization", "[dataloader]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/columnar.speck");
+    writeSpeckFile(path, 1003);
+
+    Dataset dataset = speck::loadSpeckFile(path);
+    ColumnarDataset columnar = ColumnarDataset::createFromDataset(dataset);
+
+    for (const Dataset::Variable& v : dataset.variables) {
+        CHECK(columnar.findValueRange(v.index) == dataset.findValueRange(v.index));
+        CHECK(columnar.findValueRange(v.name) == dataset.findValueRange(v.name));
+    }
+    CHECK(columnar.findValueRange(100) == glm::vec2(0.f));
+    CHECK(columnar.findValueRange("unknown") == glm::vec2(0.f));
+
+    CHECK(dataset.normalizeVariable("colorb_v"));
+    CHECK(columnar.normalizeVariable("colorb_v"));
+    CHECK_FALSE(columnar.normalizeVariable("unknown"));
+    compareDatasets(dataset, columnar.toDataset());
+
+    const std::vector<float> allNan = std::vector<float>(
+        17,
+        std::numeric_limits<float>::quiet_NaN()
+    );
+    const glm::vec2 nanRange = findValueRange(allNan);
+    CHECK(nanRange.x == std::numeric_limits<float>::max());
+    CHECK(nanRange.y == -std::numeric_limits<float>::max());
+}
+
+TEST_CASE("DataLoader: Columnar Cache", "[dataloader]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/columnar-cache.speck");
+    const std::filesystem::path cache = absPath("${TEMPORARY}/columnar-cache.cache");
+    writeSpeckFile(path, 5000);
+
+    const Dataset dataset = speck::loadSpeckFile(path);
+    const uint64_t hash = data::fileMetadataHash(path, std::nullopt);
+    const ColumnarDataset columnar = ColumnarDataset::createFromDataset(dataset);
+    data::saveColumnarCachedFile(columnar, cache, hash);
+
+    // A different content hash means that the source file has changed
+    CHECK_FALSE(data::loadColumnarCachedFile(cache, hash + 1).has_value());
+    CHECK_FALSE(
+        data::loadColumnarCachedFile(absPath("${TEMPORARY}/missing.cache"), hash)
+    );
+
+    std::optional<ColumnarDataset> mapped = data::loadColumnarCachedFile(cache, hash);
+    REQUIRE(mapped.has_value());
+    CHECK(mapped->nEntries() == dataset.entries.size());
+    CHECK(mapped->positions()[10] == dataset.entries[10].position);
+    CHECK(mapped->comment(3) == dataset.entries[3].comment);
+    compareDatasets(dataset, mapped->toDataset());
+
+    // Modifying a mapped column creates a private copy and leaves the file untouched
+    CHECK(mapped->normalizeVariable("lum"));
+    const glm::vec2 range = mapped->findValueRange("lum");
+    CHECK(range.x == 0.f);
+    CHECK(range.y == 1.f);
+
+    std::optional<ColumnarDataset> reloaded = data::loadColumnarCachedFile(cache, hash);
+    REQUIRE(reloaded.has_value());
+    compareDatasets(dataset, reloaded->toDataset());
+    reloaded = std::nullopt;
+    mapped = std::nullopt;
+
+    // A cache file whose comment offsets point past the end of the comment data is
+    // rejected. The size of the comment data is the last value of the file header
+    {
+        std::fstream file = std::fstream(
+            cache,
+            std::fstream::in | std::fstream::out | std::fstream::binary
+        );
+        constexpr std::streamoff CommentDataSizeOffset = 104;
+        file.seekp(CommentDataSizeOffset);
+        const uint64_t tooSmall = 1;
+        file.write(reinterpret_cast<const char*>(&tooSmall), sizeof(uint64_t));
+    }
+    CHECK_FALSE(data::loadColumnarCachedFile(cache, hash).has_value());
+
+    // A cache file whose positions are not aligned for floats is rejected as well
+    data::saveColumnarCachedFile(columnar, cache, hash);
+    REQUIRE(data::loadColumnarCachedFile(cache, hash).has_value());
+    {
+        std::fstream file = std::fstream(
+            cache,
+            std::fstream::in | std::fstream::out | std::fstream::binary
+        );
+        constexpr std::streamoff PositionsOffsetOffset = 64;
+        uint64_t positionsOffset = 0;
+        file.seekg(PositionsOffsetOffset);
+        file.read(reinterpret_cast<char*>(&positionsOffset), sizeof(uint64_t));
+        positionsOffset += 1;
+        file.seekp(PositionsOffsetOffset);
+        file.write(reinterpret_cast<const char*>(&positionsOffset), sizeof(uint64_t));
+    }
+    CHECK_FALSE(data::loadColumnarCachedFile(cache, hash).has_value());
+}
+
+TEST_CASE("DataLoader: Columnar Remove First Entries", "[dataloader]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/columnar-remove.speck");
+    const std::filesystem::path cache = absPath("${TEMPORARY}/columnar-remove.cache");
+    writeSpeckFile(path, 1000);
+
+    Dataset dataset = speck::loadSpeckFile(path);
+    const uint64_t hash = data::fileMetadataHash(path, std::nullopt);
+    ColumnarDataset owned = ColumnarDataset::createFromDataset(dataset);
+    data::saveColumnarCachedFile(owned, cache, hash);
+    std::optional<ColumnarDataset> mapped = data::loadColumnarCachedFile(cache, hash);
+    REQUIRE(mapped.has_value());
+
+    // Copy one of the mapped columns into memory before removing the entries, so that
+    // both kinds of storage are covered
+    mapped->mutableColumn(1);
+
+    dataset.entries.erase(dataset.entries.begin(), dataset.entries.begin() + 3);
+    owned.removeFirstEntries(3);
+    mapped->removeFirstEntries(3);
+    CHECK(owned.nEntries() == dataset.entries.size());
+    CHECK(owned.comment(0) == dataset.entries[0].comment);
+    compareDatasets(dataset, owned.toDataset());
+    compareDatasets(dataset, mapped->toDataset());
+
+    mapped->removeFirstEntries(dataset.entries.size() + 10);
+    CHECK(mapped->nEntries() == 0);
+    CHECK(mapped->isEmpty());
+}
+
+TEST_CASE("DataLoader: Throughput", "[dataloader][.benchmark]") {
+    const std::filesystem::path speckPath = absPath("${TEMPORARY}/benchmark.speck");
+    const std::filesystem::path csvPath = absPath("${TEMPORARY}/benchmark.csv");
+    writeSpeckFile(speckPath, 500000);
+    writeCsvFile(csvPath, 500000);
+
+    for (const std::filesystem::path& path : { speckPath, csvPath }) {
+        const Dataset sequential =
+            data::loadFile(path, std::nullopt, data::LoadMode::Sequential);
+        const Dataset parallel =
+            data::loadFile(path, std::nullopt, data::LoadMode::Parallel);
+        CHECK(sequential.entries.size() == parallel.entries.size());
+    }
+
+    // The file sizes are part of the benchmark names so that the throughput in MB/s can
+    // be derived from the reported times
+    const std::string speckSize = std::format(
+        "{:.1f} MB", std::filesystem::file_size(speckPath) / 1e6
+    );
+    const std::string csvSize = std::format(
+        "{:.1f} MB", std::filesystem::file_size(csvPath) / 1e6
+    );
+
+    BENCHMARK(std::format("SPECK sequential ({})", speckSize)) {
+        return data::loadFile(speckPath, std::nullopt, data::LoadMode::Sequential);
+    };
+    BENCHMARK(std::format("SPECK parallel ({})", speckSize)) {
+        return data::loadFile(speckPath, std::nullopt, data::LoadMode::Parallel);
+    };
+    BENCHMARK(std::format("CSV sequential ({})", csvSize)) {
+        return data::loadFile(csvPath, std::nullopt, data::LoadMode::Sequential);
+    };
+    BENCHMARK(std::format("CSV parallel ({})", csvSize)) {
+        return data::loadFile(csvPath, std::nullopt, data::LoadMode::Parallel);
+    };
+}
@@ -0,0 +1,185 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <modules/globebrowsing/src/disktilecache.h>
+#include <modules/globebrowsing/src/tiletextureinitdata.h>
+#include <ghoul/filesystem/filesystem.h>
+#include <ghoul/format.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace openspace;
+
+namespace {
+    TileTextureInitData initData() {
+        return TileTextureInitData(
+            8,
+            8,
+            GL_UNSIGNED_BYTE,
+            ghoul::opengl::Texture::Format::RGBA
+        );
+    }
+
+    RawTile tile(const TileIndex& tileIndex, std::byte value) {
+        RawTile res;
+        res.textureInitData = initData();
+        res.imageData = std::unique_ptr<std::byte[]>(
+            new std::byte[res.textureInitData->totalNumBytes]
+        );
+        std::memset(
+            res.imageData.get(),
+            static_cast<int>(value),
+            res.textureInitData->totalNumBytes
+        );
+        res.tileIndex = tileIndex;
+        res.tileMetaData.maxValues = { 1.f, 2.f, 3.f, 4.f };
+        res.tileMetaData.minValues = { -1.f, -2.f, -3.f, -4.f };
+        res.tileMetaData.hasMissingData = { true, false, true, false };
+        return res;
+    }
+
+    std::filesystem::path cacheDirectory(std::string_view name) {
+        const std::filesystem::path path = absPath(
+            std::format("${{TEMPORARY}}/{}", name)
+        );
+        std::filesystem::remove_all(path);
+        return path;
+    }
+} // namespace
+
+TEST_CASE("DiskTileCache: Put and Get", "[disktilecache]") {
+    DiskTileCache cache = DiskTileCache(cacheDirectory("disktilecache-get"), 1 << 20);
+    const uint64_t provider = DiskTileCache::providerKey("provider");
+    const uint64_t other = DiskTileCache::providerKey("other");
+    CHECK(provider != other);
+
+    const TileIndex index = TileIndex(3, 4, 5);
+    CHECK_FALSE(cache.get(provider, index, initData()).has_value());
+
+    cache.put(provider, tile(index, std::byte(42)));
+    CHECK(cache.nTiles() == 1);
+
+    const std::optional<RawTile> res = cache.get(provider, index, initData());
+    REQUIRE(res.has_value());
+    CHECK(res->tileIndex == index);
+    CHECK(res->error == RawTile::ReadError::None);
+    CHECK(res->imageData[0] == std::byte(42));
+    CHECK(res->imageData[255] == std::byte(42));
+    CHECK(res->tileMetaData.maxValues[2] == 3.f);
+    CHECK(res->tileMetaData.minValues[3] == -4.f);
+    CHECK(res->tileMetaData.hasMissingData[0]);
+    CHECK_FALSE(res->tileMetaData.hasMissingData[1]);
+
+    // Neither a different provider nor a different tile share the cached tile
+    CHECK_FALSE(cache.get(other, index, initData()).has_value());
+    CHECK_FALSE(cache.get(provider, TileIndex(4, 3, 5), initData()).has_value());
+    CHECK(cache.nHits() == 1);
+    CHECK(cache.nMisses() == 3);
+}
+
+TEST_CASE("DiskTileCache: Errors Are Not Cached", "[disktilecache]") {
+    DiskTileCache cache = DiskTileCache(cacheDirectory("disktilecache-error"), 1 << 20);
+    const uint64_t provider = DiskTileCache::providerKey("provider");
+
+    RawTile t = tile(TileIndex(0, 0, 1), std::byte(1));
+    t.error = RawTile::ReadError::Failure;
+    cache.put(provider, t);
+    CHECK(cache.nTiles() == 0);
+    CHECK_FALSE(cache.get(provider, TileIndex(0, 0, 1), initData()).has_value());
+}
+
+TEST_CASE("DiskTileCache: Least Recently Used", "[disktilecache]") {
+    const std::filesystem::path dir = cacheDirectory("disktilecache-lru");
+    DiskTileCache cache = DiskTileCache(dir, 1 << 20);
+    const uint64_t provider = DiskTileCache::providerKey("provider");
+
+    for (uint32_t i = 0; i < 4; i++) {
+        cache.put(provider, tile(TileIndex(i, 0, 2), std::byte(i)));
+    }
+    const uint64_t tileSize = cache.size() / 4;
+
+    // Using the first tile makes the second one the least recently used
+    CHECK(cache.get(provider, TileIndex(0, 0, 2), initData()).has_value());
+    cache.setMaxSize(3 * tileSize);
+    CHECK(cache.nTiles() == 3);
+    CHECK(cache.get(provider, TileIndex(0, 0, 2), initData()).has_value());
+    CHECK_FALSE(cache.get(provider, TileIndex(1, 0, 2), initData()).has_value());
+
+    // Adding a new tile removes the next oldest one
+    cache.put(provider, tile(TileIndex(4, 0, 2), std::byte(4)));
+    CHECK(cache.nTiles() == 3);
+    CHECK(cache.size() <= cache.maxSize());
+    CHECK_FALSE(cache.get(provider, TileIndex(2, 0, 2), initData()).has_value());
+
+    cache.clear();
+    CHECK(cache.nTiles() == 0);
+    CHECK(cache.size() == 0);
+}
+
+TEST_CASE("DiskTileCache: Persistence", "[disktilecache]") {
+    const std::filesystem::path dir = cacheDirectory("disktilecache-persistence");
+    const uint64_t provider = DiskTileCache::providerKey("provider");
+    {
+        DiskTileCache cache = DiskTileCache(dir, 1 << 20);
+        cache.put(provider, tile(TileIndex(1, 2, 3), std::byte(7)));
+        cache.put(provider, tile(TileIndex(2, 2, 3), std::byte(8)));
+    }
+
+    // Simulate a write that was interrupted by the end of the program
+    std::ofstream(dir / "interrupted.0.tmp") << "partial";
+
+    DiskTileCache cache = DiskTileCache(dir, 1 << 20);
+    CHECK(cache.nTiles() == 2);
+    CHECK_FALSE(std::filesystem::exists(dir / "interrupted.0.tmp"));
+    const std::optional<RawTile> res = cache.get(
+        provider,
+        TileIndex(2, 2, 3),
+        initData()
+    );
+    REQUIRE(res.has_value());
+    CHECK(res->imageData[0] == std::byte(8));
+}
+
+TEST_CASE("DiskTileCache: Corrupted File", "[disktilecache]") {
+    const std::filesystem::path dir = cacheDirectory("disktilecache-corrupted");
+    DiskTileCache cache = DiskTileCache(dir, 1 << 20);
+    const uint64_t provider = DiskTileCache::providerKey("provider");
+    cache.put(provider, tile(TileIndex(1, 1, 1), std::byte(1)));
+
+    for (const std::filesystem::directory_entry& e :
+         std::filesystem::recursive_directory_iterator(dir))
+    {
+        if (e.is_regular_file()) {
+            std::filesystem::resize_file(e.path(), 10);
+        }
+    }
+
+    // A corrupted tile is treated as a miss and removed from the cache
+    CHECK_FALSE(cache.get(provider, TileIndex(1, 1, 1), initData()).has_value());
+    CHECK(cache.nTiles() == 0);
+    CHECK(cache.size() == 0);
+}
@@ -0,0 +1,136 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <openspace/util/ephemeriscache.h>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    // A smooth function with a position-like and a velocity-like component
+    bool orbit(double time, std::span<double> result) {
+        constexpr double Period = 27.0 * 86400.0;
+        constexpr double Radius = 384400.0;
+        const double phase = 2.0 * 3.141592653589793 * time / Period;
+        result[0] = Radius * std::cos(phase);
+        result[1] = Radius * std::sin(phase);
+        return true;
+    }
+
+    const std::vector<std::pair<double, double>> Unbounded = {
+        {
+            std::numeric_limits<double>::lowest(),
+            std::numeric_limits<double>::max()
+        }
+    };
+} // namespace
+
+TEST_CASE("EphemerisCache: Accuracy", "[ephemeriscache]") {
+    constexpr double Tolerance = 1e-3;
+    EphemerisCache cache = EphemerisCache(2, Tolerance, Unbounded);
+
+    for (double t = -5.0 * 86400.0; t < 5.0 * 86400.0; t += 317.0) {
+        std::array<double, 2> cached;
+        REQUIRE(cache.evaluate(t, cached, orbit));
+
+        std::array<double, 2> direct;
+        orbit(t, direct);
+        CHECK_THAT(cached[0], Catch::Matchers::WithinAbs(direct[0], Tolerance));
+        CHECK_THAT(cached[1], Catch::Matchers::WithinAbs(direct[1], Tolerance));
+    }
+
+    CHECK(cache.nMisses() == 0);
+    CHECK(cache.nSegments() > 0);
+    // Ten days of evaluations should not require more than a handful of segments per day
+    CHECK(cache.nSegments() < 200);
+}
+
+TEST_CASE("EphemerisCache: Coverage", "[ephemeriscache]") {
+    EphemerisCache cache = EphemerisCache(2, 1e-3, { { 0.0, 1000.0 } });
+
+    std::array<double, 2> result = { -1.0, -1.0 };
+    CHECK_FALSE(cache.evaluate(-1.0, result, orbit));
+    CHECK_FALSE(cache.evaluate(1001.0, result, orbit));
+    CHECK(result[0] == -1.0);
+    CHECK(result[1] == -1.0);
+    CHECK(cache.nMisses() == 2);
+
+    CHECK(cache.evaluate(500.0, result, orbit));
+    CHECK(cache.evaluate(1000.0, result, orbit));
+    CHECK(cache.nHits() == 2);
+    // Both evaluations are inside the same clipped window
+    CHECK(cache.nSegments() == 1);
+}
+
+TEST_CASE("EphemerisCache: Discontinuity", "[ephemeriscache]") {
+    auto step = [](double time, std::span<double> result) {
+        result[0] = time < 1000.0 ? 0.0 : 1.0;
+        return true;
+    };
+
+    EphemerisCache cache = EphemerisCache(1, 1e-6, Unbounded);
+
+    std::array<double, 1> result;
+    // Far away from the discontinuity the function is constant and can be cached
+    REQUIRE(cache.evaluate(50000.0, result, step));
+    CHECK_THAT(result[0], Catch::Matchers::WithinAbs(1.0, 1e-6));
+
+    // Close to the discontinuity no polynomial is good enough
+    CHECK_FALSE(cache.evaluate(1000.0, result, step));
+    const uint64_t nMisses = cache.nMisses();
+    CHECK(nMisses == 1);
+
+    // Asking again is answered from the memoized failure without calling the function
+    int nCalls = 0;
+    auto counted = [&nCalls, &step](double time, std::span<double> result) {
+        nCalls++;
+        return step(time, result);
+    };
+    CHECK_FALSE(cache.evaluate(1000.0, result, counted));
+    CHECK(nCalls == 0);
+    CHECK(cache.nMisses() == nMisses + 1);
+}
+
+TEST_CASE("EphemerisCache: Failing Function", "[ephemeriscache]") {
+    auto failing = [](double, std::span<double>) { return false; };
+
+    EphemerisCache cache = EphemerisCache(2, 1e-3, Unbounded);
+    std::array<double, 2> result;
+    CHECK_FALSE(cache.evaluate(0.0, result, failing));
+    CHECK(cache.nMisses() == 1);
+    CHECK(cache.nHits() == 0);
+
+    cache.clear();
+    CHECK(cache.nSegments() == 0);
+    CHECK(cache.evaluate(0.0, result, orbit));
+    CHECK(cache.nHits() == 1);
+}
@@ -0,0 +1,306 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_EXOPLANETS_ENABLED
+#include <modules/exoplanets/datastructure.h>
+#include <modules/exoplanets/exoplanetscatalog.h>
+#include <modules/space/rendering/renderablehabitablezone.h>
+#endif // OPENSPACE_MODULE_EXOPLANETS_ENABLED
+#include <ghoul/filesystem/filesystem.h>
+#include <ghoul/format.h>
+#include <ghoul/misc/exception.h>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#ifdef OPENSPACE_MODULE_EXOPLANETS_ENABLED
+
+using namespace openspace;
+
+namespace {
+    struct TestPlanet {
+        std::string host;
+        std::string component;
+        ExoplanetDataEntry entry;
+    };
+
+    ExoplanetDataEntry planet(float a, glm::vec3 position, float teff = 5778.f,
+                              float luminosity = 1.f)
+    {
+        ExoplanetDataEntry p;
+        p.a = a;
+        p.per = 365.0;
+        p.positionX = position.x;
+        p.positionY = position.y;
+        p.positionZ = position.z;
+        p.teff = teff;
+        p.luminosity = luminosity;
+        return p;
+    }
+
+    // Writes the data file and look-up table in the same way as the
+    // ExoplanetsDataPreparationTask
+    void writeCatalog(const std::filesystem::path& dataFile,
+                      const std::filesystem::path& lookUpTable,
+                      const std::vector<TestPlanet>& planets)
+    {
+        std::ofstream bin = std::ofstream(dataFile, std::ios::out | std::ios::binary);
+        std::ofstream lut = std::ofstream(lookUpTable);
+
+        int version = 1;
+        bin.write(reinterpret_cast<char*>(&version), sizeof(int));
+        for (const TestPlanet& p : planets) {
+            const long pos = static_cast<long>(bin.tellp());
+            lut << p.host << " " << p.component << "," << pos << '\n';
+            bin.write(
+                reinterpret_cast<const char*>(&p.entry),
+                sizeof(ExoplanetDataEntry)
+            );
+        }
+    }
+
+    std::vector<TestPlanet> testPlanets() {
+        const glm::dvec4 zone =
+            RenderableHabitableZone::computeKopparapuZoneBoundaries(5778.f, 1.f);
+        const float habitable = static_cast<float>(0.5 * (zone[1] + zone[2]));
+        const float optimistic = static_cast<float>(0.5 * (zone[0] + zone[1]));
+
+        ExoplanetDataEntry insufficient = planet(1.f, glm::vec3(1.f));
+        insufficient.a = std::numeric_limits<float>::quiet_NaN();
+
+        return {
+            { "Kepler-22", "b", planet(habitable, glm::vec3(100.f, 0.f, 0.f)) },
+            { "Kepler-186", "b", planet(0.04f, glm::vec3(0.f, 150.f, 0.f)) },
+            { "Kepler-186", "f", planet(optimistic, glm::vec3(0.f, 150.f, 0.f)) },
+            { "Kepler-1649", "c", planet(0.08f, glm::vec3(0.f, 0.f, 90.f)) },
+            { "TRAPPIST-1", "b", planet(0.01f, glm::vec3(12.f, 0.f, 0.f)) },
+            { "TRAPPIST-1", "c", planet(0.02f, glm::vec3(12.f, 0.f, 0.f)) },
+            { "TRAPPIST-1", "d", planet(0.03f, glm::vec3(12.f, 0.f, 0.f)) },
+            { "TRAPPIST-1", "e", insufficient },
+            { "kepler-7", "b", planet(0.06f, glm::vec3(0.f, 0.f, 500.f)) },
+            { "HD 'Quoted'", "b", planet(0.5f, glm::vec3(5.f)) },
+            { "No Data", "b", insufficient }
+        };
+    }
+} // namespace
+
+TEST_CASE("ExoplanetsCatalog: Lookup", "[exoplanetscatalog]") {
+    const std::filesystem::path data = absPath("${TEMPORARY}/lookup.bin");
+    const std::filesystem::path lut = absPath("${TEMPORARY}/lookup.txt");
+    writeCatalog(data, lut, testPlanets());
+
+    const ExoplanetsCatalog catalog = ExoplanetsCatalog(data, lut);
+    CHECK(catalog.nSystems() == 7);
+    CHECK(catalog.nPlanets() == 11);
+    CHECK(catalog.hasSystem("Kepler-186"));
+    CHECK(catalog.hasSystem("No Data"));
+    CHECK_FALSE(catalog.hasSystem("kepler-186"));
+    CHECK_FALSE(catalog.hasSystem("Kepler"));
+
+    // Planets with insufficient data are skipped
+    const ExoplanetSystem trappist = catalog.system("TRAPPIST-1");
+    CHECK(trappist.starName == "TRAPPIST-1");
+    CHECK(trappist.planetNames == std::vector<std::string>{
+        "TRAPPIST-1 b", "TRAPPIST-1 c", "TRAPPIST-1 d"
+    });
+    REQUIRE(trappist.planetsData.size() == 3);
+    CHECK(trappist.planetsData[1].a == 0.02f);
+    CHECK(trappist.starData.position == glm::vec3(12.f, 0.f, 0.f));
+
+    // Quotes are removed from the planet names
+    const ExoplanetSystem quoted = catalog.system("HD 'Quoted'");
+    REQUIRE(quoted.planetNames.size() == 1);
+    CHECK(quoted.planetNames[0] == "HD Quoted b");
+
+    CHECK(catalog.system("No Data").planetsData.empty());
+    CHECK(catalog.system("Unknown").planetsData.empty());
+}
+
+TEST_CASE("ExoplanetsCatalog: Search", "[exoplanetscatalog]") {
+    const std::filesystem::path data = absPath("${TEMPORARY}/search.bin");
+    const std::filesystem::path lut = absPath("${TEMPORARY}/search.txt");
+    writeCatalog(data, lut, testPlanets());
+    const ExoplanetsCatalog catalog = ExoplanetsCatalog(data, lut);
+
+    const ExoplanetsCatalog::Filter filter;
+
+    // The prefix search ignores the case and returns the names alphabetically
+    CHECK(catalog.searchPrefix("KEPLER-1", 10, filter) == std::vector<std::string>{
+        "Kepler-1649", "Kepler-186"
+    });
+    CHECK(catalog.searchPrefix("kep", 10, filter) == std::vector<std::string>{
+        "Kepler-1649", "Kepler-186", "Kepler-22", "kepler-7"
+    });
+    CHECK(catalog.searchPrefix("kep", 2, filter).size() == 2);
+    CHECK(catalog.searchPrefix("no", 10, filter).empty());
+    ExoplanetsCatalog::Filter all;
+    all.requireSufficientData = false;
+    CHECK(catalog.searchPrefix("no", 10, all) == std::vector<std::string>{ "No Data" });
+    CHECK(catalog.searchPrefix("x", 10, filter).empty());
+
+    // The fuzzy search tolerates spelling mistakes
+    std::vector<std::string> fuzzy = catalog.searchFuzzy("Keplr-22", 3, filter);
+    REQUIRE(!fuzzy.empty());
+    CHECK(fuzzy[0] == "Kepler-22");
+    fuzzy = catalog.searchFuzzy("trapist 1", 3, filter);
+    REQUIRE(!fuzzy.empty());
+    CHECK(fuzzy[0] == "TRAPPIST-1");
+    fuzzy = catalog.searchFuzzy("kepler-168", 2, filter);
+    REQUIRE(fuzzy.size() == 2);
+    CHECK(fuzzy[0] == "Kepler-186");
+    CHECK(catalog.searchFuzzy("zzzz", 3, filter).empty());
+    CHECK(catalog.searchFuzzy("", 3, filter).empty());
+}
+
+TEST_CASE("ExoplanetsCatalog: Filter", "[exoplanetscatalog]") {
+    const std::filesystem::path data = absPath("${TEMPORARY}/filter.bin");
+    const std::filesystem::path lut = absPath("${TEMPORARY}/filter.txt");
+    writeCatalog(data, lut, testPlanets());
+    const ExoplanetsCatalog catalog = ExoplanetsCatalog(data, lut);
+
+    ExoplanetsCatalog::Filter filter;
+    CHECK(catalog.systems(filter).size() == 6);
+
+    filter.requireHabitablePlanet = true;
+    CHECK(catalog.systems(filter) == std::vector<std::string>{ "Kepler-22" });
+    filter.useOptimisticZone = true;
+    CHECK(catalog.systems(filter) == std::vector<std::string>{
+        "Kepler-186", "Kepler-22"
+    });
+
+    filter = ExoplanetsCatalog::Filter();
+    filter.minNumberOfPlanets = 2;
+    CHECK(catalog.systems(filter) == std::vector<std::string>{
+        "Kepler-186", "TRAPPIST-1"
+    });
+
+    filter = ExoplanetsCatalog::Filter();
+    filter.maxDistance = 100.f;
+    CHECK(catalog.systems(filter) == std::vector<std::string>{
+        "HD 'Quoted'", "Kepler-1649", "Kepler-22", "TRAPPIST-1"
+    });
+
+    filter.requireSufficientData = false;
+    CHECK(catalog.systems(filter).size() == 4);
+    filter.maxDistance = std::nullopt;
+    CHECK(catalog.systems(filter).size() == 7);
+}
+
+TEST_CASE("ExoplanetsCatalog: Invalid Look-up Table", "[exoplanetscatalog]") {
+    const std::filesystem::path data = absPath("${TEMPORARY}/invalid.bin");
+    const std::filesystem::path lut = absPath("${TEMPORARY}/invalid.txt");
+    writeCatalog(data, lut, testPlanets());
+
+    // An entry that points past the end of the data file
+    {
+        std::ofstream file = std::ofstream(lut, std::ios::app);
+        file << "Broken b," << std::filesystem::file_size(data) << '\n';
+    }
+    CHECK_THROWS_AS(ExoplanetsCatalog(data, lut), ghoul::RuntimeError);
+
+    {
+        std::ofstream file = std::ofstream(lut);
+        file << "Broken b,abc\n";
+    }
+    CHECK_THROWS_AS(ExoplanetsCatalog(data, lut), ghoul::RuntimeError);
+
+    CHECK_THROWS_AS(
+        ExoplanetsCatalog(absPath("${TEMPORARY}/missing.bin"), lut),
+        ghoul::RuntimeError
+    );
+}
+
+TEST_CASE("ExoplanetsCatalog: Benchmark", "[exoplanetscatalog][.benchmark]") {
+    // About the size of the NASA Exoplanet Archive
+    constexpr int NSystems = 5000;
+    constexpr int NQueries = 10000;
+
+    std::vector<TestPlanet> planets;
+    for (int i = 0; i < NSystems; i++) {
+        const std::string host = i % 2 == 0 ?
+            std::format("Kepler-{}", i) :
+            std::format("HD {}", 100000 + i);
+        const glm::vec3 position = glm::vec3(static_cast<float>(i % 1000));
+        for (int j = 0; j < 1 + i % 3; j++) {
+            const std::string component = std::string(1, static_cast<char>('b' + j));
+            planets.push_back({ host, component, planet(0.1f * (j + 1), position) });
+        }
+    }
+
+    const std::filesystem::path data = absPath("${TEMPORARY}/benchmark.bin");
+    const std::filesystem::path lut = absPath("${TEMPORARY}/benchmark.txt");
+    writeCatalog(data, lut, planets);
+
+    BENCHMARK("Load") {
+        return ExoplanetsCatalog(data, lut).nSystems();
+    };
+
+    const ExoplanetsCatalog catalog = ExoplanetsCatalog(data, lut);
+    std::vector<std::string> names;
+    std::vector<std::string> prefixes;
+    std::vector<std::string> misspelled;
+    for (int i = 0; i < NQueries; i++) {
+        names.push_back(std::format("Kepler-{}", 2 * (i % 2500)));
+        prefixes.push_back(std::format("hd 10{}", i % 100));
+        misspelled.push_back(std::format("keplr {}", i % 5000));
+    }
+
+    BENCHMARK("System lookup") {
+        size_t n = 0;
+        for (const std::string& name : names) {
+            n += catalog.system(name).planetsData.size();
+        }
+        return n;
+    };
+
+    const ExoplanetsCatalog::Filter defaultFilter;
+    BENCHMARK("Prefix search") {
+        size_t n = 0;
+        for (const std::string& prefix : prefixes) {
+            n += catalog.searchPrefix(prefix, 10, defaultFilter).size();
+        }
+        return n;
+    };
+    BENCHMARK("Fuzzy search") {
+        size_t n = 0;
+        for (const std::string& name : misspelled) {
+            n += catalog.searchFuzzy(name, 10, defaultFilter).size();
+        }
+        return n;
+    };
+
+    ExoplanetsCatalog::Filter filter;
+    filter.maxDistance = 500.f;
+    filter.minNumberOfPlanets = 2;
+    BENCHMARK("Filter") {
+        return catalog.systems(filter).size();
+    };
+}
+
+#endif // OPENSPACE_MODULE_EXOPLANETS_ENABLED
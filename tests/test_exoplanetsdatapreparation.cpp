@@ -0,0 +1,134 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_EXOPLANETS_ENABLED
+#include <modules/exoplanets/tasks/exoplanetsdatapreparationtask.h>
+#endif // OPENSPACE_MODULE_EXOPLANETS_ENABLED
+#include <ghoul/filesystem/filesystem.h>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#ifdef OPENSPACE_MODULE_EXOPLANETS_ENABLED
+
+using namespace openspace;
+
+namespace {
+    using Column = ExoplanetsDataPreparationTask::Column;
+    using LookupTables = ExoplanetsDataPreparationTask::LookupTables;
+
+    std::filesystem::path writeConversionFile() {
+        const std::filesystem::path path = absPath("${TEMPORARY}/teff-bv.txt");
+        std::ofstream file = std::ofstream(path);
+        file << "3000,1.5\n";
+        file << "4000,1.0\r\n";
+        file << "6000,0.5\n";
+        return path;
+    }
+
+    std::filesystem::path writeSpeckFile() {
+        const std::filesystem::path path = absPath("${TEMPORARY}/exoplanet-stars.speck");
+        std::ofstream file = std::ofstream(path);
+        file << "datavar 0 lum\n";
+        file << "texturevar 1\n";
+        file << "# A comment\n";
+        file << "1 2 3 4 # Alpha\n";
+        file << "5 6 7 8 # Beta\n";
+        file << "9 10 11 12 # Alpha\n";
+        return path;
+    }
+} // namespace
+
+TEST_CASE("ExoplanetsDataPreparation: Lookup Tables", "[exoplanetsdatapreparation]") {
+    const LookupTables tables = LookupTables(writeSpeckFile(), writeConversionFile());
+
+    // The first line for a star is used
+    CHECK(tables.starPosition("Alpha") == glm::vec3(1.f, 2.f, 3.f));
+    CHECK(tables.starPosition("Beta") == glm::vec3(5.f, 6.f, 7.f));
+    CHECK(std::isnan(tables.starPosition("Gamma").x));
+
+    CHECK(std::isnan(tables.bvFromTeff(std::numeric_limits<float>::quiet_NaN())));
+    // Temperatures below the first row and above the last row
+    CHECK(tables.bvFromTeff(2000.f) == 2.f);
+    CHECK(tables.bvFromTeff(7000.f) == 0.f);
+    // Exact and interpolated values
+    CHECK(tables.bvFromTeff(4000.f) == 1.f);
+    CHECK(tables.bvFromTeff(3500.f) == 1.25f);
+    CHECK(tables.bvFromTeff(5000.f) == 0.75f);
+
+    const LookupTables noPositions = LookupTables("", writeConversionFile());
+    CHECK(std::isnan(noPositions.starPosition("Alpha").x));
+}
+
+TEST_CASE("ExoplanetsDataPreparation: Parse Row", "[exoplanetsdatapreparation]") {
+    const LookupTables tables = LookupTables(writeSpeckFile(), writeConversionFile());
+
+    const std::vector<Column> columns = ExoplanetsDataPreparationTask::columnLayout({
+        "pl_name", "hostname", "pl_letter", "unused", "pl_orbsmax", "pl_orbper",
+        "pl_orbeccenerr2", "st_teff", "sy_pnum"
+    });
+    REQUIRE(columns.size() == 9);
+    CHECK(columns[0] == Column::PlanetName);
+    CHECK(columns[3] == Column::Ignored);
+    CHECK(columns[8] == Column::NumberOfPlanets);
+
+    const ExoplanetsDataPreparationTask::PlanetData planet =
+        ExoplanetsDataPreparationTask::parseDataRow(
+            "\"Alpha b\",Alpha,b,ignored,1.5,365.25,0.25,3500,2",
+            columns,
+            tables
+        );
+    CHECK(planet.name == "Alpha b");
+    CHECK(planet.host == "Alpha");
+    CHECK(planet.component == "b");
+    CHECK(planet.dataEntry.a == 1.5f);
+    CHECK(planet.dataEntry.per == 365.25);
+    CHECK(planet.dataEntry.eccLower == -0.25f);
+    CHECK(planet.dataEntry.teff == 3500.f);
+    CHECK(planet.dataEntry.bmv == 1.25f);
+    CHECK(planet.dataEntry.nPlanets == 2);
+    CHECK(planet.dataEntry.positionX == 1.f);
+    CHECK(planet.dataEntry.positionZ == 3.f);
+    CHECK(std::isnan(planet.dataEntry.ecc));
+
+    // Missing values at the end of a row and empty values are not read
+    const ExoplanetsDataPreparationTask::PlanetData partial =
+        ExoplanetsDataPreparationTask::parseDataRow(
+            "Gamma b,Gamma,b,,2.0,",
+            columns,
+            tables
+        );
+    CHECK(partial.host == "Gamma");
+    CHECK(partial.dataEntry.a == 2.f);
+    CHECK(std::isnan(partial.dataEntry.per));
+    CHECK(std::isnan(partial.dataEntry.positionX));
+    CHECK(std::isnan(partial.dataEntry.bmv));
+}
+
+#endif // OPENSPACE_MODULE_EXOPLANETS_ENABLED
@@ -0,0 +1,174 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <openspace/util/expression.h>
+#include <ghoul/misc/exception.h>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <span>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    double evaluate(std::string_view source) {
+        const Expression expression = Expression(source, {});
+        return expression.evaluate({});
+    }
+} // namespace
+
+TEST_CASE("Expression: Arithmetic", "[expression]") {
+    CHECK(evaluate("1 + 2 * 3") == 7.0);
+    CHECK(evaluate("(1 + 2) * 3") == 9.0);
+    CHECK(evaluate("10 - 4 - 3") == 3.0);
+    CHECK(evaluate("8 / 4 / 2") == 1.0);
+    CHECK(evaluate("7 % 4") == 3.0);
+    CHECK(evaluate("2 ^ 3 ^ 2") == 512.0);
+    CHECK(evaluate("-2 ^ 2") == -4.0);
+    CHECK(evaluate("2 ^ -1") == 0.5);
+    CHECK(evaluate("--3") == 3.0);
+    CHECK(evaluate("+3") == 3.0);
+    CHECK(evaluate("1.5e3") == 1500.0);
+    CHECK(evaluate("2.5E-1") == 0.25);
+    CHECK(evaluate(".5") == 0.5);
+    CHECK(evaluate("  3 *\t( 1+1 ) ") == 6.0);
+    CHECK(evaluate("pi") == std::numbers::pi);
+    CHECK(evaluate("e") == std::numbers::e);
+}
+
+TEST_CASE("Expression: Functions", "[expression]") {
+    CHECK(evaluate("sin(1)") == std::sin(1.0));
+    CHECK(evaluate("cos(1)") == std::cos(1.0));
+    CHECK(evaluate("atan2(1, -1)") == std::atan2(1.0, -1.0));
+    CHECK(evaluate("sqrt(16)") == 4.0);
+    CHECK(evaluate("abs(-3)") == 3.0);
+    CHECK(evaluate("log(e)") == 1.0);
+    CHECK(evaluate("log10(1000)") == 3.0);
+    CHECK(evaluate("floor(-1.5)") == -2.0);
+    CHECK(evaluate("ceil(-1.5)") == -1.0);
+    CHECK(evaluate("sign(-4)") == -1.0);
+    CHECK(evaluate("sign(0)") == 0.0);
+    CHECK(evaluate("min(3, 2)") == 2.0);
+    CHECK(evaluate("max(3, 2)") == 3.0);
+    CHECK(evaluate("pow(2, 10)") == 1024.0);
+    CHECK(evaluate("mod(-7, 4)") == -3.0);
+    CHECK(evaluate("hypot(3, 4)") == 5.0);
+    CHECK(evaluate("clamp(5, 0, 1)") == 1.0);
+    CHECK(evaluate("clamp(-5, 0, 1)") == 0.0);
+    CHECK(evaluate("max(min(4, 2 + 3), sqrt(9))") == 4.0);
+}
+
+TEST_CASE("Expression: Variables", "[expression]") {
+    const Expression expression = Expression("a * t + b", { "t", "a", "b" });
+    CHECK_FALSE(expression.isConstant());
+
+    const std::array<double, 3> values = { 2.0, 3.0, 4.0 };
+    CHECK(expression.evaluate(values) == 10.0);
+
+    const Expression orbit = Expression("1.5e11 * cos(2 * pi * t / 31557600)");
+    const std::array<double, 1> quarter = { 31557600.0 / 4.0 };
+    CHECK_THAT(orbit.evaluate(quarter), Catch::Matchers::WithinAbs(0.0, 1.0));
+}
+
+TEST_CASE("Expression: Constant Folding", "[expression]") {
+    const Expression constant = Expression("2 * pi * sin(pi / 2)", {});
+    CHECK(constant.isConstant());
+    CHECK(constant.instructions().size() == 1);
+    CHECK(constant.evaluate({}) == 2.0 * std::numbers::pi);
+
+    // The constant part of the expression is computed once, but the order of operations
+    // is kept so that the result does not change
+    const Expression expression = Expression("t * (2 * pi)");
+    CHECK(expression.instructions().size() == 3);
+    const std::array<double, 1> values = { 3.0 };
+    CHECK(expression.evaluate(values) == 3.0 * (2.0 * std::numbers::pi));
+}
+
+TEST_CASE("Expression: Errors", "[expression]") {
+    CHECK_THROWS_AS(Expression(""), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("   "), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("1 +"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("(1 + 2"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("1 + 2)"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("1 2"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("2e"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("."), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("x"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("foo(1)"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("sin(1, 2)"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("atan2(1)"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("min()"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression("1 $ 2"), ghoul::RuntimeError);
+    CHECK_THROWS_AS(Expression(std::string(1000, '(') + "1"), ghoul::RuntimeError);
+}
+
+TEST_CASE("Expression: Stack Depth", "[expression]") {
+    // Each nested parenthesis requires one more value on the stack
+    std::string source = "t";
+    for (int i = 0; i < Expression::MaxStackDepth - 1; i++) {
+        source = "t + (" + source + ")";
+    }
+    const Expression deep = Expression(source);
+    const std::array<double, 1> values = { 1.0 };
+    CHECK(deep.evaluate(values) == static_cast<double>(Expression::MaxStackDepth));
+
+    CHECK_THROWS_AS(Expression("t + (" + source + ")"), ghoul::RuntimeError);
+}
+
+TEST_CASE("Expression: Batch Evaluation", "[expression]") {
+    const Expression expression = Expression(
+        "r * cos(2 * pi * t / p) + clamp(t / p, -1, 1) ^ 2 - sign(t) * sqrt(abs(t))",
+        { "t", "r", "p" }
+    );
+
+    // Use a size that is not a multiple of the internal block size
+    constexpr size_t N = 1000;
+    std::vector<double> times(N);
+    std::vector<double> radii(N);
+    std::vector<double> periods(N);
+    for (size_t i = 0; i < N; i++) {
+        times[i] = -5000.0 + 10.0 * static_cast<double>(i);
+        radii[i] = 1.0 + 0.001 * static_cast<double>(i);
+        periods[i] = 3600.0;
+    }
+
+    const std::array<std::span<const double>, 3> columns = { times, radii, periods };
+    std::vector<double> results(N);
+    expression.evaluate(columns, results);
+
+    for (size_t i = 0; i < N; i++) {
+        const std::array<double, 3> values = { times[i], radii[i], periods[i] };
+        const double scalar = expression.evaluate(values);
+        CHECK_THAT(results[i], Catch::Matchers::WithinAbs(scalar, 1e-12));
+    }
+
+    // An empty batch is valid
+    std::vector<double> empty;
+    const std::array<std::span<const double>, 3> emptyColumns = { empty, empty, empty };
+    expression.evaluate(emptyColumns, empty);
+}
@@ -0,0 +1,328 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_GAIA_ENABLED
+#include <modules/gaia/rendering/flatoctree.h>
+#include <modules/gaia/rendering/octreecontainer.h>
+#include <modules/gaia/rendering/octreeculler.h>
+#include <modules/gaia/rendering/octreemanager.h>
+#include <modules/globebrowsing/src/basictypes.h>
+#include <openspace/util/distanceconstants.h>
+#include <ghoul/filesystem/filesystem.h>
+#include <ghoul/glm.h>
+#include <ghoul/misc/exception.h>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <span>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    constexpr AABB3 ViewFrustum = {
+        .min = glm::vec3(-1.f, -1.f, 0.f),
+        .max = glm::vec3(1.f, 1.f, 100.f)
+    };
+
+    glm::dmat4 cameraMatrix() {
+        // Place the camera a bit outside of the center looking into the galactic plane
+        constexpr double KiloParsec = 1000.0 * distanceconstants::Parsec;
+        const glm::dmat4 view = glm::lookAt(
+            glm::dvec3(-0.5 * KiloParsec, 0.0, 0.1 * KiloParsec),
+            glm::dvec3(1.0, 0.0, 0.0) * KiloParsec,
+            glm::dvec3(0.0, 0.0, 1.0)
+        );
+        const glm::dmat4 projection = glm::perspective(
+            glm::radians(60.0),
+            16.0 / 9.0,
+            1e10,
+            1e24
+        );
+        return projection * view;
+    }
+
+    size_t nStoredStars(const OctreeManager::OctreeNode& node) {
+        size_t res = node.posData.size() / 3;
+        if (!node.isLeaf) {
+            for (const std::shared_ptr<OctreeManager::OctreeNode>& c : node.children) {
+                res += nStoredStars(*c);
+            }
+        }
+        return res;
+    }
+
+    /**
+     * Writes the structure of a complete Octree in which every leaf is \p depth levels
+     * below the first layer of nodes. The file uses the format that is read by
+     * OctreeManager::readFromFile, but without any star data.
+     */
+    void writeNodeStructure(std::ofstream& out, int depth, int32_t nLeafStars,
+                            int32_t nLodStars)
+    {
+        const bool isLeaf = depth == 0;
+        const int32_t nStars = isLeaf ? nLeafStars : nLodStars;
+        const int32_t nDataSize = 0;
+        out.write(reinterpret_cast<const char*>(&isLeaf), sizeof(bool));
+        out.write(reinterpret_cast<const char*>(&nStars), sizeof(int32_t));
+        out.write(reinterpret_cast<const char*>(&nDataSize), sizeof(int32_t));
+        if (!isLeaf) {
+            for (int i = 0; i < 8; i++) {
+                writeNodeStructure(out, depth - 1, nLeafStars, nLodStars);
+            }
+        }
+    }
+} // namespace
+
+TEST_CASE("FlatOctree: Structure", "[gaiaoctree]") {
+    OctreeManager octree;
+    octree.initOctree(0, 10, 50);
+
+    std::mt19937 gen(1337);
+    std::uniform_real_distribution<float> pos(-9.9f, 9.9f);
+    std::uniform_real_distribution<float> value(0.f, 20.f);
+    for (int i = 0; i < 20000; i++) {
+        octree.insert({
+            pos(gen), pos(gen), pos(gen),
+            value(gen), value(gen),
+            value(gen), value(gen), value(gen)
+        });
+    }
+    octree.sliceLodData();
+
+    const FlatOctree flat = FlatOctree(octree);
+    const std::vector<FlatOctree::Node>& nodes = flat.nodes();
+
+    // The root is not counted by the OctreeManager
+    REQUIRE(nodes.size() == octree.totalNodes() + 1);
+    CHECK(flat.stars().positionX.size() == nStoredStars(octree.root()));
+
+    size_t nLeaves = 0;
+    for (const FlatOctree::Node& node : nodes) {
+        if (node.isLeaf()) {
+            nLeaves++;
+            continue;
+        }
+
+        // Children are stored consecutively and their boxes are nested in the parent
+        REQUIRE(node.firstChild + 8 <= nodes.size());
+        for (uint32_t i = 0; i < 8; i++) {
+            const FlatOctree::Node& child = nodes[node.firstChild + i];
+            CHECK(child.halfDimension == node.halfDimension / 2.f);
+            CHECK(glm::all(glm::lessThanEqual(
+                glm::abs(child.origin - node.origin),
+                glm::vec3(node.halfDimension)
+            )));
+        }
+    }
+    CHECK(nLeaves == octree.numLeafNodes());
+
+    // The first node that contains stars must hold exactly the stars of the first leaf in
+    // the pointer-based tree, in the same order
+    const OctreeManager::OctreeNode* source = &octree.root();
+    const FlatOctree::Node* node = &nodes.front();
+    while (!source->isLeaf) {
+        source = source->children[0].get();
+        node = &nodes[node->firstChild];
+    }
+    REQUIRE(node->nStoredStars == source->posData.size() / 3);
+    for (uint32_t i = 0; i < node->nStoredStars; i++) {
+        const uint32_t idx = node->firstStar + i;
+        CHECK(flat.stars().positionX[idx] == source->posData[i * 3]);
+        CHECK(flat.stars().positionY[idx] == source->posData[i * 3 + 1]);
+        CHECK(flat.stars().positionZ[idx] == source->posData[i * 3 + 2]);
+        CHECK(flat.stars().magnitude[idx] == source->colData[i * 2]);
+        CHECK(flat.stars().color[idx] == source->colData[i * 2 + 1]);
+        CHECK(flat.stars().velocityZ[idx] == source->velData[i * 3 + 2]);
+    }
+}
+
+TEST_CASE("FlatOctree: Traversal", "[gaiaoctree]") {
+    OctreeManager octree;
+    octree.initOctree(0, 10, 50);
+
+    std::mt19937 gen(42);
+    std::normal_distribution<float> pos(0.f, 3.f);
+    std::uniform_real_distribution<float> value(0.f, 20.f);
+    for (int i = 0; i < 20000; i++) {
+        const float x = std::clamp(pos(gen), -9.9f, 9.9f);
+        const float y = std::clamp(pos(gen), -9.9f, 9.9f);
+        const float z = std::clamp(pos(gen), -9.9f, 9.9f);
+        octree.insert({ x, y, z, value(gen), value(gen), 0.f, 0.f, 0.f });
+    }
+    octree.sliceLodData();
+    octree.initBufferIndexStack(octree.totalNodes(), true);
+
+    const FlatOctree flat = FlatOctree(octree);
+    OctreeCuller culler = OctreeCuller(ViewFrustum);
+
+    const glm::dmat4 mvp = cameraMatrix();
+    const glm::vec2 screenSize = glm::vec2(1920.f, 1080.f);
+    constexpr float Threshold = 250.f;
+
+    // Both traversals have to select the same nodes, which means the same number of nodes
+    // and the same number of stars
+    int deltaStars = 0;
+    const std::map<int, std::vector<float>> renderData =
+        octree.traverseData(mvp, screenSize, deltaStars, gaia::Motion, Threshold);
+
+    std::vector<uint32_t> visible;
+    flat.findVisibleNodes(culler, mvp, screenSize, Threshold, visible);
+
+    REQUIRE_FALSE(visible.empty());
+    CHECK(visible.size() < flat.nodes().size());
+    CHECK(visible.size() == renderData.size());
+
+    int nStars = 0;
+    size_t nValues = 0;
+    for (uint32_t index : visible) {
+        nStars += static_cast<int>(flat.nodes()[index].nStars);
+        nValues += flat.nodes()[index].nStoredStars * 8;
+    }
+    CHECK(nStars == deltaStars);
+
+    size_t nRenderValues = 0;
+    for (const std::pair<const int, std::vector<float>>& p : renderData) {
+        nRenderValues += p.second.size();
+    }
+    CHECK(nValues == nRenderValues);
+}
+
+TEST_CASE("OctreeContainer: Round Trip", "[gaiaoctree]") {
+    OctreeManager octree;
+    octree.initOctree(0, 10, 50);
+
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> pos(-9.9f, 9.9f);
+    std::uniform_real_distribution<float> value(0.f, 20.f);
+    for (int i = 0; i < 5000; i++) {
+        octree.insert({
+            pos(gen), pos(gen), pos(gen),
+            value(gen), value(gen),
+            value(gen), value(gen), value(gen)
+        });
+    }
+    octree.sliceLodData();
+
+    const std::filesystem::path path = absPath("${TEMPORARY}/gaia.container");
+    octree.writeToContainer(path);
+
+    const OctreeContainer container = OctreeContainer(path);
+    CHECK(container.valuesPerStar() == 8);
+    CHECK(container.maxStarsPerNode() == 50);
+    CHECK(container.maxDist() == 10);
+    REQUIRE(container.nodes().size() == octree.totalNodes());
+    for (const OctreeContainer::NodeEntry& node : container.nodes()) {
+        CHECK(node.dataOffset % OctreeContainer::DataAlignment == 0);
+    }
+
+    // The first node in the container is the first child of the root
+    const OctreeManager::OctreeNode& first = *octree.root().children[0];
+    const std::span<const float> data = container.nodeData(0);
+    REQUIRE(data.size() == first.posData.size() * 8 / 3);
+    CHECK(std::equal(first.posData.begin(), first.posData.end(), data.begin()));
+
+    // Reading the container recreates the same structure
+    OctreeManager streamed;
+    streamed.initOctree(0, 2, 2000);
+    int nStars = streamed.readFromContainer(path);
+    CHECK(nStars == 5000);
+    CHECK(streamed.maxDist() == 10);
+    CHECK(streamed.maxStarsPerNode() == 50);
+    CHECK(streamed.totalNodes() == octree.totalNodes());
+    CHECK(streamed.numLeafNodes() == octree.numLeafNodes());
+
+    // A partially written file is rejected
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    CHECK_THROWS_AS(OctreeContainer(path), ghoul::RuntimeError);
+}
+
+TEST_CASE("FlatOctree: Traversal Benchmark", "[gaiaoctree][.benchmark]") {
+    // Synthesizes the structure of a billion star Octree (~300k nodes) without loading
+    // any star data, as only the nodes are touched when traversing the tree
+    constexpr int Depth = 5;
+    constexpr int32_t MaxDist = 100;
+    constexpr int32_t LodStars = 4000;
+    constexpr int64_t TotalStars = 1000000000;
+    const int64_t nLeaves = 8LL << (3 * Depth);
+    const int32_t leafStars = static_cast<int32_t>(TotalStars / nLeaves);
+
+    const std::filesystem::path path = absPath("${TEMPORARY}/gaia-structure.bin");
+    {
+        std::ofstream out = std::ofstream(path, std::ofstream::binary);
+        const int32_t valuesPerStar = 8;
+        out.write(reinterpret_cast<const char*>(&valuesPerStar), sizeof(int32_t));
+        out.write(reinterpret_cast<const char*>(&LodStars), sizeof(int32_t));
+        out.write(reinterpret_cast<const char*>(&MaxDist), sizeof(int32_t));
+        for (int i = 0; i < 8; i++) {
+            writeNodeStructure(out, Depth, leafStars, LodStars);
+        }
+    }
+
+    OctreeManager octree;
+    octree.initOctree(0, MaxDist, LodStars);
+    {
+        std::ifstream in = std::ifstream(path, std::ifstream::binary);
+        const int nStars = octree.readFromFile(in, true);
+        CHECK(nStars == leafStars * nLeaves);
+    }
+    octree.initBufferIndexStack(octree.totalNodes(), true);
+
+    const FlatOctree flat = FlatOctree(octree);
+    OctreeCuller culler = OctreeCuller(ViewFrustum);
+    const glm::dmat4 mvp = cameraMatrix();
+    const glm::vec2 screenSize = glm::vec2(1920.f, 1080.f);
+    constexpr float Threshold = 250.f;
+
+    // Fill the buffer index cache once so that the benchmark measures the steady state
+    // in which most nodes have been uploaded already
+    int deltaStars = 0;
+    const size_t nPointerNodes =
+        octree.traverseData(mvp, screenSize, deltaStars, gaia::Motion, Threshold).size();
+    std::vector<uint32_t> visible;
+    flat.findVisibleNodes(culler, mvp, screenSize, Threshold, visible);
+    CHECK(visible.size() == nPointerNodes);
+
+    // The pointer-based nodes are allocated individually together with the control block
+    // of their shared pointer, so the actual difference is larger than this
+    const size_t nNodes = octree.totalNodes() + 1;
+    CHECK(flat.memoryFootprint() < nNodes * sizeof(OctreeManager::OctreeNode));
+
+    BENCHMARK("Pointer-based Octree") {
+        deltaStars = 0;
+        return octree.traverseData(mvp, screenSize, deltaStars, gaia::Motion, Threshold);
+    };
+    BENCHMARK("Flat Octree") {
+        flat.findVisibleNodes(culler, mvp, screenSize, Threshold, visible);
+        return visible.size();
+    };
+}
+
+#endif // OPENSPACE_MODULE_GAIA_ENABLED
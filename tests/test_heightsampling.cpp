@@ -0,0 +1,198 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <modules/globebrowsing/src/chunktree.h>
+#include <modules/globebrowsing/src/heightsampling.h>
+#include <modules/globebrowsing/src/layerrendersettings.h>
+#include <openspace/util/geodetic.h>
+#include <ghoul/glm.h>
+#include <array>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <span>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    constexpr unsigned int TileSize = 16;
+    constexpr float NoDataValue = -9999.f;
+
+    // Splits the leaf `chunk` into four children that are owned by `storage`
+    void split(Chunk& chunk, std::vector<std::unique_ptr<Chunk>>& storage) {
+        for (size_t i = 0; i < chunk.children.size(); i++) {
+            storage.push_back(
+                std::make_unique<Chunk>(chunk.tileIndex.child(static_cast<Quad>(i)))
+            );
+            chunk.children[i] = storage.back().get();
+        }
+    }
+
+    // Two chunk trees with leaves on the levels 1 to 3 and two synthetic height layers.
+    // The first layer is a single-channel float texture that is shared by all tiles and
+    // the second layer is read texel by texel and contains NaN and no-data values. The
+    // tile of the second layer for `missingTile` is not loaded
+    class SyntheticHeights {
+    public:
+        SyntheticHeights()
+            : left(TileIndex(0, 0, 1))
+            , right(TileIndex(1, 0, 1))
+            , _texels(TileSize * TileSize)
+        {
+            split(left, _chunks);
+            split(*left.children[0], _chunks);
+            missingTile = left.children[3];
+
+            for (size_t i = 0; i < _texels.size(); i++) {
+                _texels[i] = 0.5f * static_cast<float>(i);
+            }
+            _settings[1].multiplier = 2.f;
+            _settings[1].offset = -3.f;
+        }
+
+        std::optional<HeightTileData> tile(size_t layer, const TileIndex& ti) const {
+            HeightTileData res = {
+                .dimensions = glm::uvec2(TileSize),
+                .uvTransform = {
+                    .uvOffset = glm::vec2(0.f),
+                    .uvScale = glm::vec2(1.f)
+                },
+                .depthTransform = {
+                    .scale = 1.f + static_cast<float>(ti.level),
+                    .offset = 10.f * static_cast<float>(ti.x + ti.y)
+                },
+                .noDataValue = NoDataValue,
+                .renderSettings = &_settings[layer]
+            };
+
+            if (layer == 0) {
+                res.texels = _texels.data();
+            }
+            else {
+                if (ti == missingTile->tileIndex) {
+                    return std::nullopt;
+                }
+                res.texel = [](unsigned int x, unsigned int y) {
+                    if (x == 3) {
+                        return std::numeric_limits<float>::quiet_NaN();
+                    }
+                    if (y == 5) {
+                        return NoDataValue;
+                    }
+                    return 100.f + static_cast<float>(x * y);
+                };
+            }
+            return res;
+        }
+
+        std::vector<float> sample(std::span<const Geodetic2> positions) const {
+            std::vector<float> res(positions.size());
+            sampleHeights(
+                positions,
+                left,
+                right,
+                2,
+                [this](size_t layer, const TileIndex& ti) { return tile(layer, ti); },
+                res
+            );
+            return res;
+        }
+
+        Chunk left;
+        Chunk right;
+        const Chunk* missingTile = nullptr;
+
+    private:
+        std::vector<std::unique_ptr<Chunk>> _chunks;
+        std::vector<float> _texels;
+        std::array<LayerRenderSettings, 2> _settings;
+    };
+
+    std::vector<Geodetic2> randomPositions(size_t n) {
+        std::mt19937 gen = std::mt19937(1337);
+        std::uniform_real_distribution<double> lat = std::uniform_real_distribution(
+            -glm::half_pi<double>(),
+            glm::half_pi<double>()
+        );
+        std::uniform_real_distribution<double> lon = std::uniform_real_distribution(
+            -glm::pi<double>(),
+            glm::pi<double>()
+        );
+        std::vector<Geodetic2> res;
+        res.reserve(n);
+        for (size_t i = 0; i < n; i++) {
+            res.push_back({ .lat = lat(gen), .lon = lon(gen) });
+        }
+        return res;
+    }
+} // namespace
+
+TEST_CASE("HeightSampling: Batched Matches Individual", "[heightsampling]") {
+    const SyntheticHeights heights;
+
+    std::vector<Geodetic2> positions = randomPositions(2000);
+    // Make sure that some of the points are in the tile that is not loaded
+    const Geodetic2 missingCenter = heights.missingTile->surfacePatch.center();
+    positions.push_back(missingCenter);
+    positions.push_back({ .lat = missingCenter.lat + 0.01, .lon = missingCenter.lon });
+
+    const std::vector<float> batched = heights.sample(positions);
+    REQUIRE(batched.size() == positions.size());
+
+    int nMissing = 0;
+    for (size_t i = 0; i < positions.size(); i++) {
+        const std::vector<float> individual = heights.sample(std::span(&positions[i], 1));
+        REQUIRE(individual.size() == 1);
+        CHECK(batched[i] == individual[0]);
+
+        if (heights.missingTile->surfacePatch.contains(positions[i])) {
+            CHECK(batched[i] == 0.f);
+            nMissing++;
+        }
+    }
+    CHECK(nMissing >= 2);
+}
+
+TEST_CASE("HeightSampling: No Layers", "[heightsampling]") {
+    const SyntheticHeights heights;
+
+    // Without any height layers, all heights are 0
+    const std::vector<Geodetic2> positions = randomPositions(100);
+    std::vector<float> res = std::vector<float>(positions.size(), 1.f);
+    sampleHeights(
+        positions,
+        heights.left,
+        heights.right,
+        0,
+        [](size_t, const TileIndex&) { return std::optional<HeightTileData>(); },
+        res
+    );
+    for (const float h : res) {
+        CHECK(h == 0.f);
+    }
+}
@@ -0,0 +1,257 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_SPACE_ENABLED
+#include <modules/space/horizonsstore.h>
+#endif // OPENSPACE_MODULE_SPACE_ENABLED
+#include <ghoul/filesystem/filesystem.h>
+#include <ghoul/misc/exception.h>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#ifdef OPENSPACE_MODULE_SPACE_ENABLED
+
+using namespace openspace;
+
+namespace {
+    constexpr double Period = 365.25 * 86400.0;
+    constexpr double Radius = 1.496e11;
+    constexpr double Omega = 2.0 * 3.141592653589793 / Period;
+
+    // A circular orbit with a period of one year and a radius of one AU
+    HorizonsKeyframe orbit(double time) {
+        const double phase = Omega * time;
+        return HorizonsKeyframe {
+            .time = time,
+            .position = Radius * glm::dvec3(std::cos(phase), std::sin(phase), 0.0),
+            .velocity =
+                Radius * Omega * glm::dvec3(-std::sin(phase), std::cos(phase), 0.0)
+        };
+    }
+
+    std::vector<HorizonsKeyframe> createOrbit(int nSamples, double interval) {
+        std::vector<HorizonsKeyframe> samples;
+        samples.reserve(nSamples);
+        for (int i = 0; i < nSamples; i++) {
+            samples.push_back(orbit(i * interval));
+        }
+        return samples;
+    }
+} // namespace
+
+TEST_CASE("HorizonsStore: Write and Read", "[horizonsstore]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/write.horizonsstore");
+
+    std::vector<HorizonsKeyframe> samples = createOrbit(10000, 3600.0);
+    // Unsorted samples with duplicates are sorted and only stored once
+    std::vector<HorizonsKeyframe> shuffled = samples;
+    shuffled.insert(shuffled.end(), samples.begin(), samples.begin() + 100);
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(1337));
+    HorizonsStore::write(path, shuffled, true);
+
+    const HorizonsStore store = HorizonsStore(path);
+    CHECK(store.hasVelocities());
+    CHECK(store.startTime() == samples.front().time);
+    CHECK(store.endTime() == samples.back().time);
+    REQUIRE(store.nSamples(0) == samples.size());
+    for (size_t i = 0; i < samples.size(); i++) {
+        const HorizonsKeyframe s = store.sample(0, i);
+        CHECK(s.time == samples[i].time);
+        CHECK(s.position == samples[i].position);
+        CHECK(s.velocity == samples[i].velocity);
+    }
+
+    // Every level keeps every fourth sample of the previous one plus the last sample
+    REQUIRE(store.nLevels() > 1);
+    for (size_t level = 1; level < store.nLevels(); level++) {
+        CHECK(store.nSamples(level) == (store.nSamples(level - 1) - 1) / 4 + 1 +
+            ((store.nSamples(level - 1) - 1) % 4 != 0 ? 1 : 0));
+        CHECK(store.sample(level, 0).time == store.startTime());
+        CHECK(store.sample(level, store.nSamples(level) - 1).time == store.endTime());
+        CHECK(store.sampleInterval(level) > store.sampleInterval(level - 1));
+    }
+    CHECK(store.nSamples(store.nLevels() - 1) >= 64);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("HorizonsStore: Interpolation", "[horizonsstore]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/interp.horizonsstore");
+    constexpr double Interval = 86400.0;
+    const std::vector<HorizonsKeyframe> samples = createOrbit(1000, Interval);
+
+    HorizonsStore::write(path, samples, true);
+    const HorizonsStore hermite = HorizonsStore(path);
+
+    const std::filesystem::path linearPath =
+        absPath("${TEMPORARY}/interp-linear.horizonsstore");
+    HorizonsStore::write(linearPath, samples, false);
+    const HorizonsStore linear = HorizonsStore(linearPath);
+    CHECK_FALSE(linear.hasVelocities());
+
+    // The samples themselves are reproduced exactly
+    for (const HorizonsKeyframe& s : samples) {
+        CHECK(hermite.position(s.time) == s.position);
+        CHECK(linear.position(s.time) == s.position);
+    }
+
+    double maxHermiteError = 0.0;
+    double maxLinearError = 0.0;
+    for (double t = 0.0; t < samples.back().time; t += 0.37 * Interval) {
+        const glm::dvec3 expected = orbit(t).position;
+        maxHermiteError =
+            std::max(maxHermiteError, glm::length(hermite.position(t) - expected));
+        maxLinearError =
+            std::max(maxLinearError, glm::length(linear.position(t) - expected));
+    }
+    CHECK(maxHermiteError * 100.0 < maxLinearError);
+
+    // Outside of the covered range the closest sample is returned
+    CHECK(hermite.position(-1e9) == samples.front().position);
+    CHECK(hermite.position(1e12) == samples.back().position);
+
+    // Coarser levels are less accurate but still interpolate the orbit
+    const size_t coarse = hermite.nLevels() - 1;
+    REQUIRE(coarse > 0);
+    const double t = 0.5 * samples.back().time + 0.3 * Interval;
+    CHECK(glm::length(hermite.position(t, coarse) - orbit(t).position) < 0.01 * Radius);
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(linearPath);
+}
+
+TEST_CASE("HorizonsStore: Find Interval", "[horizonsstore]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/irregular.horizonsstore");
+
+    // Irregularly spaced samples with dense clusters and large gaps
+    std::mt19937 rd = std::mt19937(42);
+    std::vector<HorizonsKeyframe> samples;
+    double time = 0.0;
+    for (int i = 0; i < 5000; i++) {
+        time += (i % 500 < 50) ? 1.0 : std::uniform_real_distribution(1.0, 5000.0)(rd);
+        samples.push_back(orbit(time));
+    }
+    HorizonsStore::write(path, samples, true);
+    const HorizonsStore store = HorizonsStore(path);
+
+    std::vector<double> times;
+    for (const HorizonsKeyframe& s : samples) {
+        times.push_back(s.time);
+    }
+
+    std::uniform_real_distribution<double> dist(-1000.0, time + 1000.0);
+    for (int i = 0; i < 20000; i++) {
+        const double t = i % 10 == 0 ? times[i % times.size()] : dist(rd);
+        const auto it = std::upper_bound(times.begin(), times.end(), t);
+        size_t expected = static_cast<size_t>(std::distance(times.begin(), it));
+        expected = std::clamp<size_t>(expected, 1, times.size() - 1) - 1;
+        CHECK(store.findInterval(t, 0) == expected);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("HorizonsStore: Level Selection", "[horizonsstore]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/levels.horizonsstore");
+    HorizonsStore::write(path, createOrbit(100000, 60.0), true);
+    const HorizonsStore store = HorizonsStore(path);
+
+    CHECK(store.levelForTimeStep(0.0) == 0);
+    CHECK(store.levelForTimeStep(1.0) == 0);
+    CHECK(store.levelForTimeStep(60.0) == 0);
+    CHECK(store.levelForTimeStep(-240.0) == 1);
+    CHECK(store.levelForTimeStep(500.0) == 1);
+    CHECK(store.levelForTimeStep(1e12) == store.nLevels() - 1);
+    for (size_t level = 0; level < store.nLevels(); level++) {
+        CHECK(store.levelForTimeStep(store.sampleInterval(level)) == level);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("HorizonsStore: Invalid File", "[horizonsstore]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/invalid.horizonsstore");
+    {
+        std::ofstream file = std::ofstream(path, std::ofstream::binary);
+        file << "This is not a Horizons store";
+    }
+    CHECK_THROWS_AS(HorizonsStore(path), ghoul::RuntimeError);
+
+    // A truncated file is detected
+    HorizonsStore::write(path, createOrbit(1000, 60.0), true);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    CHECK_THROWS_AS(HorizonsStore(path), ghoul::RuntimeError);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("HorizonsStore: Benchmark", "[horizonsstore][.benchmark]") {
+    // Ten years at one minute resolution
+    constexpr int NSamples = 10 * 365 * 24 * 60;
+    constexpr int NLookups = 1'000'000;
+    const std::filesystem::path path = absPath("${TEMPORARY}/bench.horizonsstore");
+
+    const std::vector<HorizonsKeyframe> orbit = createOrbit(NSamples, 60.0);
+    BENCHMARK("Write") {
+        HorizonsStore::write(path, orbit, true);
+    };
+    BENCHMARK("Open") {
+        return HorizonsStore(path).nLevels();
+    };
+
+    // Random access, for example when jumping in time
+    const HorizonsStore store = HorizonsStore(path);
+    std::mt19937 rd = std::mt19937(1);
+    std::uniform_real_distribution<double> dist(0.0, store.endTime());
+    std::vector<double> times = std::vector<double>(NLookups);
+    std::generate(times.begin(), times.end(), [&]() { return dist(rd); });
+    BENCHMARK("Random lookups") {
+        double sum = 0.0;
+        for (double t : times) {
+            sum += store.position(t).x;
+        }
+        return sum;
+    };
+
+    // A time-lapse that advances one day per frame
+    const size_t level = store.levelForTimeStep(86400.0);
+    BENCHMARK("Daily time-lapse") {
+        double sum = 0.0;
+        for (double t = 0.0; t < store.endTime(); t += 86400.0) {
+            sum += store.position(t, level).x;
+        }
+        return sum;
+    };
+
+    std::filesystem::remove(path);
+}
+
+#endif // OPENSPACE_MODULE_SPACE_ENABLED
@@ -0,0 +1,324 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_SOLARBROWSING_ENABLED
+#include <modules/solarbrowsing/util/asyncimagedecoder.h>
+#include <modules/solarbrowsing/util/j2kcodec.h>
+#endif // OPENSPACE_MODULE_SOLARBROWSING_ENABLED
+#include <ghoul/filesystem/filesystem.h>
+#include <ghoul/format.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef OPENSPACE_MODULE_SOLARBROWSING_ENABLED
+
+using namespace openspace;
+
+namespace {
+    uint8_t pixel(uint32_t x, uint32_t y, int frame) {
+        return static_cast<uint8_t>((x * 7 + y * 3 + frame * 11 + (x * y) / 64) % 256);
+    }
+
+    // Encodes a lossless single-component 8-bit JPEG 2000 codestream
+    void writeImage(const std::filesystem::path& path, uint32_t width, uint32_t height,
+                    uint32_t tileSize, int frame = 0)
+    {
+        opj_image_cmptparm_t componentParams = {};
+        componentParams.dx = 1;
+        componentParams.dy = 1;
+        componentParams.w = width;
+        componentParams.h = height;
+        componentParams.prec = 8;
+        componentParams.sgnd = 0;
+        opj_image_t* image = opj_image_create(1, &componentParams, OPJ_CLRSPC_GRAY);
+        REQUIRE(image);
+        image->x0 = 0;
+        image->y0 = 0;
+        image->x1 = width;
+        image->y1 = height;
+        for (uint32_t y = 0; y < height; y++) {
+            for (uint32_t x = 0; x < width; x++) {
+                image->comps[0].data[y * width + x] = pixel(x, y, frame);
+            }
+        }
+
+        opj_cparameters_t params;
+        opj_set_default_encoder_parameters(&params);
+        params.tcp_numlayers = 1;
+        params.tcp_rates[0] = 0.f;
+        params.cp_disto_alloc = 1;
+        params.numresolution = 5;
+        if (tileSize > 0) {
+            params.tile_size_on = OPJ_TRUE;
+            params.cp_tdx = static_cast<int>(tileSize);
+            params.cp_tdy = static_cast<int>(tileSize);
+        }
+
+        opj_codec_t* codec = opj_create_compress(OPJ_CODEC_J2K);
+        REQUIRE(opj_setup_encoder(codec, &params, image));
+        opj_stream_t* stream = opj_stream_create_default_file_stream(
+            path.string().c_str(),
+            OPJ_FALSE
+        );
+        REQUIRE(stream);
+        REQUIRE(opj_start_compress(codec, image, stream));
+        REQUIRE(opj_encode(codec, stream));
+        REQUIRE(opj_end_compress(codec, stream));
+
+        opj_stream_destroy(stream);
+        opj_destroy_codec(codec);
+        opj_image_destroy(image);
+    }
+
+    std::vector<unsigned char> decode(const std::filesystem::path& path, int level,
+                                      std::optional<ImageRegion> region, uint32_t width,
+                                      uint32_t height)
+    {
+        const auto [w, h] = J2kCodec::decodedSize(
+            region.value_or(ImageRegion{ 0, 0, width, height }),
+            level
+        );
+        std::vector<unsigned char> res = std::vector<unsigned char>(w * h);
+        J2kCodec codec;
+        REQUIRE(codec.decode(path, res, level, region));
+        return res;
+    }
+} // namespace
+
+TEST_CASE("J2kCodec: Decoded Size", "[j2kcodec]") {
+    using Size = std::pair<uint32_t, uint32_t>;
+    CHECK(J2kCodec::decodedSize({ 0, 0, 4096, 4096 }, 0) == Size(4096, 4096));
+    CHECK(J2kCodec::decodedSize({ 0, 0, 4096, 4096 }, 2) == Size(1024, 1024));
+    CHECK(J2kCodec::decodedSize({ 0, 0, 1001, 999 }, 1) == Size(501, 500));
+    CHECK(J2kCodec::decodedSize({ 3, 5, 10, 10 }, 2) == Size(3, 2));
+}
+
+TEST_CASE("J2kCodec: Full Image", "[j2kcodec]") {
+    constexpr uint32_t Width = 300;
+    constexpr uint32_t Height = 200;
+
+    // A single tile is decoded directly into the buffer, multiple tiles are copied
+    for (uint32_t tileSize : { 0u, 64u }) {
+        const std::filesystem::path path = absPath(
+            std::format("${{TEMPORARY}}/j2kcodec-{}.j2k", tileSize)
+        );
+        writeImage(path, Width, Height, tileSize);
+
+        const std::vector<unsigned char> image = decode(
+            path,
+            0,
+            std::nullopt,
+            Width,
+            Height
+        );
+        REQUIRE(image.size() == Width * Height);
+        bool isEqual = true;
+        for (uint32_t y = 0; y < Height; y++) {
+            for (uint32_t x = 0; x < Width; x++) {
+                isEqual &= image[y * Width + x] == pixel(x, y, 0);
+            }
+        }
+        CHECK(isEqual);
+    }
+}
+
+TEST_CASE("J2kCodec: Region And Resolution", "[j2kcodec]") {
+    constexpr uint32_t Width = 256;
+    constexpr uint32_t Height = 256;
+
+    for (uint32_t tileSize : { 0u, 64u }) {
+        const std::filesystem::path path = absPath(
+            std::format("${{TEMPORARY}}/j2kcodec-region-{}.j2k", tileSize)
+        );
+        writeImage(path, Width, Height, tileSize);
+
+        for (int level : { 0, 1, 2, 3 }) {
+            const std::vector<unsigned char> full = decode(
+                path,
+                level,
+                std::nullopt,
+                Width,
+                Height
+            );
+            const uint32_t fullWidth = Width >> level;
+
+            // Regions that cover parts of several tiles, the inside of a single tile,
+            // and that do not start on a multiple of the downsampling factor.
+            // openjpeg decodes entire tiles even if only a part of them is requested
+            const std::array<ImageRegion, 3> regions = {
+                ImageRegion{ .x = 40, .y = 100, .w = 120, .h = 80 },
+                ImageRegion{ .x = 70, .y = 70, .w = 20, .h = 20 },
+                ImageRegion{ .x = 63, .y = 1, .w = 3, .h = 255 }
+            };
+            for (const ImageRegion& region : regions) {
+                const std::vector<unsigned char> part = decode(
+                    path,
+                    level,
+                    region,
+                    Width,
+                    Height
+                );
+                const auto [w, h] = J2kCodec::decodedSize(region, level);
+                REQUIRE(part.size() == w * h);
+
+                const uint32_t x0 = (region.x + (1 << level) - 1) >> level;
+                const uint32_t y0 = (region.y + (1 << level) - 1) >> level;
+                bool isEqual = true;
+                for (uint32_t y = 0; y < h; y++) {
+                    for (uint32_t x = 0; x < w; x++) {
+                        isEqual &= part[y * w + x] == full[(y0 + y) * fullWidth + x0 + x];
+                    }
+                }
+                CHECK(isEqual);
+            }
+        }
+    }
+}
+
+TEST_CASE("J2kCodec: Errors And Cancellation", "[j2kcodec]") {
+    const std::filesystem::path path = absPath("${TEMPORARY}/j2kcodec-cancel.j2k");
+    writeImage(path, 128, 128, 32);
+
+    std::vector<unsigned char> buffer = std::vector<unsigned char>(128 * 128);
+    J2kCodec codec;
+
+    const std::atomic<bool> isCancelled = true;
+    CHECK_FALSE(codec.decode(path, buffer, 0, std::nullopt, &isCancelled));
+
+    // The region has to be inside the image and the buffer has to be big enough
+    CHECK_FALSE(codec.decode(path, buffer, 0, ImageRegion{ 100, 0, 64, 64 }));
+    CHECK_FALSE(codec.decode(path, std::span(buffer).first(100), 0));
+    CHECK_FALSE(codec.decode(absPath("${TEMPORARY}/missing.j2k"), buffer, 0));
+
+    // The same codec can be used again after a failed decode
+    CHECK(codec.decode(path, buffer, 0));
+    CHECK(buffer[130] == pixel(2, 1, 0));
+}
+
+TEST_CASE("J2kCodec: Scrubbing", "[j2kcodec][.benchmark]") {
+    constexpr int NFrames = 48;
+    constexpr uint32_t Size = 2048;
+    constexpr int DownsamplingLevel = 1;
+    constexpr int FramesBefore = 2;
+    constexpr int FramesAfter = 6;
+
+    std::vector<ImageMetadata> frames;
+    for (int i = 0; i < NFrames; i++) {
+        const std::filesystem::path path = absPath(
+            std::format("${{TEMPORARY}}/j2kcodec-scrub-{}.j2k", i)
+        );
+        if (!std::filesystem::exists(path)) {
+            writeImage(path, Size, Size, 512, i);
+        }
+        frames.push_back({ .filePath = path, .fullResolution = static_cast<int>(Size) });
+    }
+
+    // Scrubbing forward through the first half of the sequence and back again, with a
+    // new prediction window every few milliseconds, before jumping to a part of the
+    // sequence that has not been requested before
+    std::vector<int> cursor;
+    for (int i = 0; i < NFrames / 2; i++) {
+        cursor.push_back(i);
+    }
+    for (int i = NFrames / 2; i >= 0; i -= 3) {
+        cursor.push_back(i);
+    }
+    cursor.push_back(3 * NFrames / 4);
+
+    auto replay = [&](Catch::Benchmark::Chronometer meter, bool replaceRequests) {
+        // Decoded frames are kept by the renderable, so a frame is available once any of
+        // its requests has finished
+        std::vector<std::atomic<bool>> isDecoded(NFrames);
+        std::atomic<int> nDecoded = 0;
+        const size_t nThreads = std::max(std::thread::hardware_concurrency() / 2, 1u);
+        AsyncImageDecoder decoder = AsyncImageDecoder(nThreads);
+
+        int first = 0;
+        int last = 0;
+        for (size_t step = 0; step < cursor.size(); step++) {
+            first = std::max(cursor[step] - FramesBefore, 0);
+            last = std::min(cursor[step] + FramesAfter, NFrames - 1);
+
+            std::vector<DecodeRequest> requests;
+            for (int i = first; i <= last; i++) {
+                requests.push_back({
+                    .metadata = frames[i],
+                    .downsamplingLevel = DownsamplingLevel,
+                    .callback = [&isDecoded, &nDecoded, i](DecodedImageData&&) {
+                        isDecoded[i] = true;
+                        nDecoded++;
+                    }
+                });
+            }
+
+            if (replaceRequests) {
+                decoder.replaceRequests(std::move(requests));
+            }
+            else {
+                for (DecodeRequest& request : requests) {
+                    decoder.requestDecode(std::move(request));
+                }
+            }
+            if (step < cursor.size() - 1) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+
+        // The time it takes until the images around the final position are available is
+        // what the user notices when they stop scrubbing
+        auto isWindowDecoded = [&]() {
+            for (int i = first; i <= last; i++) {
+                if (!isDecoded[i]) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        meter.measure([&]() {
+            while (!isWindowDecoded()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return nDecoded.load();
+        });
+    };
+
+    BENCHMARK_ADVANCED("Queue all requests")(Catch::Benchmark::Chronometer meter) {
+        replay(meter, false);
+    };
+    BENCHMARK_ADVANCED("Replace requests")(Catch::Benchmark::Chronometer meter) {
+        replay(meter, true);
+    };
+}
+
+#endif // OPENSPACE_MODULE_SOLARBROWSING_ENABLED
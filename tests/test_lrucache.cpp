@@ -22,10 +22,17 @@
  * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
  ****************************************************************************************/
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <modules/globebrowsing/src/flatlrucache.h>
 #include <modules/globebrowsing/src/lrucache.h>
 #include <glm/glm.hpp>
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace openspace;
 
@@ -96,3 +103,210 @@ TEST_CASE("LRUCache: StructKey", "[lrucache]") {
     CHECK(lru.get(key1) == val2);
     CHECK(lru.get(key2) == val2);
 }
+
+TEST_CASE("FlatLRUCache: Get", "[lrucache]") {
+    FlatLRUCache<int, std::string, DefaultHasher> lru(4);
+    lru.put(1, "hej");
+    lru.put(12, "san");
+    CHECK(lru.get(1) == "hej");
+}
+
+TEST_CASE("FlatLRUCache: CleaningCache", "[lrucache]") {
+    FlatLRUCache<int, double, DefaultHasher> lru(4);
+    lru.put(1, 1.2);
+    lru.put(12, 2.3);
+    lru.put(123, 33.4);
+    lru.put(1234, 4.5);
+    lru.put(12345, 6.7);
+    CHECK_FALSE(lru.exist(1));
+    CHECK(lru.exist(12));
+    CHECK(lru.size() == 4);
+}
+
+TEST_CASE("FlatLRUCache: StructKey", "[lrucache]") {
+    FlatLRUCache<MyKey, std::string, DefaultHasherMyKey> lru(4);
+
+    // These two custom keys should be treated as equal
+    MyKey key1 = { 2, 3 };
+    MyKey key2 = { 2, 3 };
+
+    lru.put(key1, "value 1");
+    CHECK(lru.exist(key1));
+    CHECK(lru.get(key1) == "value 1");
+
+    // Putting key2 should replace key1
+    lru.put(key2, "value 2");
+    CHECK(lru.size() == 1);
+    CHECK(lru.get(key1) == "value 2");
+    CHECK(lru.get(key2) == "value 2");
+}
+
+TEST_CASE("FlatLRUCache: Pop", "[lrucache]") {
+    FlatLRUCache<int, int, DefaultHasher> lru(3);
+    lru.put(1, 10);
+    lru.put(2, 20);
+    lru.put(3, 30);
+
+    // Touching makes the first item the most recently used
+    CHECK(lru.touch(1));
+    CHECK_FALSE(lru.touch(4));
+
+    const std::vector<std::pair<int, int>> popped = lru.putAndFetchPopped(4, 40);
+    REQUIRE(popped.size() == 1);
+    CHECK(popped[0].first == 2);
+    CHECK(lru.putAndFetchPopped(4, 41).empty());
+
+    CHECK(lru.popMRU() == std::pair(4, 41));
+    CHECK(lru.popLRU() == std::pair(3, 30));
+    CHECK(lru.popLRU() == std::pair(1, 10));
+    CHECK(lru.isEmpty());
+
+    // The cache can be reused after being emptied
+    lru.put(5, 50);
+    CHECK(lru.get(5) == 50);
+    lru.clear();
+    CHECK(lru.isEmpty());
+    CHECK_FALSE(lru.exist(5));
+}
+
+TEST_CASE("FlatLRUCache: Matches LRUCache", "[lrucache]") {
+    // The hasher only produces a few different values, which exercises the collision
+    // handling of the hash table
+    struct CollidingHasher {
+        unsigned long long operator()(int var) const {
+            return static_cast<unsigned long long>(var % 7);
+        }
+    };
+
+    LRUCache<int, int, CollidingHasher> reference(50);
+    FlatLRUCache<int, int, CollidingHasher> flat(50);
+
+    std::mt19937 random(1337);
+    std::uniform_int_distribution<int> keys(0, 200);
+    std::uniform_int_distribution<int> operations(0, 9);
+    for (int i = 0; i < 20000; i++) {
+        const int key = keys(random);
+        switch (operations(random)) {
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+                reference.put(key, i);
+                flat.put(key, i);
+                break;
+            case 4:
+            case 5:
+                CHECK(reference.touch(key) == flat.touch(key));
+                break;
+            case 6:
+                if (!reference.isEmpty()) {
+                    CHECK(reference.popLRU() == flat.popLRU());
+                }
+                break;
+            case 7:
+                if (!reference.isEmpty()) {
+                    CHECK(reference.popMRU() == flat.popMRU());
+                }
+                break;
+            default:
+                REQUIRE(reference.exist(key) == flat.exist(key));
+                if (reference.exist(key)) {
+                    CHECK(reference.get(key) == flat.get(key));
+                }
+                break;
+        }
+        REQUIRE(reference.size() == flat.size());
+    }
+
+    while (!reference.isEmpty()) {
+        CHECK(reference.popLRU() == flat.popLRU());
+    }
+    CHECK(flat.isEmpty());
+}
+
+TEST_CASE("ShardedLRUCache: Concurrent", "[lrucache]") {
+    ShardedLRUCache<int, int, DefaultHasher> lru(1000, 8);
+    CHECK(lru.maximumCacheSize() == 1000);
+
+    std::atomic_int nWrongValues = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&lru, &nWrongValues, t]() {
+            for (int i = 0; i < 10000; i++) {
+                const int key = t * 10000 + i;
+                lru.put(key, key * 2);
+                const std::optional<int> value = lru.tryGet(key - 100);
+                if (value.has_value() && *value != (key - 100) * 2) {
+                    nWrongValues++;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    CHECK(nWrongValues == 0);
+    CHECK(lru.size() <= 1000);
+    CHECK_FALSE(lru.isEmpty());
+    lru.clear();
+    CHECK(lru.isEmpty());
+}
+
+TEST_CASE("LRUCache: Benchmark", "[lrucache][.benchmark]") {
+    // Mimics the use in the MemoryAwareTileCache, where most tiles that are requested in
+    // a frame are already in the cache and only a few new tiles are added
+    constexpr int CacheSize = 20000;
+    constexpr int Iterations = 2000000;
+
+    std::mt19937 random(1337);
+    std::uniform_int_distribution<int> keys(0, CacheSize + CacheSize / 10);
+    std::vector<int> requests(Iterations);
+    for (int& r : requests) {
+        r = keys(random);
+    }
+
+    auto run = [&requests](auto& cache) {
+        int64_t sum = 0;
+        for (const int key : requests) {
+            if (cache.touch(key)) {
+                sum += cache.get(key);
+            }
+            else {
+                cache.put(key, key);
+            }
+        }
+        return sum;
+    };
+
+    LRUCache<int, int, DefaultHasher> list(CacheSize);
+    FlatLRUCache<int, int, DefaultHasher> flat(CacheSize);
+    CHECK(run(list) == run(flat));
+
+    BENCHMARK("LRUCache") {
+        return run(list);
+    };
+    BENCHMARK("FlatLRUCache") {
+        return run(flat);
+    };
+
+    // Concurrent readers on the sharded cache
+    ShardedLRUCache<int, int, DefaultHasher> sharded(CacheSize);
+    for (int i = 0; i < CacheSize; i++) {
+        sharded.put(i, i);
+    }
+    constexpr int NThreads = 4;
+    BENCHMARK("ShardedLRUCache") {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NThreads; t++) {
+            threads.emplace_back([&sharded, &requests, t]() {
+                for (size_t i = t; i < requests.size(); i += NThreads) {
+                    sharded.tryGet(requests[i]);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    };
+}
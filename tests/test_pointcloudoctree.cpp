@@ -0,0 +1,239 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <modules/base/rendering/pointcloud/pointcloudoctree.h>
+#include <random>
+
+using namespace openspace;
+using Range = PointCloudOctree::Range;
+
+namespace {
+    // Creates random positions in a cube with a side length of 200 around the origin
+    std::vector<float> createPositions(size_t nPoints, unsigned int seed) {
+        std::mt19937 rng = std::mt19937(seed);
+        std::uniform_real_distribution<float> dist =
+            std::uniform_real_distribution<float>(-100.f, 100.f);
+        std::vector<float> positions;
+        positions.reserve(3 * nPoints);
+        for (size_t i = 0; i < 3 * nPoints; i++) {
+            positions.push_back(dist(rng));
+        }
+        return positions;
+    }
+
+    bool isInside(const PointCloudOctree::Node& node, std::span<const float> positions,
+                  uint32_t i)
+    {
+        for (int c = 0; c < 3; c++) {
+            const float v = positions[3 * i + c];
+            const float min = node.center[c] - node.halfSize;
+            const float max = node.center[c] + node.halfSize;
+            if (v < min || v > max) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t nSelectedPoints(std::span<const Range> ranges) {
+        size_t n = 0;
+        for (const Range& r : ranges) {
+            n += r.count;
+        }
+        return n;
+    }
+} // namespace
+
+TEST_CASE("PointCloudOctree: Build", "[pointcloudoctree]") {
+    constexpr size_t NPoints = 20000;
+    constexpr size_t MaxPoints = 64;
+    const std::vector<float> positions = createPositions(NPoints, 1);
+    std::vector<float> importance(NPoints);
+    for (size_t i = 0; i < NPoints; i++) {
+        importance[i] = static_cast<float>((i * 7919) % 1000);
+    }
+    const std::array<Range, 2> ranges = { Range{ 0, 15000 }, Range{ 15000, 5000 } };
+
+    PointCloudOctree octree;
+    octree.build(positions, importance, ranges, MaxPoints);
+    REQUIRE(octree.nTrees() == 2);
+
+    // Every point is part of the order exactly once and stays in its range
+    const std::span<const uint32_t> order = octree.order();
+    REQUIRE(order.size() == NPoints);
+    std::vector<int> seen = std::vector<int>(NPoints, 0);
+    for (size_t i = 0; i < NPoints; i++) {
+        seen[order[i]]++;
+        CHECK((i < 15000) == (order[i] < 15000));
+    }
+    CHECK(std::all_of(seen.begin(), seen.end(), [](int s) { return s == 1; }));
+
+    const std::span<const PointCloudOctree::Node> nodes = octree.nodes();
+    for (const PointCloudOctree::Node& node : nodes) {
+        CHECK(node.first + node.count <= node.subtreeEnd);
+
+        // Points are only passed on to the children if the node is full
+        const bool hasChildren = std::any_of(
+            node.children.begin(),
+            node.children.end(),
+            [](int32_t c) { return c >= 0; }
+        );
+        if (hasChildren) {
+            CHECK(node.count == MaxPoints);
+        }
+        else {
+            CHECK(node.first + node.count == node.subtreeEnd);
+        }
+
+        float minImportance = std::numeric_limits<float>::max();
+        for (uint32_t i = node.first; i < node.first + node.count; i++) {
+            CHECK(isInside(node, positions, order[i]));
+            minImportance = std::min(minImportance, importance[order[i]]);
+        }
+
+        // The children follow the points of the node and contain less important points
+        uint32_t next = node.first + node.count;
+        for (int32_t c : node.children) {
+            if (c < 0) {
+                continue;
+            }
+            const PointCloudOctree::Node& child = nodes[c];
+            CHECK(child.first == next);
+            CHECK(child.halfSize == node.halfSize / 2.f);
+            next = child.subtreeEnd;
+            for (uint32_t i = child.first; i < child.subtreeEnd; i++) {
+                CHECK(importance[order[i]] <= minImportance);
+                CHECK(isInside(node, positions, order[i]));
+            }
+        }
+        CHECK(next == node.subtreeEnd);
+    }
+
+    const PointCloudOctree::Node& root0 = nodes[octree.root(0)];
+    CHECK(root0.first == 0);
+    CHECK(root0.subtreeEnd == 15000);
+    const PointCloudOctree::Node& root1 = nodes[octree.root(1)];
+    CHECK(root1.first == 15000);
+    CHECK(root1.subtreeEnd == NPoints);
+}
+
+TEST_CASE("PointCloudOctree: Empty", "[pointcloudoctree]") {
+    const std::vector<float> positions = createPositions(100, 2);
+    const std::array<Range, 2> ranges = { Range{ 0, 0 }, Range{ 0, 100 } };
+
+    PointCloudOctree octree;
+    octree.build(positions, {}, ranges, 16);
+    CHECK(octree.root(0) == -1);
+    CHECK(octree.root(1) >= 0);
+    CHECK(octree.root(2) == -1);
+
+    std::vector<Range> result;
+    CHECK(octree.select(0, glm::dvec3(0.0), {}, 0.0, result) == 0);
+    CHECK(result.empty());
+    CHECK(octree.select(1, glm::dvec3(0.0), {}, 0.0, result) == 100);
+}
+
+TEST_CASE("PointCloudOctree: Select", "[pointcloudoctree]") {
+    constexpr size_t NPoints = 50000;
+    const std::vector<float> positions = createPositions(NPoints, 3);
+
+    PointCloudOctree octree;
+    octree.build(positions, {}, {}, 100);
+    const PointCloudOctree::Node& root = octree.nodes()[octree.root(0)];
+
+    // From far away only the points of the root are visible
+    std::vector<Range> far;
+    const size_t nFar = octree.select(0, glm::dvec3(1e6, 0.0, 0.0), {}, 0.01, far);
+    CHECK(nFar == 100);
+    REQUIRE(far.size() == 1);
+    CHECK(far[0].first == root.first);
+
+    // Getting closer selects more points
+    std::vector<Range> near;
+    const size_t nNear = octree.select(0, glm::dvec3(150.0, 0.0, 0.0), {}, 0.01, near);
+    CHECK(nNear > nFar);
+    CHECK(nNear == nSelectedPoints(near));
+
+    // The selected ranges are sorted and do not touch each other
+    for (size_t i = 1; i < near.size(); i++) {
+        CHECK(near[i - 1].first + near[i - 1].count < near[i].first);
+    }
+
+    // Inside the point cloud all points are selected with a small enough angular size
+    std::vector<Range> all;
+    CHECK(octree.select(0, glm::dvec3(0.0), {}, 1e-9, all) == NPoints);
+    REQUIRE(all.size() == 1);
+    CHECK(all[0].count == NPoints);
+
+    // A plane that only keeps the half space x > 50 removes points with smaller x
+    const std::array<glm::dvec4, 1> frustum = { glm::dvec4(1.0, 0.0, 0.0, -50.0) };
+    std::vector<Range> culled;
+    const size_t nCulled = octree.select(0, glm::dvec3(0.0), frustum, 1e-9, culled);
+    CHECK(nCulled < NPoints / 2);
+    CHECK(nCulled == nSelectedPoints(culled));
+
+    // Each point lies inside of its node, so no visible point is removed
+    std::vector<bool> isSelected = std::vector<bool>(NPoints, false);
+    for (const Range& r : culled) {
+        for (size_t i = r.first; i < r.first + r.count; i++) {
+            isSelected[octree.order()[i]] = true;
+        }
+    }
+    for (size_t i = 0; i < NPoints; i++) {
+        if (positions[3 * i] > 50.f) {
+            CHECK(isSelected[i]);
+        }
+    }
+
+    // A plane that faces away from all points removes everything
+    const std::array<glm::dvec4, 1> none = { glm::dvec4(0.0, 1.0, 0.0, -1000.0) };
+    std::vector<Range> nothing;
+    CHECK(octree.select(0, glm::dvec3(0.0), none, 1e-9, nothing) == 0);
+    CHECK(nothing.empty());
+}
+
+TEST_CASE("PointCloudOctree: Benchmark", "[pointcloudoctree][.benchmark]") {
+    constexpr size_t NPoints = 5'000'000;
+    const std::vector<float> positions = createPositions(NPoints, 4);
+    std::vector<float> importance = createPositions(NPoints / 3, 5);
+    importance.resize(NPoints);
+
+    BENCHMARK("Build") {
+        PointCloudOctree octree;
+        octree.build(positions, importance, {}, 1024);
+        return octree.nodes().size();
+    };
+
+    PointCloudOctree octree;
+    octree.build(positions, importance, {}, 1024);
+    std::vector<Range> result;
+    const glm::dvec3 camera = glm::dvec3(500.0, 0.0, 0.0);
+    BENCHMARK("Select") {
+        result.clear();
+        return octree.select(0, camera, {}, 0.05, result);
+    };
+}
@@ -0,0 +1,225 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <modules/base/rendering/pointcloud/pointdataslice.h>
+#include <random>
+
+using namespace openspace;
+using Attribute = PointDataSlice::Attribute;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+    // Creates a dataset where each entry has three data columns. The first column
+    // contains the index of the entry, the second twice the index, and the third
+    // alternates between the texture ids 1 and 2
+    dataloader::ColumnarDataset createDataset(size_t nEntries) {
+        dataloader::Dataset dataset;
+        dataset.entries.reserve(nEntries);
+        for (size_t i = 0; i < nEntries; i++) {
+            const float v = static_cast<float>(i);
+            dataloader::Dataset::Entry e;
+            e.position = glm::vec3(v, 2.f * v, -v);
+            e.data = { v, 2.f * v, (i % 2 == 0) ? 1.f : 2.f };
+            dataset.entries.push_back(std::move(e));
+        }
+        return dataloader::ColumnarDataset::createFromDataset(dataset);
+    }
+} // namespace
+
+TEST_CASE("PointDataSlice: Positions", "[pointdataslice]") {
+    const dataloader::ColumnarDataset dataset = createDataset(10000);
+
+    PointDataSlice::Layout layout;
+    layout.unitScale = 2.0;
+    layout.transformation[3] = glm::dvec4(1.0, 0.0, 0.0, 1.0);
+
+    PointDataSlice slice;
+    const PointDataSlice::UpdateResult res = slice.update(dataset, 10000, layout);
+    CHECK(res.needsReallocation);
+    REQUIRE(res.changedAttributes.size() == 1);
+    CHECK(res.changedAttributes[0] == Attribute::Position);
+
+    CHECK(slice.nPoints() == 10000);
+    CHECK(slice.hasAttribute(Attribute::Position));
+    CHECK_FALSE(slice.hasAttribute(Attribute::ColorParameter));
+    CHECK(slice.data().size() == 30000);
+
+    const std::span<const float> positions = slice.column(Attribute::Position);
+    REQUIRE(positions.size() == 30000);
+    for (size_t i = 0; i < 10000; i += 997) {
+        const float v = static_cast<float>(i);
+        CHECK_THAT(positions[3 * i], WithinAbs(2.f * v + 1.f, 1e-3));
+        CHECK_THAT(positions[3 * i + 1], WithinAbs(4.f * v, 1e-3));
+        CHECK_THAT(positions[3 * i + 2], WithinAbs(-2.f * v, 1e-3));
+    }
+
+    // The point that is furthest away is the last one
+    const glm::dvec3 last = glm::dvec3(2.0 * 9999.0 + 1.0, 4.0 * 9999.0, -2.0 * 9999.0);
+    CHECK_THAT(slice.maxRadius(), WithinAbs(glm::length(last), 1e-6));
+
+    // Updating with the same layout does not change anything
+    const PointDataSlice::UpdateResult same = slice.update(dataset, 10000, layout);
+    CHECK_FALSE(same.needsReallocation);
+    CHECK(same.changedAttributes.empty());
+}
+
+TEST_CASE("PointDataSlice: Change Single Column", "[pointdataslice]") {
+    const dataloader::ColumnarDataset dataset = createDataset(5000);
+
+    PointDataSlice::Layout layout;
+    layout.colorParameterIndex = 0;
+    layout.sizeParameterIndex = 1;
+    layout.sizeMultiplier = 2.f;
+
+    PointDataSlice slice;
+    slice.update(dataset, 5000, layout);
+    CHECK(slice.columnOffset(Attribute::Position) == 0);
+    CHECK(slice.columnOffset(Attribute::ColorParameter) == 15000);
+    CHECK(slice.columnOffset(Attribute::SizeParameter) == 20000);
+    CHECK(slice.column(Attribute::ColorParameter)[100] == 100.f);
+    CHECK(slice.column(Attribute::SizeParameter)[100] == 400.f);
+
+    // Switching the color parameter only touches the color column
+    layout.colorParameterIndex = 1;
+    const PointDataSlice::UpdateResult color = slice.update(dataset, 5000, layout);
+    CHECK_FALSE(color.needsReallocation);
+    REQUIRE(color.changedAttributes.size() == 1);
+    CHECK(color.changedAttributes[0] == Attribute::ColorParameter);
+    CHECK(slice.column(Attribute::ColorParameter)[100] == 200.f);
+
+    // Interpreting the size as a radius instead only touches the size column
+    layout.sizeMultiplier = 1.f;
+    const PointDataSlice::UpdateResult size = slice.update(dataset, 5000, layout);
+    CHECK_FALSE(size.needsReallocation);
+    REQUIRE(size.changedAttributes.size() == 1);
+    CHECK(size.changedAttributes[0] == Attribute::SizeParameter);
+    CHECK(slice.column(Attribute::SizeParameter)[100] == 200.f);
+
+    // Removing the color moves the other columns but keeps their values
+    layout.colorParameterIndex = -1;
+    const PointDataSlice::UpdateResult removed = slice.update(dataset, 5000, layout);
+    CHECK(removed.needsReallocation);
+    CHECK(removed.changedAttributes.empty());
+    CHECK(slice.data().size() == 20000);
+    CHECK(slice.columnOffset(Attribute::SizeParameter) == 15000);
+    CHECK(slice.column(Attribute::SizeParameter)[100] == 200.f);
+    CHECK(slice.column(Attribute::ColorParameter).empty());
+
+    // Invalidating the slice recomputes everything
+    slice.invalidate();
+    const PointDataSlice::UpdateResult all = slice.update(dataset, 5000, layout);
+    CHECK(all.needsReallocation);
+    CHECK(all.changedAttributes.size() == 2);
+}
+
+TEST_CASE("PointDataSlice: Texture Arrays", "[pointdataslice]") {
+    const dataloader::ColumnarDataset dataset = createDataset(1001);
+
+    PointDataSlice::Layout layout;
+    layout.colorParameterIndex = 0;
+    layout.hasTextureLayer = true;
+    layout.textureIndex = 2;
+    layout.textures[1] = { .arrayId = 1, .layer = 3 };
+    layout.textures[2] = { .arrayId = 0, .layer = 5 };
+    layout.nTextureArrays = 2;
+
+    PointDataSlice slice;
+    slice.update(dataset, 1001, layout);
+
+    // Entries with an odd index use texture 2, which is in the first array
+    const std::span<const PointDataSlice::Range> ranges = slice.textureArrayRanges();
+    REQUIRE(ranges.size() == 2);
+    CHECK(ranges[0].first == 0);
+    CHECK(ranges[0].count == 500);
+    CHECK(ranges[1].first == 500);
+    CHECK(ranges[1].count == 501);
+
+    // The relative order of the entries within an array is kept
+    const std::span<const float> color = slice.column(Attribute::ColorParameter);
+    const std::span<const float> layer = slice.column(Attribute::TextureLayer);
+    CHECK(color[0] == 1.f);
+    CHECK(color[1] == 3.f);
+    CHECK(color[499] == 999.f);
+    CHECK(color[500] == 0.f);
+    CHECK(color[501] == 2.f);
+    CHECK(color[1000] == 1000.f);
+    CHECK(layer[0] == 5.f);
+    CHECK(layer[500] == 3.f);
+
+    const std::span<const float> positions = slice.column(Attribute::Position);
+    CHECK(positions[3] == 3.f);
+    CHECK(positions[3 * 500 + 1] == 0.f);
+    CHECK(positions[3 * 501 + 1] == 4.f);
+
+    // Without a texture column, all points use the default texture
+    layout.textureIndex = -1;
+    layout.defaultTexture = { .arrayId = 1, .layer = 2 };
+    const PointDataSlice::UpdateResult res = slice.update(dataset, 1001, layout);
+    CHECK_FALSE(res.needsReallocation);
+    CHECK(res.changedAttributes.size() == 3);
+    CHECK(slice.textureArrayRanges()[0].count == 0);
+    CHECK(slice.textureArrayRanges()[1].count == 1001);
+    CHECK(slice.column(Attribute::ColorParameter)[1] == 1.f);
+    CHECK(slice.column(Attribute::TextureLayer)[1] == 2.f);
+}
+
+TEST_CASE("PointDataSlice: Benchmark", "[pointdataslice][.benchmark]") {
+    constexpr size_t NPoints = 5'000'000;
+
+    std::mt19937 rng = std::mt19937(1);
+    std::uniform_real_distribution<float> dist = std::uniform_real_distribution<float>(
+        -1000.f,
+        1000.f
+    );
+    dataloader::Dataset rows;
+    rows.entries.resize(NPoints);
+    for (dataloader::Dataset::Entry& e : rows.entries) {
+        e.position = glm::vec3(dist(rng), dist(rng), dist(rng));
+        e.data = { dist(rng), dist(rng), dist(rng), dist(rng) };
+    }
+    const dataloader::ColumnarDataset dataset =
+        dataloader::ColumnarDataset::createFromDataset(rows);
+
+    PointDataSlice::Layout layout;
+    layout.unitScale = 3.0857e16;
+    layout.colorParameterIndex = 0;
+    layout.sizeParameterIndex = 1;
+
+    BENCHMARK("Full build") {
+        PointDataSlice slice;
+        slice.update(dataset, NPoints, layout);
+        return slice.column(Attribute::Position).size();
+    };
+
+    PointDataSlice slice;
+    slice.update(dataset, NPoints, layout);
+    BENCHMARK("Color change") {
+        layout.colorParameterIndex = layout.colorParameterIndex == 2 ? 3 : 2;
+        return slice.update(dataset, NPoints, layout).changedAttributes.size();
+    };
+}
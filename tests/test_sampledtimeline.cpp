@@ -0,0 +1,267 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/util/sampledtimeline.h>
+#include <openspace/util/timeline.h>
+#include <ghoul/glm.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace openspace;
+using Interpolation = SampledTimeline<double>::Interpolation;
+
+TEST_CASE("SampledTimeline: Add Samples", "[sampledtimeline]") {
+    SampledTimeline<double> timeline;
+    CHECK(timeline.evaluate(1.0) == 0.0);
+
+    CHECK(timeline.addSample(2.0, 20.0));
+    CHECK(timeline.addSample(0.0, 0.0));
+    CHECK(timeline.addSample(1.0, 10.0));
+    CHECK_FALSE(timeline.addSample(1.0, 15.0));
+    REQUIRE(timeline.nSamples() == 3);
+
+    CHECK(timeline.times()[0] == 0.0);
+    CHECK(timeline.times()[1] == 1.0);
+    CHECK(timeline.times()[2] == 2.0);
+    CHECK(timeline.values()[1] == 10.0);
+    CHECK_FALSE(timeline.hasDerivatives());
+
+    timeline.clear();
+    CHECK(timeline.nSamples() == 0);
+}
+
+TEST_CASE("SampledTimeline: Derivatives", "[sampledtimeline]") {
+    SampledTimeline<double> timeline;
+    timeline.addSample(0.0, 0.0, 1.0);
+    timeline.addSample(1.0, 1.0, 1.0);
+    CHECK(timeline.hasDerivatives());
+    CHECK(timeline.derivatives().size() == 2);
+
+    // A single sample without a derivative removes all of them
+    timeline.addSample(2.0, 2.0);
+    CHECK_FALSE(timeline.hasDerivatives());
+    CHECK(timeline.derivatives().empty());
+
+    timeline.addSample(3.0, 3.0, 1.0);
+    CHECK_FALSE(timeline.hasDerivatives());
+}
+
+TEST_CASE("SampledTimeline: Linear Interpolation", "[sampledtimeline]") {
+    SampledTimeline<glm::dvec3> timeline;
+    timeline.addSample(0.0, glm::dvec3(0.0, 0.0, 0.0));
+    timeline.addSample(10.0, glm::dvec3(10.0, 20.0, 30.0));
+    timeline.addSample(20.0, glm::dvec3(0.0, 0.0, 0.0));
+
+    CHECK(timeline.evaluate(-5.0) == glm::dvec3(0.0, 0.0, 0.0));
+    CHECK(timeline.evaluate(5.0) == glm::dvec3(5.0, 10.0, 15.0));
+    CHECK(timeline.evaluate(10.0) == glm::dvec3(10.0, 20.0, 30.0));
+    CHECK(timeline.evaluate(15.0) == glm::dvec3(5.0, 10.0, 15.0));
+    CHECK(timeline.evaluate(25.0) == glm::dvec3(0.0, 0.0, 0.0));
+
+    // Without derivatives, the Hermite interpolation falls back to linear
+    timeline.setInterpolation(SampledTimeline<glm::dvec3>::Interpolation::Hermite);
+    CHECK(timeline.evaluate(5.0) == glm::dvec3(5.0, 10.0, 15.0));
+}
+
+TEST_CASE("SampledTimeline: Hermite Interpolation", "[sampledtimeline]") {
+    // A cubic Hermite spline reproduces a cubic polynomial exactly
+    auto f = [](double t) { return 0.5 * t * t * t - 2.0 * t * t + t + 3.0; };
+    auto df = [](double t) { return 1.5 * t * t - 4.0 * t + 1.0; };
+
+    SampledTimeline<double> timeline;
+    for (double t = 0.0; t <= 10.0; t += 2.5) {
+        timeline.addSample(t, f(t), df(t));
+    }
+    timeline.setInterpolation(Interpolation::Hermite);
+
+    for (double t = 0.0; t <= 10.0; t += 0.1) {
+        CHECK(timeline.evaluate(t) == Catch::Approx(f(t)).margin(1e-9));
+    }
+
+    // A circular orbit sampled with its velocity is much more accurate than the linear
+    // interpolation of the same samples
+    constexpr double Period = 1000.0;
+    constexpr double Omega = 2.0 * 3.14159265358979323846 / Period;
+    SampledTimeline<glm::dvec3> orbit;
+    for (double t = 0.0; t <= Period; t += Period / 20.0) {
+        orbit.addSample(
+            t,
+            glm::dvec3(std::cos(Omega * t), std::sin(Omega * t), 0.0),
+            glm::dvec3(-Omega * std::sin(Omega * t), Omega * std::cos(Omega * t), 0.0)
+        );
+    }
+    double linearError = 0.0;
+    double hermiteError = 0.0;
+    for (double t = 0.0; t <= Period; t += 1.0) {
+        const glm::dvec3 p = glm::dvec3(std::cos(Omega * t), std::sin(Omega * t), 0.0);
+        orbit.setInterpolation(SampledTimeline<glm::dvec3>::Interpolation::Linear);
+        linearError = std::max(linearError, glm::length(orbit.evaluate(t) - p));
+        orbit.setInterpolation(SampledTimeline<glm::dvec3>::Interpolation::Hermite);
+        hermiteError = std::max(hermiteError, glm::length(orbit.evaluate(t) - p));
+    }
+    CHECK(hermiteError * 100.0 < linearError);
+}
+
+TEST_CASE("SampledTimeline: Find Interval", "[sampledtimeline]") {
+    SampledTimeline<double> timeline;
+    for (int i = 0; i < 1000; i++) {
+        timeline.addSample(static_cast<double>(i), static_cast<double>(i));
+    }
+
+    // Sequential lookups in both directions and random jumps find the same intervals
+    // as a search from scratch
+    std::mt19937 rng = std::mt19937(1);
+    std::uniform_real_distribution<double> dist =
+        std::uniform_real_distribution<double>(-10.0, 1010.0);
+    std::vector<double> times;
+    for (double t = 0.0; t < 1000.0; t += 0.3) {
+        times.push_back(t);
+    }
+    for (double t = 1000.0; t > 0.0; t -= 0.7) {
+        times.push_back(t);
+    }
+    for (int i = 0; i < 1000; i++) {
+        times.push_back(dist(rng));
+    }
+
+    for (double t : times) {
+        const size_t expected = std::clamp<size_t>(
+            static_cast<size_t>(std::max(std::floor(t), 0.0)),
+            0,
+            998
+        );
+        CHECK(timeline.findInterval(t) == expected);
+        CHECK(timeline.evaluate(t) == Catch::Approx(std::clamp(t, 0.0, 999.0)));
+    }
+}
+
+TEST_CASE("SampledTimeline: Batched Evaluation", "[sampledtimeline]") {
+    SampledTimeline<double> timeline;
+    for (int i = 0; i <= 100; i++) {
+        const double t = static_cast<double>(i);
+        timeline.addSample(t, std::sin(t), std::cos(t));
+    }
+    timeline.setInterpolation(Interpolation::Hermite);
+
+    std::vector<double> times;
+    for (double t = -5.0; t < 105.0; t += 0.25) {
+        times.push_back(t);
+    }
+    std::vector<double> result = std::vector<double>(times.size());
+    timeline.evaluate(times, result);
+    for (size_t i = 0; i < times.size(); i++) {
+        CHECK(result[i] == timeline.evaluate(times[i]));
+    }
+}
+
+TEST_CASE("SampledTimeline: Move-Only Values", "[sampledtimeline]") {
+    // Values that can not be interpolated can still be looked up by their time
+    SampledTimeline<std::unique_ptr<int>> timeline;
+    CHECK(timeline.addSample(1.0, std::make_unique<int>(1)));
+    CHECK(timeline.addSample(0.0, std::make_unique<int>(0)));
+    CHECK(timeline.addSample(2.0, std::make_unique<int>(2)));
+    CHECK_FALSE(timeline.addSample(1.0, std::make_unique<int>(3)));
+    REQUIRE(timeline.nSamples() == 3);
+
+    CHECK(*timeline.values()[timeline.findInterval(0.5)] == 0);
+    CHECK(*timeline.values()[timeline.findInterval(1.5)] == 1);
+    CHECK(*timeline.values()[timeline.findInterval(5.0)] == 1);
+}
+
+TEST_CASE("SampledTimeline: Hermite Function", "[sampledtimeline]") {
+    // The spline passes through the end points with the provided derivatives
+    auto f = [](double t) {
+        return interpolateHermite(2.0, 1.0, -1.0, 4.0, 5.0, 3.0, t);
+    };
+    CHECK(f(2.0) == Catch::Approx(1.0));
+    CHECK(f(4.0) == Catch::Approx(5.0));
+    constexpr double H = 1e-6;
+    CHECK((f(2.0 + H) - f(2.0)) / H == Catch::Approx(-1.0).margin(1e-4));
+    CHECK((f(4.0) - f(4.0 - H)) / H == Catch::Approx(3.0).margin(1e-4));
+
+    // A straight line with matching derivatives is reproduced exactly
+    const glm::dvec3 v = glm::dvec3(1.0, -2.0, 0.5);
+    const glm::dvec3 p =
+        interpolateHermite(0.0, glm::dvec3(0.0), v, 10.0, v * 10.0, v, 3.0);
+    CHECK(glm::length(p - v * 3.0) < 1e-12);
+}
+
+TEST_CASE("SampledTimeline: Benchmark", "[sampledtimeline][.benchmark]") {
+    constexpr int NSamples = 1'000'000;
+    constexpr int NLookups = 10'000'000;
+
+    Timeline<glm::dvec3> keyframes;
+    SampledTimeline<glm::dvec3> samples;
+    samples.reserve(NSamples);
+    for (int i = 0; i < NSamples; i++) {
+        const double t = static_cast<double>(i);
+        keyframes.addKeyframe(t, glm::dvec3(t));
+        samples.addSample(t, glm::dvec3(t), glm::dvec3(1.0));
+    }
+
+    // Sequential playback, the way the translations are evaluated every frame
+    std::vector<double> times = std::vector<double>(NLookups);
+    for (int i = 0; i < NLookups; i++) {
+        times[i] = i * static_cast<double>(NSamples) / NLookups;
+    }
+
+    BENCHMARK("Timeline") {
+        double sum = 0.0;
+        for (double t : times) {
+            const Keyframe<glm::dvec3>* prev = keyframes.lastKeyframeBefore(t, true);
+            const Keyframe<glm::dvec3>* next = keyframes.firstKeyframeAfter(t, false);
+            if (prev && next) {
+                const double s =
+                    (t - prev->timestamp) / (next->timestamp - prev->timestamp);
+                sum += prev->data.x + (next->data.x - prev->data.x) * s;
+            }
+        }
+        return sum;
+    };
+    BENCHMARK("SampledTimeline") {
+        double sum = 0.0;
+        for (double t : times) {
+            sum += samples.evaluate(t).x;
+        }
+        return sum;
+    };
+
+    std::vector<glm::dvec3> result = std::vector<glm::dvec3>(NLookups);
+    BENCHMARK("SampledTimeline batched") {
+        samples.evaluate(times, result);
+        return result.back().x;
+    };
+    samples.setInterpolation(SampledTimeline<glm::dvec3>::Interpolation::Hermite);
+    BENCHMARK("SampledTimeline batched Hermite") {
+        samples.evaluate(times, result);
+        return result.back().x;
+    };
+}
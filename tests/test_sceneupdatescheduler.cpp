@@ -0,0 +1,265 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/scene/sceneupdatescheduler.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <format>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace openspace;
+using Node = SceneUpdateScheduler::Node;
+
+namespace {
+    // Creates a scene that resembles a large profile with a broad hierarchy, a few
+    // additional dependencies between nodes, and a fraction of nodes that have to be
+    // updated on the main thread, for example because they use SPICE
+    std::vector<Node> syntheticScene(size_t nNodes, double serialFraction,
+                                     unsigned int seed)
+    {
+        std::mt19937 rng = std::mt19937(seed);
+        std::uniform_real_distribution<double> dist = std::uniform_real_distribution(
+            0.0,
+            1.0
+        );
+
+        std::vector<Node> nodes = std::vector<Node>(nNodes);
+        nodes[0].isConcurrent = true;
+        for (size_t i = 1; i < nNodes; i++) {
+            // Prefer parents close to the root so that the tree becomes broad
+            const size_t nCandidates = std::max<size_t>(1, i / 16);
+            const uint32_t parent = static_cast<uint32_t>(rng() % nCandidates);
+            nodes[i].predecessors.push_back(parent);
+            if (dist(rng) < 0.05) {
+                const uint32_t dependency = static_cast<uint32_t>(rng() % i);
+                if (dependency != parent) {
+                    nodes[i].predecessors.push_back(dependency);
+                }
+            }
+            nodes[i].isConcurrent = dist(rng) >= serialFraction;
+        }
+        return nodes;
+    }
+
+    // Simulates the cost of evaluating a transformation
+    double work(uint32_t node, int nIterations) {
+        double res = 0.0;
+        for (int i = 0; i < nIterations; i++) {
+            res += std::sin(static_cast<double>(node) + 0.001 * i);
+        }
+        return res;
+    }
+} // namespace
+
+TEST_CASE("SceneUpdateScheduler: Levels", "[sceneupdatescheduler]") {
+    //     0
+    //    / \
+    //   1   2
+    //   |   |
+    //   3 ->4  (4 depends on 3)
+    std::vector<Node> nodes = std::vector<Node>(5);
+    nodes[0] = { .predecessors = {}, .isConcurrent = true };
+    nodes[1] = { .predecessors = { 0 }, .isConcurrent = true };
+    nodes[2] = { .predecessors = { 0 }, .isConcurrent = false };
+    nodes[3] = { .predecessors = { 1 }, .isConcurrent = true };
+    nodes[4] = { .predecessors = { 2, 3 }, .isConcurrent = true };
+
+    SceneUpdateScheduler scheduler;
+    scheduler.build(nodes);
+    CHECK(scheduler.nNodes() == 5);
+
+    const std::span<const SceneUpdateScheduler::Level> levels = scheduler.levels();
+    REQUIRE(levels.size() == 4);
+
+    const std::vector<uint32_t> level0 = { 0 };
+    const std::vector<uint32_t> level1 = { 1, 2 };
+    const std::vector<uint32_t> level1Concurrent = { 1 };
+    const std::vector<uint32_t> level1Serial = { 2 };
+    const std::vector<uint32_t> level2 = { 3 };
+    const std::vector<uint32_t> level3 = { 4 };
+    CHECK(levels[0].nodes == level0);
+    CHECK(levels[1].nodes == level1);
+    CHECK(levels[1].concurrent == level1Concurrent);
+    CHECK(levels[1].serial == level1Serial);
+    CHECK(levels[2].nodes == level2);
+    CHECK(levels[3].nodes == level3);
+}
+
+TEST_CASE("SceneUpdateScheduler: Serial", "[sceneupdatescheduler]") {
+    const std::vector<Node> nodes = syntheticScene(200, 0.2, 1);
+    SceneUpdateScheduler scheduler;
+    scheduler.build(nodes);
+
+    // Without parallelism, the nodes are updated one after another
+    std::vector<int> calls;
+    scheduler.run(
+        [&calls](uint32_t i) { calls.push_back(2 * static_cast<int>(i)); },
+        [&calls](uint32_t i) { calls.push_back(2 * static_cast<int>(i) + 1); },
+        false
+    );
+
+    REQUIRE(calls.size() == 400);
+    for (size_t i = 0; i < calls.size(); i++) {
+        CHECK(calls[i] == static_cast<int>(i));
+    }
+}
+
+TEST_CASE("SceneUpdateScheduler: Parallel Ordering", "[sceneupdatescheduler]") {
+    const std::vector<Node> nodes = syntheticScene(3000, 0.2, 2);
+    SceneUpdateScheduler scheduler;
+    scheduler.build(nodes);
+
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<int> clock = 0;
+    std::vector<int> transformed = std::vector<int>(nodes.size(), -1);
+    std::vector<int> finalized = std::vector<int>(nodes.size(), -1);
+    std::atomic<int> nSerialOnWorker = 0;
+    std::atomic<int> nFinalizeOnWorker = 0;
+    std::atomic<int> nDuplicates = 0;
+
+    scheduler.run(
+        [&](uint32_t i) {
+            if (!nodes[i].isConcurrent && std::this_thread::get_id() != caller) {
+                nSerialOnWorker++;
+            }
+            if (transformed[i] != -1) {
+                nDuplicates++;
+            }
+            transformed[i] = clock++;
+            work(i, 100);
+        },
+        [&](uint32_t i) {
+            if (std::this_thread::get_id() != caller) {
+                nFinalizeOnWorker++;
+            }
+            if (finalized[i] != -1) {
+                nDuplicates++;
+            }
+            finalized[i] = clock++;
+        },
+        true
+    );
+
+    CHECK(nSerialOnWorker == 0);
+    CHECK(nFinalizeOnWorker == 0);
+    CHECK(nDuplicates == 0);
+
+    // Every node has been updated and all of its predecessors were completely updated
+    // before the update of the node started
+    int nViolations = 0;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        REQUIRE(transformed[i] != -1);
+        REQUIRE(finalized[i] > transformed[i]);
+        for (const uint32_t p : nodes[i].predecessors) {
+            if (finalized[p] > transformed[i]) {
+                nViolations++;
+            }
+        }
+    }
+    CHECK(nViolations == 0);
+}
+
+TEST_CASE("SceneUpdateScheduler: Exceptions", "[sceneupdatescheduler]") {
+    const std::vector<Node> nodes = syntheticScene(1000, 0.0, 3);
+    SceneUpdateScheduler scheduler;
+    scheduler.build(nodes);
+
+    // Find the level of the node that throws, no node of a later level may be updated
+    const std::span<const SceneUpdateScheduler::Level> levels = scheduler.levels();
+    constexpr uint32_t Failing = 500;
+    std::vector<size_t> nodeLevel = std::vector<size_t>(nodes.size());
+    for (size_t l = 0; l < levels.size(); l++) {
+        for (const uint32_t i : levels[l].nodes) {
+            nodeLevel[i] = l;
+        }
+    }
+
+    std::atomic<int> nTransformed = 0;
+    std::atomic<int> nTransformedLater = 0;
+    bool hasThrown = false;
+    try {
+        scheduler.run(
+            [&](uint32_t i) {
+                nTransformed++;
+                if (nodeLevel[i] > nodeLevel[Failing]) {
+                    nTransformedLater++;
+                }
+                if (i == Failing) {
+                    throw std::runtime_error("Failure");
+                }
+            },
+            [](uint32_t) {},
+            true
+        );
+    }
+    catch (const std::runtime_error&) {
+        hasThrown = true;
+    }
+    CHECK(hasThrown);
+    CHECK(nTransformed > 0);
+    CHECK(nTransformedLater == 0);
+}
+
+TEST_CASE("SceneUpdateScheduler: Benchmark", "[sceneupdatescheduler][.benchmark]") {
+    constexpr size_t NNodes = 3000;
+    // Roughly 20 microseconds for a transformation, similar to a SPICE lookup
+    constexpr int NIterations = 400;
+
+    for (const double serialFraction : { 0.0, 0.25, 0.5 }) {
+        const std::vector<Node> nodes = syntheticScene(NNodes, serialFraction, 4);
+        SceneUpdateScheduler scheduler;
+        scheduler.build(nodes);
+
+        // The serial lane simulates calls into a library that is protected by a global
+        // lock, which is the case for SPICE
+        std::mutex serialMutex;
+        std::vector<double> results = std::vector<double>(NNodes);
+        auto transform = [&](uint32_t i) {
+            if (nodes[i].isConcurrent) {
+                results[i] = work(i, NIterations);
+            }
+            else {
+                const std::lock_guard lock(serialMutex);
+                results[i] = work(i, NIterations);
+            }
+        };
+        auto finalize = [&results](uint32_t i) { results[i] *= 0.5; };
+
+        const int percent = static_cast<int>(serialFraction * 100.0);
+        BENCHMARK(std::format("Serial ({}% serial nodes)", percent)) {
+            scheduler.run(transform, finalize, false);
+        };
+        BENCHMARK(std::format("Parallel ({}% serial nodes)", percent)) {
+            scheduler.run(transform, finalize, true);
+        };
+    }
+}
@@ -26,7 +26,12 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <openspace/util/spicemanager.h>
+#include <openspace/util/spiceservice.h>
 #include <ghoul/filesystem/filesystem.h>
+#include <array>
+#include <cmath>
+#include <future>
+#include <vector>
 #include "SpiceUsr.h"
 #include "SpiceZpr.h"
 
@@ -255,6 +260,177 @@ TEST_CASE("SpiceManager: Get Position Transform Matrix", "[spicemanager]") {
     SpiceManager::deinitialize();
 }
 
+TEST_CASE("SpiceManager: Ephemeris Cache", "[spicemanager]") {
+    SpiceManager::initialize();
+
+    loadMetaKernel();
+
+    constexpr double PositionTolerance = 1e-3;
+    constexpr double RotationTolerance = 1e-9;
+    SpiceManager::ref().setEphemerisCacheTolerance(PositionTolerance, RotationTolerance);
+    SpiceManager::ref().setEphemerisCacheEnabled(true);
+    CHECK(SpiceManager::ref().isEphemerisCacheEnabled());
+
+    double et = 0.0;
+    str2et_c("2004 JUN 11 19:32:00", &et);
+
+    const SpiceManager::AberrationCorrection corr = {
+        SpiceManager::AberrationCorrection::Type::LightTimeStellar,
+        SpiceManager::AberrationCorrection::Direction::Reception
+    };
+
+    for (int i = 0; i < 60; i++) {
+        const double t = et + i * 60.0;
+
+        std::array<double, 3> pos = { 0.0, 0.0, 0.0 };
+        double lt = 0.0;
+        spkpos_c("EARTH", t, "J2000", "LT+S", "CASSINI", pos.data(), &lt);
+
+        double lightTime = 0.0;
+        const glm::dvec3 position = SpiceManager::ref().targetPosition(
+            "EARTH",
+            "CASSINI",
+            "J2000",
+            corr,
+            t,
+            lightTime
+        );
+        CHECK(std::abs(position.x - pos[0]) <= PositionTolerance);
+        CHECK(std::abs(position.y - pos[1]) <= PositionTolerance);
+        CHECK(std::abs(position.z - pos[2]) <= PositionTolerance);
+        CHECK(lightTime == Catch::Approx(lt));
+
+        std::array<double[3], 3> referenceMatrix;
+        pxform_c("IAU_SATURN", "J2000", t, referenceMatrix.data());
+        const glm::dmat3 matrix = SpiceManager::ref().positionTransformMatrix(
+            "IAU_SATURN",
+            "J2000",
+            t
+        );
+        for (int j = 0; j < 3; j++) {
+            for (int k = 0; k < 3; k++) {
+                const double diff = referenceMatrix[j][k] - matrix[k][j];
+                CHECK(std::abs(diff) <= RotationTolerance);
+            }
+        }
+    }
+
+    SpiceManager::EphemerisCacheStatistics stats =
+        SpiceManager::ref().ephemerisCacheStatistics();
+    CHECK(stats.nHits > 0);
+    CHECK(stats.nSegments > 0);
+
+    // In validation mode every cached value is compared against SPICE
+    SpiceManager::ref().setEphemerisCacheValidation(true);
+    for (int i = 0; i < 60; i++) {
+        const double t = et + i * 60.0 + 30.0;
+        SpiceManager::ref().targetPosition("EARTH", "CASSINI", "J2000", corr, t);
+        SpiceManager::ref().positionTransformMatrix("IAU_SATURN", "J2000", t);
+    }
+    stats = SpiceManager::ref().ephemerisCacheStatistics();
+    CHECK(stats.nValidationFailures == 0);
+    CHECK(stats.maxPositionError <= PositionTolerance);
+    CHECK(stats.maxRotationError <= RotationTolerance);
+
+    // Unloading a kernel invalidates the cached segments, but keeps the counters
+    const uint64_t nHits = stats.nHits;
+    SpiceManager::ref().unloadKernel(
+        absPath("${TESTDIR}/SpiceTest/spicekernels/cas_iss_v09.ti")
+    );
+    stats = SpiceManager::ref().ephemerisCacheStatistics();
+    CHECK(stats.nSegments == 0);
+    CHECK(stats.nHits == nHits);
+
+    SpiceManager::ref().resetEphemerisCacheStatistics();
+    stats = SpiceManager::ref().ephemerisCacheStatistics();
+    CHECK(stats.nHits == 0);
+    CHECK(stats.nMisses == 0);
+
+    SpiceManager::deinitialize();
+}
+
+TEST_CASE("SpiceManager: Batched Service", "[spicemanager]") {
+    SpiceManager::initialize();
+
+    loadMetaKernel();
+
+    double et = 0.0;
+    str2et_c("2004 JUN 11 19:32:00", &et);
+
+    // The reference values are computed directly with CSPICE before the service is used,
+    // as calling CSPICE without the SpiceManager's lock would race with the worker thread
+    std::vector<double> times;
+    std::vector<double> references;
+    for (int i = 0; i < 100; i++) {
+        times.push_back(et + i * 60.0);
+
+        std::array<double, 3> pos = { 0.0, 0.0, 0.0 };
+        double lt = 0.0;
+        spkpos_c("EARTH", times.back(), "J2000", "NONE", "CASSINI", pos.data(), &lt);
+        references.push_back(pos[0]);
+    }
+
+    SpiceService& service = SpiceManager::ref().service();
+    std::future<std::vector<glm::dvec3>> positions = service.targetPositions(
+        "EARTH",
+        "CASSINI",
+        "J2000",
+        SpiceManager::AberrationCorrection(),
+        times
+    );
+    std::future<std::vector<glm::dmat3>> matrices = service.positionTransformMatrices(
+        "CASSINI_HGA",
+        "J2000",
+        times
+    );
+
+    // Queries from this thread are interleaved with the batches of the service
+    for (size_t i = 0; i < times.size(); i++) {
+        const glm::dvec3 p = SpiceManager::ref().targetPosition(
+            "EARTH",
+            "CASSINI",
+            "J2000",
+            SpiceManager::AberrationCorrection(),
+            times[i]
+        );
+        CHECK(p.x == Catch::Approx(references[i]));
+    }
+
+    const std::vector<glm::dvec3> batchedPositions = positions.get();
+    REQUIRE(batchedPositions.size() == times.size());
+    const std::vector<glm::dmat3> batchedMatrices = matrices.get();
+    REQUIRE(batchedMatrices.size() == times.size());
+    for (size_t i = 0; i < times.size(); i++) {
+        const glm::dvec3 p = SpiceManager::ref().targetPosition(
+            "EARTH",
+            "CASSINI",
+            "J2000",
+            SpiceManager::AberrationCorrection(),
+            times[i]
+        );
+        CHECK(batchedPositions[i] == p);
+
+        const glm::dmat3 m = SpiceManager::ref().positionTransformMatrix(
+            "CASSINI_HGA",
+            "J2000",
+            times[i]
+        );
+        CHECK(batchedMatrices[i] == m);
+    }
+
+    // Errors are reported through the future
+    std::future<std::vector<glm::dvec3>> invalid = service.targetPositions(
+        "NOT_A_BODY",
+        "CASSINI",
+        "J2000",
+        SpiceManager::AberrationCorrection(),
+        times
+    );
+    CHECK_THROWS_AS(invalid.get(), SpiceManager::SpiceException);
+
+    SpiceManager::deinitialize();
+}
+
 TEST_CASE("SpiceManager: Get Field Of View", "[spicemanager]") {
     constexpr int NameLength = 128;
     constexpr int ShapeLength = 32;
@@ -0,0 +1,216 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/engine/syncengine.h>
+#include <openspace/util/blockcompression.h>
+#include <openspace/util/syncbuffer.h>
+#include <openspace/util/syncdata.h>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    // A Syncable that behaves like the script queue where each encoded message must only
+    // be processed once
+    class EventSyncable : public Syncable {
+    public:
+        std::vector<std::string> toSend;
+        std::vector<std::string> received;
+
+    protected:
+        void encode(SyncBuffer* syncBuffer) override {
+            syncBuffer->encode(toSend.size());
+            for (const std::string& s : toSend) {
+                syncBuffer->encode(s);
+            }
+            toSend.clear();
+        }
+
+        void decode(SyncBuffer* syncBuffer) override {
+            size_t n = 0;
+            syncBuffer->decode(n);
+            for (size_t i = 0; i < n; i++) {
+                received.push_back(syncBuffer->decode());
+            }
+        }
+    };
+} // namespace
+
+TEST_CASE("SyncEngine: Full Encoding", "[syncengine]") {
+    SyncEngine master = SyncEngine(4096);
+    SyncEngine client = SyncEngine(4096);
+
+    SyncData<double> masterValue = SyncData<double>(1.0);
+    SyncData<double> clientValue = SyncData<double>(0.0);
+    master.addSyncable(&masterValue);
+    client.addSyncable(&clientValue);
+
+    client.decodeSyncables(master.encodeSyncables());
+    client.postSynchronization(SyncEngine::IsMaster::No);
+    CHECK(clientValue.data() == 1.0);
+    CHECK(master.statistics().frameBytes == sizeof(double));
+    CHECK(master.statistics().dirtyRatio() == 1.0);
+}
+
+TEST_CASE("SyncEngine: Delta Encoding", "[syncengine]") {
+    SyncEngine master = SyncEngine(4096);
+    SyncEngine client = SyncEngine(4096);
+    master.setDeltaEncoding(true, 4);
+    client.setDeltaEncoding(true, 4);
+
+    SyncData<double> masterA = SyncData<double>(1.0);
+    SyncData<double> masterB = SyncData<double>(2.0);
+    EventSyncable masterEvents;
+    master.addSyncables({ &masterA, &masterB, &masterEvents });
+
+    SyncData<double> clientA;
+    SyncData<double> clientB;
+    EventSyncable clientEvents;
+    client.addSyncables({ &clientA, &clientB, &clientEvents });
+
+    auto sync = [&]() {
+        client.decodeSyncables(master.encodeSyncables());
+        client.postSynchronization(SyncEngine::IsMaster::No);
+    };
+
+    // The first frame is always a keyframe
+    masterEvents.toSend = { "first" };
+    sync();
+    CHECK(clientA.data() == 1.0);
+    CHECK(clientB.data() == 2.0);
+    CHECK(clientEvents.received == std::vector<std::string>{ "first" });
+    CHECK(master.statistics().nDirtySyncables == 3);
+    CHECK(master.statistics().nKeyframes == 1);
+    const size_t keyframeBytes = master.statistics().frameBytes;
+
+    // Only the changed value and the event syncable are sent
+    masterB = 3.0;
+    sync();
+    CHECK(clientA.data() == 1.0);
+    CHECK(clientB.data() == 3.0);
+    CHECK(clientEvents.received == std::vector<std::string>{ "first" });
+    CHECK(master.statistics().nDirtySyncables == 2);
+    CHECK(master.statistics().frameBytes < keyframeBytes);
+
+    // Nothing has changed and event messages are not repeated
+    sync();
+    sync();
+    CHECK(master.statistics().nDirtySyncables == 1);
+    CHECK(master.statistics().dirtyRatio() == 1.0 / 3.0);
+    CHECK(clientB.data() == 3.0);
+    CHECK(clientEvents.received.size() == 1);
+
+    // After the keyframe interval, everything is sent again
+    sync();
+    CHECK(master.statistics().nDirtySyncables == 3);
+    CHECK(master.statistics().nKeyframes == 2);
+    CHECK(master.statistics().nFrames == 5);
+
+    // Changing the list of syncables forces a keyframe
+    masterA = 5.0;
+    sync();
+    master.removeSyncable(&masterB);
+    client.removeSyncable(&clientB);
+    sync();
+    CHECK(master.statistics().nDirtySyncables == 2);
+    CHECK(master.statistics().nKeyframes == 3);
+    CHECK(clientA.data() == 5.0);
+}
+
+TEST_CASE("SyncEngine: Block Compression", "[syncengine]") {
+    auto roundtrip = [](const std::vector<std::byte>& data) {
+        std::vector<std::byte> compressed;
+        compressBlock(data, compressed);
+        std::vector<std::byte> decompressed;
+        CHECK(decompressBlock(compressed, decompressed, data.size()));
+        CHECK(decompressed == data);
+        return compressed.size();
+    };
+
+    roundtrip({});
+    roundtrip({ std::byte(1), std::byte(2), std::byte(3) });
+
+    // Repetitive data, like a queue of similar scripts, compresses well
+    std::vector<std::byte> repetitive;
+    const std::string script = "openspace.setPropertyValueSingle('Scene.Earth', 1.0);";
+    for (int i = 0; i < 100; i++) {
+        const std::byte* b = reinterpret_cast<const std::byte*>(script.data());
+        repetitive.insert(repetitive.end(), b, b + script.size());
+    }
+    CHECK(roundtrip(repetitive) < repetitive.size() / 10);
+
+    // Long runs of a single value use overlapping matches
+    roundtrip(std::vector<std::byte>(10000, std::byte(42)));
+
+    // Random data does not compress, but still has to survive the roundtrip
+    std::mt19937 gen = std::mt19937(1337);
+    std::vector<std::byte> random;
+    for (int i = 0; i < 100000; i++) {
+        random.push_back(static_cast<std::byte>(gen() & 0xFF));
+    }
+    roundtrip(random);
+
+    // Malformed data must not decompress
+    std::vector<std::byte> compressed;
+    compressBlock(repetitive, compressed);
+    std::vector<std::byte> decompressed;
+    CHECK_FALSE(decompressBlock(compressed, decompressed, repetitive.size() + 1));
+    compressed.resize(compressed.size() / 2);
+    CHECK_FALSE(decompressBlock(compressed, decompressed, repetitive.size()));
+}
+
+TEST_CASE("SyncEngine: Compressed Frames", "[syncengine]") {
+    SyncEngine master = SyncEngine(4096);
+    SyncEngine client = SyncEngine(4096);
+    master.setCompression(true);
+    client.setCompression(true);
+
+    SyncData<double> masterValue = SyncData<double>(1.0);
+    EventSyncable masterEvents;
+    master.addSyncables({ &masterValue, &masterEvents });
+
+    SyncData<double> clientValue;
+    EventSyncable clientEvents;
+    client.addSyncables({ &clientValue, &clientEvents });
+
+    const std::string script = "openspace.time.setPause(false);";
+    masterEvents.toSend = std::vector<std::string>(50, script);
+    client.decodeSyncables(master.encodeSyncables());
+    client.postSynchronization(SyncEngine::IsMaster::No);
+
+    CHECK(clientValue.data() == 1.0);
+    CHECK(clientEvents.received == std::vector<std::string>(50, script));
+    CHECK(master.statistics().frameBytes < master.statistics().rawBytes);
+
+    // Small frames that can't be compressed are sent without compression
+    masterValue = 2.0;
+    client.decodeSyncables(master.encodeSyncables());
+    client.postSynchronization(SyncEngine::IsMaster::No);
+    CHECK(clientValue.data() == 2.0);
+    CHECK(clientEvents.received.size() == 50);
+}
@@ -0,0 +1,206 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/util/taskscheduler.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace openspace;
+
+TEST_CASE("TaskScheduler: Execute", "[taskscheduler]") {
+    TaskScheduler scheduler = TaskScheduler(4);
+    CHECK(scheduler.nThreads() == 4);
+
+    std::atomic_int counter = 0;
+    const TaskScheduler::TaskGroup group;
+    for (int i = 0; i < 1000; i++) {
+        scheduler.enqueue(
+            [&counter]() { counter++; },
+            TaskScheduler::Priority::Normal,
+            group
+        );
+    }
+    group.wait();
+    CHECK(counter == 1000);
+    CHECK(group.nOutstandingTasks() == 0);
+}
+
+TEST_CASE("TaskScheduler: Priorities", "[taskscheduler]") {
+    TaskScheduler scheduler = TaskScheduler(1);
+
+    // Block the only worker until all tasks have been enqueued
+    std::atomic_bool isReleased = false;
+    const TaskScheduler::TaskGroup group;
+    scheduler.enqueue(
+        [&isReleased]() {
+            while (!isReleased) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        },
+        TaskScheduler::Priority::High,
+        group
+    );
+    while (scheduler.nQueuedTasks() > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::mutex mutex;
+    std::vector<int> order;
+    auto record = [&mutex, &order](int value) {
+        return [&mutex, &order, value]() {
+            const std::lock_guard lock(mutex);
+            order.push_back(value);
+        };
+    };
+    scheduler.enqueue(record(3), TaskScheduler::Priority::Low, group);
+    scheduler.enqueue(record(2), TaskScheduler::Priority::Normal, group);
+    scheduler.enqueue(record(1), TaskScheduler::Priority::High, group);
+    CHECK(scheduler.nQueuedTasks() == 3);
+
+    isReleased = true;
+    group.wait();
+    CHECK(order == std::vector<int>{ 1, 2, 3 });
+}
+
+TEST_CASE("TaskScheduler: Cancellation", "[taskscheduler]") {
+    TaskScheduler scheduler = TaskScheduler(1);
+
+    std::atomic_bool isReleased = false;
+    std::atomic_int counter = 0;
+    const TaskScheduler::TaskGroup blocker;
+    scheduler.enqueue(
+        [&isReleased]() {
+            while (!isReleased) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        },
+        TaskScheduler::Priority::Normal,
+        blocker
+    );
+
+    TaskScheduler::TaskGroup group;
+    for (int i = 0; i < 10; i++) {
+        scheduler.enqueue(
+            [&counter]() { counter++; },
+            TaskScheduler::Priority::Normal,
+            group
+        );
+    }
+    CHECK(group.nOutstandingTasks() == 10);
+    group.cancel();
+    CHECK(group.isCancelled());
+
+    isReleased = true;
+    group.wait();
+    blocker.wait();
+    CHECK(counter == 0);
+    CHECK_FALSE(blocker.isCancelled());
+}
+
+TEST_CASE("TaskScheduler: Nested Wait", "[taskscheduler]") {
+    // A task that waits for its own subtasks must not deadlock, even with one worker
+    TaskScheduler scheduler = TaskScheduler(1);
+
+    std::atomic_int counter = 0;
+    const TaskScheduler::TaskGroup outer;
+    scheduler.enqueue(
+        [&scheduler, &counter]() {
+            const TaskScheduler::TaskGroup inner;
+            for (int i = 0; i < 8; i++) {
+                scheduler.enqueue(
+                    [&counter]() { counter++; },
+                    TaskScheduler::Priority::Normal,
+                    inner
+                );
+            }
+            inner.wait();
+            CHECK(counter == 8);
+        },
+        TaskScheduler::Priority::Normal,
+        outer
+    );
+    outer.wait();
+    CHECK(counter == 8);
+}
+
+TEST_CASE("TaskScheduler: Exception", "[taskscheduler]") {
+    TaskScheduler scheduler = TaskScheduler(2);
+
+    std::atomic_int counter = 0;
+    const TaskScheduler::TaskGroup group;
+    scheduler.enqueue(
+        []() { throw std::runtime_error("Failure"); },
+        TaskScheduler::Priority::Normal,
+        group
+    );
+    scheduler.enqueue(
+        [&counter]() { counter++; },
+        TaskScheduler::Priority::Normal,
+        group
+    );
+    group.wait();
+    CHECK(counter == 1);
+}
+
+TEST_CASE("TaskScheduler: Parallel For", "[taskscheduler]") {
+    TaskScheduler scheduler = TaskScheduler(3);
+
+    std::vector<int> values = std::vector<int>(1000, 0);
+    scheduler.parallelFor(
+        values.size(),
+        [&values](size_t i) { values[i] = static_cast<int>(i); }
+    );
+    for (size_t i = 0; i < values.size(); i++) {
+        CHECK(values[i] == static_cast<int>(i));
+    }
+
+    // Nothing is called for an empty range
+    bool wasCalled = false;
+    scheduler.parallelFor(0, [&wasCalled](size_t) { wasCalled = true; });
+    CHECK_FALSE(wasCalled);
+
+    // The first exception is rethrown on the calling thread after all calls are done
+    std::atomic_int nRunning = 0;
+    CHECK_THROWS_AS(
+        scheduler.parallelFor(
+            100,
+            [&nRunning](size_t i) {
+                nRunning++;
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                nRunning--;
+                if (i == 7) {
+                    throw std::runtime_error("Failure");
+                }
+            },
+            TaskScheduler::Priority::High
+        ),
+        std::runtime_error
+    );
+    CHECK(nRunning == 0);
+}
@@ -0,0 +1,248 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <modules/globebrowsing/src/tileioscheduler.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    RawTile loadedTile(int level) {
+        RawTile tile;
+        tile.tileIndex = TileIndex(0, 0, static_cast<uint8_t>(level));
+        return tile;
+    }
+
+    // Blocks the only worker of the scheduler until released so that the order in which
+    // the other jobs are started can be controlled
+    struct Blocker {
+        std::atomic_bool isReleased = false;
+        std::atomic_bool isRunning = false;
+
+        std::function<RawTile()> job() {
+            return [this]() {
+                isRunning = true;
+                while (!isReleased) {
+                    std::this_thread::yield();
+                }
+                return loadedTile(0);
+            };
+        }
+
+        void waitUntilRunning() const {
+            while (!isRunning) {
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    std::vector<RawTile> waitForTiles(TileIOScheduler& scheduler,
+                                      TileIOScheduler::ProviderId provider, size_t n)
+    {
+        std::vector<RawTile> res;
+        while (res.size() < n) {
+            std::optional<RawTile> tile = scheduler.popFinishedTile(provider);
+            if (tile.has_value()) {
+                res.push_back(std::move(*tile));
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+        return res;
+    }
+} // namespace
+
+TEST_CASE("TileIOScheduler: Load", "[tileioscheduler]") {
+    TileIOScheduler scheduler = TileIOScheduler(4, 100);
+    CHECK(scheduler.nThreads() == 4);
+
+    const TileIOScheduler::ProviderId provider = scheduler.registerProvider();
+    for (int i = 1; i <= 50; i++) {
+        scheduler.enqueue(provider, i, 0.0, [i]() { return loadedTile(i); });
+    }
+    const std::vector<RawTile> tiles = waitForTiles(scheduler, provider, 50);
+    CHECK(tiles.size() == 50);
+    CHECK(scheduler.cancelledJobs(provider).empty());
+
+    const TileIOScheduler::Statistics stats = scheduler.statistics();
+    CHECK(stats.nFinishedJobs == 50);
+    CHECK(stats.nQueuedJobs == 0);
+    CHECK(stats.nCancelledJobs == 0);
+    CHECK(stats.maxTimeToTile >= stats.averageTimeToTile);
+
+    scheduler.unregisterProvider(provider);
+}
+
+TEST_CASE("TileIOScheduler: Priorities", "[tileioscheduler]") {
+    TileIOScheduler scheduler = TileIOScheduler(1, 100);
+    const TileIOScheduler::ProviderId provider = scheduler.registerProvider();
+
+    Blocker blocker;
+    scheduler.enqueue(provider, 100, 0.0, blocker.job());
+    blocker.waitUntilRunning();
+
+    scheduler.enqueue(provider, 1, 1.0, []() { return loadedTile(1); });
+    scheduler.enqueue(provider, 2, 3.0, []() { return loadedTile(2); });
+    scheduler.enqueue(provider, 3, 2.0, []() { return loadedTile(3); });
+    // Requesting a job again updates its priority
+    CHECK(scheduler.touch(provider, 1, 4.0));
+    CHECK_FALSE(scheduler.touch(provider, 4, 4.0));
+    blocker.isReleased = true;
+
+    const std::vector<RawTile> tiles = waitForTiles(scheduler, provider, 4);
+    CHECK(tiles[1].tileIndex.level == 1);
+    CHECK(tiles[2].tileIndex.level == 2);
+    CHECK(tiles[3].tileIndex.level == 3);
+
+    scheduler.unregisterProvider(provider);
+}
+
+TEST_CASE("TileIOScheduler: Fairness", "[tileioscheduler]") {
+    TileIOScheduler scheduler = TileIOScheduler(1, 100);
+    const TileIOScheduler::ProviderId blocked = scheduler.registerProvider();
+    const TileIOScheduler::ProviderId a = scheduler.registerProvider();
+    const TileIOScheduler::ProviderId b = scheduler.registerProvider();
+
+    Blocker blocker;
+    scheduler.enqueue(blocked, 100, 0.0, blocker.job());
+    blocker.waitUntilRunning();
+
+    std::mutex mutex;
+    std::vector<TileIOScheduler::ProviderId> order;
+    auto job = [&mutex, &order](TileIOScheduler::ProviderId id) {
+        return [&mutex, &order, id]() {
+            const std::lock_guard lock(mutex);
+            order.push_back(id);
+            return loadedTile(0);
+        };
+    };
+    for (int i = 0; i < 3; i++) {
+        scheduler.enqueue(a, i, 1.0, job(a));
+        scheduler.enqueue(b, i, 1.0, job(b));
+    }
+    blocker.isReleased = true;
+
+    waitForTiles(scheduler, a, 3);
+    waitForTiles(scheduler, b, 3);
+
+    // Jobs with the same priority alternate between the providers
+    REQUIRE(order.size() == 6);
+    for (size_t i = 1; i < order.size(); i++) {
+        CHECK(order[i] != order[i - 1]);
+    }
+
+    scheduler.unregisterProvider(blocked);
+    scheduler.unregisterProvider(a);
+    scheduler.unregisterProvider(b);
+}
+
+TEST_CASE("TileIOScheduler: Stale Jobs", "[tileioscheduler]") {
+    TileIOScheduler scheduler = TileIOScheduler(1, 100);
+    const TileIOScheduler::ProviderId provider = scheduler.registerProvider();
+
+    Blocker blocker;
+    scheduler.enqueue(provider, 100, 0.0, blocker.job());
+    blocker.waitUntilRunning();
+
+    scheduler.enqueue(provider, 1, 1.0, []() { return loadedTile(1); });
+    scheduler.enqueue(provider, 2, 1.0, []() { return loadedTile(2); });
+
+    for (uint64_t i = 0; i <= TileIOScheduler::StaleFrameCount; i++) {
+        // Only the first job is still requested by its chunk
+        scheduler.touch(provider, 1, 1.0);
+        scheduler.update();
+    }
+
+    const std::vector<TileIOScheduler::Key> cancelled = scheduler.cancelledJobs(provider);
+    REQUIRE(cancelled.size() == 1);
+    CHECK(cancelled[0] == 2);
+    // The cancelled jobs are only reported once
+    CHECK(scheduler.cancelledJobs(provider).empty());
+
+    blocker.isReleased = true;
+    const std::vector<RawTile> tiles = waitForTiles(scheduler, provider, 2);
+    CHECK(tiles[1].tileIndex.level == 1);
+    CHECK(scheduler.statistics().nCancelledJobs == 1);
+
+    scheduler.unregisterProvider(provider);
+}
+
+TEST_CASE("TileIOScheduler: Queue Limit", "[tileioscheduler]") {
+    TileIOScheduler scheduler = TileIOScheduler(1, 2);
+    const TileIOScheduler::ProviderId provider = scheduler.registerProvider();
+
+    Blocker blocker;
+    scheduler.enqueue(provider, 100, 0.0, blocker.job());
+    blocker.waitUntilRunning();
+
+    scheduler.enqueue(provider, 1, 2.0, []() { return loadedTile(1); });
+    scheduler.enqueue(provider, 2, 1.0, []() { return loadedTile(2); });
+    scheduler.enqueue(provider, 3, 3.0, []() { return loadedTile(3); });
+
+    // The job with the lowest priority had to make room for the new one
+    const std::vector<TileIOScheduler::Key> cancelled = scheduler.cancelledJobs(provider);
+    REQUIRE(cancelled.size() == 1);
+    CHECK(cancelled[0] == 2);
+    CHECK(scheduler.statistics().nQueuedJobs == 2);
+
+    const std::vector<TileIOScheduler::Key> queued = scheduler.cancelQueuedJobs(provider);
+    CHECK(queued.size() == 2);
+    CHECK(scheduler.statistics().nQueuedJobs == 0);
+
+    blocker.isReleased = true;
+    scheduler.unregisterProvider(provider);
+}
+
+TEST_CASE("TileIOScheduler: Unregister", "[tileioscheduler]") {
+    TileIOScheduler scheduler = TileIOScheduler(2, 100);
+    const TileIOScheduler::ProviderId provider = scheduler.registerProvider();
+
+    std::atomic_int nFinished = 0;
+    for (int i = 0; i < 20; i++) {
+        scheduler.enqueue(
+            provider,
+            i,
+            0.0,
+            [&nFinished]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                nFinished++;
+                return loadedTile(0);
+            }
+        );
+    }
+
+    // After unregistering, no job of the provider is running anymore
+    scheduler.unregisterProvider(provider);
+    const int n = nFinished;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    CHECK(nFinished == n);
+    CHECK(scheduler.statistics().nRunningJobs == 0);
+}
@@ -27,6 +27,7 @@
 
 #include <openspace/util/timeline.h>
 #include <openspace/util/time.h>
+#include <cmath>
 
 using namespace openspace;
 
@@ -97,3 +98,51 @@ TEST_CASE("TimeLine: Remove Keyframes In Range", "[timeline]") {
     timeline.removeKeyframesBetween(-1.0, 4.0);
     CHECK(timeline.nKeyframes() == 0);
 }
+
+TEST_CASE("TimeLine: Successive Queries", "[timeline]") {
+    Timeline<int> timeline;
+    for (int i = 0; i < 100; i++) {
+        timeline.addKeyframe(static_cast<double>(i), i);
+    }
+
+    // The lookups start at the previous result, which must not change the result for
+    // sequential queries in both directions or for jumps
+    std::vector<double> times;
+    for (double t = -1.0; t < 101.0; t += 0.5) {
+        times.push_back(t);
+    }
+    for (double t = 101.0; t > -1.0; t -= 0.25) {
+        times.push_back(t);
+    }
+    for (double t : { 50.0, 3.0, 97.5, -3.0, 42.0, 42.0, 200.0, 0.0 }) {
+        times.push_back(t);
+    }
+
+    for (double t : times) {
+        for (bool inclusive : { false, true }) {
+            const Keyframe<int>* after = timeline.firstKeyframeAfter(t, inclusive);
+            const Keyframe<int>* before = timeline.lastKeyframeBefore(t, inclusive);
+
+            const int ceiling = static_cast<int>(std::ceil(t));
+            const bool isOnKeyframe = static_cast<double>(ceiling) == t;
+            const int firstAfter = (isOnKeyframe && !inclusive) ? ceiling + 1 : ceiling;
+            if (firstAfter > 99) {
+                CHECK(after == nullptr);
+            }
+            else {
+                REQUIRE(after != nullptr);
+                CHECK(after->data == std::max(firstAfter, 0));
+            }
+
+            const int floor = static_cast<int>(std::floor(t));
+            const int lastBefore = (isOnKeyframe && !inclusive) ? floor - 1 : floor;
+            if (lastBefore < 0) {
+                CHECK(before == nullptr);
+            }
+            else {
+                REQUIRE(before != nullptr);
+                CHECK(before->data == std::min(lastBefore, 99));
+            }
+        }
+    }
+}
@@ -0,0 +1,167 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2026                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <modules/base/rendering/trailsamplecache.h>
+#include <random>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    std::vector<glm::dvec3> samples(int64_t first, int64_t last) {
+        std::vector<glm::dvec3> res;
+        for (int64_t i = first; i <= last; i++) {
+            res.emplace_back(static_cast<double>(i), 0.0, 0.0);
+        }
+        return res;
+    }
+} // namespace
+
+TEST_CASE("TrailSampleCache: Grid", "[trailsamplecache]") {
+    TrailSampleCache cache;
+    cache.setGrid(100.0, 10.0);
+
+    CHECK(cache.time(0) == 100.0);
+    CHECK(cache.time(3) == 130.0);
+    CHECK(cache.time(-2) == 80.0);
+
+    CHECK(cache.index(130.0) == 3);
+    CHECK(cache.index(80.0) == -2);
+    CHECK(cache.index(135.0) == std::nullopt);
+
+    // Times that are accumulated with rounding errors are still found on the grid
+    cache.setGrid(100.0, 0.1);
+    double t = 100.0;
+    for (int i = 0; i < 1000; i++) {
+        t += 0.1;
+    }
+    CHECK(cache.index(t) == 1000);
+}
+
+TEST_CASE("TrailSampleCache: Missing Ranges", "[trailsamplecache]") {
+    using Range = TrailSampleCache::Range;
+
+    TrailSampleCache cache;
+    cache.setGrid(0.0, 1.0);
+    const std::vector<Range> all = { { 0, 9 } };
+    CHECK(cache.missingRanges(0, 9) == all);
+
+    cache.insert(2, samples(2, 4));
+    cache.insert(7, samples(7, 7));
+    CHECK(cache.size() == 4);
+    const std::vector<Range> gaps = { { 0, 1 }, { 5, 6 }, { 8, 9 } };
+    CHECK(cache.missingRanges(0, 9) == gaps);
+    CHECK(cache.missingRanges(3, 4).empty());
+    const std::vector<Range> gap = { { 5, 6 } };
+    CHECK(cache.missingRanges(3, 6) == gap);
+
+    REQUIRE(cache.find(3));
+    CHECK(cache.find(3)->x == 3.0);
+    CHECK(!cache.find(5));
+    CHECK(!cache.find(-1));
+
+    // Filling the gap merges the runs
+    cache.insert(5, samples(5, 6));
+    CHECK(cache.missingRanges(2, 7).empty());
+    CHECK(cache.size() == 6);
+
+    // Overlapping samples replace the existing ones
+    cache.insert(0, std::vector<glm::dvec3>(4, glm::dvec3(-1.0)));
+    CHECK(cache.size() == 8);
+    CHECK(cache.find(3)->x == -1.0);
+    CHECK(cache.find(4)->x == 4.0);
+}
+
+TEST_CASE("TrailSampleCache: Invalidation", "[trailsamplecache]") {
+    TrailSampleCache cache;
+    cache.setGrid(0.0, 1.0);
+    cache.insert(0, samples(0, 9));
+    const uint64_t generation = cache.generation();
+
+    // Setting the same grid keeps the samples
+    cache.setGrid(0.0, 1.0);
+    CHECK(cache.size() == 10);
+    CHECK(cache.generation() == generation);
+
+    cache.setGrid(0.0, 2.0);
+    CHECK(cache.size() == 0);
+    CHECK(cache.generation() != generation);
+    CHECK(cache.missingRanges(0, 9).size() == 1);
+}
+
+TEST_CASE("TrailSampleCache: Trim", "[trailsamplecache]") {
+    TrailSampleCache cache;
+    cache.setGrid(0.0, 1.0);
+    cache.insert(0, samples(0, 99));
+    cache.insert(200, samples(200, 209));
+
+    // The samples furthest away from the protected range are removed first
+    cache.trim(50, 59, 50);
+    CHECK(cache.size() == 50);
+    CHECK(cache.missingRanges(50, 59).empty());
+    CHECK(!cache.find(209));
+    CHECK(!cache.find(0));
+
+    // The protected range itself is never removed
+    cache.trim(50, 59, 5);
+    CHECK(cache.size() == 10);
+    CHECK(cache.missingRanges(50, 59).empty());
+}
+
+TEST_CASE("TrailSampleCache: Randomized", "[trailsamplecache]") {
+    std::mt19937 random(1337);
+    std::uniform_int_distribution<int64_t> start(-500, 500);
+    std::uniform_int_distribution<int64_t> length(1, 50);
+
+    TrailSampleCache cache;
+    cache.setGrid(0.0, 1.0);
+    std::vector<bool> reference(1100, false);
+    for (int i = 0; i < 500; i++) {
+        const int64_t first = start(random);
+        const int64_t last = first + length(random) - 1;
+        cache.insert(first, samples(first, last));
+        for (int64_t j = first; j <= last; j++) {
+            reference[j + 500] = true;
+        }
+
+        size_t nReference = 0;
+        for (int64_t j = -500; j < 600; j++) {
+            const glm::dvec3* p = cache.find(j);
+            REQUIRE((p != nullptr) == reference[j + 500]);
+            if (p) {
+                REQUIRE(p->x == static_cast<double>(j));
+                nReference++;
+            }
+        }
+        REQUIRE(cache.size() == nReference);
+
+        for (const TrailSampleCache::Range& r : cache.missingRanges(-500, 599)) {
+            for (int64_t j = r.first; j <= r.last; j++) {
+                REQUIRE(!reference[j + 500]);
+            }
+        }
+    }
+}